@@ -14,6 +14,7 @@
 
 #define VSOMEIP_ENV_APPLICATION_NAME            "VSOMEIP_APPLICATION_NAME"
 #define VSOMEIP_ENV_CONFIGURATION               "VSOMEIP_CONFIGURATION"
+#define VSOMEIP_ENV_CONFIGURATION_CACHE         "VSOMEIP_CONFIGURATION_CACHE"
 #define VSOMEIP_ENV_E2E_PROTECTION_MODULE       "VSOMEIP_E2E_PROTECTION_MODULE"
 #define VSOMEIP_ENV_MANDATORY_CONFIGURATION_FILES "VSOMEIP_MANDATORY_CONFIGURATION_FILES"
 #define VSOMEIP_ENV_CLIENTSIDELOGGING           "VSOMEIP_CLIENTSIDELOGGING"
@@ -39,6 +40,7 @@
 
 #define VSOMEIP_DEFAULT_CONFIGURATION_FOLDER    "/vendor/run/etc/vsomeip"
 #define VSOMEIP_LOCAL_CONFIGURATION_FOLDER      "./vsomeip"
+#define VSOMEIP_DEFAULT_CONFIGURATION_CACHE     ""
 
 // VSOMEIP_BASE_PATH should be specified in Android.bp or/and Android.mk file via c/c++ compiler
 // flags. #define VSOMEIP_BASE_PATH                       "/storage/"
@@ -88,15 +90,31 @@
 
 #define VSOMEIP_DEFAULT_PING_TIMEOUT            5000 // ms
 
+// routing info updates are coalesced per client for at most this time,
+// or until the given number of service instances is pending
+#define VSOMEIP_ROUTING_INFO_COALESCING_TIME    2 // ms
+#define VSOMEIP_ROUTING_INFO_MAX_PENDING        64
+
+// bound of the cache of denied security decisions, and minimum time between
+// two denial logs of the same client
+#define VSOMEIP_SECURITY_DENIED_CACHE_SIZE      4096
+#define VSOMEIP_SECURITY_DENIED_LOG_INTERVAL    1000 // ms
+
 #define VSOMEIP_DEFAULT_UDP_RCV_BUFFER_SIZE     1703936
 
 #define VSOMEIP_DEFAULT_IO_THREAD_COUNT         2
 #define VSOMEIP_DEFAULT_IO_THREAD_NICE_LEVEL    0
 
+// maximum time the io shard threads may take to complete the pending
+// handlers when they are stopped
+#define VSOMEIP_IO_SHARDS_STOP_TIMEOUT          1000 // ms
+
 #define VSOMEIP_DEFAULT_MAX_DISPATCH_TIME       100
 #define VSOMEIP_DEFAULT_MAX_DISPATCHERS         10
+#define VSOMEIP_DEFAULT_HANDLER_TIME_BUDGET     0
 
 #define VSOMEIP_REQUEST_DEBOUNCE_TIME           0
+#define VSOMEIP_DEFAULT_EVENT_CYCLE_RESOLUTION  1
 #define VSOMEIP_DEFAULT_STATISTICS_MAX_MSG      50
 #define VSOMEIP_DEFAULT_STATISTICS_MIN_FREQ     50
 #define VSOMEIP_DEFAULT_STATISTICS_INTERVAL     10000
@@ -150,6 +168,33 @@ inline constexpr std::uint32_t QUEUE_SIZE_UNLIMITED = std::numeric_limits<std::u
 
 inline constexpr std::uint32_t VSOMEIP_UDP_BUFFER_SIZE = 1536;
 
+inline constexpr std::uint32_t VSOMEIP_TCP_RECEIVE_CHUNK_SIZE = 4096;
+
+// Minimum size of a SOME/IP frame that local endpoints send with a gather write
+// instead of copying it into the send queue
+inline constexpr std::uint32_t VSOMEIP_LOCAL_GATHER_THRESHOLD = 512;
+
+// Maximum number of bytes local endpoints hold back while coalescing writes
+inline constexpr std::uint32_t VSOMEIP_DEFAULT_LOCAL_COALESCING_BATCH_SIZE = 16 * 1024;
+
+// Number of NPDU trains (and train buffers) each target of a boardnet endpoint
+// keeps for reuse
+inline constexpr std::size_t VSOMEIP_MAX_POOLED_TRAINS = 4;
+
+// Maximum number of unused (de)serializers a routing manager keeps for reuse,
+// at least one per io thread
+inline constexpr std::size_t VSOMEIP_MAX_POOLED_SERIALIZERS = 16;
+
+// Maximum number of grid points per cycle the cyclic notifications of events
+// are aligned to
+inline constexpr std::size_t VSOMEIP_MAX_EVENT_CYCLE_SLOTS = 1024;
+
+// Maximum number of threads (the loading one included) that read configuration
+// files or parse security policies, and the minimum number of files or policies
+// each of them must handle
+inline constexpr std::size_t VSOMEIP_MAX_CONFIGURATION_LOADERS = 4;
+inline constexpr std::size_t VSOMEIP_MIN_CONFIGURATION_LOADS = 8;
+
 #define VSOMEIP_DEFAULT_NPDU_DEBOUNCING_NANO         2 * 1000 * 1000
 #define VSOMEIP_DEFAULT_NPDU_MAXIMUM_RETENTION_NANO  5 * 1000 * 1000
 
@@ -12,6 +12,9 @@
 #include <vsomeip/plugin.hpp>
 
 #include "debounce_filter_impl.hpp"
+#include "io_shards_config.hpp"
+#include "local_coalescing.hpp"
+#include "thread_scheduling.hpp"
 
 namespace vsomeip_v3 {
 
@@ -21,6 +24,7 @@ struct application_configuration {
     client_t client_;
     std::size_t max_dispatchers_;
     std::size_t max_dispatch_time_;
+    std::size_t handler_time_budget_;
     std::size_t thread_count_;
     uint32_t log_status_interval_;
     uint32_t log_version_interval_;
@@ -29,6 +33,9 @@ struct application_configuration {
     int nice_level_;
     debounce_configuration_t debounces_;
     bool has_session_handling_;
+    local_coalescing_t local_coalescing_;
+    io_shards_config_t io_shards_;
+    std::map<thread_type_e, thread_scheduling_t> thread_scheduling_;
 };
 
 } // namespace cfg
@@ -26,6 +26,9 @@
 
 #include "../../e2e_protection/include/e2exf/config.hpp"
 #include "e2e.hpp"
+#include "io_shards_config.hpp"
+#include "local_coalescing.hpp"
+#include "thread_scheduling.hpp"
 
 #include "internal.hpp"
 
@@ -103,6 +106,9 @@ public:
     virtual void get_configured_timing_responses(service_t _service, const std::string& _ip_service, std::uint16_t _port_service,
                                                  method_t _method, std::chrono::nanoseconds* _debounce_time,
                                                  std::chrono::nanoseconds* _max_retention_time) const = 0;
+    // Changes whenever the services are changed at runtime (remote offers), thus
+    // values that were looked up from them (e.g. the timings above) are outdated
+    virtual std::uint32_t get_service_generation() const = 0;
 
     virtual bool is_someip(service_t _service, instance_t _instance) const = 0;
 
@@ -124,10 +130,14 @@ public:
 
     virtual std::size_t get_max_dispatchers(const std::string& _name) const = 0;
     virtual std::size_t get_max_dispatch_time(const std::string& _name) const = 0;
+    virtual std::size_t get_handler_time_budget(const std::string& _name) const = 0;
     virtual std::size_t get_io_thread_count(const std::string& _name) const = 0;
     virtual int get_io_thread_nice_level(const std::string& _name) const = 0;
     virtual std::size_t get_request_debounce_time(const std::string& _name) const = 0;
     virtual bool has_session_handling(const std::string& _name) const = 0;
+    virtual local_coalescing_t get_local_coalescing(const std::string& _name) const = 0;
+    virtual io_shards_config_t get_io_shards(const std::string& _name) const = 0;
+    virtual thread_scheduling_t get_thread_scheduling(const std::string& _name, thread_type_e _type) const = 0;
 
     virtual std::uint32_t get_max_message_size_local() const = 0;
     virtual std::uint32_t get_max_message_size_reliable(const std::string& _address, std::uint16_t _port) const = 0;
@@ -257,6 +267,10 @@ public:
 
     virtual int get_udp_receive_buffer_size() const = 0;
 
+    // Cyclic notifications of events
+    virtual std::chrono::milliseconds get_event_cycle_resolution() const = 0;
+    virtual bool is_event_cycle_spreading() const = 0;
+
     virtual bool check_routing_credentials(client_t _client, const vsomeip_sec_client_t* _sec_client) const = 0;
 
     virtual bool check_suppress_events(service_t _service, instance_t _instance, event_t _event) const = 0;
@@ -0,0 +1,93 @@
+// Copyright (C) 2014-2026 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <boost/property_tree/ptree.hpp>
+
+#include "configuration_element.hpp"
+#include "service_definition.hpp"
+
+namespace vsomeip_v3 {
+namespace cfg {
+
+/**
+ * \brief Precompiled configuration files.
+ *
+ * A configuration cache contains a set of JSON configuration files in a
+ * compiled, compact binary format. It is generated by the
+ * vsomeip_config_compiler tool and mapped into memory when the configuration
+ * is loaded. Only the files that are actually read are decoded.
+ *
+ * The "services" section, which makes up most of large configurations, is
+ * stored as service definitions. These are used as they are, without walking
+ * a property tree. The other sections are stored as property trees.
+ *
+ * Each cached file is identified by its canonical path, its size, its
+ * modification time and the hash of its content. As long as the size and the
+ * modification time match, the content is not hashed. Copying the files into
+ * the image of the target keeps both (if the tool preserves timestamps, which
+ * may truncate them to full seconds). If a file was changed after the cache
+ * was generated, or if it is not contained in the cache, it must be parsed
+ * from JSON.
+ *
+ * The cache does not depend on the host it was generated on: the paths may
+ * be stored relative to the root directory of the target and all numbers
+ * are stored in little endian byte order.
+ */
+class configuration_cache {
+public:
+    static constexpr std::uint32_t MAGIC = 0x43435356; // "VSCC"
+    static constexpr std::uint32_t VERSION = 4;
+
+    configuration_cache();
+    ~configuration_cache();
+
+    configuration_cache(const configuration_cache&) = delete;
+    configuration_cache& operator=(const configuration_cache&) = delete;
+
+    // Writes a cache that contains the given (already parsed) configuration files. If a root
+    // directory is given, the files must be below it and are stored by their path relative to it.
+    static bool write(const std::string& _path, const std::vector<configuration_element>& _elements, const std::string& _root = "");
+
+    // Maps the cache file. Returns false if it does not exist, has a different version or is corrupt.
+    bool open(const std::string& _path);
+
+    // Returns false if the file is not cached or was changed after the cache was generated. Otherwise,
+    // _tree is the file without its "services" section, which is returned as _services.
+    bool get(const std::string& _name, boost::property_tree::ptree& _tree, std::optional<std::vector<service_definition>>& _services) const;
+
+    std::size_t get_size() const;
+    std::size_t get_hits() const;
+
+private:
+    struct entry {
+        std::uint64_t size_;
+        std::uint64_t modified_; // modification time in ns, 0 if unknown
+        std::uint64_t hash_;
+        std::uint64_t offset_;
+        std::uint64_t length_;
+    };
+
+    void close();
+
+    const char* data_;
+    std::size_t data_size_;
+    std::vector<char> buffer_; // used if the file cannot be mapped
+
+    std::map<std::string, entry, std::less<>> entries_;
+    mutable std::atomic<std::size_t> hits_;
+};
+
+} // namespace cfg
+} // namespace vsomeip_v3
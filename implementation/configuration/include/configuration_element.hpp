@@ -5,19 +5,26 @@
 
 #pragma once
 
+#include <optional>
 #include <string>
+#include <vector>
 
 #include <boost/property_tree/ptree.hpp>
 
+#include "service_definition.hpp"
+
 namespace vsomeip_v3 {
 
 struct configuration_element {
     std::string name_;
     boost::property_tree::ptree tree_;
+    // The "services" section if it was compiled by the configuration cache, it is not part of tree_ then
+    std::optional<std::vector<cfg::service_definition>> services_;
 
     configuration_element(const std::string& _name, const boost::property_tree::ptree& _tree) noexcept : name_(_name), tree_(_tree) { }
 
-    configuration_element(configuration_element&& _source) noexcept : name_(std::move(_source.name_)), tree_(std::move(_source.tree_)) { }
+    configuration_element(configuration_element&& _source) noexcept :
+        name_(std::move(_source.name_)), tree_(std::move(_source.tree_)), services_(std::move(_source.services_)) { }
 
     bool operator<(const configuration_element& _other) const { return (name_ < _other.name_); }
 };
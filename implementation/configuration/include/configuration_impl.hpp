@@ -10,6 +10,7 @@
 #include <map>
 #include <memory>
 #include <mutex>
+#include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
@@ -25,13 +26,16 @@
 #include "../../e2e_protection/include/e2exf/config.hpp"
 #include "../../security/include/policy.hpp"
 #include "../../utility/include/service_instance_map.hpp"
+#include "../../utility/include/snapshot.hpp"
 
 namespace vsomeip_v3 {
 
 namespace cfg {
 
+class configuration_cache;
 struct client;
 struct service;
+struct service_definition;
 struct servicegroup;
 struct event;
 struct eventgroup;
@@ -101,6 +105,7 @@ public:
     VSOMEIP_EXPORT void get_configured_timing_responses(service_t _service, const std::string& _ip_service, std::uint16_t _port_service,
                                                         method_t _method, std::chrono::nanoseconds* _debounce_time,
                                                         std::chrono::nanoseconds* _max_retention_time) const;
+    VSOMEIP_EXPORT std::uint32_t get_service_generation() const;
 
     VSOMEIP_EXPORT bool is_someip(service_t _service, instance_t _instance) const;
 
@@ -124,10 +129,14 @@ public:
 
     VSOMEIP_EXPORT std::size_t get_max_dispatchers(const std::string& _name) const;
     VSOMEIP_EXPORT std::size_t get_max_dispatch_time(const std::string& _name) const;
+    VSOMEIP_EXPORT std::size_t get_handler_time_budget(const std::string& _name) const;
     VSOMEIP_EXPORT std::size_t get_io_thread_count(const std::string& _name) const;
     VSOMEIP_EXPORT int get_io_thread_nice_level(const std::string& _name) const;
     VSOMEIP_EXPORT std::size_t get_request_debounce_time(const std::string& _name) const;
     VSOMEIP_EXPORT bool has_session_handling(const std::string& _name) const;
+    VSOMEIP_EXPORT local_coalescing_t get_local_coalescing(const std::string& _name) const;
+    VSOMEIP_EXPORT io_shards_config_t get_io_shards(const std::string& _name) const;
+    VSOMEIP_EXPORT thread_scheduling_t get_thread_scheduling(const std::string& _name, thread_type_e _type) const;
 
     VSOMEIP_EXPORT std::set<std::pair<service_t, instance_t>> get_remote_services() const;
 
@@ -242,6 +251,9 @@ public:
 
     VSOMEIP_EXPORT int get_udp_receive_buffer_size() const;
 
+    VSOMEIP_EXPORT std::chrono::milliseconds get_event_cycle_resolution() const;
+    VSOMEIP_EXPORT bool is_event_cycle_spreading() const;
+
     VSOMEIP_EXPORT bool is_tp_client(service_t _service, instance_t _instance, method_t _method) const;
     VSOMEIP_EXPORT bool is_tp_service(service_t _service, instance_t _instance, method_t _method) const;
     VSOMEIP_EXPORT void get_tp_configuration(service_t _service, instance_t _instance, method_t _method, bool _is_client,
@@ -276,9 +288,9 @@ private:
     void read_data(const std::set<std::string>& _input, std::vector<configuration_element>& _elements, std::set<std::string>& _failed,
                    bool _mandatory_only, bool _read_second_level = false);
 #ifndef VSOMEIP_DISABLE_POLICY
-    void load_policy_data(const std::string& _input, std::vector<configuration_element>& _elements, std::set<std::string>& _failed,
-                          bool _mandatory_only);
+    void load_policy_data(const std::string& _input, std::vector<std::string>& _files, bool _mandatory_only);
 #endif // !VSOMEIP_DISABLE_POLICY
+    void read_files(const std::vector<std::string>& _files, std::vector<configuration_element>& _elements, std::set<std::string>& _failed);
     bool load_data(const std::vector<configuration_element>& _elements, bool _load_mandatory, bool _load_optional);
 
     bool load_logging(const configuration_element& _element, std::set<std::string>& _warnings);
@@ -288,6 +300,10 @@ private:
 
     std::map<plugin_type_e, std::set<std::string>> load_plugins(const boost::property_tree::ptree& _tree,
                                                                 const std::string& _application_name);
+    local_coalescing_t load_local_coalescing(const boost::property_tree::ptree& _tree, const std::string& _application_name);
+    io_shards_config_t load_io_shards(const boost::property_tree::ptree& _tree, const std::string& _application_name);
+    std::map<thread_type_e, thread_scheduling_t> load_thread_scheduling(const boost::property_tree::ptree& _tree,
+                                                                        const std::string& _application_name);
 
     struct plugin_config_data_t {
         std::string name_;
@@ -313,6 +329,7 @@ private:
     void load_trace_filter_expressions(const boost::property_tree::ptree& _tree, std::string& _criteria,
                                        std::shared_ptr<trace_filter>& _filter);
     void load_trace_filter_match(const boost::property_tree::ptree& _data, std::tuple<service_t, instance_t, method_t>& _match);
+    void load_trace_capture(const boost::property_tree::ptree& _tree);
 
     void load_suppress_events(const configuration_element& _element);
     void load_suppress_events_data(const boost::property_tree::ptree& _tree);
@@ -334,9 +351,9 @@ private:
 
     void load_npdu_default_timings(const configuration_element& _element);
     void load_services(const configuration_element& _element);
-    void load_service(const boost::property_tree::ptree& _tree, const std::string& _unicast_address);
-    void load_event(std::shared_ptr<service>& _service, const boost::property_tree::ptree& _tree);
-    void load_eventgroup(std::shared_ptr<service>& _service, const boost::property_tree::ptree& _tree);
+    void load_service(const service_definition& _definition, const std::string& _unicast_address);
+    void load_event(std::shared_ptr<service>& _service, const service_definition& _definition);
+    void load_eventgroup(std::shared_ptr<service>& _service, const service_definition& _definition);
 
     void load_internal_services(const configuration_element& _element);
 
@@ -348,6 +365,8 @@ private:
 
     void load_request_debounce_time(const configuration_element& _element);
 
+    void load_event_cycles(const configuration_element& _element);
+
     void load_dispatch_defaults(const configuration_element& _element);
 
     void load_payload_sizes(const configuration_element& _element);
@@ -368,16 +387,13 @@ private:
     void load_acceptance_data(const boost::property_tree::ptree& _tree);
     void load_activation_file_path(std::set<std::string>& _path, const boost::property_tree::ptree& _tree);
     void load_udp_receive_buffer_size(const configuration_element& _element);
-    bool load_npdu_debounce_times_configuration(const std::shared_ptr<service>& _service, const boost::property_tree::ptree& _tree);
-    bool load_npdu_debounce_times_for_service(const std::shared_ptr<service>& _service, bool _is_request,
-                                              const boost::property_tree::ptree& _tree);
-    void load_someip_tp(const std::shared_ptr<service>& _service, const boost::property_tree::ptree& _tree);
-    void load_someip_tp_for_service(const std::shared_ptr<service>& _service, const boost::property_tree::ptree& _tree, bool _is_request);
+    void load_npdu_debounce_times_configuration(const std::shared_ptr<service>& _service, const service_definition& _definition);
+    void load_someip_tp(const std::shared_ptr<service>& _service, const service_definition& _definition);
 
     servicegroup* find_servicegroup(const std::string& _name) const;
     std::shared_ptr<client> find_client(service_instance_t _si) const;
+    // Lookups in the service index, thus they do not lock services_mutex_
     std::shared_ptr<service> find_service(service_instance_t _si) const;
-    std::shared_ptr<service> find_service_unlocked(service_instance_t _si) const;
     std::shared_ptr<service> find_service(service_t _service, const std::string& _address, std::uint16_t _port) const;
     std::shared_ptr<eventgroup> find_eventgroup(service_instance_t _si, eventgroup_t _eventgroup) const;
     bool find_port(uint16_t& _port, uint16_t _remote, bool _reliable, std::map<bool, std::set<uint16_t>>& _used_client_ports) const;
@@ -419,6 +435,9 @@ private:
 
     std::set<std::string> mandatory_;
 
+    // Precompiled configuration files, used instead of parsing them if they did not change
+    std::unique_ptr<configuration_cache> cache_;
+
     std::shared_ptr<policy_manager_impl> policy_manager_;
     std::shared_ptr<security> security_;
 
@@ -449,6 +468,27 @@ protected:
                       std::map<service_t, std::shared_ptr<service>>>>
             services_by_ip_port_;
 
+    // Flat, immutable copy of the per service configuration. The service
+    // objects must not be changed after they have been added to services_,
+    // changes replace the object and rebuild the index.
+    struct service_index {
+        service_instance_map<std::shared_ptr<service>> services_;
+        std::unordered_map<std::string, // IP
+                           std::unordered_map<std::uint32_t, // port << 16 | service
+                                              std::shared_ptr<service>>>
+                services_by_ip_port_;
+        service_instance_map<partition_id_t> partitions_;
+        std::unordered_set<service_instance_t> secure_services_;
+    };
+
+    // Must not be called while holding services_mutex_, partitions_mutex_ or secure_services_mutex_
+    void update_service_index();
+    // Replaces a service object that is referenced by services_by_ip_port_, must be called while holding services_mutex_
+    void replace_service_by_ip_port_unlocked(const std::shared_ptr<service>& _old, const std::shared_ptr<service>& _new);
+    snapshot<const service_index> service_index_;
+    // Incremented after each update of the service index
+    std::atomic<std::uint32_t> service_generation_{0};
+
     std::set<suppress_t> suppress_events_;
     bool is_suppress_events_enabled_;
 
@@ -548,6 +588,7 @@ protected:
         ET_STOP_OFFER_WATCHDOG,
         ET_OFFER_WATCHDOG,
         ET_UDS_PREFERRED,
+        ET_EVENT_CYCLES,
         ET_MAX
     };
 
@@ -626,6 +667,9 @@ protected:
 
     std::size_t request_debounce_time_;
 
+    std::chrono::milliseconds event_cycle_resolution_;
+    bool is_event_cycle_spreading_;
+
     std::size_t default_max_dispatch_time_;
     std::size_t default_max_dispatchers_;
 };
@@ -0,0 +1,36 @@
+// Copyright (C) 2014-2026 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <cstddef>
+#include <map>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include <vsomeip/primitive_types.hpp>
+
+namespace vsomeip_v3 {
+
+/**
+ * I/O context shards of an application that hosts the routing.
+ *
+ * Each shard is an io_context that is run by a single thread, optionally
+ * pinned to the CPU cpus_[index % cpus_.size()]. The endpoints of a service
+ * instance are assigned to the shard configured in services_, or to the next
+ * shard in round-robin order. The local server (and the connections it
+ * accepts) is assigned to local_, or to the next shard as well.
+ */
+struct io_shards_config_t {
+    std::size_t count_{0};
+    std::vector<int> cpus_;
+    std::optional<std::size_t> local_;
+    std::map<std::pair<service_t, instance_t>, std::size_t> services_;
+
+    bool is_enabled() const { return count_ > 0; }
+};
+
+} // namespace vsomeip_v3
@@ -0,0 +1,29 @@
+// Copyright (C) 2014-2026 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+
+namespace vsomeip_v3 {
+
+/**
+ * Write coalescing of the local endpoints of an application.
+ *
+ * Commands are held back for at most max_delay_, so that they are written
+ * together with the commands that follow. Once max_batch_size_ bytes are
+ * queued, the queue is written without further delay. Similar to the
+ * maximum retention time of the NPDU trains, the delay starts with the first
+ * command that is held back and is not extended by further commands.
+ */
+struct local_coalescing_t {
+    std::chrono::milliseconds max_delay_{0};
+    std::size_t max_batch_size_{0};
+
+    bool is_enabled() const { return max_delay_.count() > 0; }
+};
+
+} // namespace vsomeip_v3
@@ -0,0 +1,83 @@
+// Copyright (C) 2014-2026 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <boost/property_tree/ptree.hpp>
+
+#include <vsomeip/constants.hpp>
+#include <vsomeip/primitive_types.hpp>
+
+namespace vsomeip_v3 {
+namespace cfg {
+
+/**
+ * \brief A service instance as it is defined in the "services" section of a
+ * configuration file.
+ *
+ * Other than cfg::service, a definition does not depend on other sections of
+ * the configuration (the default unicast address and NPDU timings), thus it
+ * can be compiled into the configuration cache. configuration_impl creates
+ * the cfg::service from it when the configuration is loaded.
+ */
+struct service_definition {
+    struct event_definition {
+        event_t id_{0};
+        bool is_field_{false};
+        reliability_type_e reliability_{reliability_type_e::RT_UNKNOWN};
+        std::uint32_t cycle_{0}; // ms
+        bool change_resets_cycle_{false};
+        bool update_on_change_{true};
+    };
+
+    struct eventgroup_definition {
+        eventgroup_t id_{0};
+        std::string multicast_address_;
+        std::uint16_t multicast_port_{0};
+        std::uint8_t threshold_{0};
+        std::vector<event_t> events_;
+    };
+
+    // Unset times are replaced by the default NPDU timings
+    struct debounce_time_definition {
+        method_t method_{0};
+        bool is_request_{false};
+        std::optional<std::chrono::nanoseconds> debounce_time_;
+        std::optional<std::chrono::nanoseconds> maximum_retention_time_;
+    };
+
+    // An unset maximum segment length is replaced by the default one
+    struct someip_tp_definition {
+        method_t method_{0};
+        bool is_request_{false};
+        std::optional<std::uint16_t> max_segment_length_;
+        std::uint32_t separation_time_{0}; // us
+    };
+
+    service_t service_{0};
+    instance_t instance_{0};
+    std::optional<std::string> unicast_address_;
+    std::uint16_t reliable_{ILLEGAL_PORT};
+    std::uint16_t unreliable_{ILLEGAL_PORT};
+    bool use_magic_cookies_{false};
+    std::string protocol_{"someip"};
+
+    std::vector<event_definition> events_;
+    std::vector<eventgroup_definition> eventgroups_;
+    std::vector<debounce_time_definition> debounce_times_;
+    std::vector<someip_tp_definition> someip_tp_;
+
+    // Parses an entry of the "services" section, throws if it is malformed
+    static service_definition parse(const boost::property_tree::ptree& _tree);
+};
+
+} // namespace cfg
+} // namespace vsomeip_v3
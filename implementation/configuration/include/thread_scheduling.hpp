@@ -0,0 +1,42 @@
+// Copyright (C) 2014-2026 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace vsomeip_v3 {
+
+// Threads of an application that can be configured individually
+enum class thread_type_e : std::uint8_t {
+    TT_IO, // io threads, including the thread that calls application::start and the io shards
+    TT_DISPATCHER, // main and additional dispatcher threads
+    TT_AUXILIARY, // thread of the auxiliary context (m_auxiliary)
+    TT_MULTICAST // thread that joins and leaves multicast groups (m_multicast)
+};
+
+enum class scheduling_policy_e : std::uint8_t {
+    SP_DEFAULT, // keep the policy inherited from the creating thread
+    SP_OTHER,
+    SP_FIFO,
+    SP_RR
+};
+
+/**
+ * CPU affinity and scheduling policy of a thread.
+ *
+ * The priority is only evaluated for the real-time policies SP_FIFO and
+ * SP_RR. An empty CPU list keeps the inherited affinity.
+ */
+struct thread_scheduling_t {
+    std::vector<int> cpus_;
+    scheduling_policy_e policy_{scheduling_policy_e::SP_DEFAULT};
+    int priority_{0};
+
+    bool is_configured() const { return !cpus_.empty() || policy_ != scheduling_policy_e::SP_DEFAULT; }
+};
+
+} // namespace vsomeip_v3
@@ -5,11 +5,13 @@
 
 #pragma once
 
+#include <cstdint>
 #include <string>
 #include <vector>
 
 #include <vsomeip/primitive_types.hpp>
 #include <vsomeip/trace.hpp>
+#include "../../tracing/include/defines.hpp"
 #include "../../tracing/include/enumeration_types.hpp"
 
 namespace vsomeip_v3 {
@@ -29,6 +31,21 @@ struct trace_filter {
     std::vector<vsomeip_v3::trace::match_t> matches_;
 };
 
+struct trace_capture {
+    trace_capture() :
+        is_enabled_(false), is_hexstream_enabled_(true), snaplen_(VSOMEIP_TC_DEFAULT_CAPTURE_SNAPLEN),
+        buffer_size_(VSOMEIP_TC_DEFAULT_CAPTURE_BUFFER_SIZE), file_size_(VSOMEIP_TC_DEFAULT_CAPTURE_FILE_SIZE),
+        file_count_(VSOMEIP_TC_DEFAULT_CAPTURE_FILE_COUNT) { }
+
+    bool is_enabled_;
+    bool is_hexstream_enabled_; // hexstream output of the channels while capturing
+    std::string path_;
+    std::uint32_t snaplen_; // maximum number of bytes captured per message
+    std::uint32_t buffer_size_; // in bytes
+    std::uint32_t file_size_; // in bytes
+    std::uint32_t file_count_;
+};
+
 struct trace {
     trace() : is_enabled_(false), is_sd_enabled_(false), channels_(), filters_() { }
 
@@ -37,6 +54,8 @@ struct trace {
 
     std::vector<std::shared_ptr<trace_channel>> channels_;
     std::vector<std::shared_ptr<trace_filter>> filters_;
+
+    trace_capture capture_;
 };
 
 } // namespace cfg
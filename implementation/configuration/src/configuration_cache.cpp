@@ -0,0 +1,589 @@
+// Copyright (C) 2014-2026 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <limits>
+
+#if defined(__linux__) || defined(__QNX__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "../include/configuration_cache.hpp"
+#include "../../utility/include/bithelper.hpp"
+
+namespace vsomeip_v3 {
+namespace cfg {
+
+namespace {
+
+// Configuration files are not nested deeper, anything beyond is considered corrupt
+const std::size_t MAX_DEPTH(256);
+
+// magic, version, number of entries, reserved
+const std::size_t HEADER_SIZE(4 * sizeof(std::uint32_t));
+
+const std::uint64_t NANOSECONDS_PER_SECOND(1000000000);
+
+// The path the file is known by on the target, i.e. relative to the root directory
+bool get_path(const std::string& _name, const std::string& _root, std::string& _path) {
+
+    std::error_code its_error;
+    auto its_path = std::filesystem::weakly_canonical(_name, its_error);
+    if (its_error) {
+        return false;
+    }
+    if (!_root.empty()) {
+        const auto its_root = std::filesystem::weakly_canonical(_root, its_error);
+        if (its_error) {
+            return false;
+        }
+        const auto its_relative = its_path.lexically_relative(its_root);
+        if (its_relative.empty() || *its_relative.begin() == "..") {
+            return false; // not below the root directory
+        }
+        its_path = std::filesystem::path("/") / its_relative;
+    }
+
+    _path = its_path.string();
+    return true;
+}
+
+// Identifies the content of a file by its size and its (64 bit FNV-1a) hash. Other than
+// the modification time, both survive copying the files to the target.
+bool get_identity(const std::string& _name, std::uint64_t& _size, std::uint64_t& _hash) {
+
+    std::ifstream its_file(_name, std::ios::binary);
+    if (!its_file.is_open()) {
+        return false;
+    }
+
+    std::uint64_t its_size(0);
+    std::uint64_t its_hash(0xcbf29ce484222325);
+    char its_buffer[4096];
+    while (its_file) {
+        its_file.read(its_buffer, sizeof(its_buffer));
+        const auto its_read = its_file.gcount();
+        for (std::streamsize i = 0; i < its_read; ++i) {
+            its_hash = (its_hash ^ static_cast<unsigned char>(its_buffer[i])) * 0x100000001b3;
+        }
+        its_size += static_cast<std::uint64_t>(its_read);
+    }
+    if (its_file.bad()) {
+        return false;
+    }
+
+    _size = its_size;
+    _hash = its_hash;
+    return true;
+}
+
+// Gets the size and the modification time of the file. Other than the content hash, both are
+// cheap to get. The modification time survives copying the files if the timestamps are preserved.
+bool get_modification(const std::string& _name, std::uint64_t& _size, std::uint64_t& _modified) {
+
+#if defined(__linux__) || defined(__QNX__)
+    struct stat its_stat;
+    if (::stat(_name.c_str(), &its_stat) != 0) {
+        return false;
+    }
+    _size = static_cast<std::uint64_t>(its_stat.st_size);
+#if defined(__linux__)
+    _modified = static_cast<std::uint64_t>(its_stat.st_mtim.tv_sec) * NANOSECONDS_PER_SECOND
+            + static_cast<std::uint64_t>(its_stat.st_mtim.tv_nsec);
+#else
+    _modified = static_cast<std::uint64_t>(its_stat.st_mtime) * NANOSECONDS_PER_SECOND;
+#endif
+#else
+    std::error_code its_error;
+    _size = static_cast<std::uint64_t>(std::filesystem::file_size(_name, its_error));
+    if (its_error) {
+        return false;
+    }
+    _modified = 0;
+#endif
+    return true;
+}
+
+// Copying may truncate the modification time to full seconds (e.g. tar archives), thus the
+// times also match if one of them has no fractional part
+bool is_unmodified(std::uint64_t _cached, std::uint64_t _current) {
+
+    if (_cached == 0 || _current == 0) {
+        return false;
+    }
+    if (_cached == _current) {
+        return true;
+    }
+    return (_cached % NANOSECONDS_PER_SECOND == 0 || _current % NANOSECONDS_PER_SECOND == 0)
+            && _cached / NANOSECONDS_PER_SECOND == _current / NANOSECONDS_PER_SECOND;
+}
+
+// The cache may be generated on a different host --> fixed (little endian) byte order
+void append(std::vector<char>& _buffer, std::uint32_t _value) {
+    const auto its_position = _buffer.size();
+    _buffer.resize(its_position + sizeof(_value));
+    bithelper::write_uint32_le(_value, reinterpret_cast<std::uint8_t*>(&_buffer[its_position]));
+}
+
+void append(std::vector<char>& _buffer, std::uint64_t _value) {
+    const auto its_position = _buffer.size();
+    _buffer.resize(its_position + sizeof(_value));
+    bithelper::write_uint64_le(_value, reinterpret_cast<std::uint8_t*>(&_buffer[its_position]));
+}
+
+void append(std::vector<char>& _buffer, const std::string& _value) {
+    append(_buffer, static_cast<std::uint32_t>(_value.size()));
+    _buffer.insert(_buffer.end(), _value.begin(), _value.end());
+}
+
+void append(std::vector<char>& _buffer, const boost::property_tree::ptree& _tree) {
+    append(_buffer, _tree.data());
+    append(_buffer, static_cast<std::uint32_t>(_tree.size()));
+    for (const auto& [its_key, its_child] : _tree) {
+        append(_buffer, its_key);
+        append(_buffer, its_child);
+    }
+}
+
+void append(std::vector<char>& _buffer, const std::optional<std::chrono::nanoseconds>& _value) {
+    append(_buffer, static_cast<std::uint32_t>(_value.has_value()));
+    append(_buffer, static_cast<std::uint64_t>(_value.value_or(std::chrono::nanoseconds::zero()).count()));
+}
+
+void append(std::vector<char>& _buffer, const std::vector<service_definition>& _services) {
+    append(_buffer, static_cast<std::uint32_t>(_services.size()));
+    for (const auto& s : _services) {
+        append(_buffer, std::uint32_t(s.service_));
+        append(_buffer, std::uint32_t(s.instance_));
+        append(_buffer, static_cast<std::uint32_t>(s.unicast_address_.has_value()));
+        append(_buffer, s.unicast_address_.value_or(""));
+        append(_buffer, std::uint32_t(s.reliable_));
+        append(_buffer, std::uint32_t(s.unreliable_));
+        append(_buffer, static_cast<std::uint32_t>(s.use_magic_cookies_));
+        append(_buffer, s.protocol_);
+
+        append(_buffer, static_cast<std::uint32_t>(s.events_.size()));
+        for (const auto& e : s.events_) {
+            append(_buffer, std::uint32_t(e.id_));
+            append(_buffer, static_cast<std::uint32_t>(e.is_field_));
+            append(_buffer, static_cast<std::uint32_t>(e.reliability_));
+            append(_buffer, e.cycle_);
+            append(_buffer, static_cast<std::uint32_t>(e.change_resets_cycle_));
+            append(_buffer, static_cast<std::uint32_t>(e.update_on_change_));
+        }
+
+        append(_buffer, static_cast<std::uint32_t>(s.eventgroups_.size()));
+        for (const auto& g : s.eventgroups_) {
+            append(_buffer, std::uint32_t(g.id_));
+            append(_buffer, g.multicast_address_);
+            append(_buffer, std::uint32_t(g.multicast_port_));
+            append(_buffer, std::uint32_t(g.threshold_));
+            append(_buffer, static_cast<std::uint32_t>(g.events_.size()));
+            for (const auto its_event : g.events_) {
+                append(_buffer, std::uint32_t(its_event));
+            }
+        }
+
+        append(_buffer, static_cast<std::uint32_t>(s.debounce_times_.size()));
+        for (const auto& d : s.debounce_times_) {
+            append(_buffer, std::uint32_t(d.method_));
+            append(_buffer, static_cast<std::uint32_t>(d.is_request_));
+            append(_buffer, d.debounce_time_);
+            append(_buffer, d.maximum_retention_time_);
+        }
+
+        append(_buffer, static_cast<std::uint32_t>(s.someip_tp_.size()));
+        for (const auto& t : s.someip_tp_) {
+            append(_buffer, std::uint32_t(t.method_));
+            append(_buffer, static_cast<std::uint32_t>(t.is_request_));
+            append(_buffer, static_cast<std::uint32_t>(t.max_segment_length_.has_value()));
+            append(_buffer, std::uint32_t(t.max_segment_length_.value_or(0)));
+            append(_buffer, t.separation_time_);
+        }
+    }
+}
+
+class reader {
+public:
+    reader(const char* _data, std::size_t _size) : position_(_data), end_(_data + _size) { }
+
+    bool read(std::uint32_t& _value) {
+        if (static_cast<std::size_t>(end_ - position_) < sizeof(_value)) {
+            return false;
+        }
+        _value = bithelper::read_uint32_le(reinterpret_cast<const std::uint8_t*>(position_));
+        position_ += sizeof(_value);
+        return true;
+    }
+
+    bool read(std::uint64_t& _value) {
+        if (static_cast<std::size_t>(end_ - position_) < sizeof(_value)) {
+            return false;
+        }
+        _value = bithelper::read_uint64_le(reinterpret_cast<const std::uint8_t*>(position_));
+        position_ += sizeof(_value);
+        return true;
+    }
+
+    bool read(std::string& _value) {
+        std::uint32_t its_size;
+        if (!read(its_size) || static_cast<std::size_t>(end_ - position_) < its_size) {
+            return false;
+        }
+        _value.assign(position_, its_size);
+        position_ += its_size;
+        return true;
+    }
+
+    bool read(boost::property_tree::ptree& _tree, std::size_t _depth) {
+        std::uint32_t its_count;
+        if (_depth > MAX_DEPTH || !read(_tree.data()) || !read(its_count)) {
+            return false;
+        }
+        std::string its_key;
+        for (std::uint32_t i = 0; i < its_count; ++i) {
+            if (!read(its_key)) {
+                return false;
+            }
+            auto its_child = _tree.push_back(std::make_pair(its_key, boost::property_tree::ptree()));
+            if (!read(its_child->second, _depth + 1)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool read(std::vector<service_definition>& _services) {
+        std::uint32_t its_count;
+        if (!read(its_count)) {
+            return false;
+        }
+        for (std::uint32_t i = 0; i < its_count; ++i) {
+            auto& s = _services.emplace_back();
+            std::uint32_t its_events, its_eventgroups, its_debounce_times, its_someip_tp;
+            bool has_unicast_address;
+            std::string its_unicast_address;
+            if (!read_number(s.service_) || !read_number(s.instance_) || !read_number(has_unicast_address) || !read(its_unicast_address)
+                || !read_number(s.reliable_) || !read_number(s.unreliable_) || !read_number(s.use_magic_cookies_) || !read(s.protocol_)
+                || !read(its_events)) {
+                return false;
+            }
+            if (has_unicast_address) {
+                s.unicast_address_ = its_unicast_address;
+            }
+
+            for (std::uint32_t j = 0; j < its_events; ++j) {
+                auto& e = s.events_.emplace_back();
+                std::uint8_t its_reliability;
+                if (!read_number(e.id_) || !read_number(e.is_field_) || !read_number(its_reliability) || !read(e.cycle_)
+                    || !read_number(e.change_resets_cycle_) || !read_number(e.update_on_change_)) {
+                    return false;
+                }
+                e.reliability_ = static_cast<reliability_type_e>(its_reliability);
+            }
+
+            if (!read(its_eventgroups)) {
+                return false;
+            }
+            for (std::uint32_t j = 0; j < its_eventgroups; ++j) {
+                auto& g = s.eventgroups_.emplace_back();
+                std::uint32_t its_count_events;
+                if (!read_number(g.id_) || !read(g.multicast_address_) || !read_number(g.multicast_port_) || !read_number(g.threshold_)
+                    || !read(its_count_events)) {
+                    return false;
+                }
+                for (std::uint32_t k = 0; k < its_count_events; ++k) {
+                    if (!read_number(g.events_.emplace_back())) {
+                        return false;
+                    }
+                }
+            }
+
+            if (!read(its_debounce_times)) {
+                return false;
+            }
+            for (std::uint32_t j = 0; j < its_debounce_times; ++j) {
+                auto& d = s.debounce_times_.emplace_back();
+                if (!read_number(d.method_) || !read_number(d.is_request_) || !read(d.debounce_time_) || !read(d.maximum_retention_time_)) {
+                    return false;
+                }
+            }
+
+            if (!read(its_someip_tp)) {
+                return false;
+            }
+            for (std::uint32_t j = 0; j < its_someip_tp; ++j) {
+                auto& t = s.someip_tp_.emplace_back();
+                bool has_max_segment_length;
+                std::uint16_t its_max_segment_length;
+                if (!read_number(t.method_) || !read_number(t.is_request_) || !read_number(has_max_segment_length)
+                    || !read_number(its_max_segment_length) || !read(t.separation_time_)) {
+                    return false;
+                }
+                if (has_max_segment_length) {
+                    t.max_segment_length_ = its_max_segment_length;
+                }
+            }
+        }
+        return true;
+    }
+
+private:
+    bool read(std::optional<std::chrono::nanoseconds>& _value) {
+        bool has_value;
+        std::uint64_t its_value;
+        if (!read_number(has_value) || !read(its_value)) {
+            return false;
+        }
+        if (has_value) {
+            _value = std::chrono::nanoseconds(its_value);
+        }
+        return true;
+    }
+
+    // Numbers (and flags) that are stored as 32 bit value
+    template<typename T>
+    bool read_number(T& _value) {
+        std::uint32_t its_value;
+        if (!read(its_value) || its_value > std::numeric_limits<T>::max()) {
+            return false;
+        }
+        _value = static_cast<T>(its_value);
+        return true;
+    }
+
+    const char* position_;
+    const char* end_;
+};
+
+} // namespace
+
+configuration_cache::configuration_cache() : data_(nullptr), data_size_(0), hits_(0) { }
+
+configuration_cache::~configuration_cache() {
+    close();
+}
+
+bool configuration_cache::write(const std::string& _path, const std::vector<configuration_element>& _elements, const std::string& _root) {
+
+    struct source {
+        std::string path_;
+        std::uint64_t size_;
+        std::uint64_t modified_;
+        std::uint64_t hash_;
+        boost::property_tree::ptree tree_;
+        std::vector<service_definition> services_;
+    };
+
+    std::vector<source> its_sources;
+    std::size_t its_offset(HEADER_SIZE);
+    for (const auto& e : _elements) {
+        source its_source{"", 0, 0, 0, e.tree_, {}};
+        // Get the modification time before hashing: if the file is changed in between, it does no longer match
+        std::uint64_t its_size(0);
+        if (!get_modification(e.name_, its_size, its_source.modified_)) {
+            its_source.modified_ = 0;
+        }
+        if (!get_path(e.name_, _root, its_source.path_) || !get_identity(e.name_, its_source.size_, its_source.hash_)) {
+            return false;
+        }
+        if (its_size != its_source.size_) {
+            its_source.modified_ = 0;
+        }
+
+        // Compile the "services" section. Like when loading it from JSON, only the first one is
+        // used and malformed services are skipped.
+        if (auto its_services = e.tree_.get_child_optional("services")) {
+            for (const auto& [its_key, its_service] : *its_services) {
+                try {
+                    its_source.services_.push_back(service_definition::parse(its_service));
+                } catch (...) {
+                    // skipped
+                }
+            }
+        }
+        its_source.tree_.erase("services");
+
+        its_offset += sizeof(std::uint32_t) + its_source.path_.size() + 5 * sizeof(std::uint64_t);
+        its_sources.push_back(std::move(its_source));
+    }
+
+    // Compiled files
+    std::vector<char> its_files;
+    std::vector<std::pair<std::uint64_t, std::uint64_t>> its_locations;
+    for (const auto& s : its_sources) {
+        const auto its_begin = its_files.size();
+        append(its_files, s.tree_);
+        append(its_files, s.services_);
+        its_locations.emplace_back(its_offset + its_begin, its_files.size() - its_begin);
+    }
+
+    // Header & index
+    std::vector<char> its_buffer;
+    append(its_buffer, MAGIC);
+    append(its_buffer, VERSION);
+    append(its_buffer, static_cast<std::uint32_t>(its_sources.size()));
+    append(its_buffer, std::uint32_t(0)); // reserved
+    for (std::size_t i = 0; i < its_sources.size(); ++i) {
+        append(its_buffer, its_sources[i].path_);
+        append(its_buffer, its_sources[i].size_);
+        append(its_buffer, its_sources[i].modified_);
+        append(its_buffer, its_sources[i].hash_);
+        append(its_buffer, its_locations[i].first);
+        append(its_buffer, its_locations[i].second);
+    }
+    its_buffer.insert(its_buffer.end(), its_files.begin(), its_files.end());
+
+    // Write to a temporary file and rename it to not disturb processes that map the current one
+    const std::string its_temporary(_path + ".tmp");
+    std::error_code its_error;
+    {
+        std::ofstream its_file(its_temporary, std::ios::binary | std::ios::trunc);
+        if (its_file.is_open()) {
+            its_file.write(its_buffer.data(), static_cast<std::streamsize>(its_buffer.size()));
+            its_file.close();
+        }
+        if (its_file.fail()) {
+            // Do not leave a partially written file behind
+            std::filesystem::remove(its_temporary, its_error);
+            return false;
+        }
+    }
+    std::filesystem::rename(its_temporary, _path, its_error);
+    if (its_error) {
+        std::error_code its_remove_error;
+        std::filesystem::remove(its_temporary, its_remove_error);
+        return false;
+    }
+    return true;
+}
+
+bool configuration_cache::open(const std::string& _path) {
+
+    close();
+
+#if defined(__linux__) || defined(__QNX__)
+    const int its_fd = ::open(_path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (its_fd < 0) {
+        return false;
+    }
+    struct stat its_stat;
+    if (::fstat(its_fd, &its_stat) == 0 && its_stat.st_size > 0) {
+        void* its_data = ::mmap(nullptr, static_cast<std::size_t>(its_stat.st_size), PROT_READ, MAP_PRIVATE, its_fd, 0);
+        if (its_data != MAP_FAILED) {
+            data_ = static_cast<const char*>(its_data);
+            data_size_ = static_cast<std::size_t>(its_stat.st_size);
+        }
+    }
+    ::close(its_fd);
+#else
+    std::ifstream its_file(_path, std::ios::binary);
+    if (!its_file.is_open()) {
+        return false;
+    }
+    buffer_.assign(std::istreambuf_iterator<char>(its_file), std::istreambuf_iterator<char>());
+    data_ = buffer_.data();
+    data_size_ = buffer_.size();
+#endif
+    if (data_ == nullptr || data_size_ == 0) {
+        close();
+        return false;
+    }
+
+    reader its_reader(data_, data_size_);
+    std::uint32_t its_magic, its_version, its_count, its_reserved;
+    if (!its_reader.read(its_magic) || its_magic != MAGIC || !its_reader.read(its_version) || its_version != VERSION
+        || !its_reader.read(its_count) || !its_reader.read(its_reserved)) {
+        close();
+        return false;
+    }
+
+    for (std::uint32_t i = 0; i < its_count; ++i) {
+        std::string its_path;
+        entry its_entry;
+        if (!its_reader.read(its_path) || !its_reader.read(its_entry.size_) || !its_reader.read(its_entry.modified_)
+            || !its_reader.read(its_entry.hash_) || !its_reader.read(its_entry.offset_) || !its_reader.read(its_entry.length_)
+            || its_entry.offset_ > data_size_ || its_entry.length_ > data_size_ - its_entry.offset_) {
+            close();
+            return false;
+        }
+        entries_[its_path] = its_entry;
+    }
+
+    return true;
+}
+
+bool configuration_cache::get(const std::string& _name, boost::property_tree::ptree& _tree,
+                              std::optional<std::vector<service_definition>>& _services) const {
+
+    if (entries_.empty()) {
+        return false;
+    }
+
+    std::string its_path;
+    if (!get_path(_name, "", its_path)) {
+        return false;
+    }
+    auto found_entry = entries_.find(its_path);
+    if (found_entry == entries_.end()) {
+        return false;
+    }
+
+    // Only hash the content if the size matches, but the modification time does not
+    std::uint64_t its_size, its_modified;
+    if (!get_modification(its_path, its_size, its_modified) || its_size != found_entry->second.size_) {
+        return false;
+    }
+    if (!is_unmodified(found_entry->second.modified_, its_modified)) {
+        std::uint64_t its_hash;
+        if (!get_identity(its_path, its_size, its_hash) || its_size != found_entry->second.size_
+            || its_hash != found_entry->second.hash_) {
+            return false;
+        }
+    }
+
+    boost::property_tree::ptree its_tree;
+    std::vector<service_definition> its_services;
+    reader its_reader(data_ + found_entry->second.offset_, static_cast<std::size_t>(found_entry->second.length_));
+    if (!its_reader.read(its_tree, 0) || !its_reader.read(its_services)) {
+        return false;
+    }
+
+    _tree.swap(its_tree);
+    _services = std::move(its_services);
+    hits_++;
+    return true;
+}
+
+std::size_t configuration_cache::get_size() const {
+    return entries_.size();
+}
+
+std::size_t configuration_cache::get_hits() const {
+    return hits_;
+}
+
+void configuration_cache::close() {
+
+#if defined(__linux__) || defined(__QNX__)
+    if (data_ != nullptr) {
+        ::munmap(const_cast<char*>(data_), data_size_);
+    }
+#endif
+    buffer_.clear();
+    data_ = nullptr;
+    data_size_ = 0;
+    entries_.clear();
+}
+
+} // namespace cfg
+} // namespace vsomeip_v3
@@ -3,6 +3,7 @@
 // License, v. 2.0. If a copy of the MPL was not distributed with this
 // file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
+#include <algorithm>
 #include <cctype>
 #include <fstream>
 #include <functional>
@@ -29,10 +30,12 @@
 
 #include "logger_ext.hpp"
 #include "../include/client.hpp"
+#include "../include/configuration_cache.hpp"
 #include "../include/configuration_impl.hpp"
 #include "../include/event.hpp"
 #include "../include/eventgroup.hpp"
 #include "../include/service.hpp"
+#include "../include/service_definition.hpp"
 #include "../../logger/include/logger_impl.hpp"
 #include "../../protocol/include/protocol.hpp"
 #include "../../routing/include/event.hpp"
@@ -77,6 +80,7 @@ configuration_impl::configuration_impl(const std::string& _path) :
     statistics_max_messages_{VSOMEIP_DEFAULT_STATISTICS_MAX_MSG}, max_remote_subscribers_{VSOMEIP_DEFAULT_MAX_REMOTE_SUBSCRIBERS},
     path_{_path}, is_security_enabled_{false}, is_security_external_{false}, is_security_audit_{false}, is_remote_access_allowed_{true},
     initial_routing_state_{routing_state_e::RS_UNKNOWN}, request_debounce_time_{VSOMEIP_REQUEST_DEBOUNCE_TIME},
+    event_cycle_resolution_{VSOMEIP_DEFAULT_EVENT_CYCLE_RESOLUTION}, is_event_cycle_spreading_{false},
     default_max_dispatch_time_{VSOMEIP_DEFAULT_MAX_DISPATCH_TIME}, default_max_dispatchers_{VSOMEIP_DEFAULT_MAX_DISPATCHERS} {
 
     policy_manager_ = std::make_shared<policy_manager_impl>();
@@ -92,6 +96,8 @@ configuration_impl::configuration_impl(const std::string& _path) :
     routing_.guests_.unicast_ = routing_.host_.unicast_;
     routing_.guests_.ports_[{ANY_UID, ANY_GID}].emplace(31492, 31999);
 #endif
+
+    update_service_index();
 }
 
 configuration_impl::configuration_impl(const configuration_impl& _other) :
@@ -108,6 +114,7 @@ configuration_impl::configuration_impl(const configuration_impl& _other) :
     npdu_default_max_retention_requ_{_other.npdu_default_max_retention_requ_},
     npdu_default_max_retention_resp_{_other.npdu_default_max_retention_resp_}, path_{_other.path_},
     initial_routing_state_{_other.initial_routing_state_}, request_debounce_time_{_other.request_debounce_time_},
+    event_cycle_resolution_{_other.event_cycle_resolution_}, is_event_cycle_spreading_{_other.is_event_cycle_spreading_},
     default_max_dispatch_time_{_other.default_max_dispatch_time_}, default_max_dispatchers_{_other.default_max_dispatchers_} {
 
     applications_.insert(_other.applications_.begin(), _other.applications_.end());
@@ -190,6 +197,8 @@ configuration_impl::configuration_impl(const configuration_impl& _other) :
     is_security_external_ = _other.is_security_external_.load();
     is_security_audit_ = _other.is_security_audit_.load();
     is_remote_access_allowed_ = _other.is_remote_access_allowed_.load();
+
+    update_service_index();
 }
 
 configuration_impl::~configuration_impl() { }
@@ -273,6 +282,20 @@ bool configuration_impl::load(const std::string& _name) {
     std::set<std::string> its_failed;
 
     std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+
+    // Use precompiled configuration files (only if configured)
+    std::string its_cache_file(VSOMEIP_DEFAULT_CONFIGURATION_CACHE);
+    its_env = VSOMEIP_GETENV(VSOMEIP_ENV_CONFIGURATION_CACHE);
+    if (nullptr != its_env) {
+        its_cache_file = its_env;
+    }
+    if (!its_cache_file.empty()) {
+        cache_ = std::make_unique<configuration_cache>();
+        if (!cache_->open(its_cache_file)) {
+            VSOMEIP_WARNING << "Configuration cache \"" << its_cache_file << "\" cannot be used, reading the configuration files.";
+            cache_.reset();
+        }
+    }
     std::vector<configuration_element> its_mandatory_elements;
     std::vector<configuration_element> its_optional_elements;
 
@@ -311,6 +334,11 @@ bool configuration_impl::load(const std::string& _name) {
             VSOMEIP_INFO << "Using configuration folder: \"" << i << "\".";
     }
 
+    if (cache_) {
+        VSOMEIP_INFO << "Using configuration cache: \"" << its_cache_file << "\" (" << cache_->get_hits() << " of " << cache_->get_size()
+                     << " files used).";
+    }
+
     VSOMEIP_INFO << "Parsed vsomeip configuration in " << std::chrono::duration_cast<std::chrono::milliseconds>(end - begin).count()
                  << "ms";
 
@@ -343,9 +371,9 @@ void configuration_impl::lazy_load_security(const std::string& _client_host) {
 
     read_data(its_input, its_mandatory_elements, its_failed, true, true);
 
-    for (const auto& e : its_mandatory_elements) {
-        policy_manager_->load(e, true);
-    }
+    policy_manager_->load(std::vector<std::reference_wrapper<const configuration_element>>(its_mandatory_elements.begin(),
+                                                                                           its_mandatory_elements.end()),
+                          true);
 
     for (auto f : its_failed) {
         VSOMEIP_WARNING_P << "Reading of configuration file \"" << f << "\" failed. Configuration may be incomplete";
@@ -391,11 +419,15 @@ bool configuration_impl::remote_offer_info_add(service_t _service, instance_t _i
             if (const auto search = services_.find(its_service->service_instance_); search != services_.end()) {
                 VSOMEIP_INFO << "Updating remote configuration for service [" << hex4(its_service->service_instance_.service()) << "."
                              << hex4(its_service->service_instance_.instance()) << "]";
+                // Published service objects are read without lock --> replace
+                auto its_update = std::make_shared<service>(*search->second);
                 if (_reliable) {
-                    search->second->reliable_ = its_service->reliable_;
+                    its_update->reliable_ = its_service->reliable_;
                 } else {
-                    search->second->unreliable_ = its_service->unreliable_;
+                    its_update->unreliable_ = its_service->unreliable_;
                 }
+                replace_service_by_ip_port_unlocked(search->second, its_update);
+                search->second = its_update;
                 updated = true;
             }
 
@@ -408,6 +440,7 @@ bool configuration_impl::remote_offer_info_add(service_t _service, instance_t _i
                 magic_cookies_[its_service->unicast_address_].insert(its_service->reliable_);
             }
         }
+        update_service_index();
         ret = true;
     }
     return ret;
@@ -421,19 +454,28 @@ bool configuration_impl::remote_offer_info_remove(service_t _service, instance_t
     if (!is_loaded_) {
         VSOMEIP_ERROR_P << "Shall only be called after normal configuration has been parsed";
     } else {
-        std::scoped_lock its_lock(services_mutex_);
-        const auto search = services_.find(service_instance_t{_service, _instance});
-        if (services_.contains(service_instance_t{_service, _instance})) {
-            VSOMEIP_INFO << "Removing remote configuration for service [" << hex4(_service) << "." << hex4(_instance) << "]";
-            if (_reliable) {
-                search->second->reliable_ = ILLEGAL_PORT;
-                // TODO delete from magic_cookies_map without overwriting
-                // configurations from other services offered on the same port
-            } else {
-                search->second->unreliable_ = ILLEGAL_PORT;
+        {
+            std::scoped_lock its_lock(services_mutex_);
+            const auto search = services_.find(service_instance_t{_service, _instance});
+            if (search != services_.end()) {
+                VSOMEIP_INFO << "Removing remote configuration for service [" << hex4(_service) << "." << hex4(_instance) << "]";
+                // Published service objects are read without lock --> replace
+                auto its_update = std::make_shared<service>(*search->second);
+                if (_reliable) {
+                    its_update->reliable_ = ILLEGAL_PORT;
+                    // TODO delete from magic_cookies_map without overwriting
+                    // configurations from other services offered on the same port
+                } else {
+                    its_update->unreliable_ = ILLEGAL_PORT;
+                }
+                replace_service_by_ip_port_unlocked(search->second, its_update);
+                search->second = its_update;
+                *_still_offered_remote = (its_update->unreliable_ != ILLEGAL_PORT || its_update->reliable_ != ILLEGAL_PORT);
+                ret = true;
             }
-            *_still_offered_remote = (search->second->unreliable_ != ILLEGAL_PORT || search->second->reliable_ != ILLEGAL_PORT);
-            ret = true;
+        }
+        if (ret) {
+            update_service_index();
         }
     }
     return ret;
@@ -441,9 +483,10 @@ bool configuration_impl::remote_offer_info_remove(service_t _service, instance_t
 
 void configuration_impl::read_data(const std::set<std::string>& _input, std::vector<configuration_element>& _elements,
                                    std::set<std::string>& _failed, bool _mandatory_only, bool _read_second_level) {
+    std::vector<std::string> its_files;
     for (auto i : _input) {
         if (utility::is_file(i)) {
-            load_policy_data(i, _elements, _failed, _mandatory_only);
+            load_policy_data(i, its_files, _mandatory_only);
         } else if (utility::is_folder(i)) {
             // Use the map to ensure the configuration files are read in
             // the ascending order of their names. This allows to use
@@ -471,25 +514,48 @@ void configuration_impl::read_data(const std::set<std::string>& _input, std::vec
             }
 
             for (const auto& n : its_names)
-                load_policy_data(n.first, _elements, _failed, n.second);
+                load_policy_data(n.first, its_files, n.second);
         }
     }
+    read_files(its_files, _elements, _failed);
 }
 
-void configuration_impl::load_policy_data(const std::string& _input, std::vector<configuration_element>& _elements,
-                                          std::set<std::string>& _failed, bool _mandatory_only) {
+void configuration_impl::load_policy_data(const std::string& _input, std::vector<std::string>& _files, bool _mandatory_only) {
     if (is_mandatory(_input) == _mandatory_only) {
 #ifndef VSOMEIP_DISABLE_SECURITY
         if (policy_manager_->is_policy_extension(_input)) {
             policy_manager_->set_policy_extension_base_path(_input);
         }
 #endif
-        boost::property_tree::ptree its_tree;
-        try {
-            boost::property_tree::json_parser::read_json(_input, its_tree);
-            _elements.push_back({_input, its_tree});
-        } catch (boost::property_tree::json_parser_error&) {
-            _failed.insert(_input);
+        _files.push_back(_input);
+    }
+}
+
+void configuration_impl::read_files(const std::vector<std::string>& _files, std::vector<configuration_element>& _elements,
+                                    std::set<std::string>& _failed) {
+    // Read (or take from the cache) in parallel, but keep the order of the files
+    std::vector<boost::property_tree::ptree> its_trees(_files.size());
+    std::vector<std::optional<std::vector<service_definition>>> its_services(_files.size());
+    std::vector<std::uint8_t> is_read(_files.size(), 0);
+    utility::parallel_for(_files.size(), VSOMEIP_MAX_CONFIGURATION_LOADERS, VSOMEIP_MIN_CONFIGURATION_LOADS,
+                          [this, &_files, &its_trees, &its_services, &is_read](std::size_t _index) {
+                              try {
+                                  if (!cache_ || !cache_->get(_files[_index], its_trees[_index], its_services[_index])) {
+                                      boost::property_tree::json_parser::read_json(_files[_index], its_trees[_index]);
+                                  }
+                                  is_read[_index] = 1;
+                              } catch (const std::exception& e) {
+                                  VSOMEIP_ERROR << "Failed to read configuration file \"" << _files[_index] << "\": " << e.what();
+                              }
+                          });
+
+    for (std::size_t i = 0; i < _files.size(); ++i) {
+        if (is_read[i]) {
+            _elements.emplace_back(_files[i], boost::property_tree::ptree());
+            _elements.back().tree_.swap(its_trees[i]);
+            _elements.back().services_ = std::move(its_services[i]);
+        } else {
+            _failed.insert(_files[i]);
         }
     }
 }
@@ -512,6 +578,10 @@ bool configuration_impl::load_data(const std::vector<configuration_element>& _el
     bool has_routing(false);
     bool has_applications(false);
     if (_load_mandatory) {
+#ifndef VSOMEIP_DISABLE_SECURITY
+        // Policies are loaded at once after the mandatory configuration data
+        std::vector<std::reference_wrapper<const configuration_element>> its_policy_elements;
+#endif // !VSOMEIP_DISABLE_SECURITY
         // Load mandatory configuration data
         for (const auto& e : _elements) {
             has_routing = load_routing(e) || has_routing;
@@ -525,12 +595,20 @@ bool configuration_impl::load_data(const std::vector<configuration_element>& _el
             load_tcp_restart_settings(e);
             load_permissions(e);
             load_security(e);
+#ifndef VSOMEIP_DISABLE_SECURITY
+            if (!is_security_external())
+                its_policy_elements.push_back(std::cref(e));
+#endif // !VSOMEIP_DISABLE_SECURITY
             load_tracing(e);
             load_udp_receive_buffer_size(e);
             load_services(e);
             load_request_debounce_time(e);
+            load_event_cycles(e);
             load_dispatch_defaults(e);
         }
+#ifndef VSOMEIP_DISABLE_SECURITY
+        policy_manager_->load(its_policy_elements);
+#endif // !VSOMEIP_DISABLE_SECURITY
     }
 
     if (_load_optional) {
@@ -552,6 +630,8 @@ bool configuration_impl::load_data(const std::vector<configuration_element>& _el
         }
     }
 
+    update_service_index();
+
     return is_logging_loaded_ && has_routing && has_applications;
 }
 
@@ -893,6 +973,7 @@ void configuration_impl::load_application_data(const boost::property_tree::ptree
     client_t its_id(VSOMEIP_CLIENT_UNSET);
     std::size_t its_max_dispatchers(VSOMEIP_DEFAULT_MAX_DISPATCHERS);
     std::size_t its_max_dispatch_time(VSOMEIP_DEFAULT_MAX_DISPATCH_TIME);
+    std::size_t its_handler_time_budget(VSOMEIP_DEFAULT_HANDLER_TIME_BUDGET);
     std::size_t its_io_thread_count(VSOMEIP_DEFAULT_IO_THREAD_COUNT);
     uint32_t its_log_status_interval(VSOMEIP_DEFAULT_LOG_STATUS);
     uint32_t its_log_version_interval(VSOMEIP_DEFAULT_LOG_NETWORK);
@@ -901,6 +982,9 @@ void configuration_impl::load_application_data(const boost::property_tree::ptree
     int its_io_thread_nice_level(VSOMEIP_DEFAULT_IO_THREAD_NICE_LEVEL);
     debounce_configuration_t its_debounces;
     bool has_session_handling(true);
+    local_coalescing_t its_local_coalescing;
+    io_shards_config_t its_io_shards;
+    std::map<thread_type_e, thread_scheduling_t> its_thread_scheduling;
     for (auto i = _tree.begin(); i != _tree.end(); ++i) {
         std::string its_key(i->first);
         std::string its_value(i->second.data());
@@ -920,6 +1004,9 @@ void configuration_impl::load_application_data(const boost::property_tree::ptree
         } else if (its_key == "max_dispatch_time") {
             its_converter << std::dec << its_value;
             its_converter >> its_max_dispatch_time;
+        } else if (its_key == "handler_time_budget") {
+            its_converter << std::dec << its_value;
+            its_converter >> its_handler_time_budget;
         } else if (its_key == "threads") {
             its_converter << std::dec << its_value;
             its_converter >> its_io_thread_count;
@@ -958,6 +1045,12 @@ void configuration_impl::load_application_data(const boost::property_tree::ptree
             }
         } else if (its_key == "has_session_handling") {
             has_session_handling = (its_value != "false");
+        } else if (its_key == "local_coalescing") {
+            its_local_coalescing = load_local_coalescing(i->second, its_name);
+        } else if (its_key == "io_shards") {
+            its_io_shards = load_io_shards(i->second, its_name);
+        } else if (its_key == "scheduling") {
+            its_thread_scheduling = load_thread_scheduling(i->second, its_name);
         }
     }
     if (its_name != "") {
@@ -975,6 +1068,7 @@ void configuration_impl::load_application_data(const boost::property_tree::ptree
             applications_[its_name] = {its_id,
                                        its_max_dispatchers,
                                        its_max_dispatch_time,
+                                       its_handler_time_budget,
                                        its_io_thread_count,
                                        its_log_status_interval,
                                        its_log_version_interval,
@@ -982,13 +1076,177 @@ void configuration_impl::load_application_data(const boost::property_tree::ptree
                                        plugins,
                                        its_io_thread_nice_level,
                                        its_debounces,
-                                       has_session_handling};
+                                       has_session_handling,
+                                       its_local_coalescing,
+                                       its_io_shards,
+                                       its_thread_scheduling};
         } else {
             VSOMEIP_WARNING << "Multiple configurations for application " << its_name << ". Ignoring a configuration from " << _file_name;
         }
     }
 }
 
+local_coalescing_t configuration_impl::load_local_coalescing(const boost::property_tree::ptree& _tree,
+                                                             const std::string& _application_name) {
+    local_coalescing_t its_coalescing{std::chrono::milliseconds(0), VSOMEIP_DEFAULT_LOCAL_COALESCING_BATCH_SIZE};
+    for (auto i = _tree.begin(); i != _tree.end(); ++i) {
+        std::string its_key(i->first);
+        std::string its_value(i->second.data());
+        std::stringstream its_converter;
+        if (its_key == "max_delay") {
+            std::chrono::milliseconds::rep its_delay{0};
+            its_converter << std::dec << its_value;
+            its_converter >> its_delay;
+            if (its_delay > 1000) {
+                VSOMEIP_WARNING << "Max. local coalescing delay is 1.000ms (" << _application_name << ")";
+                its_delay = 1000;
+            }
+            its_coalescing.max_delay_ = std::chrono::milliseconds(its_delay);
+        } else if (its_key == "max_batch_size") {
+            its_converter << std::dec << its_value;
+            its_converter >> its_coalescing.max_batch_size_;
+        }
+    }
+    return its_coalescing;
+}
+
+io_shards_config_t configuration_impl::load_io_shards(const boost::property_tree::ptree& _tree, const std::string& _application_name) {
+    io_shards_config_t its_shards;
+    try {
+        for (auto i = _tree.begin(); i != _tree.end(); ++i) {
+            std::string its_key(i->first);
+            std::string its_value(i->second.data());
+            std::stringstream its_converter;
+            if (its_key == "count") {
+                its_converter << std::dec << its_value;
+                its_converter >> its_shards.count_;
+                if (its_shards.count_ > 64) {
+                    VSOMEIP_WARNING << "Max. number of I/O shards per application is 64 (" << _application_name << ")";
+                    its_shards.count_ = 64;
+                }
+            } else if (its_key == "cpus") {
+                for (auto j = i->second.begin(); j != i->second.end(); ++j) {
+                    int its_cpu(-1);
+                    std::stringstream its_cpu_converter;
+                    its_cpu_converter << std::dec << j->second.data();
+                    its_cpu_converter >> its_cpu;
+                    if (its_cpu >= 0) {
+                        its_shards.cpus_.push_back(its_cpu);
+                    }
+                }
+            } else if (its_key == "local") {
+                std::size_t its_shard(0);
+                its_converter << std::dec << its_value;
+                its_converter >> its_shard;
+                its_shards.local_ = its_shard;
+            } else if (its_key == "services") {
+                for (auto j = i->second.begin(); j != i->second.end(); ++j) {
+                    service_t its_service(ANY_SERVICE);
+                    instance_t its_instance(ANY_INSTANCE);
+                    std::size_t its_shard(0);
+                    for (auto k = j->second.begin(); k != j->second.end(); ++k) {
+                        std::string its_inner_key(k->first);
+                        std::stringstream its_inner_converter;
+                        if (its_inner_key == "service") {
+                            its_inner_converter << std::hex << k->second.data();
+                            its_inner_converter >> its_service;
+                        } else if (its_inner_key == "instance") {
+                            its_inner_converter << std::hex << k->second.data();
+                            its_inner_converter >> its_instance;
+                        } else if (its_inner_key == "shard") {
+                            its_inner_converter << std::dec << k->second.data();
+                            its_inner_converter >> its_shard;
+                        }
+                    }
+                    its_shards.services_[{its_service, its_instance}] = its_shard;
+                }
+            }
+        }
+    } catch (...) {
+        VSOMEIP_ERROR << "Invalid I/O shard configuration for application " << _application_name;
+        return io_shards_config_t();
+    }
+
+    for (auto it = its_shards.services_.begin(); it != its_shards.services_.end();) {
+        if (it->second >= its_shards.count_) {
+            VSOMEIP_WARNING << "Ignoring I/O shard " << it->second << " for service " << hex4(it->first.first) << "."
+                            << hex4(it->first.second) << " (" << _application_name << ")";
+            it = its_shards.services_.erase(it);
+        } else {
+            ++it;
+        }
+    }
+    if (its_shards.local_ && *its_shards.local_ >= its_shards.count_) {
+        VSOMEIP_WARNING << "Ignoring I/O shard " << *its_shards.local_ << " for local endpoints (" << _application_name << ")";
+        its_shards.local_.reset();
+    }
+    return its_shards;
+}
+
+std::map<thread_type_e, thread_scheduling_t> configuration_impl::load_thread_scheduling(const boost::property_tree::ptree& _tree,
+                                                                                        const std::string& _application_name) {
+    static const std::map<std::string, thread_type_e> its_types{{"io", thread_type_e::TT_IO},
+                                                                {"dispatcher", thread_type_e::TT_DISPATCHER},
+                                                                {"auxiliary", thread_type_e::TT_AUXILIARY},
+                                                                {"multicast", thread_type_e::TT_MULTICAST}};
+    static const std::map<std::string, scheduling_policy_e> its_policies{
+            {"other", scheduling_policy_e::SP_OTHER}, {"fifo", scheduling_policy_e::SP_FIFO}, {"rr", scheduling_policy_e::SP_RR}};
+
+    std::map<thread_type_e, thread_scheduling_t> its_scheduling;
+    try {
+        for (auto i = _tree.begin(); i != _tree.end(); ++i) {
+            auto found_type = its_types.find(i->first);
+            if (found_type == its_types.end()) {
+                VSOMEIP_WARNING << "Ignoring scheduling of unknown thread type \"" << i->first << "\" (" << _application_name << ")";
+                continue;
+            }
+
+            thread_scheduling_t its_thread_scheduling;
+            for (auto j = i->second.begin(); j != i->second.end(); ++j) {
+                std::string its_key(j->first);
+                std::string its_value(j->second.data());
+                std::stringstream its_converter;
+                if (its_key == "cpus") {
+                    for (auto k = j->second.begin(); k != j->second.end(); ++k) {
+                        int its_cpu(-1);
+                        std::stringstream its_cpu_converter;
+                        its_cpu_converter << std::dec << k->second.data();
+                        its_cpu_converter >> its_cpu;
+                        if (its_cpu >= 0) {
+                            its_thread_scheduling.cpus_.push_back(its_cpu);
+                        }
+                    }
+                } else if (its_key == "policy") {
+                    auto found_policy = its_policies.find(its_value);
+                    if (found_policy != its_policies.end()) {
+                        its_thread_scheduling.policy_ = found_policy->second;
+                    } else {
+                        VSOMEIP_WARNING << "Ignoring unknown scheduling policy \"" << its_value << "\" (" << _application_name << ")";
+                    }
+                } else if (its_key == "priority") {
+                    its_converter << std::dec << its_value;
+                    its_converter >> its_thread_scheduling.priority_;
+                }
+            }
+
+            if (its_thread_scheduling.policy_ == scheduling_policy_e::SP_FIFO
+                || its_thread_scheduling.policy_ == scheduling_policy_e::SP_RR) {
+                if (its_thread_scheduling.priority_ < 1 || its_thread_scheduling.priority_ > 99) {
+                    VSOMEIP_WARNING << "Valid real-time scheduling priorities are 1-99 (" << _application_name << ")";
+                    its_thread_scheduling.priority_ = std::clamp(its_thread_scheduling.priority_, 1, 99);
+                }
+            } else {
+                its_thread_scheduling.priority_ = 0;
+            }
+            its_scheduling[found_type->second] = its_thread_scheduling;
+        }
+    } catch (...) {
+        VSOMEIP_ERROR << "Invalid thread scheduling configuration for application " << _application_name;
+        return {};
+    }
+    return its_scheduling;
+}
+
 std::map<plugin_type_e, std::set<std::string>> configuration_impl::load_plugins(const boost::property_tree::ptree& _tree,
                                                                                 const std::string& _application_name) {
     std::map<plugin_type_e, std::set<std::string>> its_plugins;
@@ -1094,6 +1352,8 @@ void configuration_impl::load_tracing(const configuration_element& _element) {
                 load_trace_channels(i->second);
             } else if (its_key == "filters") {
                 load_trace_filters(i->second);
+            } else if (its_key == "capture") {
+                load_trace_capture(i->second);
             }
         }
     } catch (...) {
@@ -1101,6 +1361,34 @@ void configuration_impl::load_tracing(const configuration_element& _element) {
     }
 }
 
+void configuration_impl::load_trace_capture(const boost::property_tree::ptree& _tree) {
+    auto& its_capture = trace_->capture_;
+    for (auto i = _tree.begin(); i != _tree.end(); ++i) {
+        std::string its_key(i->first);
+        std::string its_value(i->second.data());
+        std::stringstream its_converter;
+        if (its_key == "enable") {
+            its_capture.is_enabled_ = (its_value == "true");
+        } else if (its_key == "hexstream") {
+            its_capture.is_hexstream_enabled_ = (its_value == "true");
+        } else if (its_key == "path") {
+            its_capture.path_ = its_value;
+        } else if (its_key == "snaplen") {
+            its_converter << std::dec << its_value;
+            its_converter >> its_capture.snaplen_;
+        } else if (its_key == "buffer-size") {
+            its_converter << std::dec << its_value;
+            its_converter >> its_capture.buffer_size_;
+        } else if (its_key == "file-size") {
+            its_converter << std::dec << its_value;
+            its_converter >> its_capture.file_size_;
+        } else if (its_key == "files") {
+            its_converter << std::dec << its_value;
+            its_converter >> its_capture.file_count_;
+        }
+    }
+}
+
 void configuration_impl::load_trace_channels(const boost::property_tree::ptree& _tree) {
     try {
         for (auto i = _tree.begin(); i != _tree.end(); ++i) {
@@ -1839,86 +2127,40 @@ void configuration_impl::load_npdu_default_timings(const configuration_element&
 
 void configuration_impl::load_services(const configuration_element& _element) {
     std::scoped_lock its_lock(services_mutex_);
+    if (_element.services_) {
+        // Taken from the configuration cache
+        for (const auto& s : *_element.services_)
+            load_service(s, default_unicast_);
+        return;
+    }
     try {
         auto its_services = _element.tree_.get_child("services");
-        for (auto i = its_services.begin(); i != its_services.end(); ++i)
-            load_service(i->second, default_unicast_);
+        for (auto i = its_services.begin(); i != its_services.end(); ++i) {
+            try {
+                load_service(service_definition::parse(i->second), default_unicast_);
+            } catch (...) {
+                // Intentionally left empty
+            }
+        }
     } catch (...) {
         // intentionally left empty
     }
 }
 
-void configuration_impl::load_service(const boost::property_tree::ptree& _tree, const std::string& _unicast_address) {
+void configuration_impl::load_service(const service_definition& _definition, const std::string& _unicast_address) {
     try {
         bool is_loaded(true);
-        bool use_magic_cookies(false);
-        service_t service_id(0);
-        instance_t instance_id(0);
-
-        auto its_service = std::make_shared<service>(service_id, instance_id);
-        its_service->reliable_ = its_service->unreliable_ = ILLEGAL_PORT;
-        its_service->unicast_address_ = _unicast_address;
-        its_service->protocol_ = "someip";
-
-        for (auto i = _tree.begin(); i != _tree.end(); ++i) {
-            std::string its_key(i->first);
-            std::string its_value(i->second.data());
-            std::stringstream its_converter;
-
-            if (its_key == "unicast") {
-                its_service->unicast_address_ = its_value;
-            } else if (its_key == "reliable") {
-                try {
-                    its_value = i->second.get_child("port").data();
-                    its_converter << its_value;
-                    its_converter >> its_service->reliable_;
-                } catch (...) {
-                    its_converter << its_value;
-                    its_converter >> its_service->reliable_;
-                }
-                if (!its_service->reliable_) {
-                    its_service->reliable_ = ILLEGAL_PORT;
-                }
-                try {
-                    its_value = i->second.get_child("enable-magic-cookies").data();
-                    use_magic_cookies = ("true" == its_value);
-                } catch (...) {
-                    // intentionally left empty
-                }
-            } else if (its_key == "unreliable") {
-                its_converter << its_value;
-                its_converter >> its_service->unreliable_;
-                if (!its_service->unreliable_) {
-                    its_service->unreliable_ = ILLEGAL_PORT;
-                }
-            } else if (its_key == "protocol") {
-                its_service->protocol_ = its_value;
-            } else if (its_key == "events") {
-                load_event(its_service, i->second);
-            } else if (its_key == "eventgroups") {
-                load_eventgroup(its_service, i->second);
-            } else if (its_key == "debounce-times") {
-                load_npdu_debounce_times_configuration(its_service, i->second);
-            } else if (its_key == "someip-tp") {
-                load_someip_tp(its_service, i->second);
-            } else {
-                // Trim "its_value"
-                if (its_value.size() > 1 && its_value[0] == '0' && its_value[1] == 'x') {
-                    its_converter << std::hex << its_value;
-                } else {
-                    its_converter << std::dec << its_value;
-                }
 
-                if (its_key == "service") {
-                    its_converter >> service_id;
-                } else if (its_key == "instance") {
-                    its_converter >> instance_id;
-                }
-            }
-        }
+        auto its_service = std::make_shared<service>(_definition.service_, _definition.instance_);
+        its_service->unicast_address_ = _definition.unicast_address_.value_or(_unicast_address);
+        its_service->reliable_ = _definition.reliable_;
+        its_service->unreliable_ = _definition.unreliable_;
+        its_service->protocol_ = _definition.protocol_;
 
-        // Initialize service_instance_ from the loaded service and instance values
-        its_service->service_instance_ = service_instance_t(service_id, instance_id);
+        load_event(its_service, _definition);
+        load_eventgroup(its_service, _definition);
+        load_npdu_debounce_times_configuration(its_service, _definition);
+        load_someip_tp(its_service, _definition);
 
         if (services_.contains(its_service->service_instance_)) {
             VSOMEIP_WARNING << "Multiple configurations for service [" << hex4(its_service->service_instance_.service()) << "."
@@ -1928,7 +2170,7 @@ void configuration_impl::load_service(const boost::property_tree::ptree& _tree,
 
         if (is_loaded) {
             services_[its_service->service_instance_] = its_service;
-            if (use_magic_cookies) {
+            if (_definition.use_magic_cookies_) {
                 magic_cookies_[its_service->unicast_address_].insert(its_service->reliable_);
             }
 
@@ -1965,130 +2207,53 @@ void configuration_impl::load_service(const boost::property_tree::ptree& _tree,
     }
 }
 
-void configuration_impl::load_event(std::shared_ptr<service>& _service, const boost::property_tree::ptree& _tree) {
-    for (auto i = _tree.begin(); i != _tree.end(); ++i) {
-        event_t its_event_id(0);
-        bool its_is_field(false);
-        reliability_type_e its_reliability(reliability_type_e::RT_UNKNOWN);
-        uint32_t its_cycle_value;
-        std::chrono::milliseconds its_cycle(std::chrono::milliseconds::zero());
-        bool its_change_resets_cycle(false);
-        bool its_update_on_change(true);
-
-        for (auto j = i->second.begin(); j != i->second.end(); ++j) {
-            std::string its_key(j->first);
-            std::string its_value(j->second.data());
-            if (its_key == "event") {
-                std::stringstream its_converter;
-                if (its_value.size() > 1 && its_value[0] == '0' && its_value[1] == 'x') {
-                    its_converter << std::hex << its_value;
-                } else {
-                    its_converter << std::dec << its_value;
-                }
-                its_converter >> its_event_id;
-            } else if (its_key == "is_field") {
-                its_is_field = (its_value == "true");
-            } else if (its_key == "is_reliable") {
-                if (its_value == "true")
-                    its_reliability = reliability_type_e::RT_RELIABLE;
-                else
+void configuration_impl::load_event(std::shared_ptr<service>& _service, const service_definition& _definition) {
+    for (const auto& e : _definition.events_) {
+        auto found_event = _service->events_.find(e.id_);
+        if (found_event != _service->events_.end()) {
+            VSOMEIP_INFO << "Multiple configurations for event [" << hex4(_service->service_instance_.service()) << "."
+                         << hex4(_service->service_instance_.instance()) << "." << hex4(e.id_) << "].";
+        } else {
+            reliability_type_e its_reliability(e.reliability_);
+            // If event reliability type was not configured,
+            if (its_reliability == reliability_type_e::RT_UNKNOWN) {
+                if (_service->unreliable_ != ILLEGAL_PORT) {
                     its_reliability = reliability_type_e::RT_UNRELIABLE;
-            } else if (its_key == "cycle") {
-                std::stringstream its_converter;
-                its_converter << std::dec << its_value;
-                its_converter >> its_cycle_value;
-                its_cycle = std::chrono::milliseconds(its_cycle_value);
-            } else if (its_key == "change_resets_cycle") {
-                its_change_resets_cycle = (its_value == "true");
-            } else if (its_key == "update_on_change") {
-                its_update_on_change = (its_value == "true");
-            }
-        }
-
-        if (its_event_id > 0) {
-            auto found_event = _service->events_.find(its_event_id);
-            if (found_event != _service->events_.end()) {
-                VSOMEIP_INFO << "Multiple configurations for event [" << hex4(_service->service_instance_.service()) << "."
-                             << hex4(_service->service_instance_.instance()) << "." << hex4(its_event_id) << "].";
-            } else {
-                // If event reliability type was not configured,
-                if (its_reliability == reliability_type_e::RT_UNKNOWN) {
-                    if (_service->unreliable_ != ILLEGAL_PORT) {
-                        its_reliability = reliability_type_e::RT_UNRELIABLE;
-                    } else if (_service->reliable_ != ILLEGAL_PORT) {
-                        its_reliability = reliability_type_e::RT_RELIABLE;
-                    }
-                    VSOMEIP_WARNING << "Reliability type for event [" << hex4(_service->service_instance_.service()) << "."
-                                    << hex4(_service->service_instance_.instance()) << "." << hex4(its_event_id)
-                                    << "] was not configured Using : "
-                                    << ((its_reliability == reliability_type_e::RT_RELIABLE) ? "RT_RELIABLE" : "RT_UNRELIABLE");
+                } else if (_service->reliable_ != ILLEGAL_PORT) {
+                    its_reliability = reliability_type_e::RT_RELIABLE;
                 }
-
-                auto its_event = std::make_shared<event>(its_event_id, its_is_field, its_reliability, its_cycle, its_change_resets_cycle,
-                                                         its_update_on_change);
-                _service->events_[its_event_id] = its_event;
+                VSOMEIP_WARNING << "Reliability type for event [" << hex4(_service->service_instance_.service()) << "."
+                                << hex4(_service->service_instance_.instance()) << "." << hex4(e.id_) << "] was not configured Using : "
+                                << ((its_reliability == reliability_type_e::RT_RELIABLE) ? "RT_RELIABLE" : "RT_UNRELIABLE");
             }
+
+            auto its_event = std::make_shared<event>(e.id_, e.is_field_, its_reliability, std::chrono::milliseconds(e.cycle_),
+                                                     e.change_resets_cycle_, e.update_on_change_);
+            _service->events_[e.id_] = its_event;
         }
     }
 }
 
-void configuration_impl::load_eventgroup(std::shared_ptr<service>& _service, const boost::property_tree::ptree& _tree) {
-    for (auto i = _tree.begin(); i != _tree.end(); ++i) {
+void configuration_impl::load_eventgroup(std::shared_ptr<service>& _service, const service_definition& _definition) {
+    for (const auto& g : _definition.eventgroups_) {
         auto its_eventgroup = std::make_shared<eventgroup>();
-        for (auto j = i->second.begin(); j != i->second.end(); ++j) {
-            std::stringstream its_converter;
-            std::string its_key(j->first);
-            std::string its_value(j->second.data());
-            if (its_key == "eventgroup") {
-                if (its_value.size() > 1 && its_value[0] == '0' && its_value[1] == 'x') {
-                    its_converter << std::hex << its_value;
-                } else {
-                    its_converter << std::dec << its_value;
-                }
-                its_converter >> its_eventgroup->id_;
-            } else if (its_key == "multicast") {
-                try {
-                    std::string its_value_inner = j->second.get_child("address").data();
-                    its_eventgroup->multicast_address_ = its_value_inner;
-                    its_value_inner = j->second.get_child("port").data();
-                    its_converter << its_value_inner;
-                    its_converter >> its_eventgroup->multicast_port_;
-                } catch (...) {
-                    // intentionally left empty
-                }
-            } else if (its_key == "threshold") {
-                int its_threshold(0);
-                its_converter << std::dec << its_value;
-                its_converter >> std::dec >> its_threshold;
-                its_eventgroup->threshold_ = (its_threshold > std::numeric_limits<std::uint8_t>::max())
-                        ? std::numeric_limits<std::uint8_t>::max()
-                        : static_cast<uint8_t>(its_threshold);
-            } else if (its_key == "events") {
-                for (auto k = j->second.begin(); k != j->second.end(); ++k) {
-                    std::string its_value_inner(k->second.data());
-                    event_t its_event_id(0);
-                    if (its_value_inner.size() > 1 && its_value_inner[0] == '0' && its_value_inner[1] == 'x') {
-                        its_converter << std::hex << its_value_inner;
-                    } else {
-                        its_converter << std::dec << its_value_inner;
-                    }
-                    its_converter >> its_event_id;
-                    if (0 < its_event_id) {
-                        std::shared_ptr<event> its_event(nullptr);
-                        auto find_event = _service->events_.find(its_event_id);
-                        if (find_event != _service->events_.end()) {
-                            its_event = find_event->second;
-                        } else {
-                            its_event = std::make_shared<event>(its_event_id, false, reliability_type_e::RT_UNRELIABLE,
-                                                                std::chrono::milliseconds::zero(), false, true);
-                        }
-                        if (its_event) {
-                            its_event->groups_.push_back(its_eventgroup);
-                            its_eventgroup->events_.insert(its_event);
-                            _service->events_[its_event_id] = its_event;
-                        }
-                    }
-                }
+        its_eventgroup->id_ = g.id_;
+        its_eventgroup->multicast_address_ = g.multicast_address_;
+        its_eventgroup->multicast_port_ = g.multicast_port_;
+        its_eventgroup->threshold_ = g.threshold_;
+        for (const auto its_event_id : g.events_) {
+            std::shared_ptr<event> its_event(nullptr);
+            auto find_event = _service->events_.find(its_event_id);
+            if (find_event != _service->events_.end()) {
+                its_event = find_event->second;
+            } else {
+                its_event = std::make_shared<event>(its_event_id, false, reliability_type_e::RT_UNRELIABLE, std::chrono::milliseconds::zero(),
+                                                    false, true);
+            }
+            if (its_event) {
+                its_event->groups_.push_back(its_eventgroup);
+                its_eventgroup->events_.insert(its_event);
+                _service->events_[its_event_id] = its_event;
             }
         }
 
@@ -2327,6 +2492,37 @@ void configuration_impl::load_request_debounce_time(const configuration_element&
     }
 }
 
+void configuration_impl::load_event_cycles(const configuration_element& _element) {
+    try {
+        auto its_event_cycles = _element.tree_.get_child("event-cycles");
+        if (is_configured_[ET_EVENT_CYCLES]) {
+            VSOMEIP_WARNING << "Multiple definitions for event-cycles. Ignoring definition from " << _element.name_;
+        } else {
+            for (const auto& i : its_event_cycles) {
+                std::string its_key(i.first);
+                std::string its_value(i.second.data());
+                if (its_key == "resolution") {
+                    std::stringstream its_converter;
+                    its_converter << std::dec << its_value;
+                    std::uint32_t its_resolution(0);
+                    its_converter >> its_resolution;
+                    if (its_resolution > 0) {
+                        event_cycle_resolution_ = std::chrono::milliseconds(its_resolution);
+                    } else {
+                        VSOMEIP_WARNING << "Invalid event-cycles.resolution \"" << its_value << "\". Ignoring definition from "
+                                        << _element.name_;
+                    }
+                } else if (its_key == "phase-spreading") {
+                    is_event_cycle_spreading_ = (its_value == "true");
+                }
+            }
+            is_configured_[ET_EVENT_CYCLES] = true;
+        }
+    } catch (...) {
+        // intentionally left empty!
+    }
+}
+
 void configuration_impl::load_payload_sizes(const configuration_element& _element) {
     const std::string payload_sizes("payload-sizes");
     const std::string max_local_payload_size("max-payload-size-local");
@@ -2483,11 +2679,6 @@ void configuration_impl::load_security(const configuration_element& _element) {
     } catch (...) {
         // intentionally left empty
     }
-
-#ifndef VSOMEIP_DISABLE_SECURITY
-    if (!is_security_external())
-        policy_manager_->load(_element);
-#endif // !VSOMEIP_DISABLE_SECURITY
 }
 
 void configuration_impl::load_selective_broadcasts_support(const configuration_element& _element) {
@@ -2686,10 +2877,9 @@ std::string configuration_impl::get_unicast_address(service_t _service, instance
 }
 
 uint16_t configuration_impl::get_reliable_port(service_t _service, instance_t _instance) const {
-    std::scoped_lock its_lock(services_mutex_);
     uint16_t its_reliable(ILLEGAL_PORT);
 
-    if (auto its_service = find_service_unlocked({_service, _instance}); its_service) {
+    if (auto its_service = find_service({_service, _instance}); its_service) {
         its_reliable = its_service->reliable_;
     }
 
@@ -2697,10 +2887,9 @@ uint16_t configuration_impl::get_reliable_port(service_t _service, instance_t _i
 }
 
 uint16_t configuration_impl::get_unreliable_port(service_t _service, instance_t _instance) const {
-    std::scoped_lock its_lock(services_mutex_);
     uint16_t its_unreliable = ILLEGAL_PORT;
 
-    if (auto its_service = find_service_unlocked({_service, _instance}); its_service) {
+    if (auto its_service = find_service({_service, _instance}); its_service) {
         its_unreliable = its_service->unreliable_;
     }
 
@@ -2749,6 +2938,10 @@ void configuration_impl::get_configured_timing_responses(service_t _service, con
     *_max_retention_time = npdu_default_max_retention_resp_;
 }
 
+std::uint32_t configuration_impl::get_service_generation() const {
+    return service_generation_.load(std::memory_order_acquire);
+}
+
 bool configuration_impl::is_someip(service_t _service, instance_t _instance) const {
     if (auto its_service = find_service({_service, _instance}); its_service)
         return (its_service->protocol_ == "someip");
@@ -2957,6 +3150,15 @@ std::size_t configuration_impl::get_max_dispatch_time(const std::string& _name)
     return its_max_dispatch_time;
 }
 
+std::size_t configuration_impl::get_handler_time_budget(const std::string& _name) const {
+    size_t its_handler_time_budget{VSOMEIP_DEFAULT_HANDLER_TIME_BUDGET};
+    auto found_application = applications_.find(_name);
+    if (found_application != applications_.end()) {
+        its_handler_time_budget = found_application->second.handler_time_budget_;
+    }
+    return its_handler_time_budget;
+}
+
 bool configuration_impl::has_session_handling(const std::string& _name) const {
 
     bool its_value(true);
@@ -2968,11 +3170,47 @@ bool configuration_impl::has_session_handling(const std::string& _name) const {
     return its_value;
 }
 
+io_shards_config_t configuration_impl::get_io_shards(const std::string& _name) const {
+    io_shards_config_t its_shards;
+
+    auto found_application = applications_.find(_name);
+    if (found_application != applications_.end()) {
+        its_shards = found_application->second.io_shards_;
+    }
+
+    return its_shards;
+}
+
+thread_scheduling_t configuration_impl::get_thread_scheduling(const std::string& _name, thread_type_e _type) const {
+    thread_scheduling_t its_scheduling;
+
+    auto found_application = applications_.find(_name);
+    if (found_application != applications_.end()) {
+        auto found_type = found_application->second.thread_scheduling_.find(_type);
+        if (found_type != found_application->second.thread_scheduling_.end()) {
+            its_scheduling = found_type->second;
+        }
+    }
+
+    return its_scheduling;
+}
+
+local_coalescing_t configuration_impl::get_local_coalescing(const std::string& _name) const {
+    local_coalescing_t its_coalescing;
+
+    auto found_application = applications_.find(_name);
+    if (found_application != applications_.end()) {
+        its_coalescing = found_application->second.local_coalescing_;
+    }
+
+    return its_coalescing;
+}
+
 std::set<std::pair<service_t, instance_t>> configuration_impl::get_remote_services() const {
-    std::scoped_lock its_lock(services_mutex_);
+    const auto its_index = service_index_.load();
     std::set<std::pair<service_t, instance_t>> its_remote_services;
 
-    for (const auto& [key, service] : services_) {
+    for (const auto& [key, service] : its_index->services_) {
         if (is_remote(service)) {
             its_remote_services.insert(std::make_pair(key.service(), key.instance()));
         }
@@ -3053,9 +3291,8 @@ void configuration_impl::get_event_update_properties(service_t _service, instanc
                                                      std::chrono::milliseconds& _cycle, bool& _change_resets_cycle,
                                                      bool& _update_on_change) const {
 
-    const auto search = services_.find(service_instance_t{_service, _instance});
-    if (search != services_.end()) {
-        const auto its_events = search->second->events_;
+    if (const auto its_service = find_service({_service, _instance}); its_service) {
+        const auto& its_events = its_service->events_;
         const auto find_event = its_events.find(_event);
         if (find_event != its_events.end()) {
             _cycle = find_event->second->cycle_;
@@ -3194,10 +3431,9 @@ bool configuration_impl::find_specific_port(uint16_t& _port, service_t _service,
 }
 
 reliability_type_e configuration_impl::get_event_reliability(service_t _service, instance_t _instance, event_t _event) const {
-    std::scoped_lock its_lock(services_mutex_);
     reliability_type_e its_reliability(reliability_type_e::RT_UNKNOWN);
 
-    if (auto its_service = find_service_unlocked({_service, _instance}); its_service) {
+    if (auto its_service = find_service({_service, _instance}); its_service) {
         if (auto its_event = its_service->events_.find(_event); its_event != its_service->events_.end()) {
             its_reliability = its_event->second->reliability_;
         }
@@ -3206,10 +3442,9 @@ reliability_type_e configuration_impl::get_event_reliability(service_t _service,
 }
 
 reliability_type_e configuration_impl::get_service_reliability(service_t _service, instance_t _instance) const {
-    std::scoped_lock its_lock(services_mutex_);
     reliability_type_e its_reliability(reliability_type_e::RT_UNKNOWN);
 
-    if (auto its_service = find_service_unlocked({_service, _instance}); its_service) {
+    if (auto its_service = find_service({_service, _instance}); its_service) {
         if (its_service->reliable_ != ILLEGAL_PORT) {
             if (its_service->unreliable_ != ILLEGAL_PORT) {
                 its_reliability = reliability_type_e::RT_BOTH;
@@ -3224,13 +3459,9 @@ reliability_type_e configuration_impl::get_service_reliability(service_t _servic
 }
 
 std::shared_ptr<service> configuration_impl::find_service(service_instance_t _si) const {
-    std::scoped_lock its_lock(services_mutex_);
-    return find_service_unlocked(_si);
-}
 
-std::shared_ptr<service> configuration_impl::find_service_unlocked(service_instance_t _si) const {
-
-    if (const auto search = services_.find(_si); search != services_.end()) {
+    const auto its_index = service_index_.load();
+    if (const auto search = its_index->services_.find(_si); search != its_index->services_.end()) {
         return search->second;
     }
 
@@ -3241,20 +3472,55 @@ std::shared_ptr<service> configuration_impl::find_service(service_t _service, co
 
     std::shared_ptr<service> its_service;
 
-    auto find_address = services_by_ip_port_.find(_address);
-    if (find_address != services_by_ip_port_.end()) {
-        auto find_port = find_address->second.find(_port);
-        if (find_port != find_address->second.end()) {
-            auto find_service = find_port->second.find(_service);
-            if (find_service != find_port->second.end()) {
-                its_service = find_service->second;
-            }
+    const auto its_index = service_index_.load();
+    auto find_address = its_index->services_by_ip_port_.find(_address);
+    if (find_address != its_index->services_by_ip_port_.end()) {
+        auto find_service = find_address->second.find(std::uint32_t(_port) << 16 | _service);
+        if (find_service != find_address->second.end()) {
+            its_service = find_service->second;
         }
     }
 
     return its_service;
 }
 
+void configuration_impl::update_service_index() {
+
+    std::scoped_lock its_lock(services_mutex_, partitions_mutex_, secure_services_mutex_);
+
+    auto its_index = std::make_shared<service_index>();
+    its_index->services_ = services_;
+    for (const auto& [its_address, its_ports] : services_by_ip_port_) {
+        auto& its_services = its_index->services_by_ip_port_[its_address];
+        for (const auto& [its_port, its_port_services] : its_ports) {
+            for (const auto& [its_service_id, its_service] : its_port_services) {
+                its_services[std::uint32_t(its_port) << 16 | its_service_id] = its_service;
+            }
+        }
+    }
+    its_index->partitions_ = partitions_;
+    for (const auto& [its_service_id, its_instances] : secure_services_) {
+        for (const auto its_instance : its_instances) {
+            its_index->secure_services_.emplace(its_service_id, its_instance);
+        }
+    }
+
+    service_index_.store(its_index);
+    service_generation_.fetch_add(1, std::memory_order_release);
+}
+
+void configuration_impl::replace_service_by_ip_port_unlocked(const std::shared_ptr<service>& _old, const std::shared_ptr<service>& _new) {
+
+    for (auto& [its_address, its_ports] : services_by_ip_port_) {
+        for (auto& [its_port, its_services] : its_ports) {
+            if (auto found_service = its_services.find(_old->service_instance_.service());
+                found_service != its_services.end() && found_service->second == _old) {
+                found_service->second = _new;
+            }
+        }
+    }
+}
+
 std::shared_ptr<eventgroup> configuration_impl::find_eventgroup(service_instance_t _si, eventgroup_t _eventgroup) const {
     std::shared_ptr<eventgroup> its_eventgroup;
 
@@ -3974,170 +4240,57 @@ void configuration_impl::load_activation_file_path(std::set<std::string>& _path,
     }
 }
 
-bool configuration_impl::load_npdu_debounce_times_configuration(const std::shared_ptr<service>& _service,
-                                                                const boost::property_tree::ptree& _tree) {
-    bool is_loaded(true);
-    try {
-        for (const auto& i : _tree) {
-            const std::string its_key(i.first);
-            if (its_key == "requests") {
-                if (!load_npdu_debounce_times_for_service(_service, true, i.second)) {
-                    is_loaded = false;
-                }
-            } else if (its_key == "responses") {
-                if (!load_npdu_debounce_times_for_service(_service, false, i.second)) {
-                    is_loaded = false;
-                }
-            }
+void configuration_impl::load_npdu_debounce_times_configuration(const std::shared_ptr<service>& _service,
+                                                                const service_definition& _definition) {
+    for (const auto& d : _definition.debounce_times_) {
+        const std::chrono::nanoseconds its_debounce_time(d.debounce_time_.value_or(npdu_default_debounce_requ_));
+        const std::chrono::nanoseconds its_retention_time(d.maximum_retention_time_.value_or(npdu_default_max_retention_requ_));
+        if (d.is_request_) {
+            _service->debounce_times_requests_[d.method_] = {its_debounce_time, its_retention_time};
+        } else {
+            _service->debounce_times_responses_[d.method_] = {its_debounce_time, its_retention_time};
         }
-    } catch (...) {
-        is_loaded = false;
     }
-    return is_loaded;
 }
 
-bool configuration_impl::load_npdu_debounce_times_for_service(const std::shared_ptr<service>& _service, bool _is_request,
-                                                              const boost::property_tree::ptree& _tree) {
-    const std::string dtime("debounce-time");
-    const std::string rtime("maximum-retention-time");
-
-    bool is_loaded(true);
-    try {
-        std::stringstream its_converter;
-        for (const auto& i : _tree) {
-            const std::string its_method_str(i.first.data());
-            if (its_method_str.size()) {
-                method_t its_method = 0xFFFF;
-                if (its_method_str.size() > 1 && its_method_str[0] == '0' && its_method_str[1] == 'x') {
-                    its_converter << std::hex << its_method_str;
-                } else {
-                    its_converter << std::dec << its_method_str;
-                }
-                its_converter >> its_method;
-                its_converter.str("");
-                its_converter.clear();
+void configuration_impl::load_someip_tp(const std::shared_ptr<service>& _service, const service_definition& _definition) {
+    for (const auto& t : _definition.someip_tp_) {
+        auto its_max_segment_length = t.max_segment_length_.value_or(std::uint16_t(VSOMEIP_TP_MAX_SEGMENT_LENGTH_DEFAULT));
 
-                std::chrono::nanoseconds its_debounce_time(npdu_default_debounce_requ_);
-                std::chrono::nanoseconds its_retention_time(npdu_default_max_retention_requ_);
-                for (const auto& j : i.second) {
-                    const std::string& key = j.first;
-                    const std::uint64_t value = std::strtoull(j.second.data().c_str(), NULL, 10) * 1000000;
-                    if (key == dtime) {
-                        its_debounce_time = std::chrono::nanoseconds(value);
-                    } else if (key == rtime) {
-                        its_retention_time = std::chrono::nanoseconds(value);
-                    }
-                }
-                if (_is_request) {
-                    _service->debounce_times_requests_[its_method] = {its_debounce_time, its_retention_time};
-                } else {
-                    _service->debounce_times_responses_[its_method] = {its_debounce_time, its_retention_time};
-                }
-            }
-        }
-    } catch (...) {
-        is_loaded = false;
-    }
-    return is_loaded;
-}
+        // Segment length must be multiple of 16
+        // Ensure this by subtracting the rest
+        auto its_rest = std::uint16_t(its_max_segment_length % 16);
+        if (its_rest != 0) {
+            VSOMEIP_WARNING << "SOMEIP/TP: max-segment-length must be multiple of 16. Corrected " << its_max_segment_length << " to "
+                            << its_max_segment_length - its_rest;
 
-void configuration_impl::load_someip_tp(const std::shared_ptr<service>& _service, const boost::property_tree::ptree& _tree) {
-    try {
-        for (const auto& i : _tree) {
-            const std::string its_key(i.first);
-            if (its_key == "client-to-service") {
-                load_someip_tp_for_service(_service, i.second, true);
-            } else if (its_key == "service-to-client") {
-                load_someip_tp_for_service(_service, i.second, false);
-            }
+            its_max_segment_length = std::uint16_t(its_max_segment_length - its_rest);
         }
-    } catch (...) {
-        // intentionally left empty
-    }
-}
 
-void configuration_impl::load_someip_tp_for_service(const std::shared_ptr<service>& _service, const boost::property_tree::ptree& _tree,
-                                                    bool _is_request) {
-    try {
-        std::stringstream its_converter;
-        for (const auto& method : _tree) {
-            method_t its_method(0);
-            uint16_t its_max_segment_length(VSOMEIP_TP_MAX_SEGMENT_LENGTH_DEFAULT);
-            uint32_t its_separation_time(0);
-
-            const std::string its_value(method.second.data());
-            if (its_value.empty()) {
-                for (const auto& its_data : method.second) {
-                    const std::string its_value_inner(its_data.second.data());
-                    if (!its_value_inner.empty()) {
-                        if (its_data.first == "method") {
-                            if (its_value_inner.size() > 1 && its_value_inner[0] == '0' && its_value_inner[1] == 'x') {
-                                its_converter << std::hex << its_value_inner;
-                            } else {
-                                its_converter << std::dec << its_value_inner;
-                            }
-                            its_converter >> its_method;
-                        } else if (its_data.first == "max-segment-length") {
-                            its_converter << std::dec << its_value_inner;
-                            its_converter >> its_max_segment_length;
-
-                            // Segment length must be multiple of 16
-                            // Ensure this by subtracting the rest
-                            auto its_rest = std::uint16_t(its_max_segment_length % 16);
-                            if (its_rest != 0) {
-                                VSOMEIP_WARNING << "SOMEIP/TP: max-segment-length must be multiple of 16. Corrected "
-                                                << its_max_segment_length << " to " << its_max_segment_length - its_rest;
-
-                                its_max_segment_length = std::uint16_t(its_max_segment_length - its_rest);
-                            }
-                        } else if (its_data.first == "separation-time") {
-                            its_converter << std::dec << its_value_inner;
-                            its_converter >> its_separation_time;
-                            its_separation_time *= std::uint32_t(1000);
-                        }
-                    }
-                    its_converter.str("");
-                    its_converter.clear();
-                }
-            } else {
-                if (its_value.size() > 1 && its_value[0] == '0' && its_value[1] == 'x') {
-                    its_converter << std::hex << its_value;
+        if (t.method_ != 0) {
+            if (t.is_request_) {
+                const auto its_entry = _service->tp_client_config_.find(t.method_);
+                if (its_entry == _service->tp_client_config_.end()) {
+                    _service->tp_client_config_[t.method_] = std::make_pair(its_max_segment_length, t.separation_time_);
                 } else {
-                    its_converter << std::dec << its_value;
+                    VSOMEIP_WARNING << "SOME/IP-TP: Multiple client configurations for method [" << hex4(_service->service_instance_.service())
+                                    << "." << hex4(_service->service_instance_.instance()) << "." << hex4(t.method_) << "]: using ("
+                                    << its_entry->second.first << ", " << its_entry->second.second << ")";
                 }
-                its_converter >> its_method;
-                its_converter.str("");
-                its_converter.clear();
-            }
-
-            if (its_method != 0) {
-                if (_is_request) {
-                    const auto its_entry = _service->tp_client_config_.find(its_method);
-                    if (its_entry == _service->tp_client_config_.end()) {
-                        _service->tp_client_config_[its_method] = std::make_pair(its_max_segment_length, its_separation_time);
-                    } else {
-                        VSOMEIP_WARNING << "SOME/IP-TP: Multiple client configurations for method ["
-                                        << hex4(_service->service_instance_.service()) << "."
-                                        << hex4(_service->service_instance_.instance()) << "." << hex4(its_method) << "]: using ("
-                                        << its_entry->second.first << ", " << its_entry->second.second << ")";
-                    }
+            } else {
+                const auto its_entry = _service->tp_service_config_.find(t.method_);
+                if (its_entry == _service->tp_service_config_.end()) {
+                    _service->tp_service_config_[t.method_] = std::make_pair(its_max_segment_length, t.separation_time_);
                 } else {
-                    const auto its_entry = _service->tp_service_config_.find(its_method);
-                    if (its_entry == _service->tp_service_config_.end()) {
-                        _service->tp_service_config_[its_method] = std::make_pair(its_max_segment_length, its_separation_time);
-                    } else {
-                        VSOMEIP_WARNING << "SOME/IP-TP: Multiple service configurations for method ["
-                                        << hex4(_service->service_instance_.service()) << "."
-                                        << hex4(_service->service_instance_.instance()) << "." << hex4(its_method) << "]: using ("
-                                        << its_entry->second.first << ", " << its_entry->second.second << ")";
-                    }
+                    VSOMEIP_WARNING << "SOME/IP-TP: Multiple service configurations for method ["
+                                    << hex4(_service->service_instance_.service()) << "." << hex4(_service->service_instance_.instance())
+                                    << "." << hex4(t.method_) << "]: using (" << its_entry->second.first << ", "
+                                    << its_entry->second.second << ")";
                 }
-            } else {
-                VSOMEIP_ERROR << "SOME/IP-TP configuration contains invalid entry. No valid method specified!";
             }
+        } else {
+            VSOMEIP_ERROR << "SOME/IP-TP configuration contains invalid entry. No valid method specified!";
         }
-    } catch (...) {
-        // intentionally left empty
     }
 }
 
@@ -4530,11 +4683,7 @@ void configuration_impl::set_sd_acceptance_rules_active(const boost::asio::ip::a
 }
 
 bool configuration_impl::is_secure_service(service_t _service, instance_t _instance) const {
-    std::scoped_lock its_lock(secure_services_mutex_);
-    const auto its_service = secure_services_.find(_service);
-    if (its_service != secure_services_.end())
-        return (its_service->second.contains(_instance));
-    return false;
+    return service_index_.load()->secure_services_.contains(service_instance_t{_service, _instance});
 }
 
 int configuration_impl::get_udp_receive_buffer_size() const {
@@ -4542,6 +4691,16 @@ int configuration_impl::get_udp_receive_buffer_size() const {
     return udp_receive_buffer_size_;
 }
 
+std::chrono::milliseconds configuration_impl::get_event_cycle_resolution() const {
+
+    return event_cycle_resolution_;
+}
+
+bool configuration_impl::is_event_cycle_spreading() const {
+
+    return is_event_cycle_spreading_;
+}
+
 bool configuration_impl::is_tp_client(service_t _service, instance_t _instance, method_t _method) const {
 
     bool ret(false);
@@ -4625,9 +4784,9 @@ partition_id_t configuration_impl::get_partition_id(service_t _service, instance
 
     partition_id_t its_id(VSOMEIP_DEFAULT_PARTITION_ID);
 
-    std::scoped_lock its_lock(partitions_mutex_);
-    const auto search = partitions_.find(service_instance_t{_service, _instance});
-    if (search != partitions_.end()) {
+    const auto its_index = service_index_.load();
+    const auto search = its_index->partitions_.find(service_instance_t{_service, _instance});
+    if (search != its_index->partitions_.end()) {
         its_id = search->second;
     }
 
@@ -0,0 +1,273 @@
+// Copyright (C) 2014-2026 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <cstdlib>
+#include <limits>
+#include <sstream>
+
+#include "../include/service_definition.hpp"
+
+namespace vsomeip_v3 {
+namespace cfg {
+
+namespace {
+
+void parse_events(service_definition& _service, const boost::property_tree::ptree& _tree) {
+    for (auto i = _tree.begin(); i != _tree.end(); ++i) {
+        service_definition::event_definition its_event;
+
+        for (auto j = i->second.begin(); j != i->second.end(); ++j) {
+            std::string its_key(j->first);
+            std::string its_value(j->second.data());
+            if (its_key == "event") {
+                std::stringstream its_converter;
+                if (its_value.size() > 1 && its_value[0] == '0' && its_value[1] == 'x') {
+                    its_converter << std::hex << its_value;
+                } else {
+                    its_converter << std::dec << its_value;
+                }
+                its_converter >> its_event.id_;
+            } else if (its_key == "is_field") {
+                its_event.is_field_ = (its_value == "true");
+            } else if (its_key == "is_reliable") {
+                if (its_value == "true")
+                    its_event.reliability_ = reliability_type_e::RT_RELIABLE;
+                else
+                    its_event.reliability_ = reliability_type_e::RT_UNRELIABLE;
+            } else if (its_key == "cycle") {
+                std::stringstream its_converter;
+                its_converter << std::dec << its_value;
+                its_converter >> its_event.cycle_;
+            } else if (its_key == "change_resets_cycle") {
+                its_event.change_resets_cycle_ = (its_value == "true");
+            } else if (its_key == "update_on_change") {
+                its_event.update_on_change_ = (its_value == "true");
+            }
+        }
+
+        if (its_event.id_ > 0) {
+            _service.events_.push_back(its_event);
+        }
+    }
+}
+
+void parse_eventgroups(service_definition& _service, const boost::property_tree::ptree& _tree) {
+    for (auto i = _tree.begin(); i != _tree.end(); ++i) {
+        service_definition::eventgroup_definition its_eventgroup;
+        for (auto j = i->second.begin(); j != i->second.end(); ++j) {
+            std::stringstream its_converter;
+            std::string its_key(j->first);
+            std::string its_value(j->second.data());
+            if (its_key == "eventgroup") {
+                if (its_value.size() > 1 && its_value[0] == '0' && its_value[1] == 'x') {
+                    its_converter << std::hex << its_value;
+                } else {
+                    its_converter << std::dec << its_value;
+                }
+                its_converter >> its_eventgroup.id_;
+            } else if (its_key == "multicast") {
+                try {
+                    std::string its_value_inner = j->second.get_child("address").data();
+                    its_eventgroup.multicast_address_ = its_value_inner;
+                    its_value_inner = j->second.get_child("port").data();
+                    its_converter << its_value_inner;
+                    its_converter >> its_eventgroup.multicast_port_;
+                } catch (...) {
+                    // intentionally left empty
+                }
+            } else if (its_key == "threshold") {
+                int its_threshold(0);
+                its_converter << std::dec << its_value;
+                its_converter >> std::dec >> its_threshold;
+                its_eventgroup.threshold_ = (its_threshold > std::numeric_limits<std::uint8_t>::max())
+                        ? std::numeric_limits<std::uint8_t>::max()
+                        : static_cast<uint8_t>(its_threshold);
+            } else if (its_key == "events") {
+                for (auto k = j->second.begin(); k != j->second.end(); ++k) {
+                    std::string its_value_inner(k->second.data());
+                    event_t its_event_id(0);
+                    if (its_value_inner.size() > 1 && its_value_inner[0] == '0' && its_value_inner[1] == 'x') {
+                        its_converter << std::hex << its_value_inner;
+                    } else {
+                        its_converter << std::dec << its_value_inner;
+                    }
+                    its_converter >> its_event_id;
+                    if (0 < its_event_id) {
+                        its_eventgroup.events_.push_back(its_event_id);
+                    }
+                }
+            }
+        }
+        _service.eventgroups_.push_back(std::move(its_eventgroup));
+    }
+}
+
+void parse_debounce_times(service_definition& _service, bool _is_request, const boost::property_tree::ptree& _tree) {
+    const std::string dtime("debounce-time");
+    const std::string rtime("maximum-retention-time");
+
+    try {
+        std::stringstream its_converter;
+        for (const auto& i : _tree) {
+            const std::string its_method_str(i.first.data());
+            if (its_method_str.size()) {
+                service_definition::debounce_time_definition its_times;
+                its_times.method_ = 0xFFFF;
+                its_times.is_request_ = _is_request;
+                if (its_method_str.size() > 1 && its_method_str[0] == '0' && its_method_str[1] == 'x') {
+                    its_converter << std::hex << its_method_str;
+                } else {
+                    its_converter << std::dec << its_method_str;
+                }
+                its_converter >> its_times.method_;
+                its_converter.str("");
+                its_converter.clear();
+
+                for (const auto& j : i.second) {
+                    const std::string& key = j.first;
+                    const std::uint64_t value = std::strtoull(j.second.data().c_str(), NULL, 10) * 1000000;
+                    if (key == dtime) {
+                        its_times.debounce_time_ = std::chrono::nanoseconds(value);
+                    } else if (key == rtime) {
+                        its_times.maximum_retention_time_ = std::chrono::nanoseconds(value);
+                    }
+                }
+                _service.debounce_times_.push_back(its_times);
+            }
+        }
+    } catch (...) {
+        // intentionally left empty
+    }
+}
+
+void parse_someip_tp(service_definition& _service, bool _is_request, const boost::property_tree::ptree& _tree) {
+    try {
+        std::stringstream its_converter;
+        for (const auto& method : _tree) {
+            service_definition::someip_tp_definition its_tp;
+            its_tp.is_request_ = _is_request;
+
+            const std::string its_value(method.second.data());
+            if (its_value.empty()) {
+                for (const auto& its_data : method.second) {
+                    const std::string its_value_inner(its_data.second.data());
+                    if (!its_value_inner.empty()) {
+                        if (its_data.first == "method") {
+                            if (its_value_inner.size() > 1 && its_value_inner[0] == '0' && its_value_inner[1] == 'x') {
+                                its_converter << std::hex << its_value_inner;
+                            } else {
+                                its_converter << std::dec << its_value_inner;
+                            }
+                            its_converter >> its_tp.method_;
+                        } else if (its_data.first == "max-segment-length") {
+                            std::uint16_t its_max_segment_length(0);
+                            its_converter << std::dec << its_value_inner;
+                            its_converter >> its_max_segment_length;
+                            its_tp.max_segment_length_ = its_max_segment_length;
+                        } else if (its_data.first == "separation-time") {
+                            its_converter << std::dec << its_value_inner;
+                            its_converter >> its_tp.separation_time_;
+                            its_tp.separation_time_ *= std::uint32_t(1000);
+                        }
+                    }
+                    its_converter.str("");
+                    its_converter.clear();
+                }
+            } else {
+                if (its_value.size() > 1 && its_value[0] == '0' && its_value[1] == 'x') {
+                    its_converter << std::hex << its_value;
+                } else {
+                    its_converter << std::dec << its_value;
+                }
+                its_converter >> its_tp.method_;
+                its_converter.str("");
+                its_converter.clear();
+            }
+            _service.someip_tp_.push_back(its_tp);
+        }
+    } catch (...) {
+        // intentionally left empty
+    }
+}
+
+} // namespace
+
+service_definition service_definition::parse(const boost::property_tree::ptree& _tree) {
+    service_definition its_service;
+
+    for (auto i = _tree.begin(); i != _tree.end(); ++i) {
+        std::string its_key(i->first);
+        std::string its_value(i->second.data());
+        std::stringstream its_converter;
+
+        if (its_key == "unicast") {
+            its_service.unicast_address_ = its_value;
+        } else if (its_key == "reliable") {
+            try {
+                its_value = i->second.get_child("port").data();
+                its_converter << its_value;
+                its_converter >> its_service.reliable_;
+            } catch (...) {
+                its_converter << its_value;
+                its_converter >> its_service.reliable_;
+            }
+            if (!its_service.reliable_) {
+                its_service.reliable_ = ILLEGAL_PORT;
+            }
+            try {
+                its_value = i->second.get_child("enable-magic-cookies").data();
+                its_service.use_magic_cookies_ = ("true" == its_value);
+            } catch (...) {
+                // intentionally left empty
+            }
+        } else if (its_key == "unreliable") {
+            its_converter << its_value;
+            its_converter >> its_service.unreliable_;
+            if (!its_service.unreliable_) {
+                its_service.unreliable_ = ILLEGAL_PORT;
+            }
+        } else if (its_key == "protocol") {
+            its_service.protocol_ = its_value;
+        } else if (its_key == "events") {
+            parse_events(its_service, i->second);
+        } else if (its_key == "eventgroups") {
+            parse_eventgroups(its_service, i->second);
+        } else if (its_key == "debounce-times") {
+            for (const auto& j : i->second) {
+                if (j.first == "requests") {
+                    parse_debounce_times(its_service, true, j.second);
+                } else if (j.first == "responses") {
+                    parse_debounce_times(its_service, false, j.second);
+                }
+            }
+        } else if (its_key == "someip-tp") {
+            for (const auto& j : i->second) {
+                if (j.first == "client-to-service") {
+                    parse_someip_tp(its_service, true, j.second);
+                } else if (j.first == "service-to-client") {
+                    parse_someip_tp(its_service, false, j.second);
+                }
+            }
+        } else {
+            // Trim "its_value"
+            if (its_value.size() > 1 && its_value[0] == '0' && its_value[1] == 'x') {
+                its_converter << std::hex << its_value;
+            } else {
+                its_converter << std::dec << its_value;
+            }
+
+            if (its_key == "service") {
+                its_converter >> its_service.service_;
+            } else if (its_key == "instance") {
+                its_converter >> its_service.instance_;
+            }
+        }
+    }
+
+    return its_service;
+}
+
+} // namespace cfg
+} // namespace vsomeip_v3
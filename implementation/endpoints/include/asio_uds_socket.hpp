@@ -40,8 +40,8 @@ private:
     void async_receive(boost::asio::mutable_buffer _buffer, rw_handler _handler) override {
         socket_.async_receive(_buffer, std::move(_handler));
     }
-    void async_write(boost::asio::const_buffer const& _buffer, rw_handler _handler) {
-        boost::asio::async_write(socket_, _buffer, std::move(_handler));
+    void async_write(std::vector<boost::asio::const_buffer> const& _buffers, rw_handler _handler) {
+        boost::asio::async_write(socket_, _buffers, std::move(_handler));
     }
     // needs to access the socket member to create a meaningful new connection
     friend class asio_uds_acceptor;
@@ -11,6 +11,8 @@
 #include <boost/asio/executor_work_guard.hpp>
 #include <boost/asio/io_context.hpp>
 
+#include "../../configuration/include/thread_scheduling.hpp"
+
 namespace vsomeip_v3 {
 
 // For TCP connections, we must accept them before processing the related
@@ -29,9 +31,10 @@ class auxiliary_context {
     boost::asio::io_context context_;
     std::thread thread_;
     const int thread_niceness_;
+    const thread_scheduling_t thread_scheduling_;
 
 public:
-    auxiliary_context(int thread_niceness);
+    auxiliary_context(int thread_niceness, const thread_scheduling_t& _thread_scheduling = {});
     ~auxiliary_context();
 
     boost::asio::io_context& get_context();
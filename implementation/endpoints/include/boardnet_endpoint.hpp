@@ -7,6 +7,7 @@
 
 #include <vsomeip/primitive_types.hpp>
 #include <vsomeip/constants.hpp>
+#include <vsomeip/structured_types.hpp>
 
 #include <boost/asio/ip/address.hpp>
 
@@ -47,6 +48,7 @@ public:
 
     virtual void print_status() = 0;
     virtual size_t get_queue_size() const = 0;
+    virtual void get_statistics(endpoint_statistics_t& _statistics) const = 0;
 
     virtual void set_established(bool _established) = 0;
     virtual void set_connected(bool _connected) = 0;
@@ -5,10 +5,15 @@
 
 #pragma once
 
+#include <algorithm>
 #include <array>
+#include <atomic>
 #include <chrono>
 #include <memory>
-#include <set>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include <boost/asio/io_context.hpp>
 #include <boost/asio/steady_timer.hpp>
@@ -16,6 +21,9 @@
 #include <vsomeip/defines.hpp>
 #include <vsomeip/primitive_types.hpp>
 
+#include "internal.hpp"
+#include "../../utility/include/snapshot.hpp"
+
 #if defined(_WIN32) && !defined(_MSVC_LANG)
 #define DEFAULT_NANOSECONDS_MAX 1000000000
 #else
@@ -32,16 +40,33 @@ struct train {
         buffer_(std::make_shared<message_buffer_t>()), minimal_debounce_time_(DEFAULT_NANOSECONDS_MAX),
         minimal_max_retention_time_(DEFAULT_NANOSECONDS_MAX), departure_(std::chrono::steady_clock::now() + std::chrono::hours(6)) {};
 
-    void reset() {
-        buffer_ = std::make_shared<message_buffer_t>();
+    // The previous buffer was handed over to the send queue and is replaced by _buffer
+    void reset(const message_buffer_ptr_t& _buffer) {
+        buffer_ = _buffer;
         passengers_.clear();
         minimal_debounce_time_ = DEFAULT_NANOSECONDS_MAX;
         minimal_max_retention_time_ = DEFAULT_NANOSECONDS_MAX;
         departure_ = std::chrono::steady_clock::now() + std::chrono::hours(6);
     }
 
+    bool has_passenger(service_t _service, method_t _method) const {
+        return std::find(passengers_.begin(), passengers_.end(), to_passenger(_service, _method)) != passengers_.end();
+    }
+
+    void add_passenger(service_t _service, method_t _method) {
+        const auto its_passenger = to_passenger(_service, _method);
+        if (std::find(passengers_.begin(), passengers_.end(), its_passenger) == passengers_.end()) {
+            passengers_.push_back(its_passenger);
+        }
+    }
+
+    static std::uint32_t to_passenger(service_t _service, method_t _method) {
+        return (static_cast<std::uint32_t>(_service) << 16) | _method;
+    }
+
     message_buffer_ptr_t buffer_;
-    std::set<std::pair<service_t, method_t>> passengers_;
+    // A train carries only a few messages, and clearing keeps the capacity
+    std::vector<std::uint32_t> passengers_;
 
     std::chrono::nanoseconds minimal_debounce_time_;
     std::chrono::nanoseconds minimal_max_retention_time_;
@@ -49,4 +74,159 @@ struct train {
     std::chrono::steady_clock::time_point departure_;
 };
 
+/**
+ * Trains and train buffers of a target that can be reused.
+ *
+ * A buffer is handed over to the send queue when its train departs. It is
+ * reused as soon as the pool holds the only reference again, that is, once
+ * it was sent. Reusing it keeps its capacity, so that a target with a steady
+ * traffic does not allocate.
+ *
+ * **Thread-safety**: Not thread-safe. The pool is guarded by the lock of the
+ * target it belongs to.
+ */
+class train_pool {
+public:
+    // Returns an empty train that departs with the passengers added next.
+    std::shared_ptr<train> get() {
+        std::shared_ptr<train> its_train;
+        if (trains_.empty()) {
+            its_train = std::make_shared<train>();
+            its_train->buffer_ = get_buffer();
+        } else {
+            its_train = std::move(trains_.back());
+            trains_.pop_back();
+            its_train->reset(get_buffer());
+        }
+        return its_train;
+    }
+
+    // Replaces the buffer of a train whose buffer was queued.
+    void reset(train& _train) { _train.reset(get_buffer()); }
+
+    // Takes back a train whose buffer was queued.
+    void release(std::shared_ptr<train>&& _train) {
+        if (trains_.size() < VSOMEIP_MAX_POOLED_TRAINS) {
+            _train->buffer_.reset();
+            trains_.push_back(std::move(_train));
+        }
+    }
+
+private:
+    message_buffer_ptr_t get_buffer() {
+        for (const auto& its_buffer : buffers_) {
+            if (its_buffer.use_count() == 1) {
+                // use_count() is a relaxed load, order the reuse after the
+                // release of the last other owner (e.g. a completed send)
+                std::atomic_thread_fence(std::memory_order_acquire);
+                its_buffer->clear();
+                return its_buffer;
+            }
+        }
+        auto its_buffer = std::make_shared<message_buffer_t>();
+        if (buffers_.size() < VSOMEIP_MAX_POOLED_TRAINS) {
+            buffers_.push_back(its_buffer);
+        }
+        return its_buffer;
+    }
+
+    std::vector<std::shared_ptr<train>> trains_;
+    std::vector<message_buffer_ptr_t> buffers_;
+};
+
+// Trains that wait for their departure, ordered by their departure. Trains
+// with the same departure keep the order they were dispatched in.
+class dispatched_trains {
+public:
+    bool empty() const { return trains_.empty(); }
+    std::size_t size() const { return trains_.size(); }
+
+    const std::shared_ptr<train>& front() const { return trains_.front(); }
+
+    void push(const std::shared_ptr<train>& _train) {
+        auto its_position = std::upper_bound(trains_.begin(), trains_.end(), _train->departure_,
+                                             [](const auto& _departure, const auto& _other) { return _departure < _other->departure_; });
+        trains_.insert(its_position, _train);
+    }
+
+    std::shared_ptr<train> pop() {
+        auto its_train = std::move(trains_.front());
+        trains_.erase(trains_.begin());
+        return its_train;
+    }
+
+    void clear() { trains_.clear(); }
+
+private:
+    // usually, only one or two trains are waiting
+    std::vector<std::shared_ptr<train>> trains_;
+};
+
+/**
+ * Debounce and maximum retention times per service and method.
+ *
+ * Looking them up in the configuration takes its service lock and needs the
+ * address of the endpoint as string, therefore they are looked up once per
+ * service and method and generation of the configured services. Remote
+ * offers change the services at runtime, the table is then rebuilt.
+ *
+ * The table is published as snapshot, so that sending only looks it up
+ * without locking. Misses copy the table under a mutex that serializes the
+ * writers, which happens once per service and method and generation.
+ *
+ * **Thread-safety**: All methods are thread-safe.
+ */
+class npdu_timings {
+public:
+    template<typename Loader>
+    void get(service_t _service, method_t _method, std::uint32_t _generation, std::chrono::nanoseconds& _debouncing,
+             std::chrono::nanoseconds& _retention, Loader&& _loader) {
+        const auto its_key = train::to_passenger(_service, _method);
+        if (auto its_timings = timings_.load(); its_timings && find(*its_timings, _generation, its_key, _debouncing, _retention)) {
+            return;
+        }
+
+        std::scoped_lock its_lock(mutex_);
+        auto its_timings = timings_.load();
+        if (its_timings && find(*its_timings, _generation, its_key, _debouncing, _retention)) {
+            return;
+        }
+        std::chrono::nanoseconds its_debouncing(0), its_retention(0);
+        _loader(&its_debouncing, &its_retention);
+
+        // The timings of an outdated generation are dropped
+        auto its_copy = (its_timings && its_timings->generation_ == _generation) ? std::make_shared<table_t>(*its_timings)
+                                                                                 : std::make_shared<table_t>();
+        its_copy->generation_ = _generation;
+        its_copy->timings_.emplace(its_key, std::make_pair(its_debouncing, its_retention));
+        timings_.store(std::move(its_copy));
+
+        _debouncing = its_debouncing;
+        _retention = its_retention;
+    }
+
+private:
+    struct table_t {
+        std::uint32_t generation_{0};
+        std::unordered_map<std::uint32_t, std::pair<std::chrono::nanoseconds, std::chrono::nanoseconds>> timings_;
+    };
+
+    static bool find(const table_t& _table, std::uint32_t _generation, std::uint32_t _key, std::chrono::nanoseconds& _debouncing,
+                     std::chrono::nanoseconds& _retention) {
+        if (_table.generation_ != _generation) {
+            return false;
+        }
+        auto found_timings = _table.timings_.find(_key);
+        if (found_timings == _table.timings_.end()) {
+            return false;
+        }
+        _debouncing = found_timings->second.first;
+        _retention = found_timings->second.second;
+        return true;
+    }
+
+    std::mutex mutex_;
+    snapshot<const table_t> timings_;
+};
+
 } // namespace vsomeip_v3
@@ -72,6 +72,7 @@ public:
     virtual bool is_reliable() const = 0;
 
     size_t get_queue_size() const;
+    void get_statistics(endpoint_statistics_t& _statistics) const override;
 
 public:
     void cancel_and_connect_cbk(boost::system::error_code const& _error);
@@ -102,6 +103,8 @@ protected:
     bool check_message_size(uint32_t _size) const;
     typename endpoint_impl<Protocol>::cms_ret_e segment_message(const std::uint8_t* const _data, std::uint32_t _size);
     bool check_queue_limit(const uint8_t* _data, std::uint32_t _size) const;
+    void get_configured_times(service_t _service, method_t _method, std::chrono::nanoseconds& _debouncing,
+                              std::chrono::nanoseconds& _maximum_retention);
     void queue_train(const std::shared_ptr<train>& _train);
     void update_last_departure();
     bool ensure_connected(const boost::system::error_code& _error);
@@ -127,8 +130,9 @@ protected:
     std::atomic<uint32_t> connecting_timeout_;
 
     // send data
+    train_pool trains_;
     std::shared_ptr<train> train_;
-    std::map<std::chrono::steady_clock::time_point, std::deque<std::shared_ptr<train>>> dispatched_trains_;
+    dispatched_trains dispatched_trains_;
     boost::asio::steady_timer dispatch_timer_;
     std::chrono::steady_clock::time_point last_departure_;
     std::atomic<bool> has_last_departure_;
@@ -153,6 +157,8 @@ private:
 
     void schedule_train();
 
+    npdu_timings configured_times_;
+
     void start_dispatch_timer(const std::chrono::steady_clock::time_point& _now);
     void cancel_dispatch_timer();
     void recreate_socket();
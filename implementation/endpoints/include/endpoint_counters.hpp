@@ -0,0 +1,73 @@
+// Copyright (C) 2014-2026 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+#include <vsomeip/structured_types.hpp>
+
+namespace vsomeip_v3 {
+
+/**
+ * Runtime counters of a boardnet endpoint.
+ *
+ * The counters are updated by the threads that send or receive on the
+ * endpoint, mostly while they already hold the endpoint's own locks. They
+ * only need to be eventually consistent, therefore all accesses are relaxed
+ * and the counters never synchronize with anything else.
+ */
+class endpoint_counters {
+public:
+    inline void on_send(std::size_t _size, bool _is_accepted) {
+        if (_is_accepted) {
+            messages_sent_.fetch_add(1, std::memory_order_relaxed);
+            bytes_sent_.fetch_add(_size, std::memory_order_relaxed);
+        } else {
+            messages_dropped_.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    inline void on_receive(std::size_t _size) {
+        messages_received_.fetch_add(1, std::memory_order_relaxed);
+        bytes_received_.fetch_add(_size, std::memory_order_relaxed);
+    }
+
+    inline void on_queue_size(std::size_t _size) {
+        auto its_mark = queue_size_high_water_mark_.load(std::memory_order_relaxed);
+        while (its_mark < _size && !queue_size_high_water_mark_.compare_exchange_weak(its_mark, _size, std::memory_order_relaxed)) { }
+    }
+
+    inline void on_tp_segment(bool _is_complete) {
+        tp_segments_received_.fetch_add(1, std::memory_order_relaxed);
+        if (_is_complete) {
+            tp_messages_reassembled_.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    inline void get(endpoint_statistics_t& _statistics) const {
+        _statistics.messages_sent_ = messages_sent_.load(std::memory_order_relaxed);
+        _statistics.bytes_sent_ = bytes_sent_.load(std::memory_order_relaxed);
+        _statistics.messages_received_ = messages_received_.load(std::memory_order_relaxed);
+        _statistics.bytes_received_ = bytes_received_.load(std::memory_order_relaxed);
+        _statistics.messages_dropped_ = messages_dropped_.load(std::memory_order_relaxed);
+        _statistics.queue_size_high_water_mark_ = queue_size_high_water_mark_.load(std::memory_order_relaxed);
+        _statistics.tp_segments_received_ = tp_segments_received_.load(std::memory_order_relaxed);
+        _statistics.tp_messages_reassembled_ = tp_messages_reassembled_.load(std::memory_order_relaxed);
+    }
+
+private:
+    std::atomic<std::uint64_t> messages_sent_{0};
+    std::atomic<std::uint64_t> bytes_sent_{0};
+    std::atomic<std::uint64_t> messages_received_{0};
+    std::atomic<std::uint64_t> bytes_received_{0};
+    std::atomic<std::uint64_t> messages_dropped_{0};
+    std::atomic<std::size_t> queue_size_high_water_mark_{0};
+    std::atomic<std::uint64_t> tp_segments_received_{0};
+    std::atomic<std::uint64_t> tp_messages_reassembled_{0};
+};
+
+} // namespace vsomeip_v3
@@ -14,6 +14,7 @@
 
 #include "buffer.hpp"
 #include "boardnet_endpoint.hpp"
+#include "endpoint_counters.hpp"
 #include "../../configuration/include/configuration.hpp"
 
 namespace vsomeip_v3 {
@@ -42,6 +43,7 @@ public:
     virtual void print_status() = 0;
 
     virtual size_t get_queue_size() const = 0;
+    void get_statistics(endpoint_statistics_t& _statistics) const override;
 
 public:
     // required
@@ -50,7 +52,7 @@ public:
     virtual void restart(bool _force) = 0;
 
 protected:
-    uint32_t find_magic_cookie(byte_t* _buffer, size_t _size);
+    uint32_t find_magic_cookie(const byte_t* _buffer, size_t _size);
     instance_t get_instance(service_t _service);
 
 protected:
@@ -74,6 +76,8 @@ protected:
     std::shared_ptr<configuration> configuration_;
 
     bool is_supporting_someip_tp_;
+
+    endpoint_counters counters_;
 };
 
 } // namespace vsomeip_v3
@@ -17,6 +17,7 @@
 #include <boost/asio/io_context.hpp>
 #include <vsomeip/primitive_types.hpp>
 #include <vsomeip/enumeration_types.hpp>
+#include <vsomeip/structured_types.hpp>
 #include "local_endpoint_manager_host.hpp"
 
 namespace vsomeip_v3 {
@@ -75,6 +76,7 @@ public:
     // Statistics
     void log_client_states() const;
     void print_status() const;
+    void get_statistics(std::vector<endpoint_statistics_t>& _statistics) const;
 
     uint32_t provider_connection_token(client_t _client) const;
 
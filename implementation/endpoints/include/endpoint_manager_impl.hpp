@@ -13,6 +13,7 @@
 #include "../include/boardnet_endpoint_host.hpp"
 #include "../include/endpoint_manager_base.hpp"
 #include "../include/auxiliary_context.hpp"
+#include "../include/io_shards.hpp"
 #include "../include/local_endpoint.hpp"
 #include "../include/endpoint_definition.hpp"
 #include "../../utility/include/service_instance_map.hpp"
@@ -43,7 +44,8 @@ public:
                                  const std::shared_ptr<endpoint_definition>& _ep_definition_unreliable);
     void clear_remote_service_info(service_t _service, instance_t _instance, bool _reliable);
 
-    std::shared_ptr<boardnet_endpoint> create_server_endpoint(uint16_t _port, bool _reliable, bool _start);
+    std::shared_ptr<boardnet_endpoint> create_server_endpoint(uint16_t _port, bool _reliable, bool _start, service_t _service,
+                                                              instance_t _instance);
 
     std::shared_ptr<boardnet_endpoint> find_server_endpoint(uint16_t _port, bool _reliable) const;
 
@@ -59,6 +61,7 @@ public:
     bool supports_selective(service_t _service, instance_t _instance) const;
 
     void print_status() const;
+    void get_statistics(std::vector<endpoint_statistics_t>& _statistics) const;
 
     bool create_routing_root(std::shared_ptr<local_server>& _root, const transport_protocol_e& _type, bool& _is_socket_activated,
                              const std::shared_ptr<routing_host>& _host);
@@ -111,7 +114,8 @@ private:
     std::shared_ptr<boardnet_endpoint> find_remote_client(service_t _service, instance_t _instance, bool _reliable);
     std::shared_ptr<boardnet_endpoint> create_remote_client(service_t _service, instance_t _instance, bool _reliable);
     std::shared_ptr<boardnet_endpoint> create_client_endpoint(const boost::asio::ip::address& _address, uint16_t _local_port,
-                                                              uint16_t _remote_port, bool _reliable);
+                                                              uint16_t _remote_port, bool _reliable, service_t _service,
+                                                              instance_t _instance);
 
     // routing root creation helpers
     bool create_local_uds_acceptor(std::shared_ptr<local_acceptor>& _uds_acceptor, const std::string& _endpoint_path,
@@ -142,6 +146,9 @@ private:
     bool const is_local_routing_;
     bool const is_uds_preferred_;
 
+    // declared before the endpoints, as these reference the shard contexts
+    io_shards io_shards_;
+
     mutable std::recursive_mutex endpoint_mutex_;
     // Client endpoints for remote services
     service_instance_map<std::map<bool, std::shared_ptr<endpoint_definition>>> remote_service_info_;
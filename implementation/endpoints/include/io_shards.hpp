@@ -0,0 +1,133 @@
+// Copyright (C) 2014-2026 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <future>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <boost/asio/executor_work_guard.hpp>
+#include <boost/asio/io_context.hpp>
+
+#include <vsomeip/primitive_types.hpp>
+
+#include "../../configuration/include/io_shards_config.hpp"
+#include "../../configuration/include/thread_scheduling.hpp"
+
+namespace vsomeip_v3 {
+
+/**
+ * @class io_shards
+ * @brief I/O contexts that are each run by a single thread.
+ *
+ * All endpoints of an application usually share the io_context that is run
+ * by its io threads. With shards, the endpoints of a service instance are
+ * assigned to one of several io_contexts, each of which is run by a single,
+ * optionally pinned thread. The socket I/O of an endpoint and its timers
+ * then stay on one core.
+ *
+ * A service instance keeps the shard it was assigned to first, so that its
+ * client and server endpoints share a shard. As server endpoints are shared
+ * by all service instances that use the same port, the service instance that
+ * creates a server endpoint determines its shard. The service instances that
+ * join the endpoint later are assigned to the same shard, unless another one
+ * is configured for them (see join_server).
+ *
+ * **Thread-safety**: All methods are thread-safe.
+ */
+class io_shards {
+public:
+    /**
+     * @param _thread_scheduling Scheduling of the shard threads. The CPUs
+     * configured for the shards take precedence over its CPUs.
+     */
+    io_shards(const io_shards_config_t& _config, int _thread_niceness, const thread_scheduling_t& _thread_scheduling = {});
+    ~io_shards();
+
+    bool is_enabled() const { return !contexts_.empty(); }
+    std::size_t size() const { return contexts_.size(); }
+
+    /**
+     * @brief Returns the io_context of the shard the service instance is assigned to.
+     *
+     * @param _default Context to be returned if sharding is disabled.
+     */
+    boost::asio::io_context& get_context(service_t _service, instance_t _instance, boost::asio::io_context& _default) const;
+
+    /**
+     * @brief Returns the io_context of the shard of a server endpoint, i.e. the
+     * shard of the service instance that creates it.
+     *
+     * @param _default Context to be returned if sharding is disabled.
+     */
+    boost::asio::io_context& get_server_context(port_t _port, bool _reliable, service_t _service, instance_t _instance,
+                                                boost::asio::io_context& _default) const;
+
+    /**
+     * @brief Adds a service instance to an existing server endpoint.
+     *
+     * A service instance without an assignment is assigned to the shard of the
+     * server endpoint.
+     *
+     * @return false if another shard is configured for the service instance
+     * than the server endpoint runs on. The server endpoint keeps its shard.
+     */
+    bool join_server(port_t _port, bool _reliable, service_t _service, instance_t _instance) const;
+
+    /**
+     * @brief Returns the io_context of the shard for local endpoints.
+     *
+     * @param _default Context to be returned if sharding is disabled.
+     */
+    boost::asio::io_context& get_local_context(boost::asio::io_context& _default) const;
+
+    /**
+     * @brief Returns the index of the shard the service instance is assigned to.
+     */
+    std::optional<std::size_t> get_shard(service_t _service, instance_t _instance) const;
+
+    void start();
+
+    /**
+     * @brief Stops the shard threads.
+     *
+     * The threads complete the handlers that are already queued, e.g. those
+     * that shut down the sockets of stopped endpoints, before they exit. Shards
+     * that do not run out of work within VSOMEIP_IO_SHARDS_STOP_TIMEOUT are
+     * stopped, dropping their remaining handlers.
+     */
+    void stop();
+
+private:
+    std::optional<std::size_t> find_configured(service_t _service, instance_t _instance) const;
+    std::size_t assign_unlocked(std::optional<std::size_t> _configured) const;
+    std::size_t assign_unlocked(service_t _service, instance_t _instance) const;
+
+    const io_shards_config_t config_;
+    const int thread_niceness_;
+    const thread_scheduling_t thread_scheduling_;
+
+    std::vector<std::unique_ptr<boost::asio::io_context>> contexts_;
+    std::vector<std::thread> threads_;
+    std::vector<boost::asio::executor_work_guard<boost::asio::io_context::executor_type>> work_guards_;
+    // set when the thread of the shard with the same index has run out of work
+    std::vector<std::future<void>> finished_;
+
+    // assignments are made on first use
+    mutable std::mutex mutex_;
+    mutable std::size_t next_{0};
+    mutable std::optional<std::size_t> local_;
+    mutable std::map<std::pair<service_t, instance_t>, std::size_t> assignments_;
+    // shards of the server endpoints by port and reliability
+    mutable std::map<std::pair<port_t, bool>, std::size_t> server_assignments_;
+};
+
+} // namespace vsomeip_v3
@@ -6,10 +6,12 @@
 #pragma once
 
 #include "local_receive_buffer.hpp"
+#include "local_send_queue.hpp"
 #include "local_client_data.hpp"
 #include "timer.hpp"
 
 #include "internal.hpp"
+#include "../../configuration/include/local_coalescing.hpp"
 
 #include "../../protocol/include/command_types.hpp"
 #include "../../protocol/include/serialize.hpp"
@@ -17,11 +19,13 @@
 
 #include <vsomeip/primitive_types.hpp>
 #include <vsomeip/constants.hpp>
+#include <vsomeip/structured_types.hpp>
 #include <vsomeip/vsomeip_sec.h>
 #include <vsomeip/internal/logger.hpp>
 
 #include <boost/asio.hpp>
 
+#include <array>
 #include <limits>
 #include <vector>
 #include <cstdint>
@@ -44,6 +48,8 @@ struct local_endpoint_context {
     boost::asio::io_context& io_;
     std::shared_ptr<configuration> configuration_;
     std::weak_ptr<routing_host> routing_host_;
+    /// write coalescing of the owning application, disabled by default
+    local_coalescing_t coalescing_{};
 };
 
 /**
@@ -173,6 +179,8 @@ public:
      *
      * Messages are queued and sent asynchronously.
      * Queue size is determined from configuration.
+     * If write coalescing is enabled, messages may be held back for the
+     * configured maximum delay to be sent together with subsequent messages.
      *
      * Note that the messages are only send out after start() has been called.
      */
@@ -192,6 +200,84 @@ public:
     template<typename T>
     bool send(T const& _in);
 
+    /**
+     * @brief Sends a command that consists of a header and a SOME/IP frame.
+     * @param _header Pointer to the serialized command header.
+     * @param _header_size Size of the command header in bytes.
+     * @param _data Pointer to the SOME/IP frame.
+     * @param _size Size of the SOME/IP frame in bytes.
+     * @return true if queued successfully, false if queue or message limit exceeded.
+     *
+     * Header and frame are copied directly into the send queue, without
+     * assembling the command first.
+     */
+    bool send(byte_t const* _header, uint32_t _header_size, byte_t const* _data, uint32_t _size);
+
+    /**
+     * @brief Sends a command that consists of a header and a shared SOME/IP frame.
+     * @param _header Pointer to the serialized command header.
+     * @param _header_size Size of the command header in bytes.
+     * @param _frame SOME/IP frame, which may be sent to other endpoints as well.
+     * @return true if queued successfully, false if queue or message limit exceeded.
+     *
+     * Frames of at least VSOMEIP_LOCAL_GATHER_THRESHOLD bytes are not copied, but
+     * kept alive until they were written with a gather write.
+     */
+    bool send(byte_t const* _header, uint32_t _header_size, local_send_queue::frame_t const& _frame);
+
+    /**
+     * @struct command
+     * @brief A send command, i.e. its serialized header and its shared SOME/IP frame.
+     */
+    struct command {
+        std::array<byte_t, protocol::SEND_COMMAND_HEADER_SIZE> header_;
+        local_send_queue::frame_t frame_;
+    };
+
+    /**
+     * @brief Sends several commands with a single send operation.
+     * @param _commands Commands to send, in order.
+     * @return Number of commands that were queued.
+     *
+     * All commands are queued under one lock, and the write is triggered
+     * (or coalesced) once for all of them.
+     */
+    std::size_t send(std::vector<command> const& _commands);
+
+    /**
+     * @struct send_statistics
+     * @brief Counters of the send path of an endpoint.
+     */
+    struct send_statistics {
+        uint64_t bytes_queued_{0}; ///< Bytes of the commands added to the send queue, copied or referenced
+        uint64_t bytes_copied_{0}; ///< Bytes copied into the send queue
+        uint64_t bytes_sent_{0}; ///< Bytes written to the socket
+        uint64_t writes_{0}; ///< Completed (gather) writes
+        uint64_t coalesced_{0}; ///< Writes that were delayed to coalesce commands
+        uint64_t commands_queued_{0}; ///< Commands added to the send queue
+        uint64_t commands_dropped_{0}; ///< Commands rejected by check_send_unlock
+        size_t queue_size_high_water_mark_{0}; ///< Maximum size of the send queue in bytes
+    };
+
+    /**
+     * @brief Returns the counters of the send path.
+     */
+    send_statistics get_send_statistics() const;
+
+    /**
+     * @struct receive_statistics
+     * @brief Counters of the receive path of an endpoint.
+     */
+    struct receive_statistics {
+        uint64_t bytes_received_{0}; ///< Bytes of the commands passed to the routing host
+        uint64_t commands_received_{0}; ///< Commands passed to the routing host
+    };
+
+    /**
+     * @brief Fills the runtime statistics of the endpoint.
+     */
+    void get_statistics(endpoint_statistics_t& _statistics) const;
+
     /**
      * @brief Retrieves the client ID of the connected peer.
      * @return vsomeip client ID of the peer application.
@@ -248,7 +334,7 @@ private:
     bool is_allowed();
 
     void connect_cbk(boost::system::error_code const& _ec);
-    void send_cbk(boost::system::error_code const& _ec, size_t _bytes, std::vector<uint8_t> _send_buffer);
+    void send_cbk(boost::system::error_code const& _ec, size_t _bytes, local_send_queue _send_buffer);
     void receive_cbk(boost::system::error_code const& _ec, size_t _bytes);
     [[nodiscard]] bool process(size_t _new_bytes, std::unique_lock<std::mutex>& _lock);
 
@@ -262,6 +348,24 @@ private:
 
     void send_buffer_unlock();
 
+    /**
+     * @brief Holds back the send queue if write coalescing is enabled and the batch is not full yet.
+     * @return true if the queue is held back and sent by the coalescing timer.
+     */
+    [[nodiscard]] bool coalesce_unlock();
+    void coalescing_timeout();
+
+    /**
+     * @brief Checks whether a command of _size bytes may be added to the send queue.
+     * @note Logs the reason, if not.
+     */
+    [[nodiscard]] bool check_send_unlock(protocol::id_e _id, size_t _size) const;
+
+    /**
+     * @brief Counts _commands of _bytes in total that were added to the send queue.
+     */
+    void count_queued_unlock(uint64_t _commands, uint64_t _bytes);
+
     std::string status() const;
     std::string status_unlock() const;
 
@@ -274,6 +378,8 @@ private:
     // this flag is stating whether a graceful shutdown is targeted (note that this flag can be set for an endpoint in any of the states
     // INIT, CONNECTING, CONNECTED and can therefore not be easily represented as a state itself)
     bool is_flushing_{false};
+    // whether the send queue is held back until the coalescing timer expires
+    bool is_coalescing_{false};
     state_e state_{state_e::STOPPED};
     client_t own_{VSOMEIP_CLIENT_UNSET};
     // holds the peer id, the peer env and the sec_client.
@@ -286,9 +392,12 @@ private:
 
     size_t const max_message_size_{0};
     size_t const queue_limit_{0};
+    local_coalescing_t const coalescing_;
 
     std::shared_ptr<local_receive_buffer> const receive_buffer_;
-    std::vector<uint8_t> send_queue_;
+    local_send_queue send_queue_;
+    send_statistics send_statistics_;
+    receive_statistics receive_statistics_;
     cleanup_handler_t cleanup_handler_;
 
     boost::asio::io_context& io_;
@@ -300,6 +409,7 @@ private:
     std::shared_ptr<timer> connect_debounce_;
     std::shared_ptr<timer> connecting_timebox_;
     std::shared_ptr<timer> assignment_timebox_;
+    std::shared_ptr<timer> coalescing_timer_;
 
     mutable std::mutex mutex_;
 };
@@ -0,0 +1,101 @@
+// Copyright (C) 2014-2026 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <ostream>
+#include <vector>
+
+#include <boost/asio/buffer.hpp>
+
+#include <vsomeip/primitive_types.hpp>
+
+namespace vsomeip_v3 {
+
+/**
+ * @class local_send_queue
+ * @brief Send queue of a local endpoint that is written with a single gather write.
+ *
+ * Commands and command headers are copied into one contiguous byte buffer.
+ * SOME/IP frames of at least `_gather_threshold` bytes are not copied, but
+ * referenced. A frame is kept alive by the queue until the write completed, so
+ * that the same frame can be queued for multiple local targets.
+ *
+ * **Layout**: The queue is a sequence of segments, each of which is either a
+ * range of the copied bytes or a referenced frame. Consecutive copies extend
+ * the last segment, so that a queue without referenced frames is written from
+ * a single buffer.
+ *
+ * **Thread-safety**: This class is NOT thread-safe. External synchronization required.
+ *
+ * @warning The pointers returned by `extend()` and the buffers returned by `buffers()`
+ *          are invalidated by any `extend()` or `push()`.
+ */
+class local_send_queue {
+public:
+    using frame_t = std::shared_ptr<const std::vector<byte_t>>;
+
+    /**
+     * @param _gather_threshold Minimum size of frames that are referenced
+     * instead of copied. 0 disables referencing.
+     */
+    explicit local_send_queue(std::size_t _gather_threshold = 0);
+
+    /**
+     * @brief Appends _size uninitialized bytes to the end of the queue, to be
+     * serialized in place.
+     *
+     * @return Pointer to the appended bytes.
+     */
+    byte_t* extend(std::size_t _size);
+
+    /**
+     * @brief Copies _size bytes to the end of the queue.
+     *
+     * @return The number of bytes copied.
+     */
+    std::size_t push(const byte_t* _data, std::size_t _size);
+
+    /**
+     * @brief Queues a command header, followed by a SOME/IP frame.
+     *
+     * The header is copied. The frame is referenced if it reaches the gather
+     * threshold, and copied otherwise.
+     *
+     * @return The number of bytes copied.
+     */
+    std::size_t push(const byte_t* _header, std::size_t _header_size, const frame_t& _frame);
+
+    /**
+     * @brief Returns the number of queued bytes, including referenced frames.
+     */
+    std::size_t size() const { return size_; }
+
+    bool empty() const { return size_ == 0; }
+
+    /**
+     * @brief Returns the queued data as a buffer sequence for a gather write.
+     */
+    std::vector<boost::asio::const_buffer> buffers() const;
+
+    friend std::ostream& operator<<(std::ostream& _out, const local_send_queue& _queue);
+
+private:
+    struct segment {
+        std::size_t offset_; ///< Offset into data_, if no frame is referenced
+        std::size_t size_;
+        frame_t frame_;
+    };
+
+    std::size_t gather_threshold_;
+    std::size_t size_{0};
+
+    std::vector<byte_t> data_;
+    std::vector<segment> segments_;
+};
+
+} // namespace vsomeip_v3
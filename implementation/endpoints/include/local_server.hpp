@@ -8,6 +8,7 @@
 #include "local_receive_buffer.hpp"
 #include "timer.hpp"
 #include "internal.hpp"
+#include "../../configuration/include/local_coalescing.hpp"
 
 #include <vsomeip/primitive_types.hpp>
 
@@ -64,12 +65,13 @@ public:
      * @param _connection_handler handler to register accepted connections. This handler is not allowed to call back into the server
      * @param _is_router True if this is the routing manager's server.
      * @param _server_host environment of the server itself. Required to send out the config_id to the client
+     * @param _coalescing write coalescing of the accepted endpoints.
      *
      * @note the acceptor needs to be already in the "listen" state.
      */
     local_server(boost::asio::io_context& _io, std::shared_ptr<local_acceptor> _acceptor, std::shared_ptr<configuration> _configuration,
                  std::weak_ptr<routing_host> _routing_host, connection_handler _connection_handler, bool _is_router,
-                 std::string _server_host);
+                 std::string _server_host, local_coalescing_t _coalescing = {});
     ~local_server();
 
     /**
@@ -192,6 +194,7 @@ private:
     std::weak_ptr<routing_host> const routing_host_;
     connection_handler const connection_handler_;
     std::string const server_host_;
+    local_coalescing_t const coalescing_;
     std::vector<boost::asio::ip::address> blocked_addresses_;
 
     std::mutex mutable mtx_;
@@ -5,6 +5,8 @@
 
 #pragma once
 
+#include "local_send_queue.hpp"
+
 #include <vsomeip/vsomeip_sec.h>
 #include <vsomeip/primitive_types.hpp>
 
@@ -42,7 +44,7 @@ char const* to_string(socket_role_e _role);
 class local_socket {
 public:
     using read_handler = std::function<void(boost::system::error_code const&, size_t)>;
-    using write_handler = std::function<void(boost::system::error_code const&, size_t, std::vector<uint8_t>)>;
+    using write_handler = std::function<void(boost::system::error_code const&, size_t, local_send_queue)>;
     using connect_handler = std::function<void(boost::system::error_code const&)>;
 
     virtual ~local_socket() = default;
@@ -77,11 +79,11 @@ public:
     virtual void async_receive(boost::asio::mutable_buffer _buffer, read_handler _handler) = 0;
 
     /**
-     * @brief Asynchronously sends data to the connected peer.
+     * @brief Asynchronously sends data to the connected peer with a single gather write.
      * @param _data Data to send (ownership transferred to async operation).
      * @param _handler Callback invoked when send completes, receives the data back.
      */
-    virtual void async_send(std::vector<uint8_t> _data, write_handler _handler) = 0;
+    virtual void async_send(local_send_queue _data, write_handler _handler) = 0;
 
     /**
      * @brief Updates security client credentials from the connected peer.
@@ -0,0 +1,40 @@
+// Copyright (C) 2014-2026 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include <vsomeip/primitive_types.hpp>
+
+namespace vsomeip_v3 {
+namespace magic_cookie {
+
+inline constexpr std::uint32_t NOT_FOUND = 0xFFFFFFFF;
+
+/**
+ * @brief Searches _buffer for a SOME/IP magic cookie with the given message
+ * identifier (byte 2) and message type (byte 14).
+ *
+ * A cookie at offset n is only reported if it is followed by at least one more
+ * byte (_size > n + 16). Uses SSE2, AVX2 or NEON if the build targets them.
+ *
+ * @return The offset of the first cookie, NOT_FOUND otherwise.
+ */
+std::uint32_t find(const byte_t* _buffer, std::size_t _size, byte_t _identifier, byte_t _type);
+
+/**
+ * @brief Byte-wise reference implementation of find().
+ */
+std::uint32_t find_scalar(const byte_t* _buffer, std::size_t _size, byte_t _identifier, byte_t _type);
+
+/**
+ * @brief Name of the instruction set used by find().
+ */
+const char* get_implementation();
+
+} // namespace magic_cookie
+} // namespace vsomeip_v3
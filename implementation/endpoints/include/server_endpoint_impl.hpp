@@ -13,6 +13,7 @@
 #include <mutex>
 #include <optional>
 #include <set>
+#include <shared_mutex>
 #include <unordered_map>
 #include <vector>
 
@@ -35,16 +36,15 @@ public:
     typedef typename Protocol::endpoint endpoint_type;
     struct endpoint_data_type {
         endpoint_data_type(boost::asio::io_context& _io) :
-            train_(std::make_shared<train>()), dispatch_timer_(std::make_shared<boost::asio::steady_timer>(_io)),
-            has_last_departure_(false), queue_size_(0), is_sending_(false), sent_timer_(_io), io_(_io) { }
+            train_(trains_.get()), dispatch_timer_(std::make_shared<boost::asio::steady_timer>(_io)), has_last_departure_(false),
+            queue_size_(0), is_sending_(false), sent_timer_(_io), io_(_io) { }
 
-        endpoint_data_type(const endpoint_data_type&& _source) :
-            train_(_source.train_), dispatch_timer_(std::make_shared<boost::asio::steady_timer>(_source.io_)),
-            has_last_departure_(_source.has_last_departure_), queue_(_source.queue_), queue_size_(_source.queue_size_),
-            is_sending_(_source.is_sending_), sent_timer_(_source.io_), io_(_source.io_) { }
+        // Guards the data of the target
+        std::mutex mutex_;
 
+        train_pool trains_;
         std::shared_ptr<train> train_;
-        std::map<std::chrono::steady_clock::time_point, std::deque<std::shared_ptr<train>>> dispatched_trains_;
+        dispatched_trains dispatched_trains_;
         std::shared_ptr<boost::asio::steady_timer> dispatch_timer_;
         std::chrono::steady_clock::time_point last_departure_;
         bool has_last_departure_;
@@ -58,8 +58,15 @@ public:
         boost::asio::io_context& io_;
     };
 
-    typedef typename std::map<endpoint_type, endpoint_data_type> target_data_type;
+    typedef typename std::map<endpoint_type, std::shared_ptr<endpoint_data_type>> target_data_type;
     typedef typename target_data_type::iterator target_data_iterator_type;
+
+    // A target whose data is locked. The target is not removed while it is held.
+    struct locked_target {
+        std::shared_lock<std::shared_mutex> targets_lock_;
+        target_data_iterator_type it_;
+        std::unique_lock<std::mutex> lock_;
+    };
     using clients_key_t = uint64_t;
 
     server_endpoint_impl(const std::shared_ptr<boardnet_endpoint_host>& _boardnet_endpoint_host,
@@ -93,31 +100,38 @@ public:
     void flush_cbk(endpoint_type _key, const boost::system::error_code& _error_code);
 
 protected:
-    // The caller must hold the `mutex_` lock
     virtual bool send_intern(endpoint_type _target, const byte_t* _data, uint32_t _port);
-    // The caller must hold the `mutex_` lock
+    // The caller must hold the lock of the target
     virtual bool send_queued(const target_data_iterator_type _it) = 0;
     virtual void get_configured_times_from_endpoint(service_t _service, method_t _method, std::chrono::nanoseconds* _debouncing,
                                                     std::chrono::nanoseconds* _maximum_retention) const = 0;
 
     virtual bool get_default_target(service_t _service, endpoint_type& _target) const = 0;
+    void get_configured_times(service_t _service, method_t _method, std::chrono::nanoseconds& _debouncing,
+                              std::chrono::nanoseconds& _maximum_retention);
 
     virtual void print_status() = 0;
 
     bool check_message_size(std::uint32_t _size) const;
-    // The caller must hold the `mutex_` lock
+    // The caller must hold the lock of the target
     typename endpoint_impl<Protocol>::cms_ret_e segment_message(const std::uint8_t* const _data, std::uint32_t _size,
-                                                                const endpoint_type& _target);
-    // The caller must hold the `mutex_` lock
+                                                                const target_data_iterator_type _it);
+    // The caller must hold the lock of the target
     bool check_queue_limit(const uint8_t* _data, std::uint32_t _size, endpoint_data_type& _endpoint_data) const;
-    // The caller must hold the `mutex_` lock
+    // The caller must hold the lock of the target
     bool queue_train(const target_data_iterator_type _it, const std::shared_ptr<train>& _train);
 
-    // The caller must hold the `mutex_` lock
-    void send_segments(const tp::tp_split_messages_t& _segments, std::uint32_t _separation_time, const endpoint_type& _target);
+    // The caller must hold the lock of the target
+    void send_segments(const tp::tp_split_messages_t& _segments, std::uint32_t _separation_time, const target_data_iterator_type _it);
 
-    // The caller must hold the `mutex_` lock
-    target_data_iterator_type find_or_create_target_unlocked(endpoint_type _target);
+    // Returns the locked target, which is created if it does not exist yet.
+    locked_target lock_target(const endpoint_type& _target);
+    // Returns the locked target, if it exists.
+    std::optional<locked_target> find_locked_target(const endpoint_type& _target);
+    // Removes the target, unless it was replaced in the meantime.
+    void remove_target(const endpoint_type& _target, const std::shared_ptr<endpoint_data_type>& _data);
+    // Resets the sending state of all targets, e.g. after the socket was recreated.
+    void reset_sending_state();
 
     static clients_key_t to_clients_key(service_t its_service, method_t its_method, client_t its_client);
 
@@ -132,9 +146,11 @@ protected:
     // Clears the target endpoints of all clients.
     void clear_client_targets();
 
+    // Each target has its own lock. The lock of the targets only guards
+    // adding and removing targets: Sending to different targets does not
+    // serialize on it, as it is taken shared.
     target_data_type targets_;
-
-    mutable std::mutex mutex_;
+    mutable std::shared_mutex targets_mutex_;
 
 private:
     virtual std::string get_remote_information(const target_data_iterator_type _queue_iterator) const = 0;
@@ -147,9 +163,11 @@ private:
     void start_dispatch_timer(target_data_iterator_type _it, const std::chrono::steady_clock::time_point& _now);
     void cancel_dispatch_timer(target_data_iterator_type _it);
 
-    // The caller must hold the `mutex_` lock
+    // The caller must hold the lock of the target
     void recalculate_queue_size(endpoint_data_type& _data) const;
 
+    npdu_timings configured_times_;
+
     // Mapping of client ids to remote endpoints used to send responses to the correct targets.
     std::unordered_map<clients_key_t, endpoint_type> clients_to_target_;
     std::mutex clients_mutex_;
@@ -0,0 +1,136 @@
+// Copyright (C) 2014-2026 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <ostream>
+
+#include <boost/asio/buffer.hpp>
+
+#include <vsomeip/primitive_types.hpp>
+
+namespace vsomeip_v3 {
+
+/**
+ * @class tcp_receive_buffer
+ * @brief Receive buffer for SOME/IP over TCP that hands out messages in place.
+ *
+ * Data is received into a fixed size chunk. Parsed messages are consumed by
+ * advancing a read offset, so neither the consumed messages nor the remaining
+ * data are moved after each message. The memory is never zero-filled.
+ *
+ * **Buffer Lifecycle**:
+ * 1. **Chunk**: Data is received into a chunk of `_chunk_size` bytes. When the
+ *    buffer runs empty, both offsets return to the start of the chunk.
+ * 2. **Compaction**: Only if a message that fits the chunk is cut off at the
+ *    end of the chunk, its already received part is moved to the front.
+ * 3. **Large messages**: Once the header of a message that does not fit the
+ *    chunk has been parsed, `prepare()` switches to a single allocation of
+ *    exactly the message size. The remainder of the message is received
+ *    directly into it.
+ * 4. **Shrinking**: The large allocation is kept for subsequent large messages
+ *    and released after `_shrink_threshold` consecutive small messages (0
+ *    disables shrinking).
+ *
+ * **Thread-safety**: This class is NOT thread-safe. External synchronization required.
+ *
+ * **Usage Pattern**:
+ * ```cpp
+ * void receive() {
+ *     buf.prepare(missing_bytes);
+ *     socket.async_receive(buf.buffer(), [this](error_code ec, size_t n) {
+ *         buf.bump_end(n);
+ *         while (<buf.data() holds a complete message of size s>) {
+ *             handle_message(buf.data(), s);
+ *             buf.consume(s);
+ *         }
+ *         receive();
+ *     });
+ * }
+ * ```
+ *
+ * @warning Pointers returned by `data()` are invalidated by `buffer()`, `prepare()` and `reset()`.
+ */
+class tcp_receive_buffer {
+public:
+    tcp_receive_buffer(std::size_t _chunk_size, std::uint32_t _shrink_threshold);
+
+    /**
+     * @brief Returns the unconsumed data.
+     */
+    const byte_t* data() const { return mem_.get() + start_; }
+
+    /**
+     * @brief Returns the number of unconsumed bytes.
+     */
+    std::size_t size() const { return end_ - start_; }
+
+    /**
+     * @brief Returns the size of the currently used allocation.
+     */
+    std::size_t capacity() const { return capacity_; }
+
+    /**
+     * @brief Returns a mutable buffer for receiving data behind the unconsumed data.
+     *
+     * If the buffer is empty, it restarts at the front of the current allocation.
+     */
+    boost::asio::mutable_buffer buffer();
+
+    /**
+     * @brief Updates the end offset after receiving data.
+     *
+     * @return false if the new end would exceed the current allocation.
+     */
+    [[nodiscard]] bool bump_end(std::size_t _new_bytes);
+
+    /**
+     * @brief Marks _size bytes at the front of the unconsumed data as processed.
+     *
+     * Updates the shrink counter and releases the large allocation, if the
+     * buffer is empty and enough small messages have been consumed.
+     */
+    void consume(std::size_t _size);
+
+    /**
+     * @brief Ensures that _missing bytes can be received contiguously behind the
+     * unconsumed data.
+     *
+     * Moves the unconsumed data to the front of the chunk, if that is sufficient,
+     * otherwise switches to a right-sized allocation for the pending message.
+     *
+     * @throws std::bad_alloc if the allocation fails.
+     */
+    void prepare(std::size_t _missing);
+
+    /**
+     * @brief Drops all data and returns to the initial chunk.
+     */
+    void reset();
+
+    friend std::ostream& operator<<(std::ostream& _out, const tcp_receive_buffer& _buffer);
+
+private:
+    void compact();
+
+    const std::size_t chunk_size_;
+    const std::uint32_t shrink_threshold_;
+    std::uint32_t shrink_count_{0};
+
+    std::unique_ptr<byte_t[]> mem_; ///< Currently used allocation
+    std::size_t capacity_{0};
+
+    /// The chunk, while a large allocation is in use
+    std::unique_ptr<byte_t[]> chunk_;
+
+    /// Invariant: start_ <= end_ <= capacity_
+    std::size_t start_{0};
+    std::size_t end_{0};
+};
+
+} // namespace vsomeip_v3
@@ -12,6 +12,7 @@
 #include <vsomeip/export.hpp>
 #include "server_endpoint_impl.hpp"
 #include "auxiliary_context.hpp"
+#include "tcp_receive_buffer.hpp"
 
 #include "tcp_socket.hpp"
 
@@ -87,9 +88,8 @@ private:
                    std::uint32_t _recv_buffer_size_initial, std::uint32_t _buffer_shrink_threshold, bool _use_magic_cookies,
                    boost::asio::io_context& _io, std::chrono::milliseconds _send_timeout);
         bool send_magic_cookie(message_buffer_ptr_t& _buffer);
-        bool is_magic_cookie(size_t _offset) const;
+        bool is_magic_cookie() const;
         void receive_cbk(boost::system::error_code const& _error, std::size_t _bytes);
-        void calculate_shrink_count();
         std::string get_address_port_local() const;
         void handle_recv_buffer_exception(const std::exception& _e);
         std::size_t write_completion_condition(const boost::system::error_code& _error, std::size_t _bytes_transferred,
@@ -103,13 +103,9 @@ private:
         std::weak_ptr<tcp_server_endpoint_impl> server_;
 
         const uint32_t max_message_size_;
-        const uint32_t recv_buffer_size_initial_;
 
-        message_buffer_t recv_buffer_;
-        size_t recv_buffer_size_;
+        tcp_receive_buffer recv_buffer_;
         std::uint32_t missing_capacity_;
-        std::uint32_t shrink_count_;
-        const std::uint32_t buffer_shrink_threshold_;
 
         endpoint_type remote_;
         boost::asio::ip::address remote_address_;
@@ -0,0 +1,164 @@
+// Copyright (C) 2014-2026 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <optional>
+
+namespace vsomeip_v3 {
+namespace tp {
+
+/**
+ * Earliest-deadline scheduler for SOME/IP-TP segments of one endpoint.
+ *
+ * The separation time is honoured per target. Targets that must wait before
+ * their next segment are kept ordered by their release time, so that a single
+ * timer per endpoint can serve all concurrent transfers. Segments of transfers
+ * to different targets are thereby interleaved instead of being serialized.
+ *
+ * The pacer is not thread-safe; the owning endpoint must protect it.
+ */
+template<typename Key>
+class tp_pacer {
+public:
+    using clock_type = std::chrono::steady_clock;
+
+    struct statistics {
+        // Number of segments sent with a separation time
+        std::uint64_t paced_segments_{0};
+        // Number of segments that had to wait for their release time
+        std::uint64_t deferred_segments_{0};
+        // Achieved gaps between consecutive segments to the same target
+        std::uint64_t gaps_{0};
+        std::chrono::microseconds min_gap_{std::chrono::microseconds::max()};
+        std::chrono::microseconds max_gap_{0};
+        std::chrono::microseconds total_gap_{0};
+        // Largest amount by which an achieved gap exceeded the configured one
+        std::chrono::microseconds max_overshoot_{0};
+
+        std::chrono::microseconds get_average_gap() const {
+            return gaps_ == 0 ? std::chrono::microseconds::zero()
+                              : std::chrono::microseconds(total_gap_.count() / static_cast<std::int64_t>(gaps_));
+        }
+    };
+
+    /**
+     * @brief Returns the time at which a segment with the given separation time
+     * (in microseconds) may be sent to _key. A default constructed time point
+     * means "immediately".
+     */
+    clock_type::time_point get_release_time(const Key& _key, std::uint32_t _separation_time) const {
+        if (_separation_time == 0) {
+            return clock_type::time_point();
+        }
+        auto found_key = last_sent_.find(_key);
+        if (found_key == last_sent_.end()) {
+            return clock_type::time_point();
+        }
+        return found_key->second + std::chrono::microseconds(_separation_time);
+    }
+
+    /**
+     * @brief Registers _key to be served at _release_time.
+     */
+    void defer(const Key& _key, clock_type::time_point _release_time) {
+        deadlines_.emplace(_release_time, _key);
+        statistics_.deferred_segments_++;
+    }
+
+    /**
+     * @brief Removes the target with the earliest release time not later than _now.
+     *
+     * @return true if a target was due, false otherwise.
+     */
+    bool pop_due(clock_type::time_point _now, Key& _key) {
+        auto its_first = deadlines_.begin();
+        if (its_first == deadlines_.end() || its_first->first > _now) {
+            return false;
+        }
+        _key = its_first->second;
+        deadlines_.erase(its_first);
+        return true;
+    }
+
+    /**
+     * @brief Returns the earliest release time of all deferred targets.
+     */
+    std::optional<clock_type::time_point> get_next_deadline() const {
+        if (deadlines_.empty()) {
+            return std::nullopt;
+        }
+        return deadlines_.begin()->first;
+    }
+
+    /**
+     * @brief Records that a segment was handed to the socket at _now.
+     *
+     * Entries without separation time end the paced sequence for the target.
+     */
+    void on_sent(const Key& _key, std::uint32_t _separation_time, clock_type::time_point _now) {
+        if (_separation_time == 0) {
+            last_sent_.erase(_key);
+            return;
+        }
+
+        statistics_.paced_segments_++;
+
+        auto found_key = last_sent_.find(_key);
+        if (found_key != last_sent_.end()) {
+            const auto its_gap = std::chrono::duration_cast<std::chrono::microseconds>(_now - found_key->second);
+            statistics_.gaps_++;
+            statistics_.total_gap_ += its_gap;
+            if (its_gap < statistics_.min_gap_) {
+                statistics_.min_gap_ = its_gap;
+            }
+            if (its_gap > statistics_.max_gap_) {
+                statistics_.max_gap_ = its_gap;
+            }
+            const auto its_overshoot = its_gap - std::chrono::microseconds(_separation_time);
+            if (its_overshoot > statistics_.max_overshoot_) {
+                statistics_.max_overshoot_ = its_overshoot;
+            }
+            found_key->second = _now;
+        } else {
+            last_sent_.emplace(_key, _now);
+        }
+    }
+
+    /**
+     * @brief Forgets all state of the given target.
+     */
+    void remove(const Key& _key) {
+        last_sent_.erase(_key);
+        for (auto it = deadlines_.begin(); it != deadlines_.end();) {
+            if (it->second == _key) {
+                it = deadlines_.erase(it);
+            } else {
+                ++it;
+            }
+        }
+    }
+
+    void clear() {
+        last_sent_.clear();
+        deadlines_.clear();
+    }
+
+    bool has_deferred() const { return !deadlines_.empty(); }
+
+    const statistics& get_statistics() const { return statistics_; }
+
+private:
+    std::map<Key, clock_type::time_point> last_sent_;
+    std::multimap<clock_type::time_point, Key> deadlines_;
+
+    statistics statistics_;
+};
+
+} // namespace tp
+} // namespace vsomeip_v3
@@ -9,6 +9,7 @@
 #include <vsomeip/defines.hpp>
 
 #include "server_endpoint_impl.hpp"
+#include "tp_pacer.hpp"
 #include "tp_reassembler.hpp"
 #include "udp_socket.hpp"
 
@@ -71,6 +72,8 @@ public:
     bool is_joined(const std::string& _address) const;
     bool is_joined(const std::string& _address, bool& _received) const;
 
+    tp::tp_pacer<endpoint_type>::statistics get_tp_pacing_statistics() const;
+
     /**
      * @brief Block until all data is sent
      *
@@ -85,6 +88,8 @@ private:
     void init_unlocked(const endpoint_type& _local, boost::system::error_code& _error);
 
     bool send_queued_unlocked(const target_data_iterator_type _it);
+    void start_tp_pacing_timer_unlocked();
+    void on_tp_pacing_timer(const boost::system::error_code& _error);
     void leave_unlocked(const std::string& _address);
     void set_broadcast();
     void receive_unicast_unlocked(std::shared_ptr<message_buffer_t> _unicast_recv_buffer);
@@ -132,7 +137,10 @@ private:
     std::shared_ptr<tp::tp_reassembler> tp_reassembler_;
     boost::asio::steady_timer tp_cleanup_timer_;
 
-    std::chrono::steady_clock::time_point last_sent_;
+    // SOME/IP-TP separation time handling, shared by all targets
+    tp::tp_pacer<endpoint_type> tp_pacer_;
+    boost::asio::steady_timer tp_pacing_timer_;
+    std::optional<std::chrono::steady_clock::time_point> tp_pacing_timer_expiry_;
 
     // Atomic so the logger can print this variable without a lock
     std::atomic<bool> is_stopped_{true};
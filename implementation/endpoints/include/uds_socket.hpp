@@ -9,6 +9,7 @@
 
 #include <boost/asio/local/stream_protocol.hpp>
 #include <functional>
+#include <vector>
 
 namespace vsomeip_v3 {
 
@@ -31,7 +32,7 @@ public:
 
     virtual void async_connect(endpoint const& _ep, connect_handler _handler) = 0;
     virtual void async_receive(boost::asio::mutable_buffer _buffer, rw_handler _handler) = 0;
-    virtual void async_write(boost::asio::const_buffer const& _buffer, rw_handler _handler) = 0;
+    virtual void async_write(std::vector<boost::asio::const_buffer> const& _buffers, rw_handler _handler) = 0;
 };
 
 }
@@ -45,6 +45,7 @@ public:
     void print_status();
 
     size_t get_queue_size() const;
+    void get_statistics(endpoint_statistics_t& _statistics) const override;
 
 private:
     std::string address_;
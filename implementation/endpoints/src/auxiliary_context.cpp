@@ -13,7 +13,8 @@
 
 #include <vsomeip/internal/logger.hpp>
 
-vsomeip_v3::auxiliary_context::auxiliary_context(int thread_niceness) : thread_niceness_(thread_niceness) { }
+vsomeip_v3::auxiliary_context::auxiliary_context(int thread_niceness, const thread_scheduling_t& _thread_scheduling) :
+    thread_niceness_(thread_niceness), thread_scheduling_(_thread_scheduling) { }
 
 vsomeip_v3::auxiliary_context::~auxiliary_context() {
     stop();
@@ -31,6 +32,7 @@ void vsomeip_v3::auxiliary_context::start() {
         pthread_setname_np(pthread_self(), "m_auxiliary");
 #endif
         utility::set_thread_niceness(thread_niceness_);
+        utility::set_thread_scheduling(thread_scheduling_);
         VSOMEIP_INFO << "Started thread m_auxiliary, id " << std::hex << std::this_thread::get_id()
 #if defined(__linux__)
                      << ", tid " << std::dec << static_cast<int>(syscall(SYS_gettid))
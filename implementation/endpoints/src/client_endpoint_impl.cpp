@@ -35,7 +35,7 @@ client_endpoint_impl<Protocol>::client_endpoint_impl(const std::shared_ptr<board
                                                      boost::asio::io_context& _io, const std::shared_ptr<configuration>& _configuration) :
     endpoint_impl<Protocol>(_boardnet_endpoint_host, _routing_host, _io, _configuration), remote_{_remote}, flush_timer_{_io},
     connect_timer_{_io}, connect_timeout_{VSOMEIP_DEFAULT_CONNECT_TIMEOUT}, state_{cei_state_e::CLOSED}, reconnect_counter_{0},
-    connecting_timer_{_io}, connecting_timeout_{VSOMEIP_DEFAULT_CONNECTING_TIMEOUT}, train_{std::make_shared<train>()},
+    connecting_timer_{_io}, connecting_timeout_{VSOMEIP_DEFAULT_CONNECTING_TIMEOUT}, train_{trains_.get()},
     dispatch_timer_{_io}, has_last_departure_{false}, queue_size_{0}, was_not_connected_{false}, is_sending_{false}, strand_(_io) {
     this->local_ = _local;
     recreate_socket();
@@ -167,11 +167,14 @@ bool client_endpoint_impl<Protocol>::send(const uint8_t* _data, uint32_t _size)
     auto its_now(std::chrono::steady_clock::now());
 
     if (endpoint_impl<Protocol>::sending_blocked_ || !check_queue_limit(_data, _size)) {
+        endpoint_impl<Protocol>::counters_.on_send(_size, false);
         return false;
     }
 
     if (!check_message_size(_size)) {
-        return segment_message(_data, _size) == endpoint_impl<Protocol>::cms_ret_e::MSG_WAS_SPLIT;
+        const bool is_split = (segment_message(_data, _size) == endpoint_impl<Protocol>::cms_ret_e::MSG_WAS_SPLIT);
+        endpoint_impl<Protocol>::counters_.on_send(_size, is_split);
+        return is_split;
     }
 
     // STEP 1: Cancel dispatch timer
@@ -182,15 +185,14 @@ bool client_endpoint_impl<Protocol>::send(const uint8_t* _data, uint32_t _size)
     const service_t its_method = bithelper::read_uint16_be(&_data[VSOMEIP_METHOD_POS_MIN]);
 
     std::chrono::nanoseconds its_debouncing(0), its_retention(0);
-    get_configured_times_from_endpoint(its_service, its_method, &its_debouncing, &its_retention);
+    get_configured_times(its_service, its_method, its_debouncing, its_retention);
 
     // STEP 4: Check if the passenger enters an empty train
-    const std::pair<service_t, method_t> its_identifier = std::make_pair(its_service, its_method);
     if (train_->passengers_.empty()) {
         train_->departure_ = its_now + its_retention; // latest possible
     } else {
         // STEP 4.1: Check whether the current train already contains the message
-        if (train_->passengers_.end() != train_->passengers_.find(its_identifier)) {
+        if (train_->has_passenger(its_service, its_method)) {
             must_depart = true;
         } else {
             // STEP 5: Check whether the current message fits into the current train
@@ -230,13 +232,13 @@ bool client_endpoint_impl<Protocol>::send(const uint8_t* _data, uint32_t _size)
         // departs. Schedule departure of current train and create a new one.
         schedule_train();
 
-        train_ = std::make_shared<train>();
+        train_ = trains_.get();
         train_->departure_ = its_now + its_retention;
     }
 
     // STEP 9: insert current message buffer
     train_->buffer_->insert(train_->buffer_->end(), _data, _data + _size);
-    train_->passengers_.insert(its_identifier);
+    train_->add_passenger(its_service, its_method);
     // STEP 9.1: update the trains minimal debounce time if necessary
     if (its_debouncing < train_->minimal_debounce_time_) {
         train_->minimal_debounce_time_ = its_debouncing;
@@ -249,6 +251,7 @@ bool client_endpoint_impl<Protocol>::send(const uint8_t* _data, uint32_t _size)
     // STEP 10: restart dispatch timer with next departure time
     start_dispatch_timer(its_now);
 
+    endpoint_impl<Protocol>::counters_.on_send(_size, true);
     return true;
 }
 
@@ -271,7 +274,7 @@ void client_endpoint_impl<Protocol>::send_segments(const tp::tp_split_messages_t
     const service_t its_method = bithelper::read_uint16_be(&(*(_segments[0]))[VSOMEIP_METHOD_POS_MIN]);
 
     std::chrono::nanoseconds its_debouncing(0), its_retention(0);
-    get_configured_times_from_endpoint(its_service, its_method, &its_debouncing, &its_retention);
+    get_configured_times(its_service, its_method, its_debouncing, its_retention);
     // update the trains minimal debounce time if necessary
     if (its_debouncing < train_->minimal_debounce_time_) {
         train_->minimal_debounce_time_ = its_debouncing;
@@ -285,7 +288,7 @@ void client_endpoint_impl<Protocol>::send_segments(const tp::tp_split_messages_t
     // messages as we will send several now anyway.
     if (!train_->passengers_.empty()) {
         schedule_train();
-        train_ = std::make_shared<train>();
+        train_ = trains_.get();
         train_->departure_ = its_now + its_retention;
     }
 
@@ -293,6 +296,7 @@ void client_endpoint_impl<Protocol>::send_segments(const tp::tp_split_messages_t
         queue_.emplace_back(std::make_pair(s, _separation_time));
         queue_size_ += s->size();
     }
+    endpoint_impl<Protocol>::counters_.on_queue_size(queue_size_);
 
     if (!is_sending_ && !queue_.empty()) { // no writing in progress
         // ignore retention time and send immediately as the train is full anyway
@@ -304,6 +308,15 @@ void client_endpoint_impl<Protocol>::send_segments(const tp::tp_split_messages_t
     }
 }
 
+template<typename Protocol>
+void client_endpoint_impl<Protocol>::get_configured_times(service_t _service, method_t _method, std::chrono::nanoseconds& _debouncing,
+                                                          std::chrono::nanoseconds& _maximum_retention) {
+    configured_times_.get(_service, _method, this->configuration_->get_service_generation(), _debouncing, _maximum_retention,
+                          [this, _service, _method](std::chrono::nanoseconds* _debounce, std::chrono::nanoseconds* _retention) {
+                              get_configured_times_from_endpoint(_service, _method, _debounce, _retention);
+                          });
+}
+
 template<typename Protocol>
 void client_endpoint_impl<Protocol>::schedule_train() {
 
@@ -313,7 +326,7 @@ void client_endpoint_impl<Protocol>::schedule_train() {
         }
     }
 
-    dispatched_trains_[train_->departure_].push_back(train_);
+    dispatched_trains_.push(train_);
 }
 
 template<typename Protocol>
@@ -335,16 +348,10 @@ bool client_endpoint_impl<Protocol>::flush() {
     std::shared_ptr<train> its_train(train_);
     if (!dispatched_trains_.empty()) {
 
-        auto its_dispatched = dispatched_trains_.begin();
-        if (its_dispatched->first <= its_train->departure_) {
+        if (dispatched_trains_.front()->departure_ <= its_train->departure_) {
 
             is_current_train = false;
-            its_train = its_dispatched->second.front();
-            its_dispatched->second.pop_front();
-            if (its_dispatched->second.empty()) {
-
-                dispatched_trains_.erase(its_dispatched);
-            }
+            its_train = dispatched_trains_.pop();
         }
     }
 
@@ -354,12 +361,16 @@ bool client_endpoint_impl<Protocol>::flush() {
 
         // Reset current train if necessary
         if (is_current_train) {
-            its_train->reset();
+            trains_.reset(*its_train);
         }
     } else {
         has_queued = false;
     }
 
+    if (!is_current_train) {
+        trains_.release(std::move(its_train));
+    }
+
     if (!is_current_train || !dispatched_trains_.empty()) {
 
         auto its_now(std::chrono::steady_clock::now());
@@ -801,6 +812,7 @@ void client_endpoint_impl<Protocol>::queue_train(const std::shared_ptr<train>& _
 
     queue_size_ += _train->buffer_->size();
     queue_.emplace_back(_train->buffer_, 0);
+    endpoint_impl<Protocol>::counters_.on_queue_size(queue_size_);
 
     if (!is_sending_ && !queue_.empty()) { // no writing in progress
         auto its_entry = get_front();
@@ -818,6 +830,18 @@ size_t client_endpoint_impl<Protocol>::get_queue_size() const {
     return queue_size_;
 }
 
+template<typename Protocol>
+void client_endpoint_impl<Protocol>::get_statistics(endpoint_statistics_t& _statistics) const {
+
+    endpoint_impl<Protocol>::get_statistics(_statistics);
+
+    boost::asio::ip::address its_address;
+    if (get_remote_address(its_address)) {
+        _statistics.remote_address_ = its_address.to_string();
+    }
+    _statistics.remote_port_ = get_remote_port();
+}
+
 template<typename Protocol>
 void client_endpoint_impl<Protocol>::start_dispatch_timer(const std::chrono::steady_clock::time_point& _now) {
 
@@ -825,10 +849,9 @@ void client_endpoint_impl<Protocol>::start_dispatch_timer(const std::chrono::ste
     std::shared_ptr<train> its_train(train_);
     if (!dispatched_trains_.empty()) {
 
-        auto its_dispatched = dispatched_trains_.begin();
-        if (its_dispatched->first < its_train->departure_) {
+        if (dispatched_trains_.front()->departure_ < its_train->departure_) {
 
-            its_train = its_dispatched->second.front();
+            its_train = dispatched_trains_.front();
         }
     }
 
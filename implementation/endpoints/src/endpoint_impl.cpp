@@ -14,6 +14,7 @@
 #include "../include/boardnet_endpoint_host.hpp"
 #include "../../routing/include/routing_host.hpp"
 #include "../include/endpoint_impl.hpp"
+#include "../include/magic_cookie_search.hpp"
 
 namespace vsomeip_v3 {
 
@@ -25,36 +26,11 @@ endpoint_impl<Protocol>::endpoint_impl(const std::shared_ptr<boardnet_endpoint_h
     configuration_(_configuration), is_supporting_someip_tp_(false) { }
 
 template<typename Protocol>
-uint32_t endpoint_impl<Protocol>::find_magic_cookie(byte_t* _buffer, size_t _size) {
-    bool is_found(false);
-    uint32_t its_offset = 0xFFFFFFFF;
-
-    uint8_t its_cookie_identifier, its_cookie_type;
-
+uint32_t endpoint_impl<Protocol>::find_magic_cookie(const byte_t* _buffer, size_t _size) {
     if (is_client()) {
-        its_cookie_identifier = static_cast<uint8_t>(MAGIC_COOKIE_SERVICE_MESSAGE);
-        its_cookie_type = static_cast<uint8_t>(MAGIC_COOKIE_SERVICE_MESSAGE_TYPE);
-    } else {
-        its_cookie_identifier = static_cast<uint8_t>(MAGIC_COOKIE_CLIENT_MESSAGE);
-        its_cookie_type = static_cast<uint8_t>(MAGIC_COOKIE_CLIENT_MESSAGE_TYPE);
+        return magic_cookie::find(_buffer, _size, MAGIC_COOKIE_SERVICE_MESSAGE, static_cast<byte_t>(MAGIC_COOKIE_SERVICE_MESSAGE_TYPE));
     }
-
-    do {
-        its_offset++; // --> first loop has "its_offset = 0"
-        if (_size > its_offset + 16) {
-            is_found = (_buffer[its_offset] == 0xFF && _buffer[its_offset + 1] == 0xFF && _buffer[its_offset + 2] == its_cookie_identifier
-                        && _buffer[its_offset + 3] == 0x00 && _buffer[its_offset + 4] == 0x00 && _buffer[its_offset + 5] == 0x00
-                        && _buffer[its_offset + 6] == 0x00 && _buffer[its_offset + 7] == 0x08 && _buffer[its_offset + 8] == 0xDE
-                        && _buffer[its_offset + 9] == 0xAD && _buffer[its_offset + 10] == 0xBE && _buffer[its_offset + 11] == 0xEF
-                        && _buffer[its_offset + 12] == 0x01 && _buffer[its_offset + 13] == 0x01
-                        && _buffer[its_offset + 14] == its_cookie_type && _buffer[its_offset + 15] == 0x00);
-        } else {
-            break;
-        }
-
-    } while (!is_found);
-
-    return (is_found ? its_offset : 0xFFFFFFFF);
+    return magic_cookie::find(_buffer, _size, MAGIC_COOKIE_CLIENT_MESSAGE, static_cast<byte_t>(MAGIC_COOKIE_CLIENT_MESSAGE_TYPE));
 }
 
 template<typename Protocol>
@@ -63,6 +39,15 @@ void endpoint_impl<Protocol>::add_default_target(service_t, const std::string&,
 template<typename Protocol>
 void endpoint_impl<Protocol>::remove_default_target(service_t) { }
 
+template<typename Protocol>
+void endpoint_impl<Protocol>::get_statistics(endpoint_statistics_t& _statistics) const {
+    _statistics.is_reliable_ = is_reliable();
+    _statistics.is_client_ = is_client();
+    _statistics.local_port_ = get_local_port();
+    _statistics.queue_size_ = get_queue_size();
+    counters_.get(_statistics);
+}
+
 template<typename Protocol>
 instance_t endpoint_impl<Protocol>::get_instance(service_t _service) {
 
@@ -299,7 +299,7 @@ std::shared_ptr<local_server> endpoint_manager_base::create_local_server(transpo
                         self->add_local_server_endpoint(std::move(_ep), token);
                     }
                 },
-                false, get_client_env());
+                false, get_client_env(), configuration_->get_local_coalescing(name_));
     }
     return nullptr;
 }
@@ -349,7 +349,7 @@ std::shared_ptr<local_endpoint> endpoint_manager_base::create_local_client_endpo
     boost::asio::ip::address const its_local_address = configuration_->get_routing_guest_address();
     bool const same_address = _is_guest && its_local_address == _remote_address;
 
-    local_endpoint_context const context{io_, configuration_, local_message_handler_};
+    local_endpoint_context const context{io_, configuration_, local_message_handler_, configuration_->get_local_coalescing(name_)};
 
 #if defined(__linux__) || defined(__QNX__)
     if (is_local_routing_ || (is_uds_preferred_ && same_address)) {
@@ -493,6 +493,15 @@ void endpoint_manager_base::print_status() const {
     VSOMEIP_INFO << "status pending local server endpoints: " << pending_server_endpoints_.size();
 }
 
+void endpoint_manager_base::get_statistics(std::vector<endpoint_statistics_t>& _statistics) const {
+    std::scoped_lock const its_lock(mtx_);
+    for (const auto& its_endpoints : {&local_client_endpoints_, &local_server_endpoints_}) {
+        for (const auto& [_, ep] : *its_endpoints) {
+            ep->get_statistics(_statistics.emplace_back());
+        }
+    }
+}
+
 uint32_t endpoint_manager_base::provider_connection_token(client_t _client) const {
     std::scoped_lock const its_lock(mtx_);
     auto const it = provider_tokens_.find(_client);
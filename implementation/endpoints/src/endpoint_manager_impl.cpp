@@ -48,7 +48,11 @@ endpoint_manager_impl::endpoint_manager_impl(routing_manager_impl* const _rm, bo
                                              const std::shared_ptr<configuration>& _configuration) :
     io_(_io), configuration_(_configuration), router_(_rm), is_local_routing_(configuration_->is_local_routing()),
     is_uds_preferred_(configuration_->is_uds_preferred()),
-    auxiliary_context_(configuration_->get_io_thread_nice_level(router_->get_name())), is_processing_options_(true) { }
+    io_shards_(configuration_->get_io_shards(router_->get_name()), configuration_->get_io_thread_nice_level(router_->get_name()),
+               configuration_->get_thread_scheduling(router_->get_name(), thread_type_e::TT_IO)),
+    auxiliary_context_(configuration_->get_io_thread_nice_level(router_->get_name()),
+                       configuration_->get_thread_scheduling(router_->get_name(), thread_type_e::TT_AUXILIARY)),
+    is_processing_options_(true) { }
 
 endpoint_manager_impl::~endpoint_manager_impl() { }
 
@@ -58,6 +62,7 @@ void endpoint_manager_impl::start() {
         pthread_setname_np(pthread_self(), "m_multicast");
 #endif
         utility::set_thread_niceness(configuration_->get_io_thread_nice_level(router_->get_name()));
+        utility::set_thread_scheduling(configuration_->get_thread_scheduling(router_->get_name(), thread_type_e::TT_MULTICAST));
 
         VSOMEIP_INFO << "Started thread m_multicast " << std::hex << std::this_thread::get_id()
 #if defined(__linux__)
@@ -73,6 +78,7 @@ void endpoint_manager_impl::start() {
     });
 
     auxiliary_context_.start();
+    io_shards_.start();
 }
 
 void endpoint_manager_impl::stop() {
@@ -135,6 +141,7 @@ void endpoint_manager_impl::stop() {
     }
 
     auxiliary_context_.stop();
+    io_shards_.stop();
 }
 
 std::shared_ptr<boardnet_endpoint> endpoint_manager_impl::find_or_create_remote_client(service_t _service, instance_t _instance,
@@ -281,7 +288,8 @@ void endpoint_manager_impl::clear_remote_service_info(service_t _service, instan
     }
 }
 
-std::shared_ptr<boardnet_endpoint> endpoint_manager_impl::create_server_endpoint(uint16_t _port, bool _reliable, bool _start) {
+std::shared_ptr<boardnet_endpoint> endpoint_manager_impl::create_server_endpoint(uint16_t _port, bool _reliable, bool _start,
+                                                                                 service_t _service, instance_t _instance) {
     std::shared_ptr<boardnet_endpoint> its_server_endpoint;
     boost::system::error_code its_error;
     boost::asio::ip::address its_unicast{configuration_->get_unicast_address()};
@@ -292,8 +300,9 @@ std::shared_ptr<boardnet_endpoint> endpoint_manager_impl::create_server_endpoint
         if (_reliable) {
             bool its_magic_cookies_enabled = configuration_->has_enabled_magic_cookies(its_unicast_str, _port)
                     || configuration_->has_enabled_magic_cookies("local", _port);
-            auto its_tmp{std::make_shared<tcp_server_endpoint_impl>(shared_from_this(), router_->shared_from_this(), io_, configuration_,
-                                                                    auxiliary_context_, its_magic_cookies_enabled)};
+            auto its_tmp{std::make_shared<tcp_server_endpoint_impl>(shared_from_this(), router_->shared_from_this(),
+                                                                    io_shards_.get_server_context(_port, true, _service, _instance, io_),
+                                                                    configuration_, auxiliary_context_, its_magic_cookies_enabled)};
             if (its_tmp) {
                 boost::asio::ip::tcp::endpoint its_reliable(its_unicast, _port);
                 its_tmp->init(its_reliable, its_error);
@@ -302,7 +311,9 @@ std::shared_ptr<boardnet_endpoint> endpoint_manager_impl::create_server_endpoint
                 }
             }
         } else {
-            auto its_tmp{std::make_shared<udp_server_endpoint_impl>(shared_from_this(), router_->shared_from_this(), io_, configuration_)};
+            auto its_tmp{std::make_shared<udp_server_endpoint_impl>(
+                    shared_from_this(), router_->shared_from_this(), io_shards_.get_server_context(_port, false, _service, _instance, io_),
+                    configuration_)};
             if (its_tmp) {
                 boost::asio::ip::udp::endpoint its_unreliable(its_unicast, _port);
                 its_tmp->init(its_unreliable, its_error);
@@ -347,9 +358,14 @@ std::shared_ptr<boardnet_endpoint> endpoint_manager_impl::find_or_create_server_
     auto its_endpoint = find_server_endpoint(_port, _reliable);
     _is_found = false;
     if (!its_endpoint) {
-        its_endpoint = create_server_endpoint(_port, _reliable, _start);
+        its_endpoint = create_server_endpoint(_port, _reliable, _start, _service, _instance);
     } else {
         _is_found = true;
+        if (_start && !_is_multicast && !io_shards_.join_server(_port, _reliable, _service, _instance)) {
+            VSOMEIP_WARNING_P << "Service instance [" << hex4(_service) << "." << hex4(_instance) << "] shares the server endpoint of port "
+                              << _port << " (" << (_reliable ? "reliable" : "unreliable")
+                              << "), which runs on another I/O shard than configured for the service instance";
+        }
     }
     if (its_endpoint) {
         std::scoped_lock its_lock(endpoint_mutex_);
@@ -618,6 +634,37 @@ void endpoint_manager_impl::print_status() const {
     }
 }
 
+void endpoint_manager_impl::get_statistics(std::vector<endpoint_statistics_t>& _statistics) const {
+    {
+        std::scoped_lock const its_lock{routing_endpoint_mtx_};
+        for (const auto& [_, ep] : routing_endpoints_) {
+            ep->get_statistics(_statistics.emplace_back());
+        }
+    }
+
+    client_endpoints_t its_client_endpoints;
+    server_endpoints_t its_server_endpoints;
+    {
+        std::scoped_lock its_lock(endpoint_mutex_);
+        its_client_endpoints = client_endpoints_;
+        its_server_endpoints = server_endpoints_;
+    }
+    for (const auto& [its_address, its_ports] : its_client_endpoints) {
+        for (const auto& [its_port, its_reliabilities] : its_ports) {
+            for (const auto& [its_reliable, its_partitions] : its_reliabilities) {
+                for (const auto& [its_partition, ep] : its_partitions) {
+                    ep->get_statistics(_statistics.emplace_back());
+                }
+            }
+        }
+    }
+    for (const auto& [its_port, its_reliabilities] : its_server_endpoints) {
+        for (const auto& [its_reliable, ep] : its_reliabilities) {
+            ep->get_statistics(_statistics.emplace_back());
+        }
+    }
+}
+
 bool endpoint_manager_impl::create_local_uds_acceptor(std::shared_ptr<local_acceptor>& _uds_acceptor, const std::string& _endpoint_path,
                                                       bool& _is_socket_activated) {
 #ifdef SYSTEMD_SOCKET_ACTIVATION
@@ -636,7 +683,7 @@ bool endpoint_manager_impl::create_local_uds_acceptor(std::shared_ptr<local_acce
         if (is_local_routing_) {
             try {
                 auto its_acceptor = std::make_shared<local_acceptor_uds_impl>(
-                        io_, boost::asio::local::stream_protocol::endpoint(_endpoint_path), configuration_);
+                        io_shards_.get_local_context(io_), boost::asio::local::stream_protocol::endpoint(_endpoint_path), configuration_);
                 if (its_acceptor) {
                     boost::system::error_code its_error;
                     its_acceptor->init(its_error, its_socket);
@@ -661,7 +708,7 @@ bool endpoint_manager_impl::create_local_uds_acceptor(std::shared_ptr<local_acce
         try {
             VSOMEIP_INFO << "Routing root @ " << _endpoint_path;
             auto its_acceptor = std::make_shared<local_acceptor_uds_impl>(
-                    io_, boost::asio::local::stream_protocol::endpoint(_endpoint_path), configuration_);
+                    io_shards_.get_local_context(io_), boost::asio::local::stream_protocol::endpoint(_endpoint_path), configuration_);
             if (its_acceptor) {
                 boost::system::error_code its_error;
                 its_acceptor->init(its_error, std::nullopt);
@@ -693,7 +740,7 @@ bool endpoint_manager_impl::create_fallback_tcp_acceptor(std::shared_ptr<local_a
         port_t its_port = VSOMEIP_INTERNAL_BASE_PORT;
         VSOMEIP_INFO << "Routing root @ " << its_port;
         auto const its_address = boost::asio::ip::tcp::v4();
-        auto its_acceptor = std::make_shared<local_acceptor_tcp_impl>(io_, configuration_);
+        auto its_acceptor = std::make_shared<local_acceptor_tcp_impl>(io_shards_.get_local_context(io_), configuration_);
 
         if (its_acceptor) {
             boost::system::error_code its_error;
@@ -720,7 +767,7 @@ bool endpoint_manager_impl::create_local_tcp_acceptor(std::shared_ptr<local_acce
 
         VSOMEIP_INFO << "Routing root @ " << its_address.to_string() << ":" << its_port;
 
-        auto its_acceptor = std::make_shared<local_acceptor_tcp_impl>(io_, configuration_);
+        auto its_acceptor = std::make_shared<local_acceptor_tcp_impl>(io_shards_.get_local_context(io_), configuration_);
         if (its_acceptor) {
             boost::system::error_code its_error;
             int its_retry{0};
@@ -750,13 +797,13 @@ void endpoint_manager_impl::setup_root_server(std::shared_ptr<local_server>& _ro
                                               const std::shared_ptr<routing_host>& _host) {
     auto create_server = [this, _host](std::shared_ptr<local_acceptor> acceptor) {
         return std::make_shared<local_server>(
-                io_, std::move(acceptor), configuration_, _host,
+                io_shards_.get_local_context(io_), std::move(acceptor), configuration_, _host,
                 [weak_self = weak_from_this(), this](auto _ep) {
                     if (auto self = weak_self.lock(); self) {
                         add_local_routing_endpoint(std::move(_ep));
                     }
                 },
-                true, get_client_host());
+                true, get_client_host(), configuration_->get_local_coalescing(router_->get_name()));
     };
 
     _root = create_server(_acceptor);
@@ -1061,7 +1108,7 @@ std::shared_ptr<boardnet_endpoint> endpoint_manager_impl::create_remote_client(s
         get_used_client_ports(its_remote_address, its_remote_port, its_used_client_ports);
         if (configuration_->get_client_port(_service, _instance, its_remote_port, _reliable, its_used_client_ports, its_local_port)) {
             if (its_endpoint_def) {
-                its_endpoint = create_client_endpoint(its_remote_address, its_local_port, its_remote_port, _reliable);
+                its_endpoint = create_client_endpoint(its_remote_address, its_local_port, its_remote_port, _reliable, _service, _instance);
             }
 
             if (its_endpoint) {
@@ -1087,21 +1134,22 @@ std::shared_ptr<boardnet_endpoint> endpoint_manager_impl::create_remote_client(s
 
 std::shared_ptr<boardnet_endpoint> endpoint_manager_impl::create_client_endpoint(const boost::asio::ip::address& _address,
                                                                                  uint16_t _local_port, uint16_t _remote_port,
-                                                                                 bool _reliable) {
+                                                                                 bool _reliable, service_t _service, instance_t _instance) {
 
     std::shared_ptr<boardnet_endpoint> its_endpoint;
     boost::asio::ip::address its_unicast = configuration_->get_unicast_address();
+    auto& its_io = io_shards_.get_context(_service, _instance, io_);
 
     try {
         if (_reliable) {
             bool its_use_magic_cookies = configuration_->has_enabled_magic_cookies(_address.to_string(), _remote_port);
             its_endpoint = std::make_shared<tcp_client_endpoint_impl>(
                     shared_from_this(), router_->shared_from_this(), boost::asio::ip::tcp::endpoint(its_unicast, _local_port),
-                    boost::asio::ip::tcp::endpoint(_address, _remote_port), io_, configuration_, its_use_magic_cookies);
+                    boost::asio::ip::tcp::endpoint(_address, _remote_port), its_io, configuration_, its_use_magic_cookies);
         } else {
             its_endpoint = std::make_shared<udp_client_endpoint_impl>(
                     shared_from_this(), router_->shared_from_this(), boost::asio::ip::udp::endpoint(its_unicast, _local_port),
-                    boost::asio::ip::udp::endpoint(_address, _remote_port), io_, configuration_);
+                    boost::asio::ip::udp::endpoint(_address, _remote_port), its_io, configuration_);
         }
     } catch (...) {
         VSOMEIP_ERROR_P << "Client endpoint creation failed";
@@ -0,0 +1,195 @@
+// Copyright (C) 2014-2026 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#if defined(__linux__)
+#include <unistd.h>
+#include <sys/syscall.h>
+#endif
+
+#include <iomanip>
+#include <sstream>
+
+#include <vsomeip/constants.hpp>
+#include <vsomeip/internal/logger.hpp>
+
+#include "internal.hpp"
+#include "../include/io_shards.hpp"
+#include "../../utility/include/utility.hpp"
+
+namespace vsomeip_v3 {
+
+io_shards::io_shards(const io_shards_config_t& _config, int _thread_niceness, const thread_scheduling_t& _thread_scheduling) :
+    config_(_config), thread_niceness_(_thread_niceness), thread_scheduling_(_thread_scheduling) {
+    for (std::size_t i = 0; i < config_.count_; i++) {
+        contexts_.push_back(std::make_unique<boost::asio::io_context>(1));
+    }
+}
+
+io_shards::~io_shards() {
+    stop();
+}
+
+boost::asio::io_context& io_shards::get_context(service_t _service, instance_t _instance, boost::asio::io_context& _default) const {
+    if (!is_enabled()) {
+        return _default;
+    }
+
+    std::scoped_lock its_lock(mutex_);
+    return *contexts_[assign_unlocked(_service, _instance)];
+}
+
+boost::asio::io_context& io_shards::get_server_context(port_t _port, bool _reliable, service_t _service, instance_t _instance,
+                                                       boost::asio::io_context& _default) const {
+    if (!is_enabled()) {
+        return _default;
+    }
+
+    std::scoped_lock its_lock(mutex_);
+    const auto its_shard = assign_unlocked(_service, _instance);
+    server_assignments_[{_port, _reliable}] = its_shard;
+    return *contexts_[its_shard];
+}
+
+bool io_shards::join_server(port_t _port, bool _reliable, service_t _service, instance_t _instance) const {
+    if (!is_enabled()) {
+        return true;
+    }
+
+    std::scoped_lock its_lock(mutex_);
+    auto found_server = server_assignments_.find({_port, _reliable});
+    if (found_server == server_assignments_.end()) {
+        return true;
+    }
+
+    const auto its_configured = find_configured(_service, _instance);
+    if (its_configured && *its_configured < contexts_.size()) {
+        assignments_.emplace(std::make_pair(_service, _instance), *its_configured);
+        return *its_configured == found_server->second;
+    }
+    assignments_.emplace(std::make_pair(_service, _instance), found_server->second);
+    return true;
+}
+
+boost::asio::io_context& io_shards::get_local_context(boost::asio::io_context& _default) const {
+    if (!is_enabled()) {
+        return _default;
+    }
+
+    std::scoped_lock its_lock(mutex_);
+    if (!local_) {
+        local_ = assign_unlocked(config_.local_);
+    }
+    return *contexts_[*local_];
+}
+
+std::optional<std::size_t> io_shards::get_shard(service_t _service, instance_t _instance) const {
+    std::scoped_lock its_lock(mutex_);
+    auto found_assignment = assignments_.find({_service, _instance});
+    if (found_assignment != assignments_.end()) {
+        return found_assignment->second;
+    }
+    return std::nullopt;
+}
+
+std::optional<std::size_t> io_shards::find_configured(service_t _service, instance_t _instance) const {
+    auto found_service = config_.services_.find({_service, _instance});
+    if (found_service == config_.services_.end()) {
+        found_service = config_.services_.find({_service, ANY_INSTANCE});
+    }
+    if (found_service != config_.services_.end()) {
+        return found_service->second;
+    }
+    return std::nullopt;
+}
+
+std::size_t io_shards::assign_unlocked(std::optional<std::size_t> _configured) const {
+    if (_configured && *_configured < contexts_.size()) {
+        return *_configured;
+    }
+    return next_++ % contexts_.size();
+}
+
+std::size_t io_shards::assign_unlocked(service_t _service, instance_t _instance) const {
+    auto found_assignment = assignments_.find({_service, _instance});
+    if (found_assignment == assignments_.end()) {
+        const auto its_shard = assign_unlocked(find_configured(_service, _instance));
+        found_assignment = assignments_.emplace(std::make_pair(_service, _instance), its_shard).first;
+    }
+    return found_assignment->second;
+}
+
+void io_shards::start() {
+    if (!is_enabled() || !threads_.empty()) {
+        return;
+    }
+
+    for (std::size_t i = 0; i < contexts_.size(); i++) {
+        auto& its_context = *contexts_[i];
+        its_context.restart();
+        work_guards_.emplace_back(its_context.get_executor());
+
+        std::promise<void> its_finished;
+        finished_.push_back(its_finished.get_future());
+
+        thread_scheduling_t its_scheduling(thread_scheduling_);
+        if (!config_.cpus_.empty()) {
+            its_scheduling.cpus_ = {config_.cpus_[i % config_.cpus_.size()]};
+        }
+
+        threads_.emplace_back([this, i, &its_context, its_scheduling, its_finished = std::move(its_finished)]() mutable {
+            std::stringstream its_name;
+            its_name << "m_shard" << std::setw(2) << std::setfill('0') << i;
+#if defined(__linux__) || defined(__QNX__)
+            pthread_setname_np(pthread_self(), its_name.str().c_str());
+#endif
+            utility::set_thread_niceness(thread_niceness_);
+            utility::set_thread_scheduling(its_scheduling);
+            VSOMEIP_INFO << "Started thread " << its_name.str() << ", id " << std::hex << std::this_thread::get_id()
+#if defined(__linux__)
+                         << ", tid " << std::dec << static_cast<int>(syscall(SYS_gettid))
+#endif
+                    ;
+            its_context.run();
+            its_finished.set_value();
+
+            VSOMEIP_INFO << "Stopped thread " << its_name.str() << ", id " << std::hex << std::this_thread::get_id()
+#if defined(__linux__)
+                         << ", tid " << std::dec << static_cast<int>(syscall(SYS_gettid))
+#endif
+                    ;
+        });
+    }
+}
+
+void io_shards::stop() {
+    // Let the threads run out of work instead of dropping the queued handlers
+    work_guards_.clear();
+
+    const auto its_deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(VSOMEIP_IO_SHARDS_STOP_TIMEOUT);
+    for (std::size_t i = 0; i < threads_.size(); i++) {
+        if (std::this_thread::get_id() == threads_[i].get_id()) {
+            contexts_[i]->stop();
+        } else if (finished_[i].wait_until(its_deadline) != std::future_status::ready) {
+            VSOMEIP_WARNING << "io_shards::" << __func__ << ": Shard " << i << " did not complete its pending handlers in time";
+            contexts_[i]->stop();
+        }
+    }
+
+    for (auto& its_thread : threads_) {
+        try {
+            if (std::this_thread::get_id() != its_thread.get_id() && its_thread.joinable()) {
+                its_thread.join();
+            } else if (its_thread.joinable()) {
+                its_thread.detach();
+            }
+        } catch (...) {
+            // Ignore exception if thread already joined
+        }
+    }
+    threads_.clear();
+    finished_.clear();
+}
+
+} // namespace vsomeip_v3
@@ -22,6 +22,7 @@
 #include <vsomeip/defines.hpp>
 #include <vsomeip/vsomeip_sec.h>
 
+#include <algorithm>
 #include <sstream>
 #include <iomanip>
 
@@ -74,7 +75,9 @@ local_endpoint::local_endpoint([[maybe_unused]] hidden, local_endpoint_context c
                                                             .routing_address_ = std::move(_params.routing_address_),
                                                             .routing_port_ = _params.routing_port_}),
     max_connection_attempts_(MAX_RECONNECTS_LOCAL), max_message_size_(_context.configuration_->get_max_message_size_local()),
-    queue_limit_(_context.configuration_->get_endpoint_queue_limit_local()), receive_buffer_(std::move(_receive_buffer)), io_(_context.io_),
+    queue_limit_(_context.configuration_->get_endpoint_queue_limit_local()), coalescing_(_context.coalescing_),
+    receive_buffer_(std::move(_receive_buffer)),
+    send_queue_(VSOMEIP_LOCAL_GATHER_THRESHOLD), io_(_context.io_),
     socket_(std::move(_params.socket_)), configuration_(_context.configuration_), routing_host_(_context.routing_host_) { }
 
 local_endpoint::~local_endpoint() {
@@ -154,73 +157,115 @@ void local_endpoint::escalate_internal(std::unique_lock<std::mutex>& _lock) {
 
 bool local_endpoint::send(byte_t const* _data, uint32_t _size) {
     std::scoped_lock const lock{mutex_};
-    if (is_flushing_) {
-        VSOMEIP_WARNING_P << "Dropping message type: " << protocol::read_command_id(_data, _size) << " and size: " << _size
-                          << ", due to the current state: " << status_unlock();
+    if (!check_send_unlock(protocol::read_command_id(_data, _size), _size)) {
+        ++send_statistics_.commands_dropped_;
         return false;
     }
-    if (std::numeric_limits<size_t>::max() - _size < send_queue_.size()) {
-        VSOMEIP_ERROR_P << "Dropping message type: " << protocol::read_command_id(_data, _size) << " and size: " << _size
-                        << ", to avoid buffer overflow, " << status_unlock();
+    send_statistics_.bytes_copied_ += send_queue_.push(_data, _size);
+    count_queued_unlock(1, _size);
+    send_unlock();
+    return true;
+}
+
+template<typename T>
+bool local_endpoint::send(T const& _in) {
+    std::scoped_lock const lock{mutex_};
+    auto const wire_size = protocol::wire_size(_in);
+    if (!check_send_unlock(protocol::get_id(_in), wire_size)) {
+        ++send_statistics_.commands_dropped_;
         return false;
     }
-    // Note: _size + send_queue_.size() could oveflow,
-    // Note 2:
-    // 1. Assume: If send_queue_ is not greater then the queue_limit_ after the n-th call,
-    // then the next check ensures that the send_queue_.size() will be not greater then the queue_limit_
-    // after the n+1-th call
-    // 2. send_queue_.size() starts with 0 -> queue_limit_ is not smaller then send_queue_.size() after n = 0
-    // 1. + 2. => the next line can never cause trouble
-    if (queue_limit_ != QUEUE_SIZE_UNLIMITED && queue_limit_ - send_queue_.size() < _size) {
-        VSOMEIP_ERROR_P << "Dropping message of type: " << protocol::read_command_id(_data, _size) << ", because the queue limit ("
-                        << queue_limit_ << ") would be exceeded with the message size: " << _size << ", " << status_unlock();
+    protocol::serialize(_in, send_queue_.extend(wire_size));
+    send_statistics_.bytes_copied_ += wire_size;
+    count_queued_unlock(1, wire_size);
+    send_unlock();
+    return true;
+}
+
+template bool local_endpoint::send<protocol::command_header>(protocol::command_header const&);
+
+bool local_endpoint::send(byte_t const* _header, uint32_t _header_size, byte_t const* _data, uint32_t _size) {
+    std::scoped_lock const lock{mutex_};
+    if (!check_send_unlock(protocol::read_command_id(_header, _header_size), size_t(_header_size) + _size)) {
+        ++send_statistics_.commands_dropped_;
         return false;
     }
-    if (max_message_size_ < _size) {
-        VSOMEIP_ERROR_P << "Dropping message of type: " << protocol::read_command_id(_data, _size) << " because the message size (" << _size
-                        << ") exceeded the limit (" << max_message_size_ << "), " << status_unlock();
+    send_statistics_.bytes_copied_ += send_queue_.push(_header, _header_size);
+    send_statistics_.bytes_copied_ += send_queue_.push(_data, _size);
+    count_queued_unlock(1, uint64_t(_header_size) + _size);
+    send_unlock();
+    return true;
+}
+
+bool local_endpoint::send(byte_t const* _header, uint32_t _header_size, local_send_queue::frame_t const& _frame) {
+    std::scoped_lock const lock{mutex_};
+    if (!check_send_unlock(protocol::read_command_id(_header, _header_size), size_t(_header_size) + (_frame ? _frame->size() : 0))) {
+        ++send_statistics_.commands_dropped_;
         return false;
     }
-    send_queue_.insert(send_queue_.end(), _data, _data + _size);
+    send_statistics_.bytes_copied_ += send_queue_.push(_header, _header_size, _frame);
+    count_queued_unlock(1, uint64_t(_header_size) + (_frame ? _frame->size() : 0));
     send_unlock();
     return true;
 }
 
-template<typename T>
-bool local_endpoint::send(T const& _in) {
+std::size_t local_endpoint::send(std::vector<command> const& _commands) {
     std::scoped_lock const lock{mutex_};
-    auto const wire_size = protocol::wire_size(_in);
-    auto const id = protocol::get_id(_in);
+    std::size_t its_queued{0};
+    uint64_t its_queued_bytes{0};
+    for (auto const& c : _commands) {
+        auto const its_size = c.header_.size() + (c.frame_ ? c.frame_->size() : 0);
+        if (!check_send_unlock(protocol::read_command_id(c.header_.data(), c.header_.size()), its_size)) {
+            ++send_statistics_.commands_dropped_;
+            continue;
+        }
+        send_statistics_.bytes_copied_ += send_queue_.push(c.header_.data(), uint32_t(c.header_.size()), c.frame_);
+        ++its_queued;
+        its_queued_bytes += its_size;
+    }
+    if (its_queued > 0) {
+        count_queued_unlock(its_queued, its_queued_bytes);
+        send_unlock();
+    }
+    return its_queued;
+}
+
+void local_endpoint::count_queued_unlock(uint64_t _commands, uint64_t _bytes) {
+    send_statistics_.commands_queued_ += _commands;
+    send_statistics_.bytes_queued_ += _bytes;
+    send_statistics_.queue_size_high_water_mark_ = std::max(send_statistics_.queue_size_high_water_mark_, send_queue_.size());
+}
+
+bool local_endpoint::check_send_unlock(protocol::id_e _id, size_t _size) const {
     if (is_flushing_) {
-        VSOMEIP_WARNING_P << "Dropping message type: " << id << " and size: " << wire_size
+        VSOMEIP_WARNING_P << "Dropping message type: " << _id << " and size: " << _size
                           << ", due to the current state: " << status_unlock();
         return false;
     }
-    if (std::numeric_limits<size_t>::max() - wire_size < send_queue_.size()) {
-        VSOMEIP_ERROR_P << "Dropping message type: " << id << " and size: " << wire_size
-                        << ", to avoid buffer overflow, state: " << status_unlock();
+    if (std::numeric_limits<size_t>::max() - _size < send_queue_.size()) {
+        VSOMEIP_ERROR_P << "Dropping message type: " << _id << " and size: " << _size << ", to avoid buffer overflow, " << status_unlock();
         return false;
     }
-    if (queue_limit_ != QUEUE_SIZE_UNLIMITED && queue_limit_ - send_queue_.size() < wire_size) {
-        VSOMEIP_ERROR_P << "Dropping message of type: " << id << ", because the queue limit (" << queue_limit_
-                        << ") would be exceeded with the message size: " << wire_size << ", state: " << status_unlock();
+    // Note: _size + send_queue_.size() could oveflow,
+    // Note 2:
+    // 1. Assume: If send_queue_ is not greater then the queue_limit_ after the n-th call,
+    // then the next check ensures that the send_queue_.size() will be not greater then the queue_limit_
+    // after the n+1-th call
+    // 2. send_queue_.size() starts with 0 -> queue_limit_ is not smaller then send_queue_.size() after n = 0
+    // 1. + 2. => the next line can never cause trouble
+    if (queue_limit_ != QUEUE_SIZE_UNLIMITED && queue_limit_ - send_queue_.size() < _size) {
+        VSOMEIP_ERROR_P << "Dropping message of type: " << _id << ", because the queue limit (" << queue_limit_
+                        << ") would be exceeded with the message size: " << _size << ", " << status_unlock();
         return false;
     }
-    if (max_message_size_ < wire_size) {
-        VSOMEIP_ERROR_P << "Dropping message of type: " << id << " because the message size (" << wire_size << ") exceeded the limit ("
-                        << max_message_size_ << "), state: " << status_unlock();
+    if (max_message_size_ < _size) {
+        VSOMEIP_ERROR_P << "Dropping message of type: " << _id << " because the message size (" << _size << ") exceeded the limit ("
+                        << max_message_size_ << "), " << status_unlock();
         return false;
     }
-    auto former_size = send_queue_.size();
-    send_queue_.resize(former_size + wire_size);
-
-    protocol::serialize(_in, send_queue_.data() + former_size);
-    send_unlock();
     return true;
 }
 
-template bool local_endpoint::send<protocol::command_header>(protocol::command_header const&);
-
 void local_endpoint::connect_unlock() {
     if (state_ != state_e::INIT) {
         return;
@@ -270,6 +315,13 @@ void local_endpoint::stop_internal(std::unique_lock<std::mutex>& lock, bool _due
     if (connecting_timebox_) {
         connecting_timebox_->stop();
     }
+    if (coalescing_timer_) {
+        coalescing_timer_->stop();
+    }
+    if (is_coalescing_ && !_due_to_error && state_ == state_e::CONNECTED) {
+        // do not lose the held back commands, the loop below waits for them to be sent
+        send_buffer_unlock();
+    }
 
     uint32_t retry_count(0);
     while (true) {
@@ -318,7 +370,9 @@ void local_endpoint::receive_unlock() {
 }
 void local_endpoint::send_unlock() {
     if (is_started_ && state_ == state_e::CONNECTED && !is_sending_) {
-        send_buffer_unlock();
+        if (!coalesce_unlock()) {
+            send_buffer_unlock();
+        }
     } else if (state_ == state_e::STOPPED || state_ == state_e::FAILED) {
         // any `send` in this state is "interesting", so log it
         VSOMEIP_WARNING_P << "Cannot send, " << status_unlock();
@@ -342,12 +396,49 @@ void local_endpoint::send_buffer_unlock() {
         return;
     }
     is_sending_ = true;
+    if (is_coalescing_) {
+        is_coalescing_ = false;
+        coalescing_timer_->stop();
+    }
     socket_->async_send(std::move(send_queue_), [weak_self = weak_from_this()](auto const& _ec, size_t _bytes, auto _buffer) {
         if (auto self = weak_self.lock(); self) {
             self->send_cbk(_ec, _bytes, std::move(_buffer));
         }
     });
-    send_queue_ = {};
+    send_queue_ = local_send_queue(VSOMEIP_LOCAL_GATHER_THRESHOLD);
+}
+
+bool local_endpoint::coalesce_unlock() {
+    // Note: Commands that are queued while a write is ongoing are sent without
+    // further delay once the write completed, as they were delayed already.
+    if (!coalescing_.is_enabled() || is_flushing_ || send_queue_.empty()
+        || (coalescing_.max_batch_size_ > 0 && send_queue_.size() >= coalescing_.max_batch_size_)) {
+        return false;
+    }
+    if (is_coalescing_) {
+        // the maximum delay is not extended by subsequent commands
+        return true;
+    }
+    if (!coalescing_timer_) {
+        coalescing_timer_ = timer::create(io_, coalescing_.max_delay_, [weak_self = weak_from_this()] {
+            if (auto self = weak_self.lock(); self) {
+                self->coalescing_timeout();
+            }
+            return false;
+        });
+    }
+    is_coalescing_ = true;
+    send_statistics_.coalesced_++;
+    coalescing_timer_->start();
+    return true;
+}
+
+void local_endpoint::coalescing_timeout() {
+    std::scoped_lock const lock{mutex_};
+    // the queue might have been sent already, because the batch became full
+    if (is_coalescing_ && state_ == state_e::CONNECTED && !is_sending_) {
+        send_buffer_unlock();
+    }
 }
 
 void local_endpoint::connect_cbk(boost::system::error_code const& _ec) {
@@ -421,14 +512,17 @@ std::string local_endpoint::status() const {
 std::string local_endpoint::status_unlock() const {
     std::stringstream s;
     s << "Client: " << hex4(peer_data_.id_) << " (" << peer_data_.lc_token_ << "), connection : " << socket_->to_string()
-      << ", send_queue: " << send_queue_.size() << ", receive_buffer: " << *receive_buffer_ << ", is_sending: " << std::boolalpha
-      << is_sending_ << ", is_flushing: " << is_flushing_ << ", state: " << state_;
+      << ", send_queue: " << send_queue_ << ", receive_buffer: " << *receive_buffer_ << ", copied/sent: " << send_statistics_.bytes_copied_
+      << "/" << send_statistics_.bytes_sent_ << ", is_sending: " << std::boolalpha
+      << is_sending_ << ", is_flushing: " << is_flushing_ << ", is_coalescing: " << is_coalescing_ << ", state: " << state_;
     return s.str();
 }
 
-void local_endpoint::send_cbk(boost::system::error_code const& _ec, [[maybe_unused]] size_t _bytes, std::vector<uint8_t> _send_buffer) {
+void local_endpoint::send_cbk(boost::system::error_code const& _ec, size_t _bytes, local_send_queue _send_buffer) {
     if (!_ec) {
         std::scoped_lock const lock{mutex_};
+        send_statistics_.bytes_sent_ += _bytes;
+        send_statistics_.writes_++;
         if (state_ == state_e::CONNECTED) {
             send_buffer_unlock();
         } else {
@@ -470,12 +564,16 @@ void local_endpoint::send_cbk(boost::system::error_code const& _ec, [[maybe_unus
                     assignment_timebox_->stop();
                 }
             }
+            receive_statistics_.bytes_received_ += result.message_size_;
+            ++receive_statistics_.commands_received_;
             _lock.unlock(); // fine to unlock, because the caller needs to return, before we would schedule another read
             routing->on_message(result.message_data_, result.message_size_, peer_data_);
             _lock.lock(); // because next_message changes internal state -> lock
         }
     } else {
         while (receive_buffer_->next_message(result)) {
+            receive_statistics_.bytes_received_ += result.message_size_;
+            ++receive_statistics_.commands_received_;
             _lock.unlock(); // fine to unlock, because the caller needs to return, before we would schedule another read
             routing->on_message(result.message_data_, result.message_size_, peer_data_);
             _lock.lock(); // because next_message changes internal state -> lock
@@ -606,6 +704,25 @@ size_t local_endpoint::get_queue_size() const {
     return send_queue_.size();
 }
 
+local_endpoint::send_statistics local_endpoint::get_send_statistics() const {
+    std::scoped_lock const lock{mutex_};
+    return send_statistics_;
+}
+
+void local_endpoint::get_statistics(endpoint_statistics_t& _statistics) const {
+    std::scoped_lock const lock{mutex_};
+    _statistics.is_local_ = true;
+    _statistics.is_reliable_ = true;
+    _statistics.peer_ = peer_data_.id_;
+    _statistics.messages_sent_ = send_statistics_.commands_queued_;
+    _statistics.bytes_sent_ = send_statistics_.bytes_queued_;
+    _statistics.messages_received_ = receive_statistics_.commands_received_;
+    _statistics.bytes_received_ = receive_statistics_.bytes_received_;
+    _statistics.messages_dropped_ = send_statistics_.commands_dropped_;
+    _statistics.queue_size_ = send_queue_.size();
+    _statistics.queue_size_high_water_mark_ = send_statistics_.queue_size_high_water_mark_;
+}
+
 std::string local_endpoint::get_env() const {
     return peer_data_.env_;
 }
@@ -0,0 +1,63 @@
+// Copyright (C) 2014-2026 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "../include/local_send_queue.hpp"
+
+#include <cstring>
+
+namespace vsomeip_v3 {
+
+local_send_queue::local_send_queue(std::size_t _gather_threshold) : gather_threshold_(_gather_threshold) { }
+
+byte_t* local_send_queue::extend(std::size_t _size) {
+    if (segments_.empty() || segments_.back().frame_) {
+        segments_.push_back({data_.size(), 0, nullptr});
+    }
+    segments_.back().size_ += _size;
+    size_ += _size;
+
+    const std::size_t its_offset = data_.size();
+    data_.resize(its_offset + _size);
+    return data_.data() + its_offset;
+}
+
+std::size_t local_send_queue::push(const byte_t* _data, std::size_t _size) {
+    if (_size > 0) {
+        std::memcpy(extend(_size), _data, _size);
+    }
+    return _size;
+}
+
+std::size_t local_send_queue::push(const byte_t* _header, std::size_t _header_size, const frame_t& _frame) {
+    std::size_t its_copied = push(_header, _header_size);
+    if (!_frame || _frame->empty()) {
+        return its_copied;
+    }
+    if (gather_threshold_ == 0 || _frame->size() < gather_threshold_) {
+        return its_copied + push(_frame->data(), _frame->size());
+    }
+    segments_.push_back({0, _frame->size(), _frame});
+    size_ += _frame->size();
+    return its_copied;
+}
+
+std::vector<boost::asio::const_buffer> local_send_queue::buffers() const {
+    std::vector<boost::asio::const_buffer> its_buffers;
+    its_buffers.reserve(segments_.size());
+    for (const auto& s : segments_) {
+        if (s.frame_) {
+            its_buffers.emplace_back(s.frame_->data(), s.size_);
+        } else {
+            its_buffers.emplace_back(data_.data() + s.offset_, s.size_);
+        }
+    }
+    return its_buffers;
+}
+
+std::ostream& operator<<(std::ostream& _out, const local_send_queue& _queue) {
+    return _out << "{size: " << _queue.size_ << ", copied: " << _queue.data_.size() << ", segments: " << _queue.segments_.size() << "}";
+}
+
+} // namespace vsomeip_v3
@@ -31,9 +31,11 @@ namespace vsomeip_v3 {
 
 local_server::local_server(boost::asio::io_context& _io, std::shared_ptr<local_acceptor> _acceptor,
                            std::shared_ptr<configuration> _configuration, std::weak_ptr<routing_host> _routing_host,
-                           connection_handler _connection_handler, bool _is_router, std::string _server_host) :
+                           connection_handler _connection_handler, bool _is_router, std::string _server_host,
+                           local_coalescing_t _coalescing) :
     is_router_(_is_router), io_(_io), acceptor_(std::move(_acceptor)), configuration_(std::move(_configuration)),
-    routing_host_(std::move(_routing_host)), connection_handler_(std::move(_connection_handler)), server_host_(std::move(_server_host)) { }
+    routing_host_(std::move(_routing_host)), connection_handler_(std::move(_connection_handler)), server_host_(std::move(_server_host)),
+    coalescing_(_coalescing) { }
 
 local_server::~local_server() = default;
 
@@ -221,7 +223,7 @@ void local_server::add_connection(client_t _client, [[maybe_unused]] client_t _e
             }
 
             auto ep = local_endpoint::create_server_ep(
-                    local_endpoint_context{io_, configuration_, routing_host_},
+                    local_endpoint_context{io_, configuration_, routing_host_, coalescing_},
                     local_endpoint_params{_client, rh->get_client(), std::move(_environment), std::move(_socket),
                                           // For TCP sockets use the real peer endpoint directly.
                                           // For UDS, fall back to what the client advertised in assign_client_command.
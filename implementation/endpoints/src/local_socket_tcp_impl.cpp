@@ -148,12 +148,13 @@ void local_socket_tcp_impl::async_receive(boost::asio::mutable_buffer _buffer, r
         boost::asio::post(io_context_, [h = std::move(_r_handler)] { h(boost::asio::error::fault, 0); });
     }
 }
-void local_socket_tcp_impl::async_send(std::vector<uint8_t> _data, write_handler _w_handle) {
+void local_socket_tcp_impl::async_send(local_send_queue _data, write_handler _w_handle) {
     std::unique_lock lock{socket_mtx_};
     if (socket_->is_open()) {
         // ensure the memory is kept alive as long as the callback hasn't been invoked
-        auto buffer = boost::asio::buffer(_data);
-        socket_->async_write({buffer}, [d = std::move(_data), handler = std::move(_w_handle)](auto const& _ec, size_t _bytes) mutable {
+        // (moving the queue does not move the referenced memory)
+        auto buffers = _data.buffers();
+        socket_->async_write(buffers, [d = std::move(_data), handler = std::move(_w_handle)](auto const& _ec, size_t _bytes) mutable {
             handler(_ec, _bytes, std::move(d));
         });
     } else {
@@ -0,0 +1,145 @@
+// Copyright (C) 2014-2026 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "../include/magic_cookie_search.hpp"
+
+#include <bit>
+#include <cstring>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#endif
+
+namespace vsomeip_v3 {
+namespace magic_cookie {
+
+namespace {
+
+constexpr std::size_t COOKIE_SIZE = 16;
+
+// Bytes that are equal in client and service cookies and are used to
+// select candidates before comparing the complete pattern.
+constexpr std::size_t FIRST_ANCHOR = 0; // 0xFF
+constexpr std::size_t SECOND_ANCHOR = 8; // 0xDE
+constexpr std::size_t THIRD_ANCHOR = 11; // 0xEF
+
+struct pattern {
+    pattern(byte_t _identifier, byte_t _type) :
+        bytes_{0xFF, 0xFF, _identifier, 0x00, 0x00, 0x00, 0x00, 0x08, 0xDE, 0xAD, 0xBE, 0xEF, 0x01, 0x01, _type, 0x00} { }
+
+    bool matches(const byte_t* _candidate) const { return std::memcmp(_candidate, bytes_, COOKIE_SIZE) == 0; }
+
+    byte_t bytes_[COOKIE_SIZE];
+};
+
+// Number of offsets that may hold a cookie. A cookie must be followed by at
+// least one byte to be reported.
+std::size_t get_candidates(std::size_t _size) {
+    return _size > COOKIE_SIZE ? _size - COOKIE_SIZE : 0;
+}
+
+std::uint32_t find_from(const byte_t* _buffer, std::size_t _begin, std::size_t _candidates, const pattern& _pattern) {
+    for (std::size_t i = _begin; i < _candidates; ++i) {
+        if (_buffer[i] == 0xFF && _pattern.matches(&_buffer[i])) {
+            return static_cast<std::uint32_t>(i);
+        }
+    }
+    return NOT_FOUND;
+}
+
+} // namespace
+
+std::uint32_t find_scalar(const byte_t* _buffer, std::size_t _size, byte_t _identifier, byte_t _type) {
+    return find_from(_buffer, 0, get_candidates(_size), pattern(_identifier, _type));
+}
+
+std::uint32_t find(const byte_t* _buffer, std::size_t _size, byte_t _identifier, byte_t _type) {
+    const std::size_t its_candidates = get_candidates(_size);
+    const pattern its_pattern(_identifier, _type);
+    std::size_t i = 0;
+
+    // Each block checks the anchors of consecutive candidates at once. The
+    // loads of a block never exceed _buffer + _size, as every candidate of a
+    // complete block is followed by a full cookie.
+#if defined(__AVX2__)
+    const __m256i its_ff = _mm256_set1_epi8(static_cast<char>(0xFF));
+    const __m256i its_de = _mm256_set1_epi8(static_cast<char>(0xDE));
+    const __m256i its_ef = _mm256_set1_epi8(static_cast<char>(0xEF));
+    for (; i + 32 <= its_candidates; i += 32) {
+        const __m256i its_first = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&_buffer[i + FIRST_ANCHOR]));
+        const __m256i its_second = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&_buffer[i + SECOND_ANCHOR]));
+        const __m256i its_third = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&_buffer[i + THIRD_ANCHOR]));
+        const __m256i its_match =
+                _mm256_and_si256(_mm256_and_si256(_mm256_cmpeq_epi8(its_first, its_ff), _mm256_cmpeq_epi8(its_second, its_de)),
+                                 _mm256_cmpeq_epi8(its_third, its_ef));
+        auto its_mask = static_cast<std::uint32_t>(_mm256_movemask_epi8(its_match));
+        while (its_mask != 0) {
+            const std::size_t its_offset = i + static_cast<std::size_t>(std::countr_zero(its_mask));
+            if (its_pattern.matches(&_buffer[its_offset])) {
+                return static_cast<std::uint32_t>(its_offset);
+            }
+            its_mask &= its_mask - 1;
+        }
+    }
+#elif defined(__SSE2__) || defined(_M_X64)
+    const __m128i its_ff = _mm_set1_epi8(static_cast<char>(0xFF));
+    const __m128i its_de = _mm_set1_epi8(static_cast<char>(0xDE));
+    const __m128i its_ef = _mm_set1_epi8(static_cast<char>(0xEF));
+    for (; i + 16 <= its_candidates; i += 16) {
+        const __m128i its_first = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&_buffer[i + FIRST_ANCHOR]));
+        const __m128i its_second = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&_buffer[i + SECOND_ANCHOR]));
+        const __m128i its_third = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&_buffer[i + THIRD_ANCHOR]));
+        const __m128i its_match = _mm_and_si128(_mm_and_si128(_mm_cmpeq_epi8(its_first, its_ff), _mm_cmpeq_epi8(its_second, its_de)),
+                                                _mm_cmpeq_epi8(its_third, its_ef));
+        auto its_mask = static_cast<std::uint32_t>(_mm_movemask_epi8(its_match));
+        while (its_mask != 0) {
+            const std::size_t its_offset = i + static_cast<std::size_t>(std::countr_zero(its_mask));
+            if (its_pattern.matches(&_buffer[its_offset])) {
+                return static_cast<std::uint32_t>(its_offset);
+            }
+            its_mask &= its_mask - 1;
+        }
+    }
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+    const uint8x16_t its_ff = vdupq_n_u8(0xFF);
+    const uint8x16_t its_de = vdupq_n_u8(0xDE);
+    const uint8x16_t its_ef = vdupq_n_u8(0xEF);
+    for (; i + 16 <= its_candidates; i += 16) {
+        const uint8x16_t its_match = vandq_u8(vandq_u8(vceqq_u8(vld1q_u8(&_buffer[i + FIRST_ANCHOR]), its_ff),
+                                                       vceqq_u8(vld1q_u8(&_buffer[i + SECOND_ANCHOR]), its_de)),
+                                              vceqq_u8(vld1q_u8(&_buffer[i + THIRD_ANCHOR]), its_ef));
+        // Narrow to one nibble per candidate, as NEON lacks a movemask
+        std::uint64_t its_mask = vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(its_match), 4)), 0);
+        while (its_mask != 0) {
+            const std::size_t its_offset = i + static_cast<std::size_t>(std::countr_zero(its_mask) >> 2);
+            if (its_pattern.matches(&_buffer[its_offset])) {
+                return static_cast<std::uint32_t>(its_offset);
+            }
+            its_mask &= ~(std::uint64_t(0xF) << ((its_offset - i) << 2));
+        }
+    }
+#endif
+
+    return find_from(_buffer, i, its_candidates, its_pattern);
+}
+
+const char* get_implementation() {
+#if defined(__AVX2__)
+    return "avx2";
+#elif defined(__SSE2__) || defined(_M_X64)
+    return "sse2";
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+    return "neon";
+#else
+    return "scalar";
+#endif
+}
+
+} // namespace magic_cookie
+} // namespace vsomeip_v3
@@ -86,9 +86,8 @@ bool server_endpoint_impl<Protocol>::send(const uint8_t* _data, uint32_t _size)
     bool is_valid_target(false);
 
     if (VSOMEIP_SESSION_POS_MAX < _size) {
-        std::scoped_lock its_lock{mutex_};
-
         if (endpoint_impl<Protocol>::sending_blocked_) {
+            endpoint_impl<Protocol>::counters_.on_send(_size, false);
             return false;
         }
 
@@ -106,6 +105,8 @@ bool server_endpoint_impl<Protocol>::send(const uint8_t* _data, uint32_t _size)
 
         if (is_valid_target) {
             is_valid_target = send_intern(its_target, _data, _size);
+        } else {
+            endpoint_impl<Protocol>::counters_.on_send(_size, false);
         }
     }
     return is_valid_target;
@@ -128,16 +129,20 @@ bool server_endpoint_impl<Protocol>::send(const std::vector<byte_t>& _cmd_header
 
 template<typename Protocol>
 bool server_endpoint_impl<Protocol>::send_intern(endpoint_type _target, const byte_t* _data, uint32_t _size) {
-    const auto its_target_iterator = find_or_create_target_unlocked(_target);
-    auto& its_data(its_target_iterator->second);
+    const auto its_target = lock_target(_target);
+    const auto its_target_iterator = its_target.it_;
+    auto& its_data(*its_target_iterator->second);
 
     // STEP 1: Check queue limit
     if (!check_queue_limit(_data, _size, its_data)) {
+        endpoint_impl<Protocol>::counters_.on_send(_size, false);
         return false;
     }
 
     if (!check_message_size(_size)) {
-        return segment_message(_data, _size, _target) == endpoint_impl<Protocol>::cms_ret_e::MSG_WAS_SPLIT;
+        const bool is_split = (segment_message(_data, _size, its_target_iterator) == endpoint_impl<Protocol>::cms_ret_e::MSG_WAS_SPLIT);
+        endpoint_impl<Protocol>::counters_.on_send(_size, is_split);
+        return is_split;
     }
 
     bool must_depart(false);
@@ -152,15 +157,14 @@ bool server_endpoint_impl<Protocol>::send_intern(endpoint_type _target, const by
 
     std::chrono::nanoseconds its_debouncing(0), its_retention(0);
     if (its_service != VSOMEIP_SD_SERVICE && its_method != VSOMEIP_SD_METHOD) {
-        get_configured_times_from_endpoint(its_service, its_method, &its_debouncing, &its_retention);
+        get_configured_times(its_service, its_method, its_debouncing, its_retention);
     }
 
     // STEP 4: Check if the passenger enters an empty train
-    const std::pair<service_t, method_t> its_identifier = std::make_pair(its_service, its_method);
     if (its_data.train_->passengers_.empty()) {
         its_data.train_->departure_ = its_now + its_retention;
     } else {
-        if (its_data.train_->passengers_.end() != its_data.train_->passengers_.find(its_identifier)) {
+        if (its_data.train_->has_passenger(its_service, its_method)) {
             must_depart = true;
         } else {
             // STEP 5: Check whether the current message fits into the current train
@@ -200,13 +204,13 @@ bool server_endpoint_impl<Protocol>::send_intern(endpoint_type _target, const by
         // departs. Block sending until train is allowed to depart.
         schedule_train(its_data);
 
-        its_data.train_ = std::make_shared<train>();
+        its_data.train_ = its_data.trains_.get();
         its_data.train_->departure_ = its_now + its_retention;
     }
 
     // STEP 9: insert current message buffer
     its_data.train_->buffer_->insert(its_data.train_->buffer_->end(), _data, _data + _size);
-    its_data.train_->passengers_.insert(its_identifier);
+    its_data.train_->add_passenger(its_service, its_method);
     // STEP 9.1: update the trains minimal debounce time if necessary
     if (its_debouncing < its_data.train_->minimal_debounce_time_) {
         its_data.train_->minimal_debounce_time_ = its_debouncing;
@@ -219,6 +223,7 @@ bool server_endpoint_impl<Protocol>::send_intern(endpoint_type _target, const by
     // STEP 10: restart timer with current departure time
     start_dispatch_timer(its_target_iterator, its_now);
 
+    endpoint_impl<Protocol>::counters_.on_send(_size, true);
     return true;
 }
 
@@ -262,13 +267,12 @@ bool server_endpoint_impl<Protocol>::tp_segmentation_enabled(service_instance_t
 
 template<typename Protocol>
 void server_endpoint_impl<Protocol>::send_segments(const tp::tp_split_messages_t& _segments, std::uint32_t _separation_time,
-                                                   const endpoint_type& _target) {
+                                                   const target_data_iterator_type _it) {
 
     if (_segments.size() == 0)
         return;
 
-    const auto its_target_iterator = find_or_create_target_unlocked(_target);
-    auto& its_data = its_target_iterator->second;
+    auto& its_data = *_it->second;
 
     auto its_now(std::chrono::steady_clock::now());
 
@@ -277,7 +281,7 @@ void server_endpoint_impl<Protocol>::send_segments(const tp::tp_split_messages_t
 
     std::chrono::nanoseconds its_debouncing(0), its_retention(0);
     if (its_service != VSOMEIP_SD_SERVICE && its_method != VSOMEIP_SD_METHOD) {
-        get_configured_times_from_endpoint(its_service, its_method, &its_debouncing, &its_retention);
+        get_configured_times(its_service, its_method, its_debouncing, its_retention);
     }
     // update the trains minimal debounce time if necessary
     if (its_debouncing < its_data.train_->minimal_debounce_time_) {
@@ -291,7 +295,7 @@ void server_endpoint_impl<Protocol>::send_segments(const tp::tp_split_messages_t
     // messages as we will send several now anyway.
     if (!its_data.train_->passengers_.empty()) {
         schedule_train(its_data);
-        its_data.train_ = std::make_shared<train>();
+        its_data.train_ = its_data.trains_.get();
         its_data.train_->departure_ = its_now + its_retention;
     }
 
@@ -299,24 +303,70 @@ void server_endpoint_impl<Protocol>::send_segments(const tp::tp_split_messages_t
         its_data.queue_.emplace_back(s, _separation_time);
         its_data.queue_size_ += s->size();
     }
+    endpoint_impl<Protocol>::counters_.on_queue_size(its_data.queue_size_);
 
     if (!its_data.is_sending_ && !its_data.queue_.empty()) { // no writing in progress
         // ignore retention time and send immediately as the train is full anyway
-        (void)send_queued(its_target_iterator);
+        (void)send_queued(_it);
+    }
+}
+
+template<typename Protocol>
+typename server_endpoint_impl<Protocol>::locked_target server_endpoint_impl<Protocol>::lock_target(const endpoint_type& _target) {
+
+    while (true) {
+        if (auto its_target = find_locked_target(_target); its_target) {
+            return std::move(*its_target);
+        }
+
+        std::unique_lock its_lock(targets_mutex_);
+        if (!targets_.contains(_target)) {
+            targets_.emplace(_target, std::make_shared<endpoint_data_type>(this->io_));
+        }
     }
 }
 
 template<typename Protocol>
-typename server_endpoint_impl<Protocol>::target_data_iterator_type
-server_endpoint_impl<Protocol>::find_or_create_target_unlocked(endpoint_type _target) {
+std::optional<typename server_endpoint_impl<Protocol>::locked_target>
+server_endpoint_impl<Protocol>::find_locked_target(const endpoint_type& _target) {
 
+    std::shared_lock its_targets_lock(targets_mutex_);
     auto its_iterator = targets_.find(_target);
     if (its_iterator == targets_.end()) {
-        auto its_result = targets_.emplace(std::make_pair(_target, endpoint_data_type(this->io_)));
-        its_iterator = its_result.first;
+        return std::nullopt;
+    }
+
+    std::unique_lock its_lock(its_iterator->second->mutex_);
+    return locked_target{std::move(its_targets_lock), its_iterator, std::move(its_lock)};
+}
+
+template<typename Protocol>
+void server_endpoint_impl<Protocol>::remove_target(const endpoint_type& _target, const std::shared_ptr<endpoint_data_type>& _data) {
+
+    std::unique_lock its_lock(targets_mutex_);
+    auto its_iterator = targets_.find(_target);
+    if (its_iterator != targets_.end() && its_iterator->second == _data) {
+        targets_.erase(its_iterator);
+    }
+}
+
+template<typename Protocol>
+void server_endpoint_impl<Protocol>::reset_sending_state() {
+
+    std::shared_lock its_targets_lock(targets_mutex_);
+    for (auto& [its_target, its_data] : targets_) {
+        std::scoped_lock its_lock(its_data->mutex_);
+        its_data->is_sending_ = false;
     }
+}
 
-    return its_iterator;
+template<typename Protocol>
+void server_endpoint_impl<Protocol>::get_configured_times(service_t _service, method_t _method, std::chrono::nanoseconds& _debouncing,
+                                                          std::chrono::nanoseconds& _maximum_retention) {
+    configured_times_.get(_service, _method, this->configuration_->get_service_generation(), _debouncing, _maximum_retention,
+                          [this, _service, _method](std::chrono::nanoseconds* _debounce, std::chrono::nanoseconds* _retention) {
+                              get_configured_times_from_endpoint(_service, _method, _debounce, _retention);
+                          });
 }
 
 template<typename Protocol>
@@ -328,7 +378,7 @@ void server_endpoint_impl<Protocol>::schedule_train(endpoint_data_type& _data) {
         }
     }
 
-    _data.dispatched_trains_[_data.train_->departure_].push_back(_data.train_);
+    _data.dispatched_trains_.push(_data.train_);
 }
 
 template<typename Protocol>
@@ -338,7 +388,7 @@ bool server_endpoint_impl<Protocol>::check_message_size(std::uint32_t _size) con
 
 template<typename Protocol>
 typename endpoint_impl<Protocol>::cms_ret_e
-server_endpoint_impl<Protocol>::segment_message(const std::uint8_t* const _data, std::uint32_t _size, const endpoint_type& _target) {
+server_endpoint_impl<Protocol>::segment_message(const std::uint8_t* const _data, std::uint32_t _size, const target_data_iterator_type _it) {
 
     if (endpoint_impl<Protocol>::is_supporting_someip_tp_ && _data != nullptr) {
         const service_t its_service = bithelper::read_uint16_be(&_data[VSOMEIP_SERVICE_POS_MIN]);
@@ -352,7 +402,7 @@ server_endpoint_impl<Protocol>::segment_message(const std::uint8_t* const _data,
 
                 this->configuration_->get_tp_configuration(its_service, its_instance, its_method, false, its_max_segment_length,
                                                            its_separation_time);
-                send_segments(tp::tp::tp_split_message(_data, _size, its_max_segment_length), its_separation_time, _target);
+                send_segments(tp::tp::tp_split_message(_data, _size, its_max_segment_length), its_separation_time, _it);
                 return endpoint_impl<Protocol>::cms_ret_e::MSG_WAS_SPLIT;
             }
         }
@@ -422,9 +472,10 @@ bool server_endpoint_impl<Protocol>::queue_train(target_data_iterator_type _it,
 
     bool must_erase(false);
 
-    auto& its_data = _it->second;
+    auto& its_data = *_it->second;
     its_data.queue_size_ += _train->buffer_->size();
     its_data.queue_.emplace_back(_train->buffer_, 0);
+    endpoint_impl<Protocol>::counters_.on_queue_size(its_data.queue_size_);
 
     if (!its_data.is_sending_) { // no writing in progress
         must_erase = send_queued(_it);
@@ -443,28 +494,19 @@ bool server_endpoint_impl<Protocol>::flush(endpoint_type _key) {
     bool has_queued(true);
     bool is_current_train(true);
 
-    std::scoped_lock its_lock(mutex_);
-
-    auto it = targets_.find(_key);
-    if (it == targets_.end())
+    const auto its_target = find_locked_target(_key);
+    if (!its_target)
         return false;
 
-    auto& its_data = it->second;
+    const auto it = its_target->it_;
+    auto& its_data = *it->second;
     auto its_train(its_data.train_);
     if (!its_data.dispatched_trains_.empty()) {
 
-        auto its_dispatched = its_data.dispatched_trains_.begin();
-        if (its_dispatched->first <= its_train->departure_) {
+        if (its_data.dispatched_trains_.front()->departure_ <= its_train->departure_) {
 
             is_current_train = false;
-            if (!its_dispatched->second.empty()) {
-                its_train = its_dispatched->second.front();
-                its_dispatched->second.pop_front();
-                if (its_dispatched->second.empty()) {
-
-                    its_data.dispatched_trains_.erase(its_dispatched);
-                }
-            }
+            its_train = its_data.dispatched_trains_.pop();
         }
     }
 
@@ -474,12 +516,16 @@ bool server_endpoint_impl<Protocol>::flush(endpoint_type _key) {
 
         // Reset current train if necessary
         if (is_current_train) {
-            its_train->reset();
+            its_data.trains_.reset(*its_train);
         }
     } else {
         has_queued = false;
     }
 
+    if (!is_current_train) {
+        its_data.trains_.release(std::move(its_train));
+    }
+
     if (!is_current_train || !its_data.dispatched_trains_.empty()) {
 
         auto its_now(std::chrono::steady_clock::now());
@@ -498,13 +544,12 @@ template<typename Protocol>
 void server_endpoint_impl<Protocol>::send_cbk(const endpoint_type _key, boost::system::error_code const& _error, std::size_t _bytes) {
     (void)_bytes;
 
-    std::scoped_lock its_lock(mutex_);
-
-    auto it = targets_.find(_key);
-    if (it == targets_.end())
+    auto its_target = find_locked_target(_key);
+    if (!its_target)
         return;
 
-    auto& its_data = it->second;
+    const auto it = its_target->it_;
+    auto& its_data = *it->second;
 
     its_data.sent_timer_.cancel();
 
@@ -564,7 +609,10 @@ void server_endpoint_impl<Protocol>::send_cbk(const endpoint_type _key, boost::s
                           << its_data.queue_.size() << " " << its_data.queue_size_ << " (" << hex4(its_client) << "): ["
                           << hex4(its_service) << "." << hex4(its_method) << "." << hex4(its_session) << "]  endpoint -> " << this;
         cancel_dispatch_timer(it);
-        targets_.erase(it);
+
+        const auto its_erroneous = it->second;
+        its_target.reset();
+        remove_target(_key, its_erroneous);
     }
 }
 
@@ -581,9 +629,10 @@ template<typename Protocol>
 size_t server_endpoint_impl<Protocol>::get_queue_size() const {
     size_t its_queue_size(0);
     {
-        std::scoped_lock its_lock(mutex_);
+        std::shared_lock its_targets_lock(targets_mutex_);
         for (const auto& t : targets_) {
-            its_queue_size += t.second.queue_size_;
+            std::scoped_lock its_lock(t.second->mutex_);
+            its_queue_size += t.second->queue_size_;
         }
     }
     return its_queue_size;
@@ -593,15 +642,14 @@ template<typename Protocol>
 void server_endpoint_impl<Protocol>::start_dispatch_timer(target_data_iterator_type _it,
                                                           const std::chrono::steady_clock::time_point& _now) {
 
-    auto& its_data = _it->second;
+    auto& its_data = *_it->second;
     std::shared_ptr<train> its_train(its_data.train_);
 
     if (!its_data.dispatched_trains_.empty()) {
 
-        auto its_dispatched = its_data.dispatched_trains_.begin();
-        if (its_dispatched->first < its_train->departure_) {
+        if (its_data.dispatched_trains_.front()->departure_ < its_train->departure_) {
 
-            its_train = its_dispatched->second.front();
+            its_train = its_data.dispatched_trains_.front();
         }
     }
 
@@ -625,7 +673,7 @@ void server_endpoint_impl<Protocol>::start_dispatch_timer(target_data_iterator_t
 
 template<typename Protocol>
 void server_endpoint_impl<Protocol>::cancel_dispatch_timer(target_data_iterator_type _it) {
-    _it->second.dispatch_timer_->cancel();
+    _it->second->dispatch_timer_->cancel();
 }
 
 template<typename Protocol>
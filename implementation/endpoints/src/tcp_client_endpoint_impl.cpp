@@ -467,6 +467,7 @@ void tcp_client_endpoint_impl::receive_cbk(boost::system::error_code const& _err
                     }
                     if (needs_forwarding) {
                         if (!use_magic_cookies_) {
+                            counters_.on_receive(current_message_size);
                             its_lock.unlock();
                             its_host->on_message(&(*_recv_buffer)[its_iteration_gap], current_message_size, this, remote_address_,
                                                  remote_port_, false);
@@ -474,6 +475,7 @@ void tcp_client_endpoint_impl::receive_cbk(boost::system::error_code const& _err
                         } else {
                             // Only call on_message without a magic cookie in front of the buffer!
                             if (!is_magic_cookie(_recv_buffer, its_iteration_gap)) {
+                                counters_.on_receive(current_message_size);
                                 its_lock.unlock();
                                 its_host->on_message(&(*_recv_buffer)[its_iteration_gap], current_message_size, this, remote_address_,
                                                      remote_port_, false);
@@ -0,0 +1,102 @@
+// Copyright (C) 2014-2026 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "../include/tcp_receive_buffer.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+namespace vsomeip_v3 {
+
+tcp_receive_buffer::tcp_receive_buffer(std::size_t _chunk_size, std::uint32_t _shrink_threshold) :
+    chunk_size_(_chunk_size), shrink_threshold_(_shrink_threshold), mem_(new byte_t[_chunk_size]), capacity_(_chunk_size) { }
+
+boost::asio::mutable_buffer tcp_receive_buffer::buffer() {
+    if (start_ == end_) {
+        start_ = end_ = 0;
+    } else if (end_ == capacity_) {
+        compact();
+    }
+
+    return boost::asio::buffer(mem_.get() + end_, capacity_ - end_);
+}
+
+bool tcp_receive_buffer::bump_end(std::size_t _new_bytes) {
+    if (_new_bytes > capacity_ - end_) {
+        return false;
+    }
+    end_ += _new_bytes;
+    return true;
+}
+
+void tcp_receive_buffer::consume(std::size_t _size) {
+    start_ += std::min(_size, size());
+
+    // Shrink heuristic: a message that would have filled more than half of
+    // the chunk indicates that the large allocation may be needed again.
+    if (_size > (chunk_size_ >> 1)) {
+        shrink_count_ = 0;
+    } else {
+        shrink_count_++;
+    }
+
+    if (start_ == end_) {
+        start_ = end_ = 0;
+        if (chunk_ && shrink_threshold_ > 0 && shrink_count_ > shrink_threshold_) {
+            mem_ = std::move(chunk_);
+            capacity_ = chunk_size_;
+            shrink_count_ = 0;
+        }
+    }
+}
+
+void tcp_receive_buffer::prepare(std::size_t _missing) {
+    if (capacity_ - end_ >= _missing) {
+        return;
+    }
+
+    const std::size_t its_required = size() + _missing;
+    if (its_required <= capacity_) {
+        compact();
+        return;
+    }
+
+    // Single allocation, sized for the pending message
+    std::unique_ptr<byte_t[]> its_mem(new byte_t[its_required]);
+    std::memcpy(its_mem.get(), data(), size());
+    if (!chunk_) {
+        chunk_ = std::move(mem_);
+    }
+    mem_ = std::move(its_mem);
+    capacity_ = its_required;
+    end_ = size();
+    start_ = 0;
+}
+
+void tcp_receive_buffer::reset() {
+    if (chunk_) {
+        mem_ = std::move(chunk_);
+        capacity_ = chunk_size_;
+    }
+    shrink_count_ = 0;
+    start_ = end_ = 0;
+}
+
+void tcp_receive_buffer::compact() {
+    if (start_ == 0) {
+        return;
+    }
+    // The regions might overlap
+    std::memmove(mem_.get(), mem_.get() + start_, size());
+    end_ -= start_;
+    start_ = 0;
+}
+
+std::ostream& operator<<(std::ostream& _out, const tcp_receive_buffer& _buffer) {
+    return _out << "{capacity: " << _buffer.capacity_ << ", first_used: " << _buffer.start_ << ", last_used: " << _buffer.end_
+                << ", shrink: [" << _buffer.shrink_count_ << ", " << _buffer.shrink_threshold_ << "]}";
+}
+
+} // namespace vsomeip_v3
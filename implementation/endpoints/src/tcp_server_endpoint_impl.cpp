@@ -167,16 +167,15 @@ void tcp_server_endpoint_impl::stop(bool /*_due_to_error*/) {
 }
 
 bool tcp_server_endpoint_impl::send_to(const std::shared_ptr<endpoint_definition> _target, const byte_t* _data, uint32_t _size) {
-    std::scoped_lock its_lock(mutex_);
     endpoint_type its_target(_target->get_address(), _target->get_port());
     return send_intern(its_target, _data, _size);
 }
 
 bool tcp_server_endpoint_impl::send_error(const std::shared_ptr<endpoint_definition> _target, const byte_t* _data, uint32_t _size) {
-    std::scoped_lock its_lock(mutex_);
     const endpoint_type its_target(_target->get_address(), _target->get_port());
-    const auto its_target_iterator(find_or_create_target_unlocked(its_target));
-    auto& its_data = its_target_iterator->second;
+    const auto its_locked_target = lock_target(its_target);
+    const auto its_target_iterator(its_locked_target.it_);
+    auto& its_data = *its_target_iterator->second;
 
     if (check_queue_limit(_data, _size, its_data) && check_message_size(_size)) {
         its_data.queue_.emplace_back(std::make_pair(std::make_shared<message_buffer_t>(_data, _data + _size), 0));
@@ -205,11 +204,11 @@ bool tcp_server_endpoint_impl::send_queued(const target_data_iterator_type _it)
         } else {
             VSOMEIP_INFO_P << instance_name_ << "Didn't find connection: " << _it->first.address().to_string() << ":"
                            << static_cast<std::uint16_t>(_it->first.port()) << " dropping outstanding messages ("
-                           << _it->second.queue_.size() << ").";
+                           << _it->second->queue_.size() << ").";
 
             // Drop outstanding messages
-            _it->second.queue_.clear();
-            _it->second.queue_size_ = 0;
+            _it->second->queue_.clear();
+            _it->second->queue_size_ = 0;
             must_erase = true;
         }
     }
@@ -466,8 +465,7 @@ tcp_server_endpoint_impl::connection::connection(const std::weak_ptr<tcp_server_
                                                  bool _use_magic_cookies, boost::asio::io_context& _io,
                                                  std::chrono::milliseconds _send_timeout) :
     socket_(abstract_socket_factory::get()->create_tcp_socket(_io)), server_(_server), max_message_size_(_max_message_size),
-    recv_buffer_size_initial_(_recv_buffer_size_initial), recv_buffer_(_recv_buffer_size_initial, 0), recv_buffer_size_(0),
-    missing_capacity_(0), shrink_count_(0), buffer_shrink_threshold_(_buffer_shrink_threshold), remote_port_(0),
+    recv_buffer_(_recv_buffer_size_initial, _buffer_shrink_threshold), missing_capacity_(0), remote_port_(0),
     use_magic_cookies_(_use_magic_cookies), last_cookie_sent_(std::chrono::steady_clock::now() - std::chrono::seconds(11)),
     send_timeout_(_send_timeout), send_timeout_warning_(_send_timeout / 2) {
     if (auto its_server = _server.lock()) {
@@ -497,8 +495,7 @@ tcp_server_endpoint_impl::connection::ptr
 tcp_server_endpoint_impl::connection::create(const std::weak_ptr<tcp_server_endpoint_impl>& _server, std::uint32_t _max_message_size,
                                              std::uint32_t _buffer_shrink_threshold, bool _magic_cookies_enabled,
                                              boost::asio::io_context& _io, std::chrono::milliseconds _send_timeout) {
-    const std::uint32_t its_initial_receveive_buffer_size = VSOMEIP_SOMEIP_HEADER_SIZE + 8 + MAGIC_COOKIE_SIZE + 8;
-    return ptr(new connection(_server, _max_message_size, its_initial_receveive_buffer_size, _buffer_shrink_threshold,
+    return ptr(new connection(_server, _max_message_size, VSOMEIP_TCP_RECEIVE_CHUNK_SIZE, _buffer_shrink_threshold,
                               _magic_cookies_enabled, _io, _send_timeout));
 }
 
@@ -517,13 +514,6 @@ void tcp_server_endpoint_impl::connection::start() {
 void tcp_server_endpoint_impl::connection::receive() {
     std::unique_lock its_lock(socket_mutex_);
     if (socket_->is_open()) {
-        const std::size_t its_capacity(recv_buffer_.capacity());
-        if (recv_buffer_size_ > its_capacity) {
-            VSOMEIP_ERROR_P << "Received buffer size is greater than the buffer capacity! recv_buffer_size_: " << recv_buffer_size_
-                            << " its_capacity: " << its_capacity;
-            return;
-        }
-        size_t left_buffer_size = its_capacity - recv_buffer_size_;
         try {
             if (missing_capacity_) {
                 if (missing_capacity_ > max_message_size_) {
@@ -533,25 +523,14 @@ void tcp_server_endpoint_impl::connection::receive() {
                     wait_until_sent(boost::asio::error::operation_aborted);
                     return;
                 }
-                const std::size_t its_required_capacity(recv_buffer_size_ + missing_capacity_);
-                if (its_capacity < its_required_capacity) {
-                    // Make the resize to its_required_capacity
-                    recv_buffer_.reserve(its_required_capacity);
-                    recv_buffer_.resize(its_required_capacity, 0x0);
-                    if (recv_buffer_.size() > 1048576) {
-                        VSOMEIP_INFO_P << instance_name_ << "recv_buffer size is: " << recv_buffer_.size()
-                                       << " local: " << get_address_port_local() << " remote: " << get_address_port_remote();
-                    }
+                // Ensure the rest of the message can be received directly behind its first part
+                const std::size_t its_capacity(recv_buffer_.capacity());
+                recv_buffer_.prepare(missing_capacity_);
+                if (recv_buffer_.capacity() != its_capacity && recv_buffer_.capacity() > 1048576) {
+                    VSOMEIP_INFO_P << instance_name_ << "recv_buffer size is: " << recv_buffer_.capacity()
+                                   << " local: " << get_address_port_local() << " remote: " << get_address_port_remote();
                 }
-                left_buffer_size = missing_capacity_;
                 missing_capacity_ = 0;
-            } else if (buffer_shrink_threshold_ && shrink_count_ > buffer_shrink_threshold_ && recv_buffer_size_ == 0) {
-                // In this case, make the resize to recv_buffer_size_initial_
-                recv_buffer_.resize(recv_buffer_size_initial_, 0x0);
-                recv_buffer_.shrink_to_fit();
-                // And set buffer_size to recv_buffer_size_initial_, the same of our resize
-                left_buffer_size = recv_buffer_size_initial_;
-                shrink_count_ = 0;
             }
         } catch (const std::exception& e) {
             handle_recv_buffer_exception(e);
@@ -560,7 +539,7 @@ void tcp_server_endpoint_impl::connection::receive() {
             return;
         }
 
-        socket_->async_receive(boost::asio::buffer(&recv_buffer_[recv_buffer_size_], left_buffer_size),
+        socket_->async_receive(recv_buffer_.buffer(),
                                std::bind(&tcp_server_endpoint_impl::connection::receive_cbk, shared_from_this(), std::placeholders::_1,
                                          std::placeholders::_2));
     }
@@ -590,7 +569,7 @@ bool tcp_server_endpoint_impl::connection::send_queued(const target_data_iterato
         VSOMEIP_ERROR_P << instance_name_ << "Couldn't lock server_";
         return false;
     }
-    message_buffer_ptr_t its_buffer = _it->second.queue_.front().first;
+    message_buffer_ptr_t its_buffer = _it->second->queue_.front().first;
     const service_t its_service = bithelper::read_uint16_be(&(*its_buffer)[VSOMEIP_SERVICE_POS_MIN]);
     const method_t its_method = bithelper::read_uint16_be(&(*its_buffer)[VSOMEIP_METHOD_POS_MIN]);
     const client_t its_client = bithelper::read_uint16_be(&(*its_buffer)[VSOMEIP_CLIENT_POS_MIN]);
@@ -602,12 +581,12 @@ bool tcp_server_endpoint_impl::connection::send_queued(const target_data_iterato
         if (std::chrono::duration_cast<std::chrono::milliseconds>(now - last_cookie_sent_) > std::chrono::milliseconds(10000)) {
             if (send_magic_cookie(its_buffer)) {
                 last_cookie_sent_ = now;
-                _it->second.queue_size_ += sizeof(SERVICE_COOKIE);
+                _it->second->queue_size_ += sizeof(SERVICE_COOKIE);
             }
         }
     }
 
-    _it->second.is_sending_ = true;
+    _it->second->is_sending_ = true;
 
     socket_->async_write(boost::asio::buffer(*its_buffer),
                          std::bind(&tcp_server_endpoint_impl::connection::write_completion_condition, shared_from_this(),
@@ -630,8 +609,8 @@ bool tcp_server_endpoint_impl::connection::send_magic_cookie(message_buffer_ptr_
     return false;
 }
 
-bool tcp_server_endpoint_impl::connection::is_magic_cookie(size_t _offset) const {
-    return (0 == std::memcmp(CLIENT_COOKIE, &recv_buffer_[_offset], sizeof(CLIENT_COOKIE)));
+bool tcp_server_endpoint_impl::connection::is_magic_cookie() const {
+    return recv_buffer_.size() >= sizeof(CLIENT_COOKIE) && 0 == std::memcmp(CLIENT_COOKIE, recv_buffer_.data(), sizeof(CLIENT_COOKIE));
 }
 
 void tcp_server_endpoint_impl::connection::receive_cbk(boost::system::error_code const& _error, std::size_t _bytes) {
@@ -649,16 +628,14 @@ void tcp_server_endpoint_impl::connection::receive_cbk(boost::system::error_code
     std::shared_ptr<boardnet_routing_host> its_host = its_server->routing_host_.lock();
     if (its_host) {
         if (!_error && 0 < _bytes) {
-            if (recv_buffer_size_ + _bytes < recv_buffer_size_) {
+            if (!recv_buffer_.bump_end(_bytes)) {
                 VSOMEIP_ERROR_P << instance_name_ << "Receive buffer overflow in tcp client endpoint ~> abort!";
                 return;
             }
-            recv_buffer_size_ += _bytes;
 
-            size_t its_iteration_gap = 0;
             bool has_full_message;
             do {
-                uint64_t read_message_size = utility::get_message_size(&recv_buffer_[its_iteration_gap], recv_buffer_size_);
+                uint64_t read_message_size = utility::get_message_size(recv_buffer_.data(), recv_buffer_.size());
                 if (read_message_size > max_message_size_) {
                     VSOMEIP_ERROR_P << instance_name_ << "Message size exceeds allowed maximum: " << read_message_size
                                     << " local: " << get_address_port_local() << " remote: " << get_address_port_remote();
@@ -667,25 +644,24 @@ void tcp_server_endpoint_impl::connection::receive_cbk(boost::system::error_code
                     return;
                 }
                 uint32_t current_message_size = static_cast<uint32_t>(read_message_size);
-                has_full_message = (current_message_size > VSOMEIP_RETURN_CODE_POS && current_message_size <= recv_buffer_size_);
+                has_full_message = (current_message_size > VSOMEIP_RETURN_CODE_POS && current_message_size <= recv_buffer_.size());
                 if (has_full_message) {
                     bool needs_forwarding(true);
-                    if (is_magic_cookie(its_iteration_gap)) {
+                    if (is_magic_cookie()) {
                         use_magic_cookies_ = true;
                     } else {
                         if (use_magic_cookies_) {
-                            uint32_t its_offset = its_server->find_magic_cookie(&recv_buffer_[its_iteration_gap], recv_buffer_size_);
+                            uint32_t its_offset = its_server->find_magic_cookie(recv_buffer_.data(), recv_buffer_.size());
                             if (its_offset < current_message_size) {
                                 VSOMEIP_ERROR_P << instance_name_ << "Detected Magic Cookie within message data. Resyncing."
                                                 << " local: " << get_address_port_local() << " remote: " << get_address_port_remote();
 
-                                if (!is_magic_cookie(its_iteration_gap)) {
+                                if (!is_magic_cookie()) {
                                     auto its_endpoint_host = its_server->endpoint_host_.lock();
                                     if (its_endpoint_host) {
                                         its_lock.unlock();
-                                        its_endpoint_host->on_error(&recv_buffer_[its_iteration_gap],
-                                                                    static_cast<length_t>(recv_buffer_size_), its_server.get(),
-                                                                    remote_address_, remote_port_);
+                                        its_endpoint_host->on_error(recv_buffer_.data(), static_cast<length_t>(recv_buffer_.size()),
+                                                                    its_server.get(), remote_address_, remote_port_);
                                         its_lock.lock();
                                     }
                                 }
@@ -695,60 +671,55 @@ void tcp_server_endpoint_impl::connection::receive_cbk(boost::system::error_code
                         }
                     }
                     if (needs_forwarding) {
-                        if (static_cast<message_type_e>(recv_buffer_[its_iteration_gap + VSOMEIP_MESSAGE_TYPE_POS])
-                            == message_type_e::MT_REQUEST) {
-                            const client_t its_client =
-                                    bithelper::read_uint16_be(&recv_buffer_[its_iteration_gap + VSOMEIP_CLIENT_POS_MIN]);
+                        if (static_cast<message_type_e>(recv_buffer_.data()[VSOMEIP_MESSAGE_TYPE_POS]) == message_type_e::MT_REQUEST) {
+                            const client_t its_client = bithelper::read_uint16_be(&recv_buffer_.data()[VSOMEIP_CLIENT_POS_MIN]);
                             if (its_client != MAGIC_COOKIE_CLIENT) {
-                                const service_t its_service =
-                                        bithelper::read_uint16_be(&recv_buffer_[its_iteration_gap + VSOMEIP_SERVICE_POS_MIN]);
-                                const method_t its_method =
-                                        bithelper::read_uint16_be(&recv_buffer_[its_iteration_gap + VSOMEIP_METHOD_POS_MIN]);
+                                const service_t its_service = bithelper::read_uint16_be(&recv_buffer_.data()[VSOMEIP_SERVICE_POS_MIN]);
+                                const method_t its_method = bithelper::read_uint16_be(&recv_buffer_.data()[VSOMEIP_METHOD_POS_MIN]);
                                 its_server->set_client_target(to_clients_key(its_service, its_method, its_client), remote_);
                             }
                         }
                         if (!use_magic_cookies_) {
+                            its_server->counters_.on_receive(current_message_size);
                             its_lock.unlock();
-                            its_host->on_message(&recv_buffer_[its_iteration_gap], current_message_size, its_server.get(), remote_address_,
-                                                 remote_port_, false);
+                            its_host->on_message(recv_buffer_.data(), current_message_size, its_server.get(), remote_address_, remote_port_,
+                                                 false);
                             its_lock.lock();
                         } else {
                             // Only call on_message without a magic cookie in front of the buffer!
-                            if (!is_magic_cookie(its_iteration_gap)) {
+                            if (!is_magic_cookie()) {
+                                its_server->counters_.on_receive(current_message_size);
                                 its_lock.unlock();
-                                its_host->on_message(&recv_buffer_[its_iteration_gap], current_message_size, its_server.get(),
-                                                     remote_address_, remote_port_, false);
+                                its_host->on_message(recv_buffer_.data(), current_message_size, its_server.get(), remote_address_,
+                                                     remote_port_, false);
                                 its_lock.lock();
                             }
                         }
                     }
-                    calculate_shrink_count();
                     missing_capacity_ = 0;
-                    recv_buffer_size_ -= current_message_size;
-                    its_iteration_gap += current_message_size;
-                } else if (use_magic_cookies_ && recv_buffer_size_ > 0) {
-                    uint32_t its_offset = its_server->find_magic_cookie(&recv_buffer_[its_iteration_gap], recv_buffer_size_);
-                    if (its_offset < recv_buffer_size_) {
+                    recv_buffer_.consume(current_message_size);
+                } else if (use_magic_cookies_ && recv_buffer_.size() > 0) {
+                    uint32_t its_offset = its_server->find_magic_cookie(recv_buffer_.data(), recv_buffer_.size());
+                    if (its_offset < recv_buffer_.size()) {
                         VSOMEIP_ERROR_P << instance_name_ << "Detected Magic Cookie within message data. Resyncing."
                                         << " local: " << get_address_port_local() << " remote: " << get_address_port_remote();
 
-                        if (!is_magic_cookie(its_iteration_gap)) {
+                        if (!is_magic_cookie()) {
                             auto its_endpoint_host = its_server->endpoint_host_.lock();
                             if (its_endpoint_host) {
                                 its_lock.unlock();
-                                its_endpoint_host->on_error(&recv_buffer_[its_iteration_gap], static_cast<length_t>(recv_buffer_size_),
+                                its_endpoint_host->on_error(recv_buffer_.data(), static_cast<length_t>(recv_buffer_.size()),
                                                             its_server.get(), remote_address_, remote_port_);
                                 its_lock.lock();
                             }
                         }
-                        recv_buffer_size_ -= its_offset;
-                        its_iteration_gap += its_offset;
+                        recv_buffer_.consume(its_offset);
                         has_full_message = true; // trigger next loop
-                        if (!is_magic_cookie(its_iteration_gap)) {
+                        if (!is_magic_cookie()) {
                             auto its_endpoint_host = its_server->endpoint_host_.lock();
                             if (its_endpoint_host) {
                                 its_lock.unlock();
-                                its_endpoint_host->on_error(&recv_buffer_[its_iteration_gap], static_cast<length_t>(recv_buffer_size_),
+                                its_endpoint_host->on_error(recv_buffer_.data(), static_cast<length_t>(recv_buffer_.size()),
                                                             its_server.get(), remote_address_, remote_port_);
                                 its_lock.lock();
                             }
@@ -757,33 +728,31 @@ void tcp_server_endpoint_impl::connection::receive_cbk(boost::system::error_code
                 }
 
                 if (!has_full_message) {
-                    if (recv_buffer_size_ > VSOMEIP_RETURN_CODE_POS
-                        && (recv_buffer_[its_iteration_gap + VSOMEIP_PROTOCOL_VERSION_POS] != VSOMEIP_PROTOCOL_VERSION
-                            || !utility::is_valid_message_type(
-                                    static_cast<message_type_e>(recv_buffer_[its_iteration_gap + VSOMEIP_MESSAGE_TYPE_POS]))
-                            || !utility::is_valid_return_code(
-                                    static_cast<return_code_e>(recv_buffer_[its_iteration_gap + VSOMEIP_RETURN_CODE_POS])))) {
-                        if (recv_buffer_[its_iteration_gap + VSOMEIP_PROTOCOL_VERSION_POS] != VSOMEIP_PROTOCOL_VERSION) {
+                    if (recv_buffer_.size() > VSOMEIP_RETURN_CODE_POS
+                        && (recv_buffer_.data()[VSOMEIP_PROTOCOL_VERSION_POS] != VSOMEIP_PROTOCOL_VERSION
+                            || !utility::is_valid_message_type(static_cast<message_type_e>(recv_buffer_.data()[VSOMEIP_MESSAGE_TYPE_POS]))
+                            || !utility::is_valid_return_code(static_cast<return_code_e>(recv_buffer_.data()[VSOMEIP_RETURN_CODE_POS])))) {
+                        if (recv_buffer_.data()[VSOMEIP_PROTOCOL_VERSION_POS] != VSOMEIP_PROTOCOL_VERSION) {
                             VSOMEIP_ERROR_P << instance_name_ << "Wrong protocol version: 0x"
-                                            << hex2(recv_buffer_[its_iteration_gap + VSOMEIP_PROTOCOL_VERSION_POS])
+                                            << hex2(recv_buffer_.data()[VSOMEIP_PROTOCOL_VERSION_POS])
                                             << " local: " << get_address_port_local() << " remote: " << get_address_port_remote()
                                             << ". Closing connection due to missing/broken data TCP stream.";
 
                             // ensure to send back a error message w/ wrong protocol version
                             its_lock.unlock();
-                            its_host->on_message(&recv_buffer_[its_iteration_gap], VSOMEIP_SOMEIP_HEADER_SIZE + 8, its_server.get(),
-                                                 remote_address_, remote_port_, false);
+                            its_host->on_message(recv_buffer_.data(), VSOMEIP_SOMEIP_HEADER_SIZE + 8, its_server.get(), remote_address_,
+                                                 remote_port_, false);
                             its_lock.lock();
                         } else if (!utility::is_valid_message_type(
-                                           static_cast<message_type_e>(recv_buffer_[its_iteration_gap + VSOMEIP_MESSAGE_TYPE_POS]))) {
+                                           static_cast<message_type_e>(recv_buffer_.data()[VSOMEIP_MESSAGE_TYPE_POS]))) {
                             VSOMEIP_ERROR_P << instance_name_ << "Invalid message type: 0x"
-                                            << hex2(recv_buffer_[its_iteration_gap + VSOMEIP_MESSAGE_TYPE_POS])
+                                            << hex2(recv_buffer_.data()[VSOMEIP_MESSAGE_TYPE_POS])
                                             << " local: " << get_address_port_local() << " remote: " << get_address_port_remote()
                                             << ". Closing connection due to missing/broken data TCP stream.";
                         } else if (!utility::is_valid_return_code(
-                                           static_cast<return_code_e>(recv_buffer_[its_iteration_gap + VSOMEIP_RETURN_CODE_POS]))) {
+                                           static_cast<return_code_e>(recv_buffer_.data()[VSOMEIP_RETURN_CODE_POS]))) {
                             VSOMEIP_ERROR_P << instance_name_ << "Invalid return code: 0x"
-                                            << hex2(recv_buffer_[its_iteration_gap + VSOMEIP_RETURN_CODE_POS])
+                                            << hex2(recv_buffer_.data()[VSOMEIP_RETURN_CODE_POS])
                                             << " local: " << get_address_port_local() << " remote: " << get_address_port_remote()
                                             << ". Closing connection due to missing/broken data TCP stream.";
                         }
@@ -792,9 +761,7 @@ void tcp_server_endpoint_impl::connection::receive_cbk(boost::system::error_code
                         wait_until_sent(boost::asio::error::operation_aborted);
                         return;
                     } else if (current_message_size > max_message_size_) {
-                        recv_buffer_size_ = 0;
-                        recv_buffer_.resize(recv_buffer_size_initial_, 0x0);
-                        recv_buffer_.shrink_to_fit();
+                        recv_buffer_.reset();
                         if (use_magic_cookies_) {
                             VSOMEIP_ERROR_P << instance_name_ << "Received a TCP message which exceeds maximum message size ("
                                             << current_message_size << " > " << max_message_size_
@@ -810,23 +777,21 @@ void tcp_server_endpoint_impl::connection::receive_cbk(boost::system::error_code
                             wait_until_sent(boost::asio::error::operation_aborted);
                             return;
                         }
-                    } else if (current_message_size > recv_buffer_size_) {
-                        missing_capacity_ = current_message_size - static_cast<std::uint32_t>(recv_buffer_size_);
-                    } else if (VSOMEIP_SOMEIP_HEADER_SIZE > recv_buffer_size_) {
-                        missing_capacity_ = VSOMEIP_SOMEIP_HEADER_SIZE - static_cast<std::uint32_t>(recv_buffer_size_);
-                    } else if (use_magic_cookies_ && recv_buffer_size_ > 0) {
+                    } else if (current_message_size > recv_buffer_.size()) {
+                        missing_capacity_ = current_message_size - static_cast<std::uint32_t>(recv_buffer_.size());
+                    } else if (VSOMEIP_SOMEIP_HEADER_SIZE > recv_buffer_.size()) {
+                        missing_capacity_ = VSOMEIP_SOMEIP_HEADER_SIZE - static_cast<std::uint32_t>(recv_buffer_.size());
+                    } else if (use_magic_cookies_ && recv_buffer_.size() > 0) {
                         // no need to check for magic cookie here again: has_full_message
                         // would have been set to true if there was one present in the data
-                        recv_buffer_size_ = 0;
-                        recv_buffer_.resize(recv_buffer_size_initial_, 0x0);
-                        recv_buffer_.shrink_to_fit();
+                        recv_buffer_.reset();
                         missing_capacity_ = 0;
                         VSOMEIP_ERROR_P << instance_name_ << "Didn't find magic cookie in broken data, trying to resync."
                                         << " local: " << get_address_port_local() << " remote: " << get_address_port_remote();
                     } else {
-                        VSOMEIP_ERROR_P << instance_name_ << "recv_buffer_size is: " << recv_buffer_size_
-                                        << " but couldn't read out message_size. recv_buffer_capacity: " << recv_buffer_.capacity()
-                                        << " its_iteration_gap: " << its_iteration_gap << "local: " << get_address_port_local()
+                        VSOMEIP_ERROR_P << instance_name_ << "recv_buffer_size is: " << recv_buffer_.size()
+                                        << " but couldn't read out message_size. recv_buffer: " << recv_buffer_
+                                        << " local: " << get_address_port_local()
                                         << " remote: " << get_address_port_remote()
                                         << ". Closing connection due to missing/broken data TCP stream.";
 
@@ -835,17 +800,7 @@ void tcp_server_endpoint_impl::connection::receive_cbk(boost::system::error_code
                         return;
                     }
                 }
-            } while (has_full_message && recv_buffer_size_);
-            if (its_iteration_gap) {
-                // Copy incomplete message to front for next receive_cbk iteration
-                for (size_t i = 0; i < recv_buffer_size_; ++i) {
-                    recv_buffer_[i] = recv_buffer_[i + its_iteration_gap];
-                }
-                // Still more capacity needed after shifting everything to front?
-                if (missing_capacity_ && missing_capacity_ <= recv_buffer_.capacity() - recv_buffer_size_) {
-                    missing_capacity_ = 0;
-                }
-            }
+            } while (has_full_message && recv_buffer_.size());
 
             its_lock.unlock();
             receive();
@@ -862,18 +817,6 @@ void tcp_server_endpoint_impl::connection::receive_cbk(boost::system::error_code
     }
 }
 
-void tcp_server_endpoint_impl::connection::calculate_shrink_count() {
-    if (buffer_shrink_threshold_) {
-        if (recv_buffer_.capacity() != recv_buffer_size_initial_) {
-            if (recv_buffer_size_ < (recv_buffer_.capacity() >> 1)) {
-                shrink_count_++;
-            } else {
-                shrink_count_ = 0;
-            }
-        }
-    }
-}
-
 void tcp_server_endpoint_impl::connection::set_remote_info(const endpoint_type& _remote) {
     if (remote_ != _remote) {
         instance_name_ += _remote.address().to_string();
@@ -918,16 +861,16 @@ void tcp_server_endpoint_impl::connection::handle_recv_buffer_exception(const st
     its_message << instance_name_ << "Caught exception" << _e.what() << " local: " << get_address_port_local()
                 << " remote: " << get_address_port_remote() << " shutting down connection. Start of buffer: ";
 
-    for (std::size_t i = 0; i < recv_buffer_size_ && i < 16; i++) {
-        its_message << hex2(recv_buffer_[i]) << " ";
+    for (std::size_t i = 0; i < recv_buffer_.size() && i < 16; i++) {
+        its_message << hex2(recv_buffer_.data()[i]) << " ";
     }
 
     its_message << " Last 16 Bytes captured: ";
-    for (int i = 15; recv_buffer_size_ > 15 && i >= 0; i--) {
-        its_message << hex2(recv_buffer_[static_cast<size_t>(i)]) << " ";
+    for (int i = 15; recv_buffer_.size() > 15 && i >= 0; i--) {
+        its_message << hex2(recv_buffer_.data()[static_cast<size_t>(i)]) << " ";
     }
     VSOMEIP_ERROR_P << its_message.str();
-    recv_buffer_.clear();
+    recv_buffer_.reset();
 }
 
 std::size_t tcp_server_endpoint_impl::connection::get_recv_buffer_capacity() const {
@@ -984,14 +927,19 @@ void tcp_server_endpoint_impl::receive() {
 }
 
 void tcp_server_endpoint_impl::print_status() {
-    std::scoped_lock its_lock(mutex_);
     connections_t its_connections;
     {
         std::scoped_lock its_lock_inner(connections_mutex_);
         its_connections = connections_;
     }
 
-    VSOMEIP_INFO_P << instance_name_ << local_.port() << " connections: " << its_connections.size() << " targets: " << targets_.size();
+    std::size_t its_targets_size(0);
+    {
+        std::shared_lock its_targets_lock(targets_mutex_);
+        its_targets_size = targets_.size();
+    }
+
+    VSOMEIP_INFO_P << instance_name_ << local_.port() << " connections: " << its_connections.size() << " targets: " << its_targets_size;
     for (const auto& c : its_connections) {
         std::size_t its_data_size(0);
         std::size_t its_queue_size(0);
@@ -1000,10 +948,9 @@ void tcp_server_endpoint_impl::print_status() {
             std::unique_lock c_s_lock(c.second->get_socket_lock());
             its_recv_size = c.second->get_recv_buffer_capacity();
         }
-        auto found_queue = targets_.find(c.first);
-        if (found_queue != targets_.end()) {
-            its_queue_size = found_queue->second.queue_.size();
-            its_data_size = found_queue->second.queue_size_;
+        if (const auto its_target = find_locked_target(c.first); its_target) {
+            its_queue_size = its_target->it_->second->queue_.size();
+            its_data_size = its_target->it_->second->queue_size_;
         }
         VSOMEIP_INFO_P << instance_name_ << "Client: " << c.second->get_address_port_remote() << " queue: " << its_queue_size
                        << " data: " << its_data_size << " recv_buffer: " << its_recv_size;
@@ -1023,11 +970,9 @@ void tcp_server_endpoint_impl::connection::wait_until_sent(const boost::system::
     if (!its_server)
         return;
 
-    std::scoped_lock its_lock(its_server->mutex_);
-
-    auto it = its_server->targets_.find(remote_);
-    if (it != its_server->targets_.end()) {
-        auto& its_data = it->second;
+    const auto its_target = its_server->find_locked_target(remote_);
+    if (its_target) {
+        auto& its_data = *its_target->it_->second;
         if (its_data.is_sending_ && _error) {
             std::chrono::milliseconds its_timeout(VSOMEIP_MAX_TCP_SENT_WAIT_TIME);
             its_data.sent_timer_.expires_after(its_timeout);
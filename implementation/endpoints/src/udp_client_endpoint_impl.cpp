@@ -319,11 +319,14 @@ void udp_client_endpoint_impl::receive_cbk(boost::system::error_code const& _err
                 } else if (tp::tp::tp_flag_is_set((*_recv_buffer)[i + VSOMEIP_MESSAGE_TYPE_POS])) {
                     const auto res =
                             tp_reassembler_->process_tp_message(&(*_recv_buffer)[i], current_message_size, remote_address_, remote_port_);
+                    counters_.on_tp_segment(res.first);
                     if (res.first) {
+                        counters_.on_receive(res.second.size());
                         its_host->on_message(&res.second[0], static_cast<std::uint32_t>(res.second.size()), this, remote_address_,
                                              remote_port_, false);
                     }
                 } else {
+                    counters_.on_receive(current_message_size);
                     its_host->on_message(&(*_recv_buffer)[i], current_message_size, this, remote_address_, remote_port_, false);
                 }
                 remaining_bytes -= current_message_size;
@@ -36,7 +36,8 @@ udp_server_endpoint_impl::udp_server_endpoint_impl(const std::shared_ptr<boardne
                                                    boost::asio::io_context& _io, const std::shared_ptr<configuration>& _configuration) :
     server_endpoint_impl<ip::udp>(_boardnet_endpoint_host, _routing_host, _io, _configuration), lifecycle_idx_(0),
     multicast_lifecycle_idx_(0), netmask_(_configuration->get_netmask()), prefix_(_configuration->get_prefix()),
-    tp_reassembler_(std::make_shared<tp::tp_reassembler>(_configuration->get_max_message_size_unreliable(), _io)), tp_cleanup_timer_(_io) {
+    tp_reassembler_(std::make_shared<tp::tp_reassembler>(_configuration->get_max_message_size_unreliable(), _io)), tp_cleanup_timer_(_io),
+    tp_pacing_timer_(_io) {
     is_supporting_someip_tp_ = true;
     max_message_size_ = VSOMEIP_MAX_UDP_MESSAGE_SIZE;
 
@@ -56,13 +57,15 @@ bool udp_server_endpoint_impl::is_local() const {
 
 void udp_server_endpoint_impl::init(const endpoint_type& _local, boost::system::error_code& _error) {
     VSOMEIP_INFO_P << instance_name_ << _local.address() << ":" << _local.port() << ", lifecycle_idx=" << lifecycle_idx_.load();
+    reset_sending_state();
+
     std::scoped_lock its_lock(sync_);
     init_unlocked(_local, _error);
     VSOMEIP_INFO_P << instance_name_ << "lifecycle_idx=" << lifecycle_idx_.load() << ", " << _error.message();
 }
 
 void udp_server_endpoint_impl::init_unlocked(const endpoint_type& _local, boost::system::error_code& _error) {
-    // The caller must hold the lock
+    // The caller must hold the lock and must have reset the sending state of the targets
 
     if (unicast_socket_) {
         if (local_ == _local) {
@@ -74,11 +77,6 @@ void udp_server_endpoint_impl::init_unlocked(const endpoint_type& _local, boost:
         unicast_socket_.reset();
     }
 
-    // reset sending flag for all targets
-    for (auto& [client, endpoint_type] : targets_) {
-        endpoint_type.is_sending_ = false;
-    }
-
     auto socket_factory = abstract_socket_factory::get();
     unicast_socket_ = socket_factory->create_udp_socket(io_);
     if (!unicast_socket_) {
@@ -211,6 +209,8 @@ void udp_server_endpoint_impl::restart(bool _force) {
     std::ignore = _force;
 
     VSOMEIP_INFO_P << instance_name_ << "lifecycle_idx=" << lifecycle_idx_.load();
+    reset_sending_state();
+
     std::scoped_lock its_lock(sync_);
 
     stop_unlocked();
@@ -274,6 +274,10 @@ void udp_server_endpoint_impl::stop_unlocked() {
     unicast_socket_.reset();
     multicast_socket_.reset();
     tp_reassembler_->stop();
+
+    tp_pacing_timer_.cancel();
+    tp_pacing_timer_expiry_.reset();
+    tp_pacer_.clear();
 }
 
 void udp_server_endpoint_impl::receive_unicast_unlocked(std::shared_ptr<message_buffer_t> _unicast_recv_buffer) {
@@ -359,9 +363,7 @@ void udp_server_endpoint_impl::receive_multicast_unlocked(std::shared_ptr<messag
 
 bool udp_server_endpoint_impl::send_to(const std::shared_ptr<endpoint_definition> _target, const byte_t* _data, uint32_t _size) {
     // The caller shall not hold the sync_ lock
-    // But the mutex_ must be locked for the call to send_intern
 
-    std::scoped_lock its_lock(mutex_);
     bool result = false;
     if (_target) {
         endpoint_type its_target(_target->get_address(), _target->get_port());
@@ -371,13 +373,13 @@ bool udp_server_endpoint_impl::send_to(const std::shared_ptr<endpoint_definition
 }
 
 bool udp_server_endpoint_impl::send_error(const std::shared_ptr<endpoint_definition> _target, const byte_t* _data, uint32_t _size) {
-    // The `mutex_` lock must be hold when modifying the `targets_` list or
-    // any field inside this list (`_target` points to this list).
-    std::scoped_lock its_lock(mutex_, sync_);
-
+    // The lock of the target must be hold when modifying its data.
     const endpoint_type its_target(_target->get_address(), _target->get_port());
-    const auto its_target_iterator(find_or_create_target_unlocked(its_target));
-    auto& its_data = its_target_iterator->second;
+    const auto its_locked_target = lock_target(its_target);
+    std::scoped_lock its_lock(sync_);
+
+    const auto its_target_iterator(its_locked_target.it_);
+    auto& its_data = *its_target_iterator->second;
     bool can_be_send = check_queue_limit(_data, _size, its_data) && check_message_size(_size);
 
     if (can_be_send) {
@@ -394,7 +396,7 @@ bool udp_server_endpoint_impl::send_error(const std::shared_ptr<endpoint_definit
 }
 
 bool udp_server_endpoint_impl::send_queued(const target_data_iterator_type _it) {
-    // The caller hold the lock on `mutex_`
+    // The caller holds the lock of the target
 
     std::scoped_lock its_lock(sync_);
     bool result = false;
@@ -407,30 +409,29 @@ bool udp_server_endpoint_impl::send_queued(const target_data_iterator_type _it)
 }
 
 bool udp_server_endpoint_impl::send_queued_unlocked(const target_data_iterator_type _it) {
-    // The caller hold two locks: `mutex_` and `sync_` in that order
+    // The caller holds two locks: the lock of the target and `sync_` in that order
 
-    const auto its_entry = _it->second.queue_.front();
+    const auto its_entry = _it->second->queue_.front();
     const auto separation_time = its_entry.second;
 
-    // Check whether we need to wait (SOME/IP-TP separation time)
-    if (separation_time > 0) {
-        if (last_sent_ != std::chrono::steady_clock::time_point()) {
-            const auto its_elapsed =
-                    std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - last_sent_).count();
-            if (separation_time > its_elapsed) {
-                std::this_thread::sleep_for(std::chrono::microseconds(its_entry.second - its_elapsed));
-            }
-        }
-        last_sent_ = std::chrono::steady_clock::now();
-    } else {
-        last_sent_ = std::chrono::steady_clock::time_point();
+    // Check whether we need to wait (SOME/IP-TP separation time). Instead of
+    // blocking the calling thread, the target is handed to the pacer and will
+    // be served by the pacing timer once its release time is reached.
+    const auto its_now = std::chrono::steady_clock::now();
+    const auto its_release_time = tp_pacer_.get_release_time(_it->first, separation_time);
+    if (its_release_time > its_now) {
+        _it->second->is_sending_ = true;
+        tp_pacer_.defer(_it->first, its_release_time);
+        start_tp_pacing_timer_unlocked();
+        return true;
     }
+    tp_pacer_.on_sent(_it->first, separation_time, its_now);
 
     if (auto its_me{std::dynamic_pointer_cast<udp_server_endpoint_impl>(shared_from_this())}) {
         auto its_buffer = its_entry.first;
         auto its_target = _it->first;
 
-        _it->second.is_sending_ = true;
+        _it->second->is_sending_ = true;
         unicast_socket_->async_send_to(boost::asio::buffer(its_buffer->data(), its_buffer->size()), its_target,
                                        [its_me, its_buffer, its_target](const boost::system::error_code& _error, std::size_t _bytes) {
                                            if (!_error && its_me->on_unicast_sent_ && !its_target.address().is_multicast()) {
@@ -445,6 +446,69 @@ bool udp_server_endpoint_impl::send_queued_unlocked(const target_data_iterator_t
     }
 }
 
+void udp_server_endpoint_impl::start_tp_pacing_timer_unlocked() {
+    // The caller holds the lock on `sync_`
+
+    const auto its_deadline = tp_pacer_.get_next_deadline();
+    if (!its_deadline) {
+        return;
+    }
+
+    // The timer is already armed for an earlier (or the same) deadline
+    if (tp_pacing_timer_expiry_ && *tp_pacing_timer_expiry_ <= *its_deadline) {
+        return;
+    }
+
+    tp_pacing_timer_expiry_ = *its_deadline;
+    tp_pacing_timer_.expires_at(*its_deadline);
+    tp_pacing_timer_.async_wait([self = shared_ptr()](const boost::system::error_code& _error) { self->on_tp_pacing_timer(_error); });
+}
+
+void udp_server_endpoint_impl::on_tp_pacing_timer(const boost::system::error_code& _error) {
+    if (_error == boost::asio::error::operation_aborted) {
+        return;
+    }
+
+    // Collect all targets whose release time has passed, earliest first
+    std::vector<endpoint_type> its_due_targets;
+    {
+        std::scoped_lock its_lock(sync_);
+        tp_pacing_timer_expiry_.reset();
+
+        if (!unicast_socket_) {
+            return;
+        }
+
+        endpoint_type its_target;
+        while (tp_pacer_.pop_due(std::chrono::steady_clock::now(), its_target)) {
+            its_due_targets.push_back(its_target);
+        }
+    }
+
+    // The targets must be locked before `sync_`
+    for (const auto& its_target : its_due_targets) {
+        const auto its_locked_target = find_locked_target(its_target);
+        if (!its_locked_target) {
+            std::scoped_lock its_lock(sync_);
+            tp_pacer_.remove(its_target);
+            continue;
+        }
+
+        auto& its_data = *its_locked_target->it_->second;
+        if (its_data.queue_.empty() || !send_queued(its_locked_target->it_)) {
+            its_data.is_sending_ = false;
+        }
+    }
+
+    std::scoped_lock its_lock(sync_);
+    start_tp_pacing_timer_unlocked();
+}
+
+tp::tp_pacer<udp_server_endpoint_impl::endpoint_type>::statistics udp_server_endpoint_impl::get_tp_pacing_statistics() const {
+    std::scoped_lock its_lock(sync_);
+    return tp_pacer_.get_statistics();
+}
+
 void udp_server_endpoint_impl::get_configured_times_from_endpoint(service_t _service, method_t _method,
                                                                   std::chrono::nanoseconds* _debouncing,
                                                                   std::chrono::nanoseconds* _maximum_retention) const {
@@ -703,7 +767,9 @@ void udp_server_endpoint_impl::on_message_received_unlocked(const boost::system:
                         }
                         const auto res =
                                 tp_reassembler_->process_tp_message(&_buffer[i], current_message_size, its_remote_address, its_remote_port);
+                        counters_.on_tp_segment(res.first);
                         if (res.first) {
+                            counters_.on_receive(res.second.size());
                             if (static_cast<message_type_e>(res.second[VSOMEIP_MESSAGE_TYPE_POS]) == message_type_e::MT_REQUEST) {
                                 const client_t its_client = bithelper::read_uint16_be(&res.second[VSOMEIP_CLIENT_POS_MIN]);
                                 if (its_client != MAGIC_COOKIE_CLIENT) {
@@ -716,6 +782,7 @@ void udp_server_endpoint_impl::on_message_received_unlocked(const boost::system:
                     } else {
                         if (its_service != VSOMEIP_SD_SERVICE
                             || (current_message_size > VSOMEIP_SOMEIP_HEADER_SIZE && current_message_size >= remaining_bytes)) {
+                            counters_.on_receive(current_message_size);
                             its_host->on_message(&_buffer[i], current_message_size, this, its_remote_address, its_remote_port,
                                                  _is_multicast);
                         } else {
@@ -769,18 +836,33 @@ bool udp_server_endpoint_impl::is_same_subnet_unlocked(const boost::asio::ip::ad
 }
 
 void udp_server_endpoint_impl::print_status() {
-    std::scoped_lock its_lock(mutex_, sync_);
-
-    VSOMEIP_ERROR_P << instance_name_ << local_.port() << " number targets: " << targets_.size();
+    {
+        // Each target is locked on its own, senders of other targets are not blocked
+        std::shared_lock its_targets_lock(targets_mutex_);
+
+        VSOMEIP_ERROR_P << instance_name_ << local_.port() << " number targets: " << targets_.size();
+
+        for (const auto& c : targets_) {
+            std::size_t its_data_size(0);
+            std::size_t its_queue_size(0);
+            {
+                std::scoped_lock its_lock(c.second->mutex_);
+                its_queue_size = c.second->queue_.size();
+                its_data_size = c.second->queue_size_;
+            }
 
-    for (const auto& c : targets_) {
-        std::size_t its_data_size(0);
-        std::size_t its_queue_size(0);
-        its_queue_size = c.second.queue_.size();
-        its_data_size = c.second.queue_size_;
+            VSOMEIP_INFO_P << instance_name_ << "Client: " << c.first.address().to_string() << ":" << c.first.port()
+                           << " queue: " << its_queue_size << " data: " << its_data_size;
+        }
+    }
 
-        VSOMEIP_INFO_P << instance_name_ << "Client: " << c.first.address().to_string() << ":" << c.first.port()
-                       << " queue: " << its_queue_size << " data: " << its_data_size;
+    const auto its_tp_statistics = get_tp_pacing_statistics();
+    if (its_tp_statistics.paced_segments_ > 0) {
+        VSOMEIP_INFO_P << instance_name_ << "TP pacing: segments: " << its_tp_statistics.paced_segments_
+                       << " deferred: " << its_tp_statistics.deferred_segments_ << " gap [us] min/avg/max: "
+                       << (its_tp_statistics.gaps_ > 0 ? its_tp_statistics.min_gap_.count() : 0) << "/"
+                       << its_tp_statistics.get_average_gap().count() << "/" << its_tp_statistics.max_gap_.count()
+                       << " max overshoot [us]: " << its_tp_statistics.max_overshoot_.count();
     }
 }
 
@@ -1031,18 +1113,19 @@ bool udp_server_endpoint_impl::is_joining() const {
 }
 
 void udp_server_endpoint_impl::wait_until_sent() {
-    std::unique_lock its_lock(mutex_);
+    std::shared_lock its_lock(targets_mutex_);
 
     uint32_t retry_count(0);
     while (true) {
         bool is_sending = false;
-        for (auto const& [_, endpoint_type] : targets_) {
+        for (auto const& [_, its_data] : targets_) {
+            std::scoped_lock its_data_lock(its_data->mutex_);
             size_t data_in_train = 0;
-            if (endpoint_type.train_) {
-                data_in_train = endpoint_type.train_->buffer_ ? endpoint_type.train_->buffer_->size() : 0;
+            if (its_data->train_) {
+                data_in_train = its_data->train_->buffer_ ? its_data->train_->buffer_->size() : 0;
             }
 
-            is_sending = is_sending || endpoint_type.is_sending_ || data_in_train > 0 || endpoint_type.dispatched_trains_.size() > 0;
+            is_sending = is_sending || its_data->is_sending_ || data_in_train > 0 || its_data->dispatched_trains_.size() > 0;
         }
 
         if (is_sending) {
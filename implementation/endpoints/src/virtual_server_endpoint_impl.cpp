@@ -105,4 +105,9 @@ void virtual_server_endpoint_impl::print_status() { }
 size_t virtual_server_endpoint_impl::get_queue_size() const {
     return 0;
 }
+
+void virtual_server_endpoint_impl::get_statistics(endpoint_statistics_t& _statistics) const {
+    _statistics.is_reliable_ = reliable_;
+    _statistics.local_port_ = port_;
+}
 } // namespace vsomeip_v3
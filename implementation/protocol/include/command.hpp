@@ -35,6 +35,10 @@ protected:
     mutable command_size_t size_;
 
     command(id_e _id);
+
+    // Serializes the command header into _buffer (which must provide
+    // COMMAND_HEADER_SIZE bytes)
+    void serialize_header(byte_t* _buffer) const;
 };
 
 } // namespace protocol
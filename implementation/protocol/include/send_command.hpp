@@ -17,6 +17,11 @@ public:
     void serialize(std::vector<byte_t>& _buffer) const;
     void deserialize(const std::vector<byte_t>& _buffer, error_e& _error);
 
+    // Serializes everything but the message into _buffer (which must provide
+    // SEND_COMMAND_HEADER_SIZE bytes), for a message of _message_size bytes
+    // that is sent separately.
+    void serialize_header(byte_t* _buffer, size_t _message_size) const;
+
     instance_t get_instance() const;
     void set_instance(instance_t _instance);
 
@@ -15,6 +15,11 @@ void command::serialize(std::vector<byte_t>& _buffer) const {
     // buffer space reservation is done within the code of
     // the derived classes that call this method
 
+    serialize_header(&_buffer[0]);
+}
+
+void command::serialize_header(byte_t* _buffer) const {
+
     _buffer[0] = static_cast<byte_t>(id_);
     std::memcpy(&_buffer[COMMAND_POSITION_VERSION], &version_, sizeof(version_));
     std::memcpy(&_buffer[COMMAND_POSITION_CLIENT], &client_, sizeof(client_));
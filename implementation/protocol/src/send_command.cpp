@@ -64,18 +64,27 @@ void send_command::set_message(const std::vector<byte_t>& _message) {
 
 void send_command::serialize(std::vector<byte_t>& _buffer) const {
 
-    size_t its_size(COMMAND_HEADER_SIZE + sizeof(instance_) + sizeof(is_reliable_) + sizeof(status_) + sizeof(target_) + message_.size());
-
     // resize buffer
-    _buffer.resize(its_size);
+    _buffer.resize(SEND_COMMAND_HEADER_SIZE + message_.size());
+
+    // serialize header and fields
+    serialize_header(&_buffer[0], message_.size());
+
+    // serialize payload
+    if (!message_.empty()) {
+        std::memcpy(&_buffer[SEND_COMMAND_HEADER_SIZE], &message_[0], message_.size());
+    }
+}
+
+void send_command::serialize_header(byte_t* _buffer, size_t _message_size) const {
 
     // set size
-    size_ = static_cast<command_size_t>(its_size - COMMAND_HEADER_SIZE);
+    size_ = static_cast<command_size_t>(SEND_COMMAND_HEADER_SIZE - COMMAND_HEADER_SIZE + _message_size);
 
     // serialize header
-    command::serialize(_buffer);
+    command::serialize_header(_buffer);
 
-    // serialize payload
+    // serialize fields
     size_t its_offset(COMMAND_POSITION_PAYLOAD);
     std::memcpy(&_buffer[its_offset], &instance_, sizeof(instance_));
     its_offset += sizeof(instance_);
@@ -84,8 +93,6 @@ void send_command::serialize(std::vector<byte_t>& _buffer) const {
     _buffer[its_offset] = static_cast<byte_t>(status_);
     its_offset += sizeof(status_);
     std::memcpy(&_buffer[its_offset], &target_, sizeof(target_));
-    its_offset += sizeof(target_);
-    std::memcpy(&_buffer[its_offset], &message_[0], message_.size());
 }
 
 void send_command::deserialize(const std::vector<byte_t>& _buffer, error_e& _error) {
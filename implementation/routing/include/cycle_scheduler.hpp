@@ -0,0 +1,128 @@
+// Copyright (C) 2014-2026 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/steady_timer.hpp>
+
+namespace vsomeip_v3 {
+
+/**
+ * @class cycle_scheduler
+ * @brief Fires the cyclic notifications of all events from one timer per cycle.
+ *
+ * Events with equal cycles are grouped into a bucket. The due times of the
+ * events of a bucket are aligned to a grid of `resolution`, events that are
+ * due at the same grid point are fired by the same timer expiry.
+ *
+ * If phase spreading is enabled, newly started cycles are placed into the
+ * least loaded grid point of their bucket. This avoids bursts if many events
+ * are started at once, but may delay the first cyclic notification by up to
+ * one cycle. Restarted cycles (change resets cycle) are never spread.
+ *
+ * **Thread-safety**: All methods are thread-safe. Handlers are called from
+ * the io_context without holding the lock of the scheduler.
+ */
+class cycle_scheduler : public std::enable_shared_from_this<cycle_scheduler> {
+public:
+    using id_t = std::uint64_t;
+    using handler_t = std::function<void(id_t)>;
+
+    struct statistics {
+        std::uint64_t events_{0}; // currently scheduled events
+        std::uint64_t expiries_{0};
+        std::uint64_t notifications_{0};
+        std::chrono::microseconds min_jitter_{std::chrono::microseconds::max()};
+        std::chrono::microseconds max_jitter_{0};
+        std::chrono::microseconds total_jitter_{0};
+
+        std::chrono::microseconds get_average_jitter() const {
+            return expiries_ > 0 ? total_jitter_ / static_cast<std::int64_t>(expiries_) : std::chrono::microseconds::zero();
+        }
+    };
+
+    cycle_scheduler(boost::asio::io_context& _io, std::chrono::milliseconds _resolution, bool _spread_phases);
+
+    /**
+     * @brief Schedules the handler to be called every `_cycle`.
+     *
+     * @param _is_restart Whether the cycle of an event is restarted. Restarted
+     * cycles keep their distance to the last notification and are not spread.
+     * @return Id that is passed to the handler and that identifies the entry.
+     */
+    id_t add(std::chrono::milliseconds _cycle, handler_t _handler, bool _is_restart = false);
+
+    /**
+     * @brief Stops calling the handler.
+     *
+     * A handler that was already collected for an expiry may still be called
+     * once. The handler can compare the passed id to detect this.
+     */
+    void remove(id_t _id);
+
+    // Jitter (lateness of the timer expiries) per cycle
+    std::map<std::chrono::milliseconds, statistics> get_statistics() const;
+    void print_statistics() const;
+
+    /**
+     * @brief Aligns a due time to a grid of `_granularity` that restarts every
+     * `_cycle` from `_origin`.
+     *
+     * The due time is rounded to the nearest grid point, thus the aligned time
+     * differs from `_due` by at most half of `_granularity`.
+     */
+    static std::chrono::steady_clock::time_point align(std::chrono::steady_clock::time_point _origin, std::chrono::nanoseconds _granularity,
+                                                       std::chrono::milliseconds _cycle, std::chrono::steady_clock::time_point _due);
+
+private:
+    struct entry {
+        std::chrono::steady_clock::time_point due_;
+        handler_t handler_;
+    };
+
+    struct bucket {
+        explicit bucket(boost::asio::io_context& _io) : timer_(_io) { }
+
+        boost::asio::steady_timer timer_;
+        std::chrono::steady_clock::time_point origin_;
+        std::chrono::nanoseconds granularity_{0};
+        std::vector<std::size_t> loads_; // entries per grid point
+
+        std::multimap<std::chrono::steady_clock::time_point, id_t> schedule_;
+        std::map<id_t, entry> entries_;
+
+        std::optional<std::chrono::steady_clock::time_point> expiry_;
+        statistics statistics_;
+    };
+
+    bucket& get_bucket_unlocked(std::chrono::milliseconds _cycle, std::chrono::steady_clock::time_point _now);
+    std::size_t get_slot(const bucket& _bucket, std::chrono::milliseconds _cycle, std::chrono::steady_clock::time_point _due) const;
+    std::chrono::steady_clock::time_point spread(const bucket& _bucket, std::chrono::milliseconds _cycle,
+                                                 std::chrono::steady_clock::time_point _earliest) const;
+
+    void start_timer_unlocked(std::chrono::milliseconds _cycle, bucket& _bucket);
+    void on_timer(std::chrono::milliseconds _cycle, const boost::system::error_code& _error);
+
+    boost::asio::io_context& io_;
+    const std::chrono::milliseconds resolution_;
+    const bool spread_phases_;
+
+    mutable std::mutex mutex_;
+    id_t next_id_{1};
+    std::map<id_t, std::chrono::milliseconds> cycles_;
+    std::map<std::chrono::milliseconds, std::unique_ptr<bucket>> buckets_;
+};
+
+} // namespace vsomeip_v3
@@ -5,6 +5,7 @@
 
 #pragma once
 
+#include <cstddef>
 #include <list>
 #include <map>
 #include <memory>
@@ -13,12 +14,14 @@
 #include <atomic>
 
 #include <boost/asio/ip/address.hpp>
-#include <boost/asio/steady_timer.hpp>
 
 #include <vsomeip/primitive_types.hpp>
 #include <vsomeip/function_types.hpp>
 #include <vsomeip/payload.hpp>
 
+#include "cycle_scheduler.hpp"
+#include "../../utility/include/snapshot.hpp"
+
 namespace vsomeip_v3 {
 
 class endpoint;
@@ -31,7 +34,9 @@ struct debounce_filter_impl_t;
 
 class event : public std::enable_shared_from_this<event> {
 public:
-    event(boost::asio::io_context& _io, event_dispatcher& _dispatcher, bool _is_shadow, bool _is_router_event);
+    event(const std::shared_ptr<cycle_scheduler>& _cycle_scheduler, event_dispatcher& _dispatcher, bool _is_shadow,
+          bool _is_router_event);
+    ~event();
 
     service_t get_service() const;
     void set_service(service_t _service);
@@ -117,20 +122,42 @@ public:
     void set_session();
 
 private:
-    void update_cbk(boost::system::error_code const& _error);
+    void update_cbk(cycle_scheduler::id_t _id);
     void notify(bool _force);
     void notify(client_t _client, const std::shared_ptr<endpoint_definition>& _target);
 
-    void start_cycle();
+    // The caller must hold the `mutex_` lock
+    void start_cycle(bool _is_restart = false);
+    // The caller must hold the `mutex_` lock
     void stop_cycle();
 
     bool has_changed(const std::shared_ptr<payload>& _lhs, const std::shared_ptr<payload>& _rhs) const;
 
+    /**
+     * Published version of the current payload. It is replaced, never modified,
+     * and can therefore be read without holding `mutex_`.
+     */
+    struct payload_version {
+        std::shared_ptr<payload> payload_;
+        std::size_t hash_; // only computed for fields, 0 otherwise
+    };
+
+    static std::size_t get_hash(const payload& _payload);
+    // Compares the length and the hash of the payloads first, and their bytes only if both match
+    static bool has_payload_changed(const payload_version& _current, const std::shared_ptr<payload>& _payload, std::size_t _hash);
+    // Whether _payload can be dropped as an unchanged field value, checked without `mutex_`
+    bool is_unchanged_field(const std::shared_ptr<payload>& _payload, std::size_t _hash, bool _force) const;
+    void publish_payload(const std::shared_ptr<payload>& _payload);
+    void publish_payload(const std::shared_ptr<payload>& _payload, std::size_t _hash);
+
     void notify_one_unlocked(client_t _client, bool _force);
     void notify_one_unlocked(client_t _client, const std::shared_ptr<endpoint_definition>& _target);
 
     bool prepare_update_payload_unlocked(const std::shared_ptr<payload>& _payload, bool _force);
+    bool prepare_update_payload_unlocked(const std::shared_ptr<payload>& _payload, std::size_t _hash, bool _force);
     void update_payload_unlocked();
+    // Variant for payloads whose hash was already computed
+    void update_payload_unlocked(std::size_t _hash);
 
     /// Updates the `is_set` flag to the given `value`.
     ///
@@ -147,11 +174,13 @@ private:
 
     std::shared_ptr<message> current_;
     std::shared_ptr<message> update_;
+    snapshot<const payload_version> current_payload_;
 
     std::atomic<event_type_e> type_;
 
-    boost::asio::steady_timer cycle_timer_;
-    std::chrono::milliseconds cycle_;
+    std::shared_ptr<cycle_scheduler> cycle_scheduler_;
+    cycle_scheduler::id_t cycle_id_; // 0 if the cycle is not running
+    std::atomic<std::chrono::milliseconds> cycle_;
 
     std::atomic<bool> change_resets_cycle_;
     std::atomic<bool> is_updating_on_change_;
@@ -0,0 +1,57 @@
+// Copyright (C) 2014-2026 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <map>
+#include <set>
+#include <utility>
+
+#include <vsomeip/primitive_types.hpp>
+
+#include "../../utility/include/service_instance_map.hpp"
+
+namespace vsomeip_v3 {
+
+/**
+ * @class local_service_index
+ * @brief Requests of the local clients and the instances they offer, indexed for the routing info propagation.
+ *
+ * The requests are kept per client and, in reverse, per requested service
+ * instance (which might be ANY_INSTANCE). This allows to find the requesters
+ * of an offered instance without scanning the requests of all clients. The
+ * offered instances are kept per client and service to answer ANY_INSTANCE
+ * requests without scanning all offers of a client.
+ *
+ * **Thread-safety**: None, the routing_manager_stub guards it by its routing_info_mutex_.
+ */
+class local_service_index {
+public:
+    void add_request(client_t _client, service_t _service, instance_t _instance, major_version_t _major, minor_version_t _minor);
+    void remove_requests(client_t _client);
+
+    bool has_requested(client_t _client, service_t _service, instance_t _instance) const;
+
+    /**
+     * @brief Returns the clients that requested the service instance, either
+     * explicitly or by requesting ANY_INSTANCE of the service.
+     */
+    std::set<client_t> get_requesters(service_t _service, instance_t _instance) const;
+
+    void add_offer(client_t _client, service_t _service, instance_t _instance);
+    void remove_offer(client_t _client, service_t _service, instance_t _instance);
+    void remove_offers(client_t _client);
+
+    std::set<instance_t> get_offered_instances(client_t _client, service_t _service) const;
+
+private:
+    std::map<client_t, service_instance_map<std::pair<major_version_t, minor_version_t>>> requests_;
+    // reverse index of requests_
+    service_instance_map<std::set<client_t>> requesters_;
+
+    std::map<client_t, std::map<service_t, std::set<instance_t>>> offered_instances_;
+};
+
+} // namespace vsomeip_v3
@@ -0,0 +1,88 @@
+// Copyright (C) 2014-2026 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/steady_timer.hpp>
+
+#include "../../protocol/include/routing_info_entry.hpp"
+
+namespace vsomeip_v3 {
+
+/**
+ * @class routing_info_coalescer
+ * @brief Collects the routing info entries for each client and sends them together.
+ *
+ * Queued entries are sent when the coalescing window that was started by the
+ * first queued entry elapses, or at once when `max_services` service instances
+ * are pending for a client. Consecutive updates of the same hoster are merged
+ * into one entry. Entries that are sent directly are preceded by the pending
+ * entries of their client, thus a client receives all updates in order.
+ *
+ * **Thread-safety**: All methods are thread-safe. The send handler is called
+ * while holding the lock of the coalescer to keep the order of the updates,
+ * therefore it must not call back into the coalescer.
+ */
+class routing_info_coalescer : public std::enable_shared_from_this<routing_info_coalescer> {
+public:
+    using send_handler_t = std::function<void(client_t, std::vector<protocol::routing_info_entry>&&)>;
+
+    routing_info_coalescer(boost::asio::io_context& _io, std::chrono::milliseconds _window, std::size_t _max_services,
+                           send_handler_t _handler);
+
+    /**
+     * @brief Queues an entry for a client, to be sent within the coalescing window.
+     */
+    void queue(client_t _target, const protocol::routing_info_entry& _entry);
+
+    /**
+     * @brief Sends entries to a client at once, preceded by the entries that are pending for it.
+     */
+    void send(client_t _target, std::vector<protocol::routing_info_entry>&& _entries);
+
+    /**
+     * @brief Sends all pending entries.
+     */
+    void flush();
+
+    /**
+     * @brief Drops the pending entries of a client.
+     */
+    void remove(client_t _target);
+
+    /**
+     * @brief Sends all pending entries and cancels the coalescing window.
+     */
+    void stop();
+
+private:
+    struct pending {
+        std::vector<protocol::routing_info_entry> entries_;
+        std::size_t services_{0};
+    };
+
+    void flush_unlocked();
+    void on_timer(const boost::system::error_code& _error);
+
+    const std::chrono::milliseconds window_;
+    const std::size_t max_services_;
+    const send_handler_t handler_;
+
+    std::mutex mutex_;
+    std::map<client_t, pending> pending_;
+    boost::asio::steady_timer timer_;
+    bool is_timer_running_{false};
+};
+
+} // namespace vsomeip_v3
@@ -14,6 +14,7 @@
 #include <vsomeip/vsomeip_sec.h>
 
 #include "types.hpp"
+#include "cycle_scheduler.hpp"
 #include "event.hpp"
 #include "serviceinfo.hpp"
 #include "routing_host.hpp"
@@ -27,10 +28,12 @@
 #include "../../configuration/include/configuration.hpp"
 #include "../../configuration/include/debounce_filter_impl.hpp"
 #include "../../endpoints/include/endpoint_manager_base.hpp"
+#include "../../endpoints/include/local_send_queue.hpp"
 
 #if defined(__QNX__)
 #include "../../utility/include/qnx_helper.hpp"
 #endif
+#include "../../utility/include/object_pool.hpp"
 #include "../../utility/include/service_instance_map.hpp"
 
 namespace vsomeip_v3 {
@@ -90,11 +93,46 @@ protected:
 
     bool send_local(std::shared_ptr<local_endpoint>& _target, client_t _client, const byte_t* _data, uint32_t _size, instance_t _instance,
                     bool _reliable, protocol::id_e _command, uint8_t _status_check, client_t _sender) const;
+    // Variant for sending the same frame to multiple local targets: the frame is shared instead of copied per target.
+    bool send_local(std::shared_ptr<local_endpoint>& _target, client_t _client, const local_send_queue::frame_t& _frame,
+                    instance_t _instance, bool _reliable, protocol::id_e _command, uint8_t _status_check, client_t _sender) const;
+    static void serialize_send_header(byte_t* _header, client_t _client, uint32_t _size, instance_t _instance, bool _reliable,
+                                      protocol::id_e _command, uint8_t _status_check, client_t _sender);
+
+    /**
+     * \brief Send batches
+     *
+     * While the calling thread has a send batch open, send_local does not send,
+     * but collects the commands per target. Closing the batch passes the commands
+     * of each target to a single send operation. To keep the order with respect
+     * to concurrent sends, close the batch while still holding the lock that
+     * serializes them.
+     */
+    void open_send_batch() const;
+    void close_send_batch() const;
+    // Keeps a send batch open for its lifetime, thus the batch is closed on every exit path
+    class send_batch_guard {
+    public:
+        explicit send_batch_guard(const routing_manager_base& _owner) : owner_(_owner) { owner_.open_send_batch(); }
+        ~send_batch_guard() { owner_.close_send_batch(); }
+
+        send_batch_guard(const send_batch_guard&) = delete;
+        send_batch_guard& operator=(const send_batch_guard&) = delete;
+
+    private:
+        const routing_manager_base& owner_;
+    };
+    // The following sends may stem from a changed message
+    void next_send_batch_entry() const;
+    // Serializes _message once per batch entry, returns nullptr if no batch is open
+    local_send_queue::frame_t get_send_batch_frame(const std::shared_ptr<message>& _message);
 
     std::shared_ptr<serializer> get_serializer();
     void put_serializer(const std::shared_ptr<serializer>& _serializer);
     std::shared_ptr<deserializer> get_deserializer();
     void put_deserializer(const std::shared_ptr<deserializer>& _deserializer);
+    // Logs the sizes and high-water marks of the (de)serializer pools
+    void print_pool_status() const;
 
     virtual void send_subscribe(client_t _client, service_t _service, instance_t _instance, eventgroup_t _eventgroup,
                                 major_version_t _major, event_t _event, const std::shared_ptr<debounce_filter_impl_t>& _filter) = 0;
@@ -105,13 +143,12 @@ protected:
 
     std::shared_ptr<configuration> configuration_;
 
-    std::queue<std::shared_ptr<serializer>> serializers_;
-    std::mutex serializer_mutex_;
-    std::condition_variable serializer_condition_;
+    // Fires the cyclic notifications of all events
+    std::shared_ptr<cycle_scheduler> cycle_scheduler_;
 
-    std::queue<std::shared_ptr<deserializer>> deserializers_;
-    std::mutex deserializer_mutex_;
-    std::condition_variable deserializer_condition_;
+    // Grow on demand, so that senders never wait for a (de)serializer
+    object_pool<serializer> serializers_;
+    object_pool<deserializer> deserializers_;
 
     mutable std::mutex env_mutex_;
     std::string env_;
@@ -110,6 +110,9 @@ public:
     void notify_one(service_t _service, instance_t _instance, event_t _event, std::shared_ptr<payload> _payload, client_t _client,
                     bool _force);
     void notify(service_t _service, instance_t _instance, event_t _event, std::shared_ptr<payload> _payload, bool _force);
+    // Notifies all updates with one provider lookup and one send batch
+    void notify(service_t _service, instance_t _instance, const std::vector<std::pair<event_t, std::shared_ptr<payload>>>& _notifications,
+                bool _force);
     /**
      * @brief Notify current value for event/eventgroup
      *
@@ -120,6 +123,9 @@ public:
     std::shared_ptr<event> find_provided_event(service_t _service, instance_t _instance, event_t _event) const;
     std::shared_ptr<event> find_consumed_event(service_t _service, instance_t _instance, event_t _event) const;
 
+    // Appends the statistics of the connection to the routing manager and of all local endpoints
+    void get_statistics(std::vector<endpoint_statistics_t>& _statistics) const;
+
 private:
     void unregister_event_base(client_t _client, service_t _service, instance_t _instance, event_t _event, bool _is_provided);
 
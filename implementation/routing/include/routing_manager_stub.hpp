@@ -31,6 +31,8 @@
 #include "../../protocol/include/command_types.hpp"
 #include "../../utility/include/service_instance_map.hpp"
 #include "../../protocol/include/routing_info_entry.hpp"
+#include "local_service_index.hpp"
+#include "routing_info_coalescer.hpp"
 
 namespace vsomeip_v3 {
 
@@ -136,7 +138,10 @@ private:
 
     void remove_client_connections(client_t _client);
 
-    void send_client_routing_info(const client_t _target, protocol::routing_info_entry& _entry);
+    /**
+     * @brief Sends a routing info command with the given entries to a client.
+     * @note Called by routing_info_coalescer_ only, to keep the order of the updates.
+     */
     void send_client_routing_info(const client_t _target, std::vector<protocol::routing_info_entry>&& _entries);
 
     void send_client_credentials(client_t _target, std::set<std::pair<uid_t, gid_t>>& _credentials);
@@ -175,6 +180,11 @@ private:
     std::mutex lazy_load_mtx_;
 
     std::map<client_t, service_instance_map<std::pair<major_version_t, minor_version_t>>> routing_info_;
+    // requests of the clients and index of the instances of routing_info_, guarded by routing_info_mutex_
+    local_service_index local_services_;
+
+    // routing info entries that are not sent yet, created by init()
+    std::shared_ptr<routing_info_coalescer> routing_info_coalescer_;
     mutable std::mutex routing_info_mutex_;
     std::shared_ptr<configuration> configuration_;
 
@@ -185,8 +195,6 @@ private:
     std::mutex pinged_clients_mutex_;
     std::map<client_t, boost::asio::steady_timer::time_point> pinged_clients_;
 
-    std::map<client_t, service_instance_map<std::pair<major_version_t, minor_version_t>>> service_requests_;
-
     std::mutex pending_security_updates_mutex_;
     pending_security_update_id_t pending_security_update_id_;
     std::map<pending_security_update_id_t, std::unordered_set<client_t>> pending_security_updates_;
@@ -0,0 +1,228 @@
+// Copyright (C) 2014-2026 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <algorithm>
+#include <utility>
+
+#include "logger_ext.hpp"
+#include "../include/cycle_scheduler.hpp"
+#include "internal.hpp"
+
+#define VSOMEIP_LOG_PREFIX "cycle_scheduler"
+
+namespace vsomeip_v3 {
+
+cycle_scheduler::cycle_scheduler(boost::asio::io_context& _io, std::chrono::milliseconds _resolution, bool _spread_phases) :
+    io_(_io), resolution_(std::max(_resolution, std::chrono::milliseconds(1))), spread_phases_(_spread_phases) { }
+
+cycle_scheduler::id_t cycle_scheduler::add(std::chrono::milliseconds _cycle, handler_t _handler, bool _is_restart) {
+
+    std::scoped_lock its_lock(mutex_);
+    const auto its_now = std::chrono::steady_clock::now();
+    auto& its_bucket = get_bucket_unlocked(_cycle, its_now);
+
+    const auto its_due = (spread_phases_ && !_is_restart) ? spread(its_bucket, _cycle, its_now + _cycle)
+                                                          : align(its_bucket.origin_, its_bucket.granularity_, _cycle, its_now + _cycle);
+
+    const auto its_id = next_id_++;
+    its_bucket.entries_.emplace(its_id, entry{its_due, std::move(_handler)});
+    its_bucket.schedule_.emplace(its_due, its_id);
+    its_bucket.loads_[get_slot(its_bucket, _cycle, its_due)]++;
+    cycles_[its_id] = _cycle;
+
+    start_timer_unlocked(_cycle, its_bucket);
+
+    return its_id;
+}
+
+void cycle_scheduler::remove(id_t _id) {
+
+    std::scoped_lock its_lock(mutex_);
+    auto found_cycle = cycles_.find(_id);
+    if (found_cycle == cycles_.end()) {
+        return;
+    }
+
+    const auto its_cycle = found_cycle->second;
+    cycles_.erase(found_cycle);
+
+    auto& its_bucket = *buckets_[its_cycle];
+    auto found_entry = its_bucket.entries_.find(_id);
+    if (found_entry == its_bucket.entries_.end()) {
+        return;
+    }
+
+    const auto its_due = found_entry->second.due_;
+    auto its_range = its_bucket.schedule_.equal_range(its_due);
+    for (auto it = its_range.first; it != its_range.second; ++it) {
+        if (it->second == _id) {
+            its_bucket.schedule_.erase(it);
+            break;
+        }
+    }
+    its_bucket.loads_[get_slot(its_bucket, its_cycle, its_due)]--;
+    its_bucket.entries_.erase(found_entry);
+
+    if (its_bucket.entries_.empty()) {
+        its_bucket.timer_.cancel();
+        its_bucket.expiry_.reset();
+    }
+}
+
+std::map<std::chrono::milliseconds, cycle_scheduler::statistics> cycle_scheduler::get_statistics() const {
+
+    std::map<std::chrono::milliseconds, statistics> its_statistics;
+
+    std::scoped_lock its_lock(mutex_);
+    for (const auto& [its_cycle, its_bucket] : buckets_) {
+        auto& its_entry = its_statistics[its_cycle];
+        its_entry = its_bucket->statistics_;
+        its_entry.events_ = its_bucket->entries_.size();
+    }
+    return its_statistics;
+}
+
+void cycle_scheduler::print_statistics() const {
+
+    for (const auto& [its_cycle, its_statistics] : get_statistics()) {
+        VSOMEIP_INFO_P << "cycle: " << its_cycle.count() << "ms events: " << its_statistics.events_
+                       << " expiries: " << its_statistics.expiries_ << " notifications: " << its_statistics.notifications_
+                       << " jitter [us] min/avg/max: " << (its_statistics.expiries_ > 0 ? its_statistics.min_jitter_.count() : 0)
+                       << "/" << its_statistics.get_average_jitter().count() << "/" << its_statistics.max_jitter_.count();
+    }
+}
+
+cycle_scheduler::bucket& cycle_scheduler::get_bucket_unlocked(std::chrono::milliseconds _cycle,
+                                                              std::chrono::steady_clock::time_point _now) {
+
+    auto found_bucket = buckets_.find(_cycle);
+    if (found_bucket == buckets_.end()) {
+        auto its_bucket = std::make_unique<bucket>(io_);
+        its_bucket->origin_ = _now;
+
+        // Limit the number of grid points for long cycles
+        const std::chrono::nanoseconds its_cycle(_cycle);
+        const auto its_max_slots = static_cast<std::int64_t>(VSOMEIP_MAX_EVENT_CYCLE_SLOTS);
+        its_bucket->granularity_ =
+                std::max<std::chrono::nanoseconds>(resolution_, (its_cycle + std::chrono::nanoseconds(its_max_slots - 1)) / its_max_slots);
+        its_bucket->loads_.resize(
+                static_cast<std::size_t>((its_cycle + its_bucket->granularity_ - std::chrono::nanoseconds(1)) / its_bucket->granularity_));
+
+        found_bucket = buckets_.emplace(_cycle, std::move(its_bucket)).first;
+    }
+    return *found_bucket->second;
+}
+
+std::size_t cycle_scheduler::get_slot(const bucket& _bucket, std::chrono::milliseconds _cycle,
+                                      std::chrono::steady_clock::time_point _due) const {
+
+    const auto its_phase = (_due - _bucket.origin_) % std::chrono::nanoseconds(_cycle);
+    return std::min(static_cast<std::size_t>(its_phase / _bucket.granularity_), _bucket.loads_.size() - 1);
+}
+
+std::chrono::steady_clock::time_point cycle_scheduler::align(std::chrono::steady_clock::time_point _origin,
+                                                             std::chrono::nanoseconds _granularity, std::chrono::milliseconds _cycle,
+                                                             std::chrono::steady_clock::time_point _due) {
+
+    const std::chrono::nanoseconds its_cycle(_cycle);
+    const auto its_phase = (_due - _origin) % its_cycle;
+    const auto its_period_start = _due - its_phase;
+
+    // Round to the nearest grid point. Events that become due at almost the
+    // same time thus share an expiry, at the cost of firing up to half a grid
+    // step before the cycle has passed.
+    const auto its_aligned_phase = ((its_phase + _granularity / 2) / _granularity) * _granularity;
+    if (its_aligned_phase >= its_cycle) {
+        return its_period_start + its_cycle;
+    }
+    return its_period_start + its_aligned_phase;
+}
+
+std::chrono::steady_clock::time_point cycle_scheduler::spread(const bucket& _bucket, std::chrono::milliseconds _cycle,
+                                                              std::chrono::steady_clock::time_point _earliest) const {
+
+    const std::chrono::nanoseconds its_cycle(_cycle);
+    const auto its_period_start = _earliest - (_earliest - _bucket.origin_) % its_cycle;
+
+    // Use the least loaded grid point, the earliest one if several are equally loaded
+    std::optional<std::chrono::steady_clock::time_point> its_due;
+    std::size_t its_load(0);
+    for (std::size_t i = 0; i < _bucket.loads_.size(); ++i) {
+        auto its_candidate = its_period_start + _bucket.granularity_ * static_cast<std::int64_t>(i);
+        if (its_candidate < _earliest) {
+            its_candidate += its_cycle;
+        }
+        if (!its_due || _bucket.loads_[i] < its_load || (_bucket.loads_[i] == its_load && its_candidate < *its_due)) {
+            its_due = its_candidate;
+            its_load = _bucket.loads_[i];
+        }
+    }
+    return its_due ? *its_due : align(_bucket.origin_, _bucket.granularity_, _cycle, _earliest);
+}
+
+void cycle_scheduler::start_timer_unlocked(std::chrono::milliseconds _cycle, bucket& _bucket) {
+
+    if (_bucket.schedule_.empty()) {
+        return;
+    }
+
+    // The timer is already armed for an earlier (or the same) due time
+    const auto its_next = _bucket.schedule_.begin()->first;
+    if (_bucket.expiry_ && *_bucket.expiry_ <= its_next) {
+        return;
+    }
+
+    _bucket.expiry_ = its_next;
+    _bucket.timer_.expires_at(its_next);
+    _bucket.timer_.async_wait(
+            [self = shared_from_this(), _cycle](const boost::system::error_code& _error) { self->on_timer(_cycle, _error); });
+}
+
+void cycle_scheduler::on_timer(std::chrono::milliseconds _cycle, const boost::system::error_code& _error) {
+
+    if (_error == boost::asio::error::operation_aborted) {
+        return;
+    }
+
+    std::vector<std::pair<id_t, handler_t>> its_handlers;
+    {
+        std::scoped_lock its_lock(mutex_);
+        auto& its_bucket = *buckets_[_cycle];
+        its_bucket.expiry_.reset();
+
+        const auto its_now = std::chrono::steady_clock::now();
+        while (!its_bucket.schedule_.empty() && its_bucket.schedule_.begin()->first <= its_now) {
+            const auto [its_due, its_id] = *its_bucket.schedule_.begin();
+            its_bucket.schedule_.erase(its_bucket.schedule_.begin());
+
+            if (its_handlers.empty()) {
+                const auto its_jitter = std::chrono::duration_cast<std::chrono::microseconds>(its_now - its_due);
+                auto& its_statistics = its_bucket.statistics_;
+                its_statistics.expiries_++;
+                its_statistics.min_jitter_ = std::min(its_statistics.min_jitter_, its_jitter);
+                its_statistics.max_jitter_ = std::max(its_statistics.max_jitter_, its_jitter);
+                its_statistics.total_jitter_ += its_jitter;
+            }
+
+            // Keep the phase, but skip the cycles that were missed
+            auto& its_entry = its_bucket.entries_[its_id];
+            do {
+                its_entry.due_ += _cycle;
+            } while (its_entry.due_ <= its_now);
+            its_bucket.schedule_.emplace(its_entry.due_, its_id);
+
+            its_handlers.emplace_back(its_id, its_entry.handler_);
+        }
+        its_bucket.statistics_.notifications_ += its_handlers.size();
+
+        start_timer_unlocked(_cycle, its_bucket);
+    }
+
+    for (const auto& [its_id, its_handler] : its_handlers) {
+        its_handler(its_id);
+    }
+}
+
+} // namespace vsomeip_v3
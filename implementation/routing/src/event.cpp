@@ -7,6 +7,7 @@
 #include <chrono>
 #include <iomanip>
 #include <sstream>
+#include <string_view>
 #include <thread>
 
 #include <vsomeip/constants.hpp>
@@ -30,14 +31,23 @@
 
 namespace vsomeip_v3 {
 
-event::event(boost::asio::io_context& _io, event_dispatcher& _dispatcher, bool _is_shadow, bool _is_router_event) :
+event::event(const std::shared_ptr<cycle_scheduler>& _cycle_scheduler, event_dispatcher& _dispatcher, bool _is_shadow,
+             bool _is_router_event) :
     is_router_event_(_is_router_event), dispatcher_(_dispatcher), current_(runtime::get()->create_notification()),
-    update_(runtime::get()->create_notification()), type_(event_type_e::ET_EVENT), cycle_timer_(_io),
+    update_(runtime::get()->create_notification()),
+    current_payload_(std::make_shared<const payload_version>(payload_version{current_->get_payload(), 0})), type_(event_type_e::ET_EVENT),
+    cycle_scheduler_(_cycle_scheduler), cycle_id_(0),
     cycle_(std::chrono::milliseconds::zero()), change_resets_cycle_(false), is_updating_on_change_(true), is_set_(false),
     is_provided_(false), is_shadow_(_is_shadow), is_cache_placeholder_(false),
     epsilon_change_func_(std::bind(&event::has_changed, this, std::placeholders::_1, std::placeholders::_2)),
     has_default_epsilon_change_func_(true), reliability_(reliability_type_e::RT_UNKNOWN) { }
 
+event::~event() {
+    if (cycle_id_) {
+        cycle_scheduler_->remove(cycle_id_);
+    }
+}
+
 service_t event::get_service() const {
 
     return current_->get_service();
@@ -121,8 +131,7 @@ bool event::is_set() const {
 
 std::shared_ptr<payload> event::get_payload() const {
 
-    std::scoped_lock its_lock(mutex_);
-    return current_->get_payload();
+    return current_payload_.load()->payload_;
 }
 
 void event::update_payload() {
@@ -133,14 +142,35 @@ void event::update_payload() {
 
 void event::update_payload_unlocked() {
 
-    current_->set_payload(update_->get_payload());
+    publish_payload(update_->get_payload());
+}
+
+void event::update_payload_unlocked(std::size_t _hash) {
+
+    publish_payload(update_->get_payload(), _hash);
+}
+
+void event::publish_payload(const std::shared_ptr<payload>& _payload) {
+
+    publish_payload(_payload, (is_field() && _payload ? get_hash(*_payload) : 0));
+}
+
+void event::publish_payload(const std::shared_ptr<payload>& _payload, std::size_t _hash) {
+
+    current_payload_.store(std::make_shared<const payload_version>(payload_version{_payload, _hash}));
 }
 
 void event::set_payload(const std::shared_ptr<payload>& _payload, bool _force) {
 
+    // Unchanged field values are dropped without contending for the lock
+    const std::size_t its_hash = (is_field() && _payload ? get_hash(*_payload) : 0);
+    if (is_unchanged_field(_payload, its_hash, _force)) {
+        return;
+    }
+
     std::scoped_lock its_lock(mutex_);
     if (is_provided_) {
-        if (prepare_update_payload_unlocked(_payload, _force)) {
+        if (prepare_update_payload_unlocked(_payload, its_hash, _force)) {
             if (is_updating_on_change_) {
                 if (change_resets_cycle_)
                     stop_cycle();
@@ -148,9 +178,9 @@ void event::set_payload(const std::shared_ptr<payload>& _payload, bool _force) {
                 notify(_force);
 
                 if (change_resets_cycle_)
-                    start_cycle();
+                    start_cycle(true);
 
-                update_payload_unlocked();
+                update_payload_unlocked(its_hash);
             }
         }
     } else {
@@ -161,12 +191,17 @@ void event::set_payload(const std::shared_ptr<payload>& _payload, bool _force) {
 
 void event::set_payload(const std::shared_ptr<payload>& _payload, client_t _client, bool _force) {
 
+    const std::size_t its_hash = (is_field() && _payload ? get_hash(*_payload) : 0);
+    if (is_unchanged_field(_payload, its_hash, _force)) {
+        return;
+    }
+
     std::scoped_lock its_lock(mutex_);
     if (is_provided_) {
-        if (prepare_update_payload_unlocked(_payload, _force)) {
+        if (prepare_update_payload_unlocked(_payload, its_hash, _force)) {
             if (is_updating_on_change_) {
                 notify_one_unlocked(_client, _force);
-                update_payload_unlocked();
+                update_payload_unlocked(its_hash);
             }
         }
     } else {
@@ -178,12 +213,17 @@ void event::set_payload(const std::shared_ptr<payload>& _payload, client_t _clie
 void event::set_payload(const std::shared_ptr<payload>& _payload, const client_t _client,
                         const std::shared_ptr<endpoint_definition>& _target, bool _force) {
 
+    const std::size_t its_hash = (is_field() && _payload ? get_hash(*_payload) : 0);
+    if (is_unchanged_field(_payload, its_hash, _force)) {
+        return;
+    }
+
     std::scoped_lock its_lock(mutex_);
     if (is_provided_) {
-        if (prepare_update_payload_unlocked(_payload, _force)) {
+        if (prepare_update_payload_unlocked(_payload, its_hash, _force)) {
             if (is_updating_on_change_) {
                 notify_one_unlocked(_client, _target);
-                update_payload_unlocked();
+                update_payload_unlocked(its_hash);
             }
         }
     } else {
@@ -220,12 +260,12 @@ void event::unset_payload(bool _force) {
     if (_force) {
         set_payload_filled(false);
         stop_cycle();
-        current_->set_payload(std::make_shared<payload_impl>());
+        publish_payload(std::make_shared<payload_impl>());
     } else {
         if (is_provided_) {
             set_payload_filled(false);
             stop_cycle();
-            current_->set_payload(std::make_shared<payload_impl>());
+            publish_payload(std::make_shared<payload_impl>());
         }
     }
 }
@@ -299,14 +339,12 @@ void event::set_eventgroups(const std::set<eventgroup_t>& _eventgroups) {
         eventgroups_[e] = std::set<client_t>();
 }
 
-void event::update_cbk(boost::system::error_code const& _error) {
+void event::update_cbk(cycle_scheduler::id_t _id) {
 
-    if (!_error) {
-        std::scoped_lock its_lock(mutex_);
-        cycle_timer_.expires_after(cycle_);
+    std::scoped_lock its_lock(mutex_);
+    // The cycle might have been stopped or restarted in the meantime
+    if (_id == cycle_id_) {
         notify(true);
-        auto its_handler = std::bind(&event::update_cbk, shared_from_this(), std::placeholders::_1);
-        cycle_timer_.async_wait(its_handler);
     }
 }
 
@@ -380,8 +418,13 @@ bool event::prepare_update_payload(const std::shared_ptr<payload>& _payload, boo
 
 bool event::prepare_update_payload_unlocked(const std::shared_ptr<payload>& _payload, bool _force) {
 
-    if (!_force && type_ == event_type_e::ET_FIELD && cycle_ == std::chrono::milliseconds::zero()
-        && !has_changed(current_->get_payload(), _payload) && !is_shadow_ && is_set_) {
+    return prepare_update_payload_unlocked(_payload, (is_field() && _payload ? get_hash(*_payload) : 0), _force);
+}
+
+bool event::prepare_update_payload_unlocked(const std::shared_ptr<payload>& _payload, std::size_t _hash, bool _force) {
+
+    if (!_force && type_ == event_type_e::ET_FIELD && cycle_.load() == std::chrono::milliseconds::zero() && !is_shadow_ && is_set_
+        && !has_payload_changed(*current_payload_.load(), _payload, _hash)) {
         return false;
     }
 
@@ -580,7 +623,7 @@ std::set<client_t> event::get_filtered_subscribers(bool _force) {
 
     std::shared_ptr<payload> its_payload, its_payload_update;
     {
-        its_payload = current_->get_payload();
+        its_payload = current_payload_.load()->payload_;
         its_payload_update = update_->get_payload();
     }
 
@@ -676,18 +719,27 @@ void event::set_cache_placeholder(bool _is_cache_place_holder) {
     is_cache_placeholder_ = _is_cache_place_holder;
 }
 
-void event::start_cycle() {
+void event::start_cycle(bool _is_restart) {
 
-    if (!is_shadow_ && std::chrono::milliseconds::zero() != cycle_) {
-        cycle_timer_.expires_after(cycle_);
-        auto its_handler = std::bind(&event::update_cbk, shared_from_this(), std::placeholders::_1);
-        cycle_timer_.async_wait(its_handler);
+    if (!is_shadow_ && std::chrono::milliseconds::zero() != cycle_.load()) {
+        stop_cycle();
+
+        std::weak_ptr<event> its_me(shared_from_this());
+        cycle_id_ = cycle_scheduler_->add(
+                cycle_.load(),
+                [its_me](cycle_scheduler::id_t _id) {
+                    if (auto its_event = its_me.lock()) {
+                        its_event->update_cbk(_id);
+                    }
+                },
+                _is_restart);
     }
 }
 
 void event::stop_cycle() {
-    if (!is_shadow_ && std::chrono::milliseconds::zero() != cycle_) {
-        cycle_timer_.cancel();
+    if (cycle_id_) {
+        cycle_scheduler_->remove(cycle_id_);
+        cycle_id_ = 0;
     }
 }
 
@@ -708,6 +760,30 @@ bool event::has_changed(const std::shared_ptr<payload>& _lhs, const std::shared_
     return true; // both are nullptr
 }
 
+std::size_t event::get_hash(const payload& _payload) {
+
+    return std::hash<std::string_view>()(
+            std::string_view(reinterpret_cast<const char*>(_payload.get_data()), static_cast<std::size_t>(_payload.get_length())));
+}
+
+bool event::has_payload_changed(const payload_version& _current, const std::shared_ptr<payload>& _payload, std::size_t _hash) {
+
+    // Same as has_changed: a missing payload only differs from another missing payload
+    if (!_current.payload_ || !_payload) {
+        return !_current.payload_ && !_payload;
+    }
+    if (_current.payload_->get_length() != _payload->get_length() || _current.hash_ != _hash) {
+        return true;
+    }
+    return !((*_current.payload_) == (*_payload));
+}
+
+bool event::is_unchanged_field(const std::shared_ptr<payload>& _payload, std::size_t _hash, bool _force) const {
+
+    return (!_force && type_ == event_type_e::ET_FIELD && cycle_.load() == std::chrono::milliseconds::zero() && is_provided_ && !is_shadow_
+            && is_set_ && !has_payload_changed(*current_payload_.load(), _payload, _hash));
+}
+
 std::set<client_t> event::get_subscribers(eventgroup_t _eventgroup) {
 
     std::set<client_t> its_subscribers;
@@ -0,0 +1,81 @@
+// Copyright (C) 2014-2026 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <vsomeip/constants.hpp>
+
+#include "../include/local_service_index.hpp"
+
+namespace vsomeip_v3 {
+
+void local_service_index::add_request(client_t _client, service_t _service, instance_t _instance, major_version_t _major,
+                                      minor_version_t _minor) {
+    requests_[_client][{_service, _instance}] = std::make_pair(_major, _minor);
+    requesters_[{_service, _instance}].insert(_client);
+}
+
+void local_service_index::remove_requests(client_t _client) {
+    if (auto found_client = requests_.find(_client); found_client != requests_.end()) {
+        for (const auto& [si, version] : found_client->second) {
+            if (auto found_si = requesters_.find(si); found_si != requesters_.end()) {
+                found_si->second.erase(_client);
+                if (found_si->second.empty()) {
+                    requesters_.erase(found_si);
+                }
+            }
+        }
+        requests_.erase(found_client);
+    }
+}
+
+bool local_service_index::has_requested(client_t _client, service_t _service, instance_t _instance) const {
+    if (auto found_client = requests_.find(_client); found_client != requests_.end()) {
+        return found_client->second.contains({_service, _instance});
+    }
+    return false;
+}
+
+std::set<client_t> local_service_index::get_requesters(service_t _service, instance_t _instance) const {
+    std::set<client_t> its_requesters;
+    if (auto found_si = requesters_.find({_service, _instance}); found_si != requesters_.end()) {
+        its_requesters = found_si->second;
+    }
+    if (auto found_any = requesters_.find({_service, ANY_INSTANCE}); found_any != requesters_.end()) {
+        its_requesters.insert(found_any->second.begin(), found_any->second.end());
+    }
+    return its_requesters;
+}
+
+void local_service_index::add_offer(client_t _client, service_t _service, instance_t _instance) {
+    offered_instances_[_client][_service].insert(_instance);
+}
+
+void local_service_index::remove_offer(client_t _client, service_t _service, instance_t _instance) {
+    if (auto found_client = offered_instances_.find(_client); found_client != offered_instances_.end()) {
+        if (auto found_service = found_client->second.find(_service); found_service != found_client->second.end()) {
+            found_service->second.erase(_instance);
+            if (found_service->second.empty()) {
+                found_client->second.erase(found_service);
+            }
+        }
+        if (found_client->second.empty()) {
+            offered_instances_.erase(found_client);
+        }
+    }
+}
+
+void local_service_index::remove_offers(client_t _client) {
+    offered_instances_.erase(_client);
+}
+
+std::set<instance_t> local_service_index::get_offered_instances(client_t _client, service_t _service) const {
+    if (auto found_client = offered_instances_.find(_client); found_client != offered_instances_.end()) {
+        if (auto found_service = found_client->second.find(_service); found_service != found_client->second.end()) {
+            return found_service->second;
+        }
+    }
+    return {};
+}
+
+} // namespace vsomeip_v3
@@ -0,0 +1,102 @@
+// Copyright (C) 2014-2026 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <iterator>
+#include <utility>
+
+#include "../include/routing_info_coalescer.hpp"
+
+namespace vsomeip_v3 {
+
+routing_info_coalescer::routing_info_coalescer(boost::asio::io_context& _io, std::chrono::milliseconds _window,
+                                               std::size_t _max_services, send_handler_t _handler) :
+    window_(_window), max_services_(_max_services), handler_(std::move(_handler)), timer_(_io) { }
+
+void routing_info_coalescer::queue(client_t _target, const protocol::routing_info_entry& _entry) {
+
+    std::scoped_lock its_lock(mutex_);
+
+    auto& its_pending = pending_[_target];
+    auto& its_entries = its_pending.entries_;
+    // merge consecutive updates of the same hoster into one entry
+    if (!its_entries.empty() && its_entries.back().get_type() == _entry.get_type()
+        && its_entries.back().get_client() == _entry.get_client() && its_entries.back().get_address() == _entry.get_address()
+        && its_entries.back().get_port() == _entry.get_port()) {
+        for (const auto& s : _entry.get_services()) {
+            its_entries.back().add_service(s);
+        }
+    } else {
+        its_entries.push_back(_entry);
+    }
+    its_pending.services_ += _entry.get_services().size();
+
+    if (its_pending.services_ >= max_services_) {
+        auto its_entries_to_send = std::move(its_entries);
+        pending_.erase(_target);
+        handler_(_target, std::move(its_entries_to_send));
+        return;
+    }
+
+    if (!is_timer_running_) {
+        is_timer_running_ = true;
+        timer_.expires_after(window_);
+        timer_.async_wait([its_me = shared_from_this()](const boost::system::error_code& _error) { its_me->on_timer(_error); });
+    }
+}
+
+void routing_info_coalescer::send(client_t _target, std::vector<protocol::routing_info_entry>&& _entries) {
+
+    std::scoped_lock its_lock(mutex_);
+
+    // keep the order of the updates
+    if (auto found_pending = pending_.find(_target); found_pending != pending_.end()) {
+        auto its_entries = std::move(found_pending->second.entries_);
+        its_entries.insert(its_entries.end(), std::make_move_iterator(_entries.begin()), std::make_move_iterator(_entries.end()));
+        pending_.erase(found_pending);
+        handler_(_target, std::move(its_entries));
+    } else {
+        handler_(_target, std::move(_entries));
+    }
+}
+
+void routing_info_coalescer::flush() {
+
+    std::scoped_lock its_lock(mutex_);
+    flush_unlocked();
+}
+
+void routing_info_coalescer::remove(client_t _target) {
+
+    std::scoped_lock its_lock(mutex_);
+    pending_.erase(_target);
+}
+
+void routing_info_coalescer::stop() {
+
+    std::scoped_lock its_lock(mutex_);
+    flush_unlocked();
+    timer_.cancel();
+    is_timer_running_ = false;
+}
+
+void routing_info_coalescer::flush_unlocked() {
+    auto its_pending = std::move(pending_);
+    pending_.clear();
+    for (auto& [its_target, its_info] : its_pending) {
+        handler_(its_target, std::move(its_info.entries_));
+    }
+}
+
+void routing_info_coalescer::on_timer(const boost::system::error_code& _error) {
+    if (_error == boost::asio::error::operation_aborted) {
+        return;
+    }
+
+    std::scoped_lock its_lock(mutex_);
+    is_timer_running_ = false;
+    flush_unlocked();
+}
+
+} // namespace vsomeip_v3
@@ -3,6 +3,7 @@
 // License, v. 2.0. If a copy of the MPL was not distributed with this
 // file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
+#include <algorithm>
 #include <iomanip>
 #include <fstream>
 
@@ -23,17 +24,35 @@ namespace vsomeip_v3 {
 
 #define VSOMEIP_LOG_PREFIX "rmb"
 
-routing_manager_base::routing_manager_base(routing_manager_host* _host) :
-    host_(_host), io_(host_->get_io()), configuration_(host_->get_configuration()), tc_(trace::connector_impl::get()) {
-    const std::size_t its_max = configuration_->get_io_thread_count(host_->get_name());
-    const uint32_t its_buffer_shrink_threshold = configuration_->get_buffer_shrink_threshold();
+namespace {
 
-    for (std::size_t i = 0; i < its_max; ++i) {
-        serializers_.push(std::make_shared<serializer>(its_buffer_shrink_threshold));
-        deserializers_.push(std::make_shared<deserializer>(its_buffer_shrink_threshold));
-    }
+// Local sends that the calling thread collects while a send batch is open
+struct send_batch {
+    const routing_manager_base* owner_{nullptr};
+    const message* message_{nullptr};
+    local_send_queue::frame_t frame_;
+    std::vector<std::pair<std::shared_ptr<local_endpoint>, std::vector<local_endpoint::command>>> targets_;
+};
+
+thread_local send_batch open_batch;
+
+send_batch* get_send_batch(const routing_manager_base* _owner) {
+    return (open_batch.owner_ == _owner ? &open_batch : nullptr);
 }
 
+} // namespace
+
+routing_manager_base::routing_manager_base(routing_manager_host* _host) :
+    host_(_host), io_(host_->get_io()), configuration_(host_->get_configuration()),
+    cycle_scheduler_(std::make_shared<cycle_scheduler>(io_, configuration_->get_event_cycle_resolution(),
+                                                       configuration_->is_event_cycle_spreading())),
+    serializers_([its_threshold = configuration_->get_buffer_shrink_threshold()] { return std::make_shared<serializer>(its_threshold); },
+                 configuration_->get_io_thread_count(host_->get_name()), VSOMEIP_MAX_POOLED_SERIALIZERS),
+    deserializers_(
+            [its_threshold = configuration_->get_buffer_shrink_threshold()] { return std::make_shared<deserializer>(its_threshold); },
+            configuration_->get_io_thread_count(host_->get_name()), VSOMEIP_MAX_POOLED_SERIALIZERS),
+    tc_(trace::connector_impl::get()) { }
+
 boost::asio::io_context& routing_manager_base::get_io() {
 
     return io_;
@@ -178,66 +197,152 @@ std::string const& routing_manager_base::get_name() const {
 
 // ********************************* PROTECTED **************************************
 
+
 bool routing_manager_base::send_local(std::shared_ptr<local_endpoint>& _target, client_t _client, const byte_t* _data, uint32_t _size,
                                       instance_t _instance, bool _reliable, protocol::id_e _command, uint8_t _status_check,
                                       client_t _sender) const {
 
+    if (auto its_batch = get_send_batch(this)) {
+        // Reuse the frame of the batch entry if the data stems from it
+        auto its_frame = its_batch->frame_;
+        if (!its_frame || its_frame->data() != _data || its_frame->size() != _size) {
+            its_frame = std::make_shared<const std::vector<byte_t>>(_data, _data + _size);
+        }
+        return send_local(_target, _client, its_frame, _instance, _reliable, _command, _status_check, _sender);
+    }
+
+    // The frame is copied only once, into the send queue of the endpoint
+    byte_t its_header[protocol::SEND_COMMAND_HEADER_SIZE];
+    serialize_send_header(its_header, _client, _size, _instance, _reliable, _command, _status_check, _sender);
+
+    return _target->send(its_header, uint32_t(sizeof(its_header)), _data, _size);
+}
+
+bool routing_manager_base::send_local(std::shared_ptr<local_endpoint>& _target, client_t _client, const local_send_queue::frame_t& _frame,
+                                      instance_t _instance, bool _reliable, protocol::id_e _command, uint8_t _status_check,
+                                      client_t _sender) const {
+
+    if (auto its_batch = get_send_batch(this)) {
+        auto found_target = std::find_if(its_batch->targets_.begin(), its_batch->targets_.end(),
+                                         [&_target](const auto& _entry) { return _entry.first == _target; });
+        if (found_target == its_batch->targets_.end()) {
+            found_target = its_batch->targets_.emplace(its_batch->targets_.end(), _target, std::vector<local_endpoint::command>());
+        }
+        auto& its_command = found_target->second.emplace_back();
+        serialize_send_header(its_command.header_.data(), _client, uint32_t(_frame->size()), _instance, _reliable, _command, _status_check,
+                              _sender);
+        its_command.frame_ = _frame;
+        return true;
+    }
+
+    byte_t its_header[protocol::SEND_COMMAND_HEADER_SIZE];
+    serialize_send_header(its_header, _client, uint32_t(_frame->size()), _instance, _reliable, _command, _status_check, _sender);
+
+    return _target->send(its_header, uint32_t(sizeof(its_header)), _frame);
+}
+
+void routing_manager_base::serialize_send_header(byte_t* _header, client_t _client, uint32_t _size, instance_t _instance, bool _reliable,
+                                                 protocol::id_e _command, uint8_t _status_check, client_t _sender) {
+
     protocol::send_command its_command(_command);
     its_command.set_client(_sender);
     its_command.set_instance(_instance);
     its_command.set_reliable(_reliable);
     its_command.set_status(_status_check);
     its_command.set_target(_client);
-    its_command.set_message(std::vector<byte_t>(_data, _data + _size));
 
-    std::vector<byte_t> its_buffer;
-    its_command.serialize(its_buffer);
+    its_command.serialize_header(_header, _size);
+}
 
-    return _target->send(&its_buffer[0], uint32_t(its_buffer.size()));
+void routing_manager_base::open_send_batch() const {
+
+    open_batch.owner_ = this;
+    open_batch.message_ = nullptr;
+    open_batch.frame_.reset();
+    open_batch.targets_.clear();
 }
 
-std::shared_ptr<serializer> routing_manager_base::get_serializer() {
+void routing_manager_base::next_send_batch_entry() const {
+
+    if (auto its_batch = get_send_batch(this)) {
+        its_batch->message_ = nullptr;
+        its_batch->frame_.reset();
+    }
+}
+
+local_send_queue::frame_t routing_manager_base::get_send_batch_frame(const std::shared_ptr<message>& _message) {
+
+    auto its_batch = get_send_batch(this);
+    if (!its_batch) {
+        return nullptr;
+    }
+
+    // Serialize once per batch entry, all further sends of the entry share the frame
+    if (its_batch->message_ != _message.get() || !its_batch->frame_) {
+        its_batch->frame_.reset();
+        std::shared_ptr<serializer> its_serializer(get_serializer());
+        if (its_serializer->serialize(_message.get())) {
+            its_batch->frame_ = std::make_shared<const std::vector<byte_t>>(
+                    its_serializer->get_data(), its_serializer->get_data() + its_serializer->get_size());
+            its_batch->message_ = _message.get();
+        } else {
+            VSOMEIP_ERROR_P << "Failed to serialize message. Check message size!";
+        }
+        its_serializer->reset();
+        put_serializer(its_serializer);
+    }
+    return its_batch->frame_;
+}
+
+void routing_manager_base::close_send_batch() const {
+
+    auto its_batch = get_send_batch(this);
+    if (!its_batch) {
+        return;
+    }
 
-    std::unique_lock its_lock(serializer_mutex_);
-    while (serializers_.empty()) {
-        VSOMEIP_INFO_P << "Client 0x" << hex4(get_client()) << " has no available serializer. Waiting...";
-        serializer_condition_.wait(its_lock, [this] { return !serializers_.empty(); });
-        VSOMEIP_INFO_P << ": Client 0x" << hex4(get_client()) << " now checking for available serializer.";
+    auto its_targets = std::move(its_batch->targets_);
+    its_batch->owner_ = nullptr;
+    its_batch->message_ = nullptr;
+    its_batch->frame_.reset();
+    its_batch->targets_.clear();
+
+    for (auto& [its_target, its_commands] : its_targets) {
+        const auto its_queued = its_target->send(its_commands);
+        if (its_queued != its_commands.size()) {
+            VSOMEIP_WARNING_P << "Client 0x" << hex4(get_client()) << ": dropped " << its_commands.size() - its_queued << " of "
+                              << its_commands.size() << " batched commands";
+        }
     }
+}
 
-    auto its_serializer = serializers_.front();
-    serializers_.pop();
+std::shared_ptr<serializer> routing_manager_base::get_serializer() {
 
-    return its_serializer;
+    return serializers_.get();
 }
 
 void routing_manager_base::put_serializer(const std::shared_ptr<serializer>& _serializer) {
 
-    std::scoped_lock its_lock(serializer_mutex_);
-    serializers_.push(_serializer);
-    serializer_condition_.notify_one();
+    serializers_.put(_serializer);
 }
 
 std::shared_ptr<deserializer> routing_manager_base::get_deserializer() {
 
-    std::unique_lock its_lock(deserializer_mutex_);
-    while (deserializers_.empty()) {
-        VSOMEIP_INFO_P << ": Client 0x" << hex4(get_client()) << "~> all in use!";
-        deserializer_condition_.wait(its_lock, [this] { return !deserializers_.empty(); });
-        VSOMEIP_INFO_P << "Client 0x" << hex4(get_client()) << "~> wait finished!";
-    }
+    return deserializers_.get();
+}
 
-    auto its_deserializer = deserializers_.front();
-    deserializers_.pop();
+void routing_manager_base::put_deserializer(const std::shared_ptr<deserializer>& _deserializer) {
 
-    return its_deserializer;
+    deserializers_.put(_deserializer);
 }
 
-void routing_manager_base::put_deserializer(const std::shared_ptr<deserializer>& _deserializer) {
+void routing_manager_base::print_pool_status() const {
 
-    std::scoped_lock its_lock(deserializer_mutex_);
-    deserializers_.push(_deserializer);
-    deserializer_condition_.notify_one();
+    const auto its_serializers = serializers_.get_statistics();
+    const auto its_deserializers = deserializers_.get_statistics();
+    VSOMEIP_INFO_P << "Client 0x" << hex4(get_client()) << " serializers: " << its_serializers.in_use_ << "/" << its_serializers.size_
+                   << " (max " << its_serializers.high_water_ << ") deserializers: " << its_deserializers.in_use_ << "/"
+                   << its_deserializers.size_ << " (max " << its_deserializers.high_water_ << ")";
 }
 
 } // namespace vsomeip_v3
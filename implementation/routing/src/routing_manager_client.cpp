@@ -143,11 +143,23 @@ void routing_manager_client::start() {
     }
 }
 
+void routing_manager_client::get_statistics(std::vector<endpoint_statistics_t>& _statistics) const {
+    {
+        std::scoped_lock its_sender_lock{sender_mutex_};
+        if (sender_) {
+            sender_->get_statistics(_statistics.emplace_back());
+        }
+    }
+    ep_mgr_->get_statistics(_statistics);
+}
+
 void routing_manager_client::status_log_timer_cbk(boost::system::error_code const& _error) {
     if (!_error) {
         const uint32_t its_interval = configuration_->get_status_log_interval(host_->get_name(), false);
         VSOMEIP_INFO_P << " ";
         ep_mgr_->print_status();
+        cycle_scheduler_->print_statistics();
+        print_pool_status();
 
         {
             std::scoped_lock its_lock(log_timer_mutex_);
@@ -774,7 +786,7 @@ bool routing_manager_client::send(client_t _client, const byte_t* _data, length_
             if (its_target) {
                 is_sent = send_local(its_target, get_client(), _data, _size, _instance, _reliable, protocol::id_e::SEND_ID, _status_check,
                                      get_client());
-                if (is_sent) {
+                if (is_sent && tc_->is_enabled()) {
                     trace::header its_header;
                     if (its_header.prepare(its_target, true, _instance))
                         tc_->trace(its_header.data_, VSOMEIP_TRACE_HEADER_SIZE, _data, _size);
@@ -813,7 +825,7 @@ bool routing_manager_client::send(client_t _client, const byte_t* _data, length_
         if (send) {
             auto its_client{its_command == protocol::id_e::NOTIFY_ONE_ID ? _client : get_client()};
             is_sent = send_local(its_target, its_client, _data, _size, _instance, _reliable, its_command, _status_check, get_client());
-            if (is_sent && !utility::is_notification(VSOMEIP_MESSAGE_TYPE_POS) && !message_to_stub) {
+            if (is_sent && !utility::is_notification(VSOMEIP_MESSAGE_TYPE_POS) && !message_to_stub && tc_->is_enabled()) {
                 trace::header its_header;
                 if (its_header.prepare(its_target, true, _instance))
                     tc_->trace(its_header.data_, VSOMEIP_TRACE_HEADER_SIZE, _data, _size);
@@ -999,7 +1011,7 @@ void routing_manager_client::on_message(const byte_t* _data, length_t _size, con
                         }
                     }
 
-                    if (client_side_logging_
+                    if (client_side_logging_ && tc_->is_enabled()
                         && (client_side_logging_filter_.empty()
                             || (1 == client_side_logging_filter_.count(std::make_tuple(its_message->get_service(), ANY_INSTANCE)))
                             || (1
@@ -2516,6 +2528,15 @@ bool routing_manager_client::send(client_t _client, std::shared_ptr<message> _me
         }
     }
 
+    // Within a send batch, the message is serialized only once for all its receivers
+    if (utility::is_notification(_message->get_message_type())) {
+        if (auto its_frame = get_send_batch_frame(_message)) {
+            auto const sec_client = get_sec_client();
+            return send(_client, its_frame->data(), length_t(its_frame->size()), _message->get_instance(), _message->is_reliable(),
+                        get_client(), &sec_client, 0, false, _force);
+        }
+    }
+
     std::shared_ptr<serializer> its_serializer(get_serializer());
     if (its_serializer->serialize(_message.get())) {
         auto const sec_client = get_sec_client();
@@ -2623,7 +2644,7 @@ void routing_manager_client::register_consumer_event(client_t _client, service_t
             its_event->set_update_cycle(_cycle);
         }
     } else {
-        its_event = std::make_shared<event>(io_, *this, false, false);
+        its_event = std::make_shared<event>(cycle_scheduler_, *this, false, false);
         its_event->set_service(_service);
         its_event->set_instance(_instance);
         its_event->set_event(_notifier);
@@ -2758,7 +2779,7 @@ void routing_manager_client::register_provider_event(client_t _client, service_t
             its_event->set_update_cycle(_cycle);
         }
     } else {
-        its_event = std::make_shared<event>(io_, *this, false, false);
+        its_event = std::make_shared<event>(cycle_scheduler_, *this, false, false);
         its_event->set_service(_service);
         its_event->set_instance(_instance);
         its_event->set_event(_notifier);
@@ -3043,6 +3064,26 @@ void routing_manager_client::notify(service_t _service, instance_t _instance, ev
     }
 }
 
+void routing_manager_client::notify(service_t _service, instance_t _instance,
+                                    const std::vector<std::pair<event_t, std::shared_ptr<payload>>>& _notifications, bool _force) {
+
+    // The batch is closed (and sent) before the provider lock is released.
+    // Otherwise, a concurrent notification of the same event could overtake
+    // the batched one.
+    std::scoped_lock its_lock{provider_mutex_};
+    send_batch_guard its_batch(*this);
+    for (const auto& [its_event_id, its_payload] : _notifications) {
+        std::shared_ptr<event> its_event = find_provided_event(_service, _instance, its_event_id, its_lock);
+        if (its_event) {
+            next_send_batch_entry();
+            its_event->set_payload(its_payload, _force);
+        } else {
+            VSOMEIP_WARNING_P << "Attempt to update the undefined event/field [" << hex4(_service) << "." << hex4(_instance) << "."
+                              << hex4(its_event_id) << "]";
+        }
+    }
+}
+
 bool routing_manager_client::is_subscribe_to_any_event_allowed(const vsomeip_sec_client_t* _sec_client, client_t _client,
                                                                service_t _service, instance_t _instance, eventgroup_t _eventgroup,
                                                                bool _is_provided) {
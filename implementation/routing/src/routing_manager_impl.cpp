@@ -685,7 +685,7 @@ bool routing_manager_impl::send(client_t _client, const byte_t* _data, length_t
     if (its_local_target) {
         is_sent = send_local(its_local_target, its_target_client, _data, _size, _instance, _reliable, protocol::id_e::SEND_ID,
                              _status_check, VSOMEIP_ROUTING_CLIENT);
-        if (is_sent && (is_notification && find_local_client(its_service, _instance) == VSOMEIP_ROUTING_CLIENT)) {
+        if (is_sent && tc_->is_enabled() && (is_notification && find_local_client(its_service, _instance) == VSOMEIP_ROUTING_CLIENT)) {
             trace::header its_header;
             if (its_header.prepare(its_local_target, true, _instance))
                 tc_->trace(its_header.data_, VSOMEIP_TRACE_HEADER_SIZE, _data, _size);
@@ -723,7 +723,7 @@ bool routing_manager_impl::send(client_t _client, const byte_t* _data, length_t
             its_target = ep_mgr_impl_->find_or_create_remote_client(its_service, _instance, _reliable);
             if (its_target) {
                 is_sent = its_target->send(_data, _size);
-                if (is_sent) {
+                if (is_sent && tc_->is_enabled()) {
                     trace::header its_header;
                     if (its_header.prepare(its_target, true, _instance,
                                            its_target->is_reliable() ? trace::protocol_e::tcp : trace::protocol_e::udp))
@@ -794,7 +794,7 @@ bool routing_manager_impl::send(client_t _client, const byte_t* _data, length_t
                             }
                             has_sent = true;
                         }
-                        if (has_sent) {
+                        if (has_sent && tc_->is_enabled()) {
                             trace::header its_header;
                             if (its_header.prepare(nullptr, true, _instance, trace::protocol_e::unknown))
                                 tc_->trace(its_header.data_, VSOMEIP_TRACE_HEADER_SIZE, _data, _size);
@@ -815,7 +815,7 @@ bool routing_manager_impl::send(client_t _client, const byte_t* _data, length_t
                             is_service_discovery ? (sd_info_ ? sd_info_->get_endpoint(false) : nullptr) : its_info->get_endpoint(_reliable);
                     if (its_target) {
                         is_sent = its_target->send(_data, _size);
-                        if (is_sent) {
+                        if (is_sent && tc_->is_enabled()) {
                             trace::header its_header;
                             if (its_header.prepare(its_target, true, _instance,
                                                    its_target->is_reliable() ? trace::protocol_e::tcp : trace::protocol_e::udp))
@@ -887,7 +887,7 @@ bool routing_manager_impl::send_to(const std::shared_ptr<endpoint_definition>& _
 
     if (its_endpoint) {
         is_sent = its_endpoint->send_to(_target, _data, _size);
-        if (is_sent) {
+        if (is_sent && tc_->is_enabled()) {
             trace::header its_header;
             if (its_header.prepare(its_endpoint, true, _instance,
                                    its_endpoint->is_reliable() ? trace::protocol_e::tcp : trace::protocol_e::udp))
@@ -908,7 +908,7 @@ bool routing_manager_impl::send_via_sd(const std::shared_ptr<endpoint_definition
 
     if (its_endpoint) {
         is_sent = its_endpoint->send_to(_target, _data, _size);
-        if (is_sent && tc_->is_sd_enabled()) {
+        if (is_sent && tc_->is_enabled() && tc_->is_sd_enabled()) {
             trace::header its_header;
             if (its_header.prepare(its_endpoint, true, 0x0, its_endpoint->is_reliable() ? trace::protocol_e::tcp : trace::protocol_e::udp))
                 tc_->trace(its_header.data_, VSOMEIP_TRACE_HEADER_SIZE, _data, _size);
@@ -1182,7 +1182,7 @@ void routing_manager_impl::on_message(const byte_t* _data, length_t _length, boa
                                   its_check_status, true);
     }
 
-    if (is_forwarded) {
+    if (is_forwarded && tc_->is_enabled()) {
         trace::header its_header;
         const boost::asio::ip::address_v4 its_remote_address =
                 _remote_address.is_v4() ? _remote_address.to_v4() : boost::asio::ip::make_address_v4("6.6.6.6");
@@ -1406,10 +1406,21 @@ bool routing_manager_impl::deliver_notification(service_t _service, instance_t _
         // as the filter was already applied there.
         auto its_subscribers = its_event->update_and_get_filtered_subscribers(its_payload, _is_from_remote);
         if (its_event->get_type() != event_type_e::ET_SELECTIVE_EVENT) {
+            // Share a single copy of large frames between all local subscribers,
+            // small frames are copied into the send queues of the targets
+            local_send_queue::frame_t its_frame;
+            if (its_subscribers.size() > 1 && _length >= VSOMEIP_LOCAL_GATHER_THRESHOLD) {
+                its_frame = std::make_shared<const std::vector<byte_t>>(_data, _data + _length);
+            }
             for (const auto its_local_client : its_subscribers) {
                 if (std::shared_ptr<local_endpoint> its_local_target = find_routing_endpoint(its_local_client); its_local_target) {
-                    send_local(its_local_target, VSOMEIP_ROUTING_CLIENT, _data, _length, _instance, _reliable, protocol::id_e::SEND_ID,
-                               _status_check, VSOMEIP_ROUTING_CLIENT);
+                    if (its_frame) {
+                        send_local(its_local_target, VSOMEIP_ROUTING_CLIENT, its_frame, _instance, _reliable, protocol::id_e::SEND_ID,
+                                   _status_check, VSOMEIP_ROUTING_CLIENT);
+                    } else {
+                        send_local(its_local_target, VSOMEIP_ROUTING_CLIENT, _data, _length, _instance, _reliable,
+                                   protocol::id_e::SEND_ID, _status_check, VSOMEIP_ROUTING_CLIENT);
+                    }
                 }
             }
         } else {
@@ -1458,7 +1469,7 @@ std::shared_ptr<boardnet_endpoint> routing_manager_impl::create_service_discover
     auto its_service_endpoint = ep_mgr_impl_->find_server_endpoint(_port, _reliable);
     if (!its_service_endpoint) {
         try {
-            its_service_endpoint = ep_mgr_impl_->create_server_endpoint(_port, _reliable, true);
+            its_service_endpoint = ep_mgr_impl_->create_server_endpoint(_port, _reliable, true, VSOMEIP_SD_SERVICE, VSOMEIP_SD_INSTANCE);
 
             if (its_service_endpoint) {
                 sd_info_ = std::make_shared<serviceinfo>(VSOMEIP_SD_SERVICE, VSOMEIP_SD_INSTANCE, ANY_MAJOR, ANY_MINOR, DEFAULT_TTL,
@@ -2310,10 +2321,12 @@ void routing_manager_impl::send_error(return_code_e _return_code, const byte_t*
                         ep_mgr_impl_->find_server_endpoint(its_endpoint_def->get_remote_port(), its_endpoint_def->is_reliable());
                 if (its_endpoint) {
                     its_endpoint->send_error(its_endpoint_def, its_serializer->get_data(), its_serializer->get_size());
-                    trace::header its_header;
-                    if (its_header.prepare(its_endpoint, true, _instance,
-                                           its_endpoint->is_reliable() ? trace::protocol_e::tcp : trace::protocol_e::udp))
-                        tc_->trace(its_header.data_, VSOMEIP_TRACE_HEADER_SIZE, _data, _size);
+                    if (tc_->is_enabled()) {
+                        trace::header its_header;
+                        if (its_header.prepare(its_endpoint, true, _instance,
+                                               its_endpoint->is_reliable() ? trace::protocol_e::tcp : trace::protocol_e::udp))
+                            tc_->trace(its_header.data_, VSOMEIP_TRACE_HEADER_SIZE, _data, _size);
+                    }
                 }
             }
             its_serializer->reset();
@@ -3383,6 +3396,8 @@ void routing_manager_impl::status_log_timer_cbk(boost::system::error_code const&
     VSOMEIP_INFO_P << " ";
 
     ep_mgr_impl_->print_status();
+    cycle_scheduler_->print_statistics();
+    print_pool_status();
     {
         std::scoped_lock its_lock{log_timer_mutex_};
         status_log_timer_.expires_after(std::chrono::milliseconds(its_interval));
@@ -3996,7 +4011,7 @@ void routing_manager_impl::register_event(client_t _client, service_t _service,
             its_event->set_update_cycle(_cycle);
         }
     } else {
-        its_event = std::make_shared<event>(io_, *this, _is_shadow, true);
+        its_event = std::make_shared<event>(cycle_scheduler_, *this, _is_shadow, true);
         its_event->set_service(_service);
         its_event->set_instance(_instance);
         its_event->set_event(_notifier);
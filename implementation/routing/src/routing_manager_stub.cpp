@@ -71,6 +71,14 @@ routing_manager_stub::~routing_manager_stub() { }
 
 void routing_manager_stub::init() {
 
+    routing_info_coalescer_ = std::make_shared<routing_info_coalescer>(
+            io_, std::chrono::milliseconds(VSOMEIP_ROUTING_INFO_COALESCING_TIME), VSOMEIP_ROUTING_INFO_MAX_PENDING,
+            [its_me = weak_from_this()](client_t _target, std::vector<protocol::routing_info_entry>&& _entries) {
+                if (auto its_stub = its_me.lock()) {
+                    its_stub->send_client_routing_info(_target, std::move(_entries));
+                }
+            });
+
     init_routing_endpoint();
 
     if (char its_hostname[1024]; gethostname(its_hostname, sizeof(its_hostname)) == 0) {
@@ -97,6 +105,10 @@ void routing_manager_stub::start() {
 }
 
 void routing_manager_stub::stop() {
+    if (routing_info_coalescer_) {
+        routing_info_coalescer_->stop();
+    }
+
     auto stop_local_server = [](auto& local_server) {
         if (local_server) {
             local_server->stop();
@@ -600,6 +612,7 @@ void routing_manager_stub::on_deregister_application(client_t _client) {
     }
 
     routing_info_.erase(_client);
+    local_services_.remove_offers(_client);
 }
 
 void routing_manager_stub::on_offered_service_request(client_t _client, offer_type_e _offer_type) {
@@ -674,7 +687,8 @@ void routing_manager_stub::on_register_application(client_t _client, const boost
 void routing_manager_stub::remove_client_connections(client_t client_id) {
     {
         std::scoped_lock its_guard{routing_info_mutex_};
-        service_requests_.erase(client_id);
+        local_services_.remove_requests(client_id);
+        routing_info_coalescer_->remove(client_id);
     }
     host_->remove_local(client_id);
 }
@@ -710,6 +724,7 @@ void routing_manager_stub::on_offer_service(client_t _client, service_t _service
 
     std::scoped_lock its_guard{routing_info_mutex_};
     routing_info_[_client][{_service, _instance}] = std::make_pair(_major, _minor);
+    local_services_.add_offer(_client, _service, _instance);
     if (configuration_->is_security_enabled()) {
         distribute_credentials(_client, _service, _instance);
     }
@@ -735,6 +750,7 @@ void routing_manager_stub::on_stop_offer_service_unlocked(client_t _client, serv
             const auto& [found_major, found_minor] = found_si->second;
             if ((_major == found_major && _minor == found_minor) || (_major == DEFAULT_MAJOR && _minor == DEFAULT_MINOR)) {
                 found_client->second.erase(found_si);
+                local_services_.remove_offer(_client, _service, _instance);
                 inform_requesters(_client, _service, _instance, _major, _minor,
                                   protocol::routing_info_entry_type_e::RIE_DELETE_SERVICE_INSTANCE);
             }
@@ -757,13 +773,6 @@ void routing_manager_stub::send_client_credentials(const client_t _target, std::
         VSOMEIP_ERROR_P << "Sending credentials to client [" << hex4(_target) << "] failed";
 }
 
-void routing_manager_stub::send_client_routing_info(const client_t _target, protocol::routing_info_entry& _entry) {
-
-    std::vector<protocol::routing_info_entry> its_entries;
-    its_entries.emplace_back(_entry);
-    send_client_routing_info(_target, std::move(its_entries));
-}
-
 void routing_manager_stub::send_client_routing_info(const client_t _target, std::vector<protocol::routing_info_entry>&& _entries) {
 
     if (auto its_target_endpoint = find_local_routing_endpoint(_target); its_target_endpoint) {
@@ -782,14 +791,8 @@ void routing_manager_stub::send_client_routing_info(const client_t _target, std:
 
 void routing_manager_stub::distribute_credentials(client_t _hoster, service_t _service, instance_t _instance) {
     std::set<std::pair<uid_t, gid_t>> its_credentials;
-    std::set<client_t> its_requesting_clients;
     // search for clients which shall receive the credentials
-    for (auto its_requesting_client : service_requests_) {
-        if (its_requesting_client.second.contains({_service, _instance})
-            || its_requesting_client.second.contains({_service, ANY_INSTANCE})) {
-            its_requesting_clients.insert(its_requesting_client.first);
-        }
-    }
+    const std::set<client_t> its_requesting_clients = local_services_.get_requesters(_service, _instance);
 
     // search for UID / GID linked with the client ID that offers the requested services
     vsomeip_sec_client_t its_sec_client;
@@ -811,36 +814,32 @@ void routing_manager_stub::distribute_credentials(client_t _hoster, service_t _s
 void routing_manager_stub::inform_requesters(client_t _hoster, service_t _service, instance_t _instance, major_version_t _major,
                                              minor_version_t _minor, protocol::routing_info_entry_type_e _type) {
 
+    std::set<client_t> its_requesters = local_services_.get_requesters(_service, _instance);
+    its_requesters.erase(VSOMEIP_ROUTING_CLIENT);
+    if (its_requesters.empty()) {
+        return;
+    }
+
+    protocol::routing_info_entry its_entry;
+    its_entry.set_type(_type);
+    its_entry.set_client(_hoster);
     boost::asio::ip::address its_address;
     port_t its_port;
+    if (_type == protocol::routing_info_entry_type_e::RIE_ADD_SERVICE_INSTANCE
+        && host_->get_endpoint_manager()->get_guest(_hoster, its_address, its_port)) {
+        its_entry.set_address(its_address);
+        its_entry.set_port(its_port);
+    }
+    its_entry.add_service({_service, _instance, _major, _minor});
 
-    for (auto its_client : service_requests_) {
-        if (its_client.second.contains({_service, _instance}) || its_client.second.contains({_service, ANY_INSTANCE})) {
-            if (its_client.first != VSOMEIP_ROUTING_CLIENT) {
-                protocol::routing_info_entry its_entry;
-                its_entry.set_type(_type);
-                its_entry.set_client(_hoster);
-                if (_type == protocol::routing_info_entry_type_e::RIE_ADD_SERVICE_INSTANCE
-                    && host_->get_endpoint_manager()->get_guest(_hoster, its_address, its_port)) {
-                    its_entry.set_address(its_address);
-                    its_entry.set_port(its_port);
-                }
-                its_entry.add_service({_service, _instance, _major, _minor});
-                send_client_routing_info(its_client.first, its_entry);
-            }
-        }
+    for (const client_t its_requester : its_requesters) {
+        routing_info_coalescer_->queue(its_requester, its_entry);
     }
 }
 
 bool routing_manager_stub::has_client_requested(client_t _client, service_t _service, instance_t _instance) const {
     std::scoped_lock its_lock(routing_info_mutex_);
-    if (auto found_client = service_requests_.find(_client); found_client != service_requests_.end()) {
-        if (found_client->second.contains({_service, _instance})) {
-            return true;
-        }
-    }
-
-    return false;
+    return local_services_.has_requested(_client, _service, _instance);
 }
 
 void routing_manager_stub::broadcast(protocol::command_header const& _command) const {
@@ -1176,7 +1175,7 @@ void routing_manager_stub::handle_requests(const client_t _client, std::set<prot
     std::scoped_lock its_guard{routing_info_mutex_};
 
     for (auto const& request : _requests) {
-        service_requests_[_client][{request.service_, request.instance_}] = std::make_pair(request.major_, request.minor_);
+        local_services_.add_request(_client, request.service_, request.instance_, request.major_, request.minor_);
         if (_client == VSOMEIP_ROUTING_CLIENT) {
             continue;
         }
@@ -1186,8 +1185,9 @@ void routing_manager_stub::handle_requests(const client_t _client, std::set<prot
         for (const client_t c : its_clients) {
             if (const auto found_client = routing_info_.find(c); found_client != routing_info_.end()) {
                 if (request.instance_ == ANY_INSTANCE) {
-                    for (const auto& [si, version] : found_client->second) {
-                        if (si.service() == request.service_) {
+                    for (const instance_t its_instance : local_services_.get_offered_instances(c, request.service_)) {
+                        if (auto found_si = found_client->second.find({request.service_, its_instance});
+                            found_si != found_client->second.end()) {
                             protocol::routing_info_entry its_entry;
                             its_entry.set_type(protocol::routing_info_entry_type_e::RIE_ADD_SERVICE_INSTANCE);
                             its_entry.set_client(c);
@@ -1195,7 +1195,7 @@ void routing_manager_stub::handle_requests(const client_t _client, std::set<prot
                                 its_entry.set_address(its_address);
                                 its_entry.set_port(its_port);
                             }
-                            its_entry.add_service({request.service_, si.instance(), version.first, version.second});
+                            its_entry.add_service({request.service_, its_instance, found_si->second.first, found_si->second.second});
                             its_entries.emplace_back(its_entry);
                         }
                     }
@@ -1218,7 +1218,7 @@ void routing_manager_stub::handle_requests(const client_t _client, std::set<prot
     }
 
     if (!its_entries.empty()) {
-        send_client_routing_info(_client, std::move(its_entries));
+        routing_info_coalescer_->send(_client, std::move(its_entries));
     }
 }
 
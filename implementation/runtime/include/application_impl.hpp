@@ -6,6 +6,7 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
 #include <cstdint>
 #include <deque>
@@ -26,6 +27,7 @@
 #include <vsomeip/application.hpp>
 
 #include "internal.hpp"
+#include "handler_time_statistics.hpp"
 #include "../../routing/include/routing_manager_host.hpp"
 #include "../../utility/include/service_instance_map.hpp"
 
@@ -83,6 +85,8 @@ public:
 
     VSOMEIP_EXPORT void notify(service_t _service, instance_t _instance, event_t _event, std::shared_ptr<payload> _payload,
                                bool _force) const;
+    VSOMEIP_EXPORT void notify(service_t _service, instance_t _instance,
+                               const std::vector<std::pair<event_t, std::shared_ptr<payload>>>& _notifications, bool _force) const;
 
     VSOMEIP_EXPORT void notify_one(service_t _service, instance_t _instance, event_t _event, std::shared_ptr<payload> _payload,
                                    client_t _client, bool _force) const;
@@ -191,6 +195,9 @@ public:
     VSOMEIP_EXPORT void register_message_handler_ext(service_t _service, instance_t _instance, method_t _method,
                                                      const message_handler_t& _handler, handler_registration_type_e _type);
 
+    VSOMEIP_EXPORT statistics_t get_statistics() const;
+    VSOMEIP_EXPORT void set_slow_handler_handler(const slow_handler_handler_t& _handler);
+
 private:
     using members_key_t = std::uint64_t;
     using members_t = std::unordered_map<members_key_t, std::deque<message_handler_t>>;
@@ -203,18 +210,18 @@ private:
     //
     // Types
     //
-    enum class handler_type_e : uint8_t { MESSAGE, AVAILABILITY, STATE, SUBSCRIPTION, OFFERED_SERVICES_INFO, WATCHDOG, UNKNOWN };
-
     struct sync_handler {
 
         sync_handler(const std::function<void()>& _handler) :
             handler_(_handler), service_id_(ANY_SERVICE), instance_id_(ANY_INSTANCE), method_id_(ANY_METHOD), session_id_(0),
-            eventgroup_id_(0), client_id_(ANY_CLIENT), handler_type_(handler_type_e::UNKNOWN) { }
+            eventgroup_id_(0), client_id_(ANY_CLIENT), handler_type_(handler_type_e::HT_UNKNOWN),
+            enqueued_(std::chrono::steady_clock::now()) { }
 
         sync_handler(service_t _service_id, instance_t _instance_id, method_t _method_id, session_t _session_id,
                      eventgroup_t _eventgroup_id, client_t _client_id, handler_type_e _handler_type) :
             handler_(nullptr), service_id_(_service_id), instance_id_(_instance_id), method_id_(_method_id), session_id_(_session_id),
-            eventgroup_id_(_eventgroup_id), client_id_(_client_id), handler_type_(_handler_type) { }
+            eventgroup_id_(_eventgroup_id), client_id_(_client_id), handler_type_(_handler_type),
+            enqueued_(std::chrono::steady_clock::now()) { }
 
         std::function<void()> handler_;
         service_t service_id_;
@@ -224,6 +231,7 @@ private:
         eventgroup_t eventgroup_id_;
         client_t client_id_;
         handler_type_e handler_type_;
+        std::chrono::steady_clock::time_point enqueued_;
     };
 
     //
@@ -260,6 +268,8 @@ private:
     bool check_subscription_state(service_t _service, instance_t _instance, eventgroup_t _eventgroup, event_t _event);
 
     void print_blocking_call(const std::shared_ptr<sync_handler>& _handler);
+    void update_handler_statistics(std::unique_lock<std::mutex>& _lock, const std::shared_ptr<sync_handler>& _handler,
+                                   std::chrono::steady_clock::time_point _start, std::chrono::steady_clock::time_point _finish);
 
     void watchdog_cbk(boost::system::error_code const& _error);
 
@@ -366,6 +376,10 @@ private:
     mutable std::condition_variable dispatcher_condition_;
     std::size_t max_dispatchers_;
     std::size_t max_dispatch_time_;
+    // Counters of the dispatchers, guarded by handlers_mutex_
+    dispatcher_statistics_t dispatcher_statistics_;
+    handler_time_statistics handler_time_statistics_;
+    slow_handler_handler_t slow_handler_handler_;
 
     std::mutex start_stop_mutex_;
     std::atomic_bool stopping_;
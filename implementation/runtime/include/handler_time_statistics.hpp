@@ -0,0 +1,71 @@
+// Copyright (C) 2014-2026 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <optional>
+#include <tuple>
+#include <unordered_map>
+
+#include <vsomeip/structured_types.hpp>
+
+namespace vsomeip_v3 {
+
+/**
+ * @class handler_time_statistics
+ * @brief Collects the execution and queue times of the handlers of the dispatchers.
+ *
+ * The times are collected as log2 microsecond histograms per handler type and,
+ * for message handlers, per service, instance and method. Handlers that run
+ * longer than the handler time budget are counted as slow. A budget of zero
+ * disables the detection of slow handlers.
+ *
+ * **Thread-safety**: None, the application guards it by its handlers mutex.
+ */
+class handler_time_statistics {
+public:
+    using method_key_t = std::uint64_t;
+
+    explicit handler_time_statistics(std::chrono::milliseconds _budget = std::chrono::milliseconds::zero());
+
+    void set_budget(std::chrono::milliseconds _budget);
+    std::chrono::milliseconds get_budget() const;
+
+    /**
+     * @brief Records the execution of a handler.
+     *
+     * The queue time is the time from `_enqueued` to `_started`, the execution
+     * time the time from `_started` to `_finished`.
+     *
+     * @return The slow handler if the execution exceeded the budget.
+     */
+    std::optional<slow_handler_t> add(handler_type_e _type, service_t _service, instance_t _instance, method_t _method,
+                                      std::chrono::steady_clock::time_point _enqueued, std::chrono::steady_clock::time_point _started,
+                                      std::chrono::steady_clock::time_point _finished);
+
+    /**
+     * @brief Copies the handler counters and histograms to the dispatcher statistics.
+     */
+    void get(dispatcher_statistics_t& _statistics) const;
+
+    static void add_to_histogram(latency_histogram_t& _histogram, std::chrono::nanoseconds _duration);
+
+    static method_key_t to_method_key(service_t _service, instance_t _instance, method_t _method);
+    static std::tuple<service_t, instance_t, method_t> from_method_key(method_key_t _key);
+
+private:
+    std::chrono::milliseconds budget_;
+
+    std::uint64_t handlers_invoked_{0};
+    std::chrono::nanoseconds handler_time_total_{0};
+    std::chrono::nanoseconds handler_time_max_{0};
+    std::array<handler_statistics_t, static_cast<std::size_t>(handler_type_e::HT_UNKNOWN) + 1> handler_types_;
+    std::unordered_map<method_key_t, handler_statistics_t> methods_;
+};
+
+} // namespace vsomeip_v3
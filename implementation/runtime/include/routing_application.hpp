@@ -12,6 +12,7 @@
 #include <vsomeip/enumeration_types.hpp>
 #include <vsomeip/payload.hpp>
 #include <vsomeip/handler.hpp>
+#include <vsomeip/structured_types.hpp>
 
 #include <boost/asio/executor_work_guard.hpp>
 
@@ -51,6 +52,8 @@ public:
 
     connection_control_response_e change_connection_control(connection_control_request_e _control, const std::string& _guest_address) const;
 
+    void get_statistics(std::vector<endpoint_statistics_t>& _statistics) const;
+
 private:
     // routing_manager_host interface
     client_t get_client() const override;
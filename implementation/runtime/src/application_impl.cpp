@@ -3,6 +3,7 @@
 // License, v. 2.0. If a copy of the MPL was not distributed with this
 // file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
+#include <algorithm>
 #include <future>
 #include <thread>
 #include <iomanip>
@@ -61,7 +62,8 @@ application_impl::application_impl(const std::string& _name, const std::string&
     signals_{io_, SIGINT, SIGTERM},
 #endif
     is_dispatching_{false}, max_dispatchers_{VSOMEIP_DEFAULT_MAX_DISPATCHERS}, max_dispatch_time_{VSOMEIP_DEFAULT_MAX_DISPATCH_TIME},
-    stopping_{false}, is_routing_manager_host_{false}, watchdog_timer_{io_}, client_side_logging_{false}, has_session_handling_{true} {
+    handler_time_statistics_{std::chrono::milliseconds(VSOMEIP_DEFAULT_HANDLER_TIME_BUDGET)}, stopping_{false},
+    is_routing_manager_host_{false}, watchdog_timer_{io_}, client_side_logging_{false}, has_session_handling_{true} {
 }
 
 application_impl::~application_impl() {
@@ -212,6 +214,7 @@ bool application_impl::init() {
         // the main dispatcher
         max_dispatchers_ = its_configuration->get_max_dispatchers(name_) + 1;
         max_dispatch_time_ = its_configuration->get_max_dispatch_time(name_);
+        handler_time_statistics_.set_budget(std::chrono::milliseconds(its_configuration->get_handler_time_budget(name_)));
 
         has_session_handling_ = its_configuration->has_session_handling(name_);
         if (!has_session_handling_)
@@ -326,6 +329,7 @@ void application_impl::start() {
 
     const size_t io_thread_count = configuration_->get_io_thread_count(name_);
     const int io_thread_nice_level = configuration_->get_io_thread_nice_level(name_);
+    const thread_scheduling_t io_thread_scheduling = configuration_->get_thread_scheduling(name_, thread_type_e::TT_IO);
     {
         std::scoped_lock its_lock{start_stop_mutex_};
 
@@ -363,7 +367,7 @@ void application_impl::start() {
             routing_->start();
 
         for (size_t i = 0; i < io_thread_count - 1; i++) {
-            auto its_thread = std::make_shared<std::thread>([this, i, io_thread_nice_level] {
+            auto its_thread = std::make_shared<std::thread>([this, i, io_thread_nice_level, io_thread_scheduling] {
 #if defined(__linux__)
                 {
                     std::stringstream s;
@@ -372,6 +376,7 @@ void application_impl::start() {
                 }
                 utility::set_thread_niceness(io_thread_nice_level);
 #endif
+                utility::set_thread_scheduling(io_thread_scheduling);
 
                 VSOMEIP_INFO << "Started thread " << hex4(client_) << "_io" << hex2(static_cast<uint8_t>(i + 1)) << ", application '"
                              << name_ << "', id " << std::hex << std::this_thread::get_id()
@@ -433,6 +438,7 @@ void application_impl::start() {
     }
 
     utility::set_thread_niceness(io_thread_nice_level);
+    utility::set_thread_scheduling(io_thread_scheduling);
 
     try {
         io_.run();
@@ -877,6 +883,19 @@ void application_impl::notify(service_t _service, instance_t _instance, event_t
     }
 }
 
+void application_impl::notify(service_t _service, instance_t _instance,
+                              const std::vector<std::pair<event_t, std::shared_ptr<payload>>>& _notifications, bool _force) const {
+
+    if (routing_) {
+        std::vector<std::pair<event_t, std::shared_ptr<payload>>> its_notifications;
+        its_notifications.reserve(_notifications.size());
+        for (const auto& [its_event, its_payload] : _notifications) {
+            its_notifications.emplace_back(its_event, runtime_->create_payload(its_payload->get_data(), its_payload->get_length()));
+        }
+        routing_->notify(_service, _instance, its_notifications, _force);
+    }
+}
+
 void application_impl::notify_one(service_t _service, instance_t _instance, event_t _event, std::shared_ptr<payload> _payload,
                                   client_t _client, bool _force) const {
     if (routing_) {
@@ -937,7 +956,7 @@ void application_impl::invoke_availability_handler(service_t _service, instance_
                     std::scoped_lock handlers_lock{handlers_mutex_};
                     auto its_sync_handler = std::make_shared<sync_handler>(
                             [its_handler, _service, _instance, its_state]() { its_handler(_service, _instance, its_state); });
-                    its_sync_handler->handler_type_ = handler_type_e::AVAILABILITY;
+                    its_sync_handler->handler_type_ = handler_type_e::HT_AVAILABILITY;
                     its_sync_handler->service_id_ = _service;
                     its_sync_handler->instance_id_ = _instance;
                     handlers_.push_back(its_sync_handler);
@@ -961,7 +980,7 @@ void application_impl::register_availability_handler_unlocked(service_t _service
 
     auto add_sync_handler = [&](service_t _srvc, instance_t _nstnc, const availability_state_handler_t& _hndlr, availability_state_e _stt) {
         auto its_sync_handler = std::make_shared<sync_handler>([_hndlr, _srvc, _nstnc, _stt]() { _hndlr(_srvc, _nstnc, _stt); });
-        its_sync_handler->handler_type_ = handler_type_e::AVAILABILITY;
+        its_sync_handler->handler_type_ = handler_type_e::HT_AVAILABILITY;
         its_sync_handler->service_id_ = _srvc;
         its_sync_handler->instance_id_ = _nstnc;
         handlers_.push_back(its_sync_handler);
@@ -1036,7 +1055,7 @@ void application_impl::on_subscription(service_t _service, instance_t _instance,
     its_sync_handler->instance_id_ = _instance;
     its_sync_handler->eventgroup_id_ = _eventgroup;
     its_sync_handler->client_id_ = _client;
-    its_sync_handler->handler_type_ = handler_type_e::SUBSCRIPTION;
+    its_sync_handler->handler_type_ = handler_type_e::HT_SUBSCRIPTION;
     std::scoped_lock handlers_lock(handlers_mutex_);
     handlers_.push_back(its_sync_handler);
     dispatcher_condition_.notify_all();
@@ -1171,7 +1190,7 @@ void application_impl::deliver_subscription_state(service_t _service, instance_t
             auto its_sync_handler = std::make_shared<sync_handler>([handler, _service, _instance, _eventgroup, _event, _error]() {
                 handler(_service, _instance, _eventgroup, _event, _error);
             });
-            its_sync_handler->handler_type_ = handler_type_e::SUBSCRIPTION;
+            its_sync_handler->handler_type_ = handler_type_e::HT_SUBSCRIPTION;
             its_sync_handler->service_id_ = _service;
             its_sync_handler->instance_id_ = _instance;
             its_sync_handler->method_id_ = _event;
@@ -1380,7 +1399,7 @@ void application_impl::on_state(state_type_e _state) {
     if (has_state_handler) {
         std::scoped_lock its_lock{handlers_mutex_};
         auto its_sync_handler = std::make_shared<sync_handler>([handler, _state]() { handler(_state); });
-        its_sync_handler->handler_type_ = handler_type_e::STATE;
+        its_sync_handler->handler_type_ = handler_type_e::HT_STATE;
         handlers_.push_back(its_sync_handler);
         dispatcher_condition_.notify_all();
     }
@@ -1486,7 +1505,7 @@ void application_impl::on_availability(service_t _service, instance_t _instance,
             for (const auto& handler : its_handlers) {
                 auto its_sync_handler =
                         std::make_shared<sync_handler>([handler, _service, _instance, _state]() { handler(_service, _instance, _state); });
-                its_sync_handler->handler_type_ = handler_type_e::AVAILABILITY;
+                its_sync_handler->handler_type_ = handler_type_e::HT_AVAILABILITY;
                 its_sync_handler->service_id_ = _service;
                 its_sync_handler->instance_id_ = _instance;
                 handlers_.push_back(its_sync_handler);
@@ -1565,7 +1584,7 @@ void application_impl::on_message(std::shared_ptr<message>&& _message) {
             std::scoped_lock its_lock_inner{handlers_mutex_};
             for (const auto& handler : its_handlers) {
                 auto its_sync_handler = std::make_shared<sync_handler>([handler, _message]() { handler(_message); });
-                its_sync_handler->handler_type_ = handler_type_e::MESSAGE;
+                its_sync_handler->handler_type_ = handler_type_e::HT_MESSAGE;
                 its_sync_handler->service_id_ = _message->get_service();
                 its_sync_handler->instance_id_ = _message->get_instance();
                 its_sync_handler->method_id_ = _message->get_method();
@@ -1580,6 +1599,7 @@ void application_impl::on_message(std::shared_ptr<message>&& _message) {
 // Interface "service_discovery_host"
 void application_impl::main_dispatch() {
     utility::set_thread_niceness(configuration_->get_io_thread_nice_level(name_));
+    utility::set_thread_scheduling(configuration_->get_thread_scheduling(name_, thread_type_e::TT_DISPATCHER));
 #if defined(__linux__) || defined(__QNX__)
     {
         std::stringstream s;
@@ -1635,6 +1655,7 @@ void application_impl::dispatch() {
         pthread_setname_np(pthread_self(), s.str().c_str());
     }
 #endif
+    utility::set_thread_scheduling(configuration_->get_thread_scheduling(name_, thread_type_e::TT_DISPATCHER));
     const std::thread::id its_id = std::this_thread::get_id();
 
     VSOMEIP_INFO << "Started thread " << hex4(client_) << "_dispatch, application '" << name_ << "', id " << std::hex << its_id
@@ -1683,13 +1704,15 @@ void application_impl::dispatch() {
 }
 
 std::shared_ptr<application_impl::sync_handler> application_impl::get_next_handler() {
+    dispatcher_statistics_.queue_size_high_water_mark_ = std::max(dispatcher_statistics_.queue_size_high_water_mark_, handlers_.size());
+
     std::shared_ptr<sync_handler> its_next_handler;
     while (!handlers_.empty() && !its_next_handler) {
         its_next_handler = handlers_.front();
         handlers_.pop_front();
 
         // Check handler
-        if (its_next_handler->handler_type_ == handler_type_e::SUBSCRIPTION && its_next_handler->client_id_ != ANY_CLIENT) {
+        if (its_next_handler->handler_type_ == handler_type_e::HT_SUBSCRIPTION && its_next_handler->client_id_ != ANY_CLIENT) {
             const auto its_key = its_next_handler->client_id_;
             auto found = subscription_handlers_.find(its_key);
             if (found != subscription_handlers_.end() && !found->second.empty() && found->second.front() != its_next_handler) {
@@ -1699,7 +1722,7 @@ std::shared_ptr<application_impl::sync_handler> application_impl::get_next_handl
             } else {
                 subscription_handlers_[its_key].push_back(its_next_handler);
             }
-        } else if (its_next_handler->handler_type_ == handler_type_e::AVAILABILITY) {
+        } else if (its_next_handler->handler_type_ == handler_type_e::HT_AVAILABILITY) {
             const service_instance_t its_si_pair{its_next_handler->service_id_, its_next_handler->instance_id_};
 
             auto found_si = availability_handlers_.find(its_si_pair);
@@ -1711,7 +1734,7 @@ std::shared_ptr<application_impl::sync_handler> application_impl::get_next_handl
             } else {
                 availability_handlers_[its_si_pair].push_back(its_next_handler);
             }
-        } else if (its_next_handler->handler_type_ == handler_type_e::MESSAGE) {
+        } else if (its_next_handler->handler_type_ == handler_type_e::HT_MESSAGE) {
             const service_instance_t its_si_pair{its_next_handler->service_id_, its_next_handler->instance_id_};
 
             auto found_si = availability_handlers_.find(its_si_pair);
@@ -1728,7 +1751,7 @@ std::shared_ptr<application_impl::sync_handler> application_impl::get_next_handl
 }
 
 void application_impl::reschedule_availability_handler(const std::shared_ptr<sync_handler>& _handler) {
-    if (_handler->handler_type_ == handler_type_e::AVAILABILITY) {
+    if (_handler->handler_type_ == handler_type_e::HT_AVAILABILITY) {
         const service_instance_t its_si_pair{_handler->service_id_, _handler->instance_id_};
 
         auto found_si = availability_handlers_.find(its_si_pair);
@@ -1750,7 +1773,7 @@ void application_impl::reschedule_availability_handler(const std::shared_ptr<syn
 }
 
 void application_impl::reschedule_subscription_handler(const std::shared_ptr<sync_handler>& _handler) {
-    if (_handler->handler_type_ == handler_type_e::SUBSCRIPTION && _handler->client_id_ != ANY_CLIENT) {
+    if (_handler->handler_type_ == handler_type_e::HT_SUBSCRIPTION && _handler->client_id_ != ANY_CLIENT) {
         const auto its_key = _handler->client_id_;
         if (auto const found = subscription_handlers_.find(its_key); found != subscription_handlers_.end()) {
             if (!found->second.empty() && found->second.front() == _handler) {
@@ -1781,6 +1804,7 @@ void application_impl::invoke_handler(std::unique_lock<std::mutex>& _lock, std::
         if (!_error) {
             print_blocking_call(its_sync_handler);
             std::scoped_lock its_lock{handlers_mutex_};
+            ++dispatcher_statistics_.handlers_blocked_;
             if (has_active_dispatcher()) {
                 dispatcher_condition_.notify_all();
             } else {
@@ -1815,13 +1839,17 @@ void application_impl::invoke_handler(std::unique_lock<std::mutex>& _lock, std::
 
     if (is_dispatching_) {
         _lock.unlock();
+        const auto its_start = std::chrono::steady_clock::now();
         try {
             _handler->handler_();
         } catch (const std::exception& e) {
             VSOMEIP_ERROR_P << "Caught exception: " << e.what();
             print_blocking_call(its_sync_handler);
         }
+        const auto its_finish = std::chrono::steady_clock::now();
         _lock.lock();
+
+        update_handler_statistics(_lock, _handler, its_start, its_finish);
     }
 
     its_dispatcher_timer.cancel();
@@ -1957,6 +1985,29 @@ connection_control_response_e application_impl::change_connection_control(connec
     return routing_app_->change_connection_control(_control, _guest_address);
 }
 
+statistics_t application_impl::get_statistics() const {
+    statistics_t its_statistics;
+    if (routing_) {
+        routing_->get_statistics(its_statistics.endpoints_);
+    }
+    if (routing_app_) {
+        routing_app_->get_statistics(its_statistics.endpoints_);
+    }
+
+    std::scoped_lock its_lock{handlers_mutex_};
+    its_statistics.dispatcher_ = dispatcher_statistics_;
+    its_statistics.dispatcher_.dispatchers_ = dispatchers_.size();
+    its_statistics.dispatcher_.running_dispatchers_ = running_dispatchers_.size();
+    its_statistics.dispatcher_.queue_size_ = handlers_.size();
+    handler_time_statistics_.get(its_statistics.dispatcher_);
+    return its_statistics;
+}
+
+void application_impl::set_slow_handler_handler(const slow_handler_handler_t& _handler) {
+    std::scoped_lock its_lock{handlers_mutex_};
+    slow_handler_handler_ = _handler;
+}
+
 void application_impl::check_send_back_cached_event(service_t _service, instance_t _instance, event_t _event, eventgroup_t _eventgroup,
                                                     bool* _send_back_cached_event, bool* _send_back_cached_eventgroup) {
     std::scoped_lock its_lock{subscriptions_mutex_};
@@ -2103,34 +2154,59 @@ bool application_impl::check_subscription_state(service_t _service, instance_t _
 
 void application_impl::print_blocking_call(const std::shared_ptr<sync_handler>& _handler) {
     switch (_handler->handler_type_) {
-    case handler_type_e::AVAILABILITY:
+    case handler_type_e::HT_AVAILABILITY:
         VSOMEIP_WARNING << "BLOCKING CALL AVAILABILITY(" << hex4(get_client()) << "): [" << hex4(_handler->service_id_) << "."
                         << hex4(_handler->instance_id_) << "]";
         break;
-    case handler_type_e::MESSAGE:
+    case handler_type_e::HT_MESSAGE:
         VSOMEIP_WARNING << "BLOCKING CALL MESSAGE(" << hex4(get_client()) << "): [" << hex4(_handler->service_id_) << "."
                         << hex4(_handler->instance_id_) << "." << hex4(_handler->method_id_) << ":" << hex4(_handler->session_id_) << "]";
         break;
-    case handler_type_e::STATE:
+    case handler_type_e::HT_STATE:
         VSOMEIP_WARNING << "BLOCKING CALL STATE(" << hex4(get_client()) << ")";
         break;
-    case handler_type_e::SUBSCRIPTION:
+    case handler_type_e::HT_SUBSCRIPTION:
         VSOMEIP_WARNING << "BLOCKING CALL SUBSCRIPTION(" << hex4(get_client()) << "): [" << hex4(_handler->service_id_) << "."
                         << hex4(_handler->instance_id_) << "." << hex4(_handler->eventgroup_id_) << ":" << hex4(_handler->method_id_)
                         << "]";
         break;
-    case handler_type_e::OFFERED_SERVICES_INFO:
+    case handler_type_e::HT_OFFERED_SERVICES_INFO:
         VSOMEIP_WARNING << "BLOCKING CALL OFFERED_SERVICES_INFO(" << hex4(get_client()) << ")";
         break;
-    case handler_type_e::WATCHDOG:
+    case handler_type_e::HT_WATCHDOG:
         VSOMEIP_WARNING << "BLOCKING CALL WATCHDOG(" << hex4(get_client()) << ")";
         break;
-    case handler_type_e::UNKNOWN:
+    case handler_type_e::HT_UNKNOWN:
         VSOMEIP_WARNING << "BLOCKING CALL UNKNOWN(" << hex4(get_client()) << ")";
         break;
     }
 }
 
+void application_impl::update_handler_statistics(std::unique_lock<std::mutex>& _lock, const std::shared_ptr<sync_handler>& _handler,
+                                                 std::chrono::steady_clock::time_point _start,
+                                                 std::chrono::steady_clock::time_point _finish) {
+    const auto its_slow_handler = handler_time_statistics_.add(_handler->handler_type_, _handler->service_id_, _handler->instance_id_,
+                                                               _handler->method_id_, _handler->enqueued_, _start, _finish);
+    if (its_slow_handler) {
+        const auto its_slow_handler_handler = slow_handler_handler_;
+        const auto its_budget = handler_time_statistics_.get_budget();
+
+        // Neither log nor call the application while holding the handlers mutex
+        _lock.unlock();
+        if (its_slow_handler_handler) {
+            its_slow_handler_handler(*its_slow_handler);
+        } else {
+            VSOMEIP_WARNING << "SLOW HANDLER(" << hex4(get_client()) << "): [" << hex4(_handler->service_id_) << "."
+                            << hex4(_handler->instance_id_) << "." << hex4(_handler->method_id_) << ":" << hex4(_handler->session_id_)
+                            << "] type=" << static_cast<std::uint32_t>(_handler->handler_type_) << " execution="
+                            << std::chrono::duration_cast<std::chrono::microseconds>(its_slow_handler->execution_time_).count()
+                            << "us queue=" << std::chrono::duration_cast<std::chrono::microseconds>(its_slow_handler->queue_time_).count()
+                            << "us budget=" << std::dec << its_budget.count() << "ms";
+        }
+        _lock.lock();
+    }
+}
+
 void application_impl::get_offered_services_async(offer_type_e _offer_type, const offered_services_handler_t& _handler) {
     {
         std::scoped_lock its_lock{offered_services_handler_mutex_};
@@ -2152,7 +2228,7 @@ void application_impl::on_offered_services_info(std::vector<std::pair<service_t,
     if (has_offered_services_handler) {
         std::scoped_lock its_lock{handlers_mutex_};
         auto its_sync_handler = std::make_shared<sync_handler>([handler, _services]() { handler(_services); });
-        its_sync_handler->handler_type_ = handler_type_e::OFFERED_SERVICES_INFO;
+        its_sync_handler->handler_type_ = handler_type_e::HT_OFFERED_SERVICES_INFO;
         handlers_.push_back(its_sync_handler);
         dispatcher_condition_.notify_all();
     }
@@ -2174,7 +2250,7 @@ void application_impl::watchdog_cbk(boost::system::error_code const& _error) {
         if (handler) {
             std::scoped_lock its_lock{handlers_mutex_};
             auto its_sync_handler = std::make_shared<sync_handler>([handler]() { handler(); });
-            its_sync_handler->handler_type_ = handler_type_e::WATCHDOG;
+            its_sync_handler->handler_type_ = handler_type_e::HT_WATCHDOG;
             handlers_.push_back(its_sync_handler);
             dispatcher_condition_.notify_all();
         }
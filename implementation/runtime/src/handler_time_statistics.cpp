@@ -0,0 +1,94 @@
+// Copyright (C) 2014-2026 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <algorithm>
+#include <bit>
+
+#include "../include/handler_time_statistics.hpp"
+
+namespace vsomeip_v3 {
+
+handler_time_statistics::handler_time_statistics(std::chrono::milliseconds _budget) : budget_(_budget) { }
+
+void handler_time_statistics::set_budget(std::chrono::milliseconds _budget) {
+    budget_ = _budget;
+}
+
+std::chrono::milliseconds handler_time_statistics::get_budget() const {
+    return budget_;
+}
+
+std::optional<slow_handler_t> handler_time_statistics::add(handler_type_e _type, service_t _service, instance_t _instance, method_t _method,
+                                                           std::chrono::steady_clock::time_point _enqueued,
+                                                           std::chrono::steady_clock::time_point _started,
+                                                           std::chrono::steady_clock::time_point _finished) {
+    const std::chrono::nanoseconds its_execution_time = _finished - _started;
+    const std::chrono::nanoseconds its_queue_time = _started - _enqueued;
+
+    ++handlers_invoked_;
+    handler_time_total_ += its_execution_time;
+    handler_time_max_ = std::max(handler_time_max_, its_execution_time);
+
+    const bool is_slow = (budget_ > std::chrono::milliseconds::zero() && its_execution_time > budget_);
+
+    auto& its_type_statistics = handler_types_[std::min(static_cast<std::size_t>(_type), handler_types_.size() - 1)];
+    add_to_histogram(its_type_statistics.execution_time_, its_execution_time);
+    add_to_histogram(its_type_statistics.queue_time_, its_queue_time);
+    if (is_slow) {
+        ++its_type_statistics.budget_exceeded_;
+    }
+
+    if (_type == handler_type_e::HT_MESSAGE) {
+        auto& its_method_statistics = methods_[to_method_key(_service, _instance, _method)];
+        add_to_histogram(its_method_statistics.execution_time_, its_execution_time);
+        add_to_histogram(its_method_statistics.queue_time_, its_queue_time);
+        if (is_slow) {
+            ++its_method_statistics.budget_exceeded_;
+        }
+    }
+
+    if (!is_slow) {
+        return std::nullopt;
+    }
+    return slow_handler_t{_type, _service, _instance, _method, its_execution_time, its_queue_time};
+}
+
+void handler_time_statistics::get(dispatcher_statistics_t& _statistics) const {
+    _statistics.handlers_invoked_ = handlers_invoked_;
+    _statistics.handler_time_total_ = handler_time_total_;
+    _statistics.handler_time_max_ = handler_time_max_;
+
+    _statistics.handler_types_.clear();
+    for (std::size_t i = 0; i < handler_types_.size(); ++i) {
+        if (handler_types_[i].execution_time_.count_ > 0) {
+            _statistics.handler_types_[static_cast<handler_type_e>(i)] = handler_types_[i];
+        }
+    }
+    _statistics.methods_.clear();
+    for (const auto& [its_key, its_method_statistics] : methods_) {
+        _statistics.methods_[from_method_key(its_key)] = its_method_statistics;
+    }
+}
+
+void handler_time_statistics::add_to_histogram(latency_histogram_t& _histogram, std::chrono::nanoseconds _duration) {
+    const auto its_us =
+            static_cast<std::uint64_t>(std::max<std::int64_t>(0, std::chrono::duration_cast<std::chrono::microseconds>(_duration).count()));
+    const auto its_bucket = std::min<std::size_t>(std::bit_width(its_us), latency_histogram_t::BUCKETS - 1);
+    ++_histogram.buckets_[its_bucket];
+    ++_histogram.count_;
+    _histogram.total_ += _duration;
+    _histogram.max_ = std::max(_histogram.max_, _duration);
+}
+
+handler_time_statistics::method_key_t handler_time_statistics::to_method_key(service_t _service, instance_t _instance, method_t _method) {
+    return (static_cast<method_key_t>(_service) << 0) | (static_cast<method_key_t>(_instance) << 16)
+            | (static_cast<method_key_t>(_method) << 32);
+}
+
+std::tuple<service_t, instance_t, method_t> handler_time_statistics::from_method_key(method_key_t _key) {
+    return {static_cast<service_t>(_key), static_cast<instance_t>(_key >> 16), static_cast<method_t>(_key >> 32)};
+}
+
+} // namespace vsomeip_v3
@@ -171,6 +171,10 @@ connection_control_response_e routing_application::change_connection_control(con
     return routing_->change_connection_control(_control, its_addr);
 }
 
+void routing_application::get_statistics(std::vector<endpoint_statistics_t>& _statistics) const {
+    routing_->get_endpoint_manager()->get_statistics(_statistics);
+}
+
 bool routing_application::is_routing() const {
     return true;
 }
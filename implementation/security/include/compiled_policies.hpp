@@ -0,0 +1,73 @@
+// Copyright (C) 2014-2026 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <boost/icl/interval_map.hpp>
+#include <boost/icl/interval_set.hpp>
+
+#include <vsomeip/primitive_types.hpp>
+
+#include "policy.hpp"
+
+namespace vsomeip_v3 {
+
+/**
+ * @class compiled_policies
+ * @brief Immutable snapshot of the client policies that is used to decide
+ * whether a client is allowed to access a service.
+ *
+ * The snapshot copies the credentials and requests of the policies, so that
+ * decisions do neither lock the policy manager nor the single policies. The
+ * policies that allow given credentials are indexed by uid. Only these and
+ * the policies that deny credentials need to be evaluated for a decision.
+ *
+ * **Thread-safety**: Safe to be shared between threads, as it is never
+ * modified after construction.
+ */
+class compiled_policies {
+public:
+    /**
+     * @param _policies Policies to compile. The caller must hold the lock
+     *                  that protects the policy list.
+     * @param _generation Generation of the policy list.
+     */
+    compiled_policies(const std::vector<std::shared_ptr<policy>>& _policies, std::uint64_t _generation);
+
+    /**
+     * @brief Evaluates the policies for the given credentials and request.
+     *
+     * @return true, if a policy allows the request.
+     */
+    bool is_allowed(uid_t _uid, gid_t _gid, service_t _service, instance_t _instance, method_t _method, bool _is_request_service) const;
+
+    std::uint64_t get_generation() const { return generation_; }
+    std::size_t size() const { return rules_.size(); }
+
+private:
+    struct rule {
+        boost::icl::interval_map<uid_t, boost::icl::interval_set<gid_t>> credentials_;
+        boost::icl::interval_map<service_t, boost::icl::interval_map<instance_t, boost::icl::interval_set<method_t>>> requests_;
+        bool allow_who_;
+        bool allow_what_;
+    };
+
+    bool is_allowed(const rule& _rule, uid_t _uid, gid_t _gid, service_t _service, instance_t _instance, method_t _method,
+                    bool _is_request_service) const;
+
+    std::uint64_t const generation_;
+    std::vector<rule> rules_;
+
+    // uid -> indexes of the rules that allow the uid
+    boost::icl::interval_map<uid_t, boost::icl::interval_set<std::size_t>> allow_who_index_;
+    // indexes of the rules that deny credentials, ascending
+    std::vector<std::size_t> deny_who_rules_;
+};
+
+} // namespace vsomeip_v3
@@ -5,10 +5,14 @@
 
 #pragma once
 
+#include <array>
 #include <atomic>
+#include <chrono>
+#include <functional>
 #include <map>
 #include <mutex>
 #include <shared_mutex>
+#include <tuple>
 #include <unordered_set>
 #include <vector>
 
@@ -19,7 +23,9 @@
 #include <vsomeip/internal/policy_manager.hpp>
 #include <vsomeip/vsomeip_sec.h>
 
+#include "../include/compiled_policies.hpp"
 #include "../include/policy.hpp"
+#include "../../utility/include/snapshot.hpp"
 
 namespace vsomeip_v3 {
 
@@ -53,6 +59,7 @@ public:
 
     // extension
     void load(const configuration_element& _element, const bool _lazy_load = false);
+    void load(const std::vector<std::reference_wrapper<const configuration_element>>& _elements, const bool _lazy_load = false);
 
     void update_security_policy(uid_t _uid, uid_t _gid, const std::shared_ptr<policy>& _policy);
     bool remove_security_policy(uid_t _uid, uid_t _gid);
@@ -75,8 +82,9 @@ public:
 private:
     // Configuration
     bool exist_in_any_client_policies_unlocked(std::shared_ptr<policy>& _policy);
-    void load_policies(const configuration_element& _element);
-    void load_policy(const boost::property_tree::ptree& _tree);
+    void load_policies(const configuration_element& _element, std::vector<const boost::property_tree::ptree*>& _policies);
+    std::shared_ptr<policy> load_policy(const boost::property_tree::ptree& _tree);
+    void add_policies(const std::vector<std::shared_ptr<policy>>& _policies);
     void load_policy_body(std::shared_ptr<policy>& _policy, const boost::property_tree::ptree::const_iterator& _tree);
     void load_credential(const boost::property_tree::ptree& _tree, boost::icl::interval_map<uid_t, boost::icl::interval_set<gid_t>>& _ids);
     bool load_routing_credentials(const configuration_element& _element);
@@ -84,6 +92,13 @@ private:
     void load_interval_set(const boost::property_tree::ptree& _tree, boost::icl::interval_set<T_>& _range, bool _exclude_margins = false);
     void load_security_update_whitelist(const configuration_element& _element);
     void load_security_policy_extensions(const configuration_element& _element);
+
+    // Decisions
+    void invalidate_decisions_unlocked();
+    std::shared_ptr<const compiled_policies> get_compiled_policies() const;
+    using denied_key_t = std::tuple<uid_t, gid_t, service_t, instance_t, method_t, bool>;
+    void cache_denied(std::uint64_t _generation, const denied_key_t& _key) const;
+    void log_denied(uid_t _uid, gid_t _gid, service_t _service, instance_t _instance, method_t _method) const;
 #endif // !VSOMEIP_DISABLE_SECURITY
 
 public:
@@ -118,6 +133,32 @@ private:
     mutable std::shared_mutex is_client_allowed_cache_mutex_;
     mutable std::map<std::pair<uid_t, gid_t>, std::set<std::tuple<service_t, instance_t, method_t>>> is_client_allowed_cache_;
 
+    // Decisions are taken from a compiled snapshot of any_client_policies_, which is
+    // recompiled on demand if the generation changed. Denials are cached, too.
+    std::atomic<std::uint64_t> policies_generation_;
+    mutable snapshot<const compiled_policies> compiled_policies_;
+    mutable std::mutex compiled_policies_mutex_;
+
+    // Denials of a generation, sorted. Published like the compiled policies, thus
+    // repeated denials are decided without locking. Only new denials copy it,
+    // serialized by the mutex.
+    struct denied_decisions {
+        std::uint64_t generation_{0};
+        std::vector<denied_key_t> keys_;
+    };
+    mutable snapshot<const denied_decisions> denied_decisions_;
+    mutable std::mutex denied_decisions_mutex_;
+
+    // Rate limit of the denial logs, indexed by a hash of the credentials. Credentials
+    // that share a slot are rate limited together.
+    struct denied_log_t {
+        std::atomic<std::uint64_t> credentials_{0};
+        std::atomic<std::chrono::steady_clock::rep> last_{0};
+        std::atomic<std::uint32_t> suppressed_{0};
+    };
+    static constexpr std::size_t denied_log_size_{256};
+    mutable std::array<denied_log_t, denied_log_size_> denied_log_;
+
     std::atomic<bool> policy_enabled_;
     bool check_credentials_;
     bool allow_remote_clients_;
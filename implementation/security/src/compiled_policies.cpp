@@ -0,0 +1,92 @@
+// Copyright (C) 2014-2026 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "../include/compiled_policies.hpp"
+
+#include <mutex>
+
+#include <vsomeip/constants.hpp>
+
+namespace vsomeip_v3 {
+
+compiled_policies::compiled_policies(const std::vector<std::shared_ptr<policy>>& _policies, std::uint64_t _generation) :
+    generation_(_generation) {
+
+    rules_.reserve(_policies.size());
+    for (const auto& p : _policies) {
+        std::scoped_lock its_policy_lock(p->mutex_);
+        const std::size_t its_index = rules_.size();
+        rules_.push_back({p->credentials_, p->requests_, p->allow_who_, p->allow_what_});
+
+        if (p->allow_who_) {
+            for (const auto& c : p->credentials_) {
+                allow_who_index_ += std::make_pair(c.first, boost::icl::interval_set<std::size_t>(its_index));
+            }
+        } else {
+            deny_who_rules_.push_back(its_index);
+        }
+    }
+}
+
+bool compiled_policies::is_allowed(uid_t _uid, gid_t _gid, service_t _service, instance_t _instance, method_t _method,
+                                   bool _is_request_service) const {
+
+    // A policy can only allow a request, never deny it explicitly. Therefore,
+    // the request is allowed if any of the policies that apply to the
+    // credentials allows it.
+    const auto found_uid = allow_who_index_.find(_uid);
+    if (found_uid != allow_who_index_.end()) {
+        for (const auto& its_range : found_uid->second) {
+            std::size_t its_first, its_last;
+            get_bounds(its_range, its_first, its_last);
+            for (auto i = its_first; i <= its_last; i++) {
+                if (is_allowed(rules_[i], _uid, _gid, _service, _instance, _method, _is_request_service)) {
+                    return true;
+                }
+            }
+        }
+    }
+
+    for (const auto i : deny_who_rules_) {
+        if (is_allowed(rules_[i], _uid, _gid, _service, _instance, _method, _is_request_service)) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool compiled_policies::is_allowed(const rule& _rule, uid_t _uid, gid_t _gid, service_t _service, instance_t _instance,
+                                   method_t _method, bool _is_request_service) const {
+
+    bool has_credentials(false);
+    const auto found_uid = _rule.credentials_.find(_uid);
+    if (found_uid != _rule.credentials_.end()) {
+        has_credentials = found_uid->second.find(_gid) != found_uid->second.end();
+    }
+    if (has_credentials != _rule.allow_who_) {
+        return false;
+    }
+
+    bool is_matching(false);
+    const auto found_service = _rule.requests_.find(_service);
+    if (found_service != _rule.requests_.end()) {
+        const auto found_instance = found_service->second.find(_instance);
+        if (found_instance != found_service->second.end()) {
+            // VSOMEIP_REQUEST_SERVICE matches any method
+            is_matching = _is_request_service || found_instance->second.find(_method) != found_instance->second.end();
+        }
+    }
+
+    if (_rule.allow_what_) {
+        return is_matching;
+    }
+
+    // deny policy: allow client if the service / instance / !ANY_METHOD was not found,
+    // or if the service / instance / ANY_METHOD was not found and it is a "deny nothing" policy
+    return !is_matching && (_method != ANY_METHOD || _rule.requests_.empty());
+}
+
+} // namespace vsomeip_v3
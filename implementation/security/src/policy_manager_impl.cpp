@@ -38,8 +38,8 @@ void read_data(const std::string& _in, T_& _out) {
 
 policy_manager_impl::policy_manager_impl() :
 #ifndef VSOMEIP_DISABLE_SECURITY
-    policy_enabled_(false), check_credentials_(false), allow_remote_clients_(true), check_whitelist_(false), policy_base_path_(""),
-    check_routing_credentials_(false),
+    policies_generation_(0), policy_enabled_(false), check_credentials_(false),
+    allow_remote_clients_(true), check_whitelist_(false), policy_base_path_(""), check_routing_credentials_(false),
 #endif // !VSOMEIP_DISABLE_SECURITY
     is_configured_(false) {
 }
@@ -223,69 +223,115 @@ bool policy_manager_impl::is_client_allowed(const vsomeip_sec_client_t* _sec_cli
         }
     }
 
-    // Check policies
-    std::shared_lock its_lock(any_client_policies_mutex_);
-    for (const auto& p : any_client_policies_) {
-        std::scoped_lock its_policy_lock(p->mutex_);
-        bool has_uid, has_gid(false);
-        bool is_matching(false);
+    // Check denied cache (lock-free)
+    const denied_key_t its_denied_key(its_uid, its_gid, _service, _instance, _method, _is_request_service);
+    bool is_denied(false);
+    if (const auto its_denied = denied_decisions_.load(); its_denied && its_denied->generation_ == policies_generation_) {
+        is_denied = std::binary_search(its_denied->keys_.begin(), its_denied->keys_.end(), its_denied_key);
+    }
 
-        const auto found_uid = p->credentials_.find(its_uid);
-        has_uid = (found_uid != p->credentials_.end());
-        if (has_uid) {
-            const auto found_gid = found_uid->second.find(its_gid);
-            has_gid = (found_gid != found_uid->second.end());
+    // Check policies
+    if (!is_denied) {
+        const auto its_policies = get_compiled_policies();
+        if (its_policies->is_allowed(its_uid, its_gid, _service, _instance, _method, _is_request_service)) {
+            std::unique_lock its_cache_lock(is_client_allowed_cache_mutex_);
+            is_client_allowed_cache_[its_credentials].insert(its_key);
+            return true;
         }
+        cache_denied(its_policies->get_generation(), its_denied_key);
+    }
 
-        const auto found_service = p->requests_.find(_service);
-        if (found_service != p->requests_.end()) {
-            const auto found_instance = found_service->second.find(_instance);
-            if (found_instance != found_service->second.end()) {
-                if (!_is_request_service) {
-                    const auto found_method = found_instance->second.find(_method);
-                    is_matching = (found_method != found_instance->second.end());
-                } else {
-                    // handle VSOMEIP_REQUEST_SERVICE
-                    is_matching = true;
-                }
-            }
-        }
+    log_denied(its_uid, its_gid, _service, _instance, _method);
 
-        if ((has_uid && has_gid && p->allow_who_) || ((!has_uid || !has_gid) && !p->allow_who_)) {
-            if (p->allow_what_) {
-                // allow policy
-                if (is_matching) {
-                    std::unique_lock its_cache_lock(is_client_allowed_cache_mutex_);
-                    is_client_allowed_cache_[its_credentials].insert(its_key);
-                    return true;
-                }
-            } else {
-                // deny policy
-                // allow client if the service / instance / !ANY_METHOD was not found
-                if ((!is_matching && (_method != ANY_METHOD))
-                    // allow client if the service / instance / ANY_METHOD was not found
-                    // and it is a "deny nothing" policy
-                    || (!is_matching && (_method == ANY_METHOD) && p->requests_.empty())) {
-                    std::unique_lock its_cache_lock(is_client_allowed_cache_mutex_);
-                    is_client_allowed_cache_[its_credentials].insert(its_key);
-                    return true;
-                }
-            }
+    return !check_credentials_;
+#endif // VSOMEIP_DISABLE_SECURITY
+}
+
+#ifndef VSOMEIP_DISABLE_SECURITY
+void policy_manager_impl::invalidate_decisions_unlocked() {
+    // must be called with any_client_policies_mutex_ being locked exclusively
+    policies_generation_++;
+
+    // Denials of the previous generation are no longer used, release them
+    std::scoped_lock its_lock(denied_decisions_mutex_);
+    denied_decisions_.store(nullptr);
+}
+
+void policy_manager_impl::cache_denied(std::uint64_t _generation, const denied_key_t& _key) const {
+    std::scoped_lock its_lock(denied_decisions_mutex_);
+    // do not cache the decision if the policies were changed meanwhile
+    if (_generation != policies_generation_) {
+        return;
+    }
+
+    const auto its_denied = denied_decisions_.load();
+    auto its_copy = std::make_shared<denied_decisions>();
+    its_copy->generation_ = _generation;
+    if (its_denied && its_denied->generation_ == _generation && its_denied->keys_.size() < VSOMEIP_SECURITY_DENIED_CACHE_SIZE) {
+        its_copy->keys_.reserve(its_denied->keys_.size() + 1);
+        its_copy->keys_ = its_denied->keys_;
+    }
+    const auto its_position = std::lower_bound(its_copy->keys_.begin(), its_copy->keys_.end(), _key);
+    if (its_position != its_copy->keys_.end() && *its_position == _key) {
+        // cached by a concurrent denial
+        return;
+    }
+    its_copy->keys_.insert(its_position, _key);
+    denied_decisions_.store(std::move(its_copy));
+}
+
+std::shared_ptr<const compiled_policies> policy_manager_impl::get_compiled_policies() const {
+    auto its_policies = compiled_policies_.load();
+    if (!its_policies || its_policies->get_generation() != policies_generation_) {
+        // Only one thread compiles, the others take its result. The generation
+        // is checked again, thus a snapshot is never replaced by an older one.
+        std::scoped_lock its_compile_lock(compiled_policies_mutex_);
+        std::shared_lock its_lock(any_client_policies_mutex_);
+        its_policies = compiled_policies_.load();
+        if (!its_policies || its_policies->get_generation() != policies_generation_) {
+            its_policies = std::make_shared<const compiled_policies>(any_client_policies_, policies_generation_);
+            compiled_policies_.store(its_policies);
         }
     }
+    return its_policies;
+}
+
+void policy_manager_impl::log_denied(uid_t _uid, gid_t _gid, service_t _service, instance_t _instance, method_t _method) const {
+    const auto its_now = std::chrono::steady_clock::now().time_since_epoch().count();
+    const auto its_interval = std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                                      std::chrono::milliseconds(VSOMEIP_SECURITY_DENIED_LOG_INTERVAL))
+                                      .count();
+    const auto its_credentials = (static_cast<std::uint64_t>(_uid) << 32) | static_cast<std::uint64_t>(_gid);
+    // Fibonacci hashing, as the credentials often differ in the upper (uid) bits only
+    auto& its_log = denied_log_[((its_credentials * 0x9E3779B97F4A7C15) >> 32) % denied_log_size_];
+
+    // Lock-free, as this is called for every denial
+    auto its_last = its_log.last_.load(std::memory_order_relaxed);
+    const bool is_known = (its_log.credentials_.load(std::memory_order_relaxed) == its_credentials);
+    if ((is_known && its_now - its_last < its_interval)
+        || !its_log.last_.compare_exchange_strong(its_last, its_now, std::memory_order_relaxed)) {
+        // Suppressed, or another thread logs a denial at the same time
+        its_log.suppressed_.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    its_log.credentials_.store(its_credentials, std::memory_order_relaxed);
+    auto its_suppressed = its_log.suppressed_.exchange(0, std::memory_order_relaxed);
+    if (!is_known) {
+        // The slot was used for other credentials
+        its_suppressed = 0;
+    }
 
     std::string security_mode_text = " ~> Skip!";
     if (!check_credentials_) {
         security_mode_text = " but will be allowed due to audit mode is active!";
     }
 
-    VSOMEIP_INFO << "vSomeIP Security: UID/GID=" << its_uid << "/" << its_gid
+    VSOMEIP_INFO << "vSomeIP Security: UID/GID=" << _uid << "/" << _gid
                  << " : Isn't allowed to communicate with service/instance/(method / event) " << hex4(_service) << "/" << hex4(_instance)
-                 << "/" << _method << security_mode_text;
-
-    return !check_credentials_;
-#endif // VSOMEIP_DISABLE_SECURITY
+                 << "/" << _method << security_mode_text
+                 << (its_suppressed > 0 ? " (" + std::to_string(its_suppressed) + " denials suppressed)" : std::string());
 }
+#endif // !VSOMEIP_DISABLE_SECURITY
 
 bool policy_manager_impl::is_offer_allowed(const vsomeip_sec_client_t* _sec_client, service_t _service, instance_t _instance) const {
 
@@ -359,19 +405,43 @@ bool policy_manager_impl::is_offer_allowed(const vsomeip_sec_client_t* _sec_clie
 #ifndef VSOMEIP_DISABLE_SECURITY
 void policy_manager_impl::load(const configuration_element& _element, const bool _lazy_load) {
 
-    load_policies(_element);
-    if (!_lazy_load) {
+    const std::vector<std::reference_wrapper<const configuration_element>> its_elements{std::cref(_element)};
+    load(its_elements, _lazy_load);
+}
 
-        load_security_update_whitelist(_element);
-        load_security_policy_extensions(_element);
-        load_routing_credentials(_element);
+void policy_manager_impl::load(const std::vector<std::reference_wrapper<const configuration_element>>& _elements, const bool _lazy_load) {
 
-        if (policy_enabled_ && check_credentials_)
-            VSOMEIP_INFO << "Security configuration is active.";
+    std::vector<const boost::property_tree::ptree*> its_trees;
+    for (const configuration_element& e : _elements) {
+        load_policies(e, its_trees);
+        if (!_lazy_load) {
 
-        if (policy_enabled_ && !check_credentials_)
-            VSOMEIP_INFO << "Security configuration is active but in audit mode (allow all)";
+            load_security_update_whitelist(e);
+            load_security_policy_extensions(e);
+            load_routing_credentials(e);
+
+            if (policy_enabled_ && check_credentials_)
+                VSOMEIP_INFO << "Security configuration is active.";
+
+            if (policy_enabled_ && !check_credentials_)
+                VSOMEIP_INFO << "Security configuration is active but in audit mode (allow all)";
+        }
     }
+
+    // The policies do not depend on each other and are therefore parsed in parallel,
+    // but added at once to invalidate the decisions only once.
+    std::vector<std::shared_ptr<policy>> its_policies(its_trees.size());
+    utility::parallel_for(its_trees.size(), VSOMEIP_MAX_CONFIGURATION_LOADERS, VSOMEIP_MIN_CONFIGURATION_LOADS,
+                          [this, &its_trees, &its_policies](std::size_t _index) {
+                              try {
+                                  its_policies[_index] = load_policy(*its_trees[_index]);
+                              } catch (const std::exception& e) {
+                                  VSOMEIP_ERROR << "Failed to load security policy: " << e.what();
+                              } catch (...) {
+                                  VSOMEIP_ERROR << "Failed to load security policy.";
+                              }
+                          });
+    add_policies(its_policies);
 }
 
 bool policy_manager_impl::remove_security_policy(uid_t _uid, gid_t _gid) {
@@ -400,6 +470,7 @@ bool policy_manager_impl::remove_security_policy(uid_t _uid, gid_t _gid) {
             if (is_matching) {
                 was_removed = true;
                 p_it = any_client_policies_.erase(p_it);
+                invalidate_decisions_unlocked();
             } else {
                 ++p_it;
             }
@@ -454,6 +525,7 @@ void policy_manager_impl::update_security_policy(uid_t _uid, gid_t _gid, const s
     } else {
         any_client_policies_.push_back(_policy);
     }
+    invalidate_decisions_unlocked();
 
     std::unique_lock its_cache_lock(is_client_allowed_cache_mutex_);
     is_client_allowed_cache_.erase(std::make_pair(_uid, _gid));
@@ -484,6 +556,7 @@ void policy_manager_impl::add_security_credentials(uid_t _uid, gid_t _gid, const
     // credentials policy with same credentials was found
     if (!was_found) {
         any_client_policies_.push_back(_policy);
+        invalidate_decisions_unlocked();
         VSOMEIP_INFO_P << "Added security credentials at client: 0x" << hex4(_client) << " with UID: " << _uid << " GID: " << _gid;
     }
 }
@@ -575,14 +648,14 @@ bool policy_manager_impl::exist_in_any_client_policies_unlocked(std::shared_ptr<
     return false;
 }
 
-void policy_manager_impl::load_policies(const configuration_element& _element) {
+void policy_manager_impl::load_policies(const configuration_element& _element, std::vector<const boost::property_tree::ptree*>& _policies) {
     try {
         auto optional = _element.tree_.get_child_optional("security");
         if (!optional) {
             return;
         }
         policy_enabled_ = true;
-        auto found_policy = _element.tree_.get_child("security");
+        const auto& found_policy = _element.tree_.get_child("security");
         for (auto its_security = found_policy.begin(); its_security != found_policy.end(); ++its_security) {
             if (its_security->first == "check_credentials") {
                 if (its_security->second.data() == "true") {
@@ -598,14 +671,14 @@ void policy_manager_impl::load_policies(const configuration_element& _element) {
                 }
             } else if (its_security->first == "policies") {
                 for (auto its_policy = its_security->second.begin(); its_policy != its_security->second.end(); ++its_policy) {
-                    load_policy(its_policy->second);
+                    _policies.push_back(&its_policy->second);
                 }
             }
         }
     } catch (...) { }
 }
 
-void policy_manager_impl::load_policy(const boost::property_tree::ptree& _tree) {
+std::shared_ptr<policy> policy_manager_impl::load_policy(const boost::property_tree::ptree& _tree) {
 
     std::shared_ptr<policy> policy(std::make_shared<policy>());
     bool allow_deny_set(false);
@@ -690,9 +763,22 @@ void policy_manager_impl::load_policy(const boost::property_tree::ptree& _tree)
             load_policy_body(policy, i);
         }
     }
+    return policy;
+}
+
+void policy_manager_impl::add_policies(const std::vector<std::shared_ptr<policy>>& _policies) {
+
     std::unique_lock its_lock(any_client_policies_mutex_);
-    if (!exist_in_any_client_policies_unlocked(policy))
-        any_client_policies_.push_back(policy);
+    bool has_added(false);
+    for (auto p : _policies) {
+        if (p && !exist_in_any_client_policies_unlocked(p)) {
+            any_client_policies_.push_back(p);
+            has_added = true;
+        }
+    }
+    if (has_added) {
+        invalidate_decisions_unlocked();
+    }
 }
 
 void policy_manager_impl::load_policy_body(std::shared_ptr<policy>& _policy, const boost::property_tree::ptree::const_iterator& _tree) {
@@ -0,0 +1,105 @@
+// Copyright (C) 2014-2026 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <vsomeip/primitive_types.hpp>
+
+namespace vsomeip_v3 {
+
+namespace cfg {
+struct trace_capture;
+}
+
+namespace trace {
+
+/**
+ * \brief Writes traced messages to rotating pcapng files.
+ *
+ * Each record consists of the trace header followed by the (possibly truncated)
+ * SOME/IP message and is written as an Enhanced Packet Block of link type
+ * LINKTYPE_USER0, which is decoded by tools/wireshark_plugin/vsomeip-dissector.lua.
+ *
+ * write() copies the record into a bounded lock-free ring buffer and never
+ * blocks. If the ring buffer is full, the record is dropped and counted.
+ * A background thread drains the ring buffer periodically and writes the
+ * records to the current file, which is rotated when it exceeds the
+ * configured size.
+ */
+class capture_sink {
+public:
+    // Link type of the captured records
+    static constexpr std::uint16_t LINKTYPE = 147; // LINKTYPE_USER0
+
+    explicit capture_sink(const cfg::trace_capture& _configuration);
+    ~capture_sink();
+
+    capture_sink(const capture_sink&) = delete;
+    capture_sink& operator=(const capture_sink&) = delete;
+
+    void start();
+    // Writes all pending records before returning
+    void stop();
+
+    void write(const byte_t* _header, std::uint16_t _header_size, const byte_t* _data, std::uint32_t _data_size,
+               std::uint32_t _original_size);
+
+    std::uint64_t get_written() const;
+    std::uint64_t get_dropped() const;
+
+    std::string get_file_name(std::uint32_t _index) const;
+
+private:
+    struct slot {
+        std::atomic<std::size_t> sequence_{0};
+        std::uint64_t timestamp_{0}; // microseconds since epoch
+        std::uint32_t length_{0};
+        std::uint32_t original_length_{0};
+    };
+
+    void flush_cbk();
+    // Returns false if the ring buffer is empty
+    bool drain(std::vector<byte_t>& _buffer);
+    void write_to_file(const std::vector<byte_t>& _buffer);
+    void open_file();
+
+    const std::string path_;
+    const std::uint32_t snaplen_;
+    const std::uint32_t file_size_;
+    const std::uint32_t file_count_;
+
+    // Ring buffer (bounded MPSC queue, one sequence number per slot)
+    std::size_t mask_;
+    std::unique_ptr<slot[]> slots_;
+    std::unique_ptr<byte_t[]> data_; // snaplen_ bytes per slot
+    alignas(64) std::atomic<std::size_t> enqueue_position_;
+    alignas(64) std::size_t dequeue_position_;
+
+    std::atomic<std::uint64_t> written_;
+    std::atomic<std::uint64_t> dropped_;
+
+    // Used by the flush thread only
+    std::ofstream file_;
+    std::uint32_t file_index_;
+    std::uint64_t file_written_;
+
+    std::mutex mutex_;
+    std::condition_variable condition_;
+    bool is_running_;
+    std::thread flush_thread_;
+};
+
+} // namespace trace
+} // namespace vsomeip_v3
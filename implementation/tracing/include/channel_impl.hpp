@@ -5,19 +5,47 @@
 
 #pragma once
 
+#include <array>
 #include <atomic>
-#include <functional>
 #include <map>
+#include <memory>
 #include <mutex>
+#include <optional>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 #include "enumeration_types.hpp"
+#include "../../utility/include/snapshot.hpp"
 #include <vsomeip/trace.hpp>
 
 namespace vsomeip_v3 {
 namespace trace {
 
-typedef std::function<bool(service_t, instance_t, method_t)> filter_func_t;
+/**
+ * \brief Matches (service, instance, method) triples against a set of filters.
+ *
+ * Matches that contain wildcards are stored per wildcard combination, keyed by
+ * their non-wildcard parts. A lookup therefore needs at most one hash lookup per
+ * used combination, plus a scan of the (rarely used) range filters.
+ */
+class filter_matcher {
+public:
+    void add(const match_t& _match, std::size_t _index);
+    void add(const match_t& _from, const match_t& _to, std::size_t _index);
+
+    // Returns the smallest index of the filters that match
+    std::optional<std::size_t> find(service_t _service, instance_t _instance, method_t _method) const;
+
+private:
+    static constexpr std::size_t MASKS = 8;
+
+    static std::uint64_t get_key(service_t _service, instance_t _instance, method_t _method, std::size_t _mask);
+
+    std::array<std::unordered_map<std::uint64_t, std::size_t>, MASKS> matches_;
+    std::vector<std::size_t> masks_; // used wildcard combinations
+    std::vector<std::tuple<match_t, match_t, std::size_t>> ranges_;
+};
 
 class channel_impl : public channel {
 public:
@@ -40,19 +68,35 @@ public:
 
     void remove_filter(filter_id_t _id);
 
-    std::pair<bool, bool> matches(service_t _service, instance_t _instance, method_t _method);
+    // Evaluates the filters that were compiled when they were last changed, without taking `mutex_`
+    std::pair<bool, bool> matches(service_t _service, instance_t _instance, method_t _method) const;
 
 private:
-    filter_id_t add_filter_intern(const filter_func_t& _func, filter_type_e _type);
+    struct filter {
+        std::vector<match_t> matches_; // [from, to] for range filters
+        bool is_range_;
+        filter_type_e type_;
+    };
+
+    struct compiled_filters {
+        filter_matcher negative_;
+        filter_matcher positive_; // indexes into is_full_
+        std::vector<bool> is_full_; // false for header-only filters
+        bool has_positive_{false};
+    };
+
+    filter_id_t add_filter_intern(filter&& _filter);
+    // The caller must hold `mutex_`
+    void compile_unlocked();
 
     std::string id_;
     std::string name_;
 
     std::atomic<filter_id_t> current_filter_id_;
 
-    std::map<filter_id_t, std::pair<filter_func_t, bool>> positive_;
-    std::map<filter_id_t, filter_func_t> negative_;
-    std::mutex mutex_; // protects positive_ & negative_
+    std::map<filter_id_t, filter> filters_;
+    std::mutex mutex_; // protects filters_
+    snapshot<const compiled_filters> compiled_;
 };
 
 } // namespace trace
@@ -9,9 +9,11 @@
 #include <dlt/dlt.h>
 #endif
 
+#include <atomic>
+#include <map>
+#include <memory>
 #include <mutex>
 #include <vector>
-#include <map>
 
 #include <boost/shared_ptr.hpp>
 
@@ -22,6 +24,7 @@
 #include "enumeration_types.hpp"
 #include "header.hpp"
 #include "../../endpoints/include/buffer.hpp"
+#include "../../utility/include/snapshot.hpp"
 
 namespace vsomeip_v3 {
 
@@ -31,6 +34,7 @@ struct trace;
 
 namespace trace {
 
+class capture_sink;
 class channel_impl;
 
 class connector_impl : public connector {
@@ -58,13 +62,31 @@ public:
     VSOMEIP_EXPORT void trace(const byte_t* _header, uint16_t _header_size, const byte_t* _data, uint32_t _data_size);
 
 private:
+    struct active_channel {
+        std::string id_;
+        std::shared_ptr<channel_impl> channel_;
+#ifdef USE_DLT
+        std::shared_ptr<DltContext> context_;
+#endif
+    };
+
+    std::shared_ptr<channel_impl> get_channel_impl(const std::string& _id) const;
+    // Publishes the current channels (and contexts) for trace()
+    void update_active_channels();
+
     std::atomic<bool> is_enabled_;
-    bool is_sd_enabled_;
+    std::atomic<bool> is_sd_enabled_;
+    // Whether the channels write the hexstream while the capture is active
+    std::atomic<bool> is_hexstream_enabled_;
 
     std::map<std::string, std::shared_ptr<channel_impl>> channels_;
     mutable std::mutex channels_mutex_;
 
-    std::shared_ptr<channel_impl> get_channel_impl(const std::string& _id) const;
+    // Snapshot of channels_, read by trace() without taking channels_mutex_
+    snapshot<const std::vector<active_channel>> active_channels_;
+
+    // Optional, receives the traced messages in addition to the channels' output
+    snapshot<capture_sink> capture_sink_;
 
     mutable std::mutex configure_mutex_;
 
@@ -10,3 +10,9 @@
 
 #define VSOMEIP_TC_INSTANCE_POS_MIN                 8
 #define VSOMEIP_TC_INSTANCE_POS_MAX                 9
+
+#define VSOMEIP_TC_DEFAULT_CAPTURE_SNAPLEN          1024
+#define VSOMEIP_TC_DEFAULT_CAPTURE_BUFFER_SIZE      (1024 * 1024)
+#define VSOMEIP_TC_DEFAULT_CAPTURE_FILE_SIZE        (16 * 1024 * 1024)
+#define VSOMEIP_TC_DEFAULT_CAPTURE_FILE_COUNT       4
+#define VSOMEIP_TC_CAPTURE_FLUSH_INTERVAL           100 // milliseconds
@@ -0,0 +1,270 @@
+// Copyright (C) 2014-2026 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <sstream>
+
+#if defined(_WIN32)
+#include <process.h>
+#else
+#include <unistd.h>
+#endif
+
+#include <vsomeip/defines.hpp>
+
+#include "logger_ext.hpp"
+#include "../include/capture_sink.hpp"
+#include "../include/defines.hpp"
+#include "../include/header.hpp"
+#include "../../configuration/include/trace.hpp"
+
+#define VSOMEIP_LOG_PREFIX "capture_sink"
+
+namespace vsomeip_v3 {
+namespace trace {
+
+namespace {
+
+const std::uint32_t SHB_TYPE(0x0A0D0D0A);
+const std::uint32_t IDB_TYPE(0x00000001);
+const std::uint32_t EPB_TYPE(0x00000006);
+const std::uint32_t BYTE_ORDER_MAGIC(0x1A2B3C4D);
+
+const std::uint32_t SHB_SIZE(28);
+const std::uint32_t IDB_SIZE(20);
+const std::uint32_t EPB_SIZE(32); // without the (padded) packet data
+
+// pcapng blocks are written in host byte order, the byte order magic tells the reader
+template<typename T>
+void append(std::vector<byte_t>& _buffer, T _value) {
+    const auto its_position = _buffer.size();
+    _buffer.resize(its_position + sizeof(T));
+    std::memcpy(&_buffer[its_position], &_value, sizeof(T));
+}
+
+std::uint32_t pad(std::uint32_t _length) {
+    return (_length + 3) & ~std::uint32_t(3);
+}
+
+std::size_t get_slot_count(std::uint32_t _buffer_size, std::uint32_t _snaplen) {
+    // Power of two, so that positions can be masked
+    std::size_t its_count(2);
+    while (its_count * 2 * _snaplen <= _buffer_size) {
+        its_count *= 2;
+    }
+    return its_count;
+}
+
+} // namespace
+
+capture_sink::capture_sink(const cfg::trace_capture& _configuration) :
+    path_(_configuration.path_.empty() ? std::filesystem::temp_directory_path().string() : _configuration.path_),
+    snaplen_(std::max(_configuration.snaplen_, std::uint32_t(VSOMEIP_TRACE_HEADER_SIZE + VSOMEIP_FULL_HEADER_SIZE))),
+    file_size_(_configuration.file_size_), file_count_(std::max(_configuration.file_count_, std::uint32_t(1))), mask_(0),
+    enqueue_position_(0), dequeue_position_(0), written_(0), dropped_(0), file_index_(0), file_written_(0), is_running_(false) {
+
+    const auto its_count = get_slot_count(_configuration.buffer_size_, snaplen_);
+    mask_ = its_count - 1;
+    slots_ = std::make_unique<slot[]>(its_count);
+    for (std::size_t i = 0; i < its_count; ++i) {
+        slots_[i].sequence_.store(i, std::memory_order_relaxed);
+    }
+    data_ = std::make_unique<byte_t[]>(its_count * snaplen_);
+}
+
+capture_sink::~capture_sink() {
+    stop();
+}
+
+void capture_sink::start() {
+    std::scoped_lock its_lock(mutex_);
+    if (is_running_) {
+        return;
+    }
+    is_running_ = true;
+    flush_thread_ = std::thread([this] {
+#if defined(__linux__) || defined(__QNX__)
+        pthread_setname_np(pthread_self(), "m_capture");
+#endif
+        flush_cbk();
+    });
+    VSOMEIP_INFO_P << "Capturing to " << get_file_name(0) << ", " << (mask_ + 1) << " x " << snaplen_ << " bytes buffered";
+}
+
+void capture_sink::stop() {
+    {
+        std::scoped_lock its_lock(mutex_);
+        if (!is_running_) {
+            return;
+        }
+        is_running_ = false;
+    }
+    condition_.notify_one();
+    if (flush_thread_.joinable()) {
+        flush_thread_.join();
+    }
+}
+
+void capture_sink::write(const byte_t* _header, std::uint16_t _header_size, const byte_t* _data, std::uint32_t _data_size,
+                         std::uint32_t _original_size) {
+
+    // Reserve a slot
+    slot* its_slot(nullptr);
+    auto its_position = enqueue_position_.load(std::memory_order_relaxed);
+    for (;;) {
+        its_slot = &slots_[its_position & mask_];
+        const auto its_sequence = its_slot->sequence_.load(std::memory_order_acquire);
+        if (its_sequence == its_position) {
+            if (enqueue_position_.compare_exchange_weak(its_position, its_position + 1, std::memory_order_relaxed)) {
+                break;
+            }
+        } else if (its_sequence < its_position) {
+            // The flush thread did not yet consume this slot --> buffer is full
+            dropped_.fetch_add(1, std::memory_order_relaxed);
+            return;
+        } else {
+            its_position = enqueue_position_.load(std::memory_order_relaxed);
+        }
+    }
+
+    // Fill it
+    byte_t* its_data = &data_[(its_position & mask_) * snaplen_];
+    const std::uint32_t its_header_size = std::min(std::uint32_t(_header_size), snaplen_);
+    const std::uint32_t its_data_size = std::min(_data_size, snaplen_ - its_header_size);
+    std::memcpy(its_data, _header, its_header_size);
+    std::memcpy(its_data + its_header_size, _data, its_data_size);
+
+    its_slot->timestamp_ = static_cast<std::uint64_t>(
+            std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::system_clock::now().time_since_epoch()).count());
+    its_slot->length_ = its_header_size + its_data_size;
+    its_slot->original_length_ = std::uint32_t(_header_size) + _original_size;
+
+    // Publish it
+    its_slot->sequence_.store(its_position + 1, std::memory_order_release);
+}
+
+std::uint64_t capture_sink::get_written() const {
+    return written_;
+}
+
+std::uint64_t capture_sink::get_dropped() const {
+    return dropped_;
+}
+
+std::string capture_sink::get_file_name(std::uint32_t _index) const {
+    std::stringstream its_name;
+#if defined(_WIN32)
+    its_name << "vsomeip-" << _getpid() << "-" << _index << ".pcapng";
+#else
+    its_name << "vsomeip-" << ::getpid() << "-" << _index << ".pcapng";
+#endif
+    return (std::filesystem::path(path_) / its_name.str()).string();
+}
+
+void capture_sink::flush_cbk() {
+
+    std::vector<byte_t> its_buffer;
+    bool is_running(true);
+    while (is_running) {
+        {
+            std::unique_lock its_lock(mutex_);
+            condition_.wait_for(its_lock, std::chrono::milliseconds(VSOMEIP_TC_CAPTURE_FLUSH_INTERVAL), [this] { return !is_running_; });
+            is_running = is_running_;
+        }
+
+        while (drain(its_buffer)) {
+            write_to_file(its_buffer);
+            its_buffer.clear();
+        }
+        if (file_.is_open()) {
+            file_.flush();
+        }
+    }
+    file_.close();
+}
+
+bool capture_sink::drain(std::vector<byte_t>& _buffer) {
+
+    // Limit the amount of data that is written at once
+    const std::size_t its_limit = (mask_ + 1) * snaplen_ / 4;
+    while (_buffer.size() < its_limit) {
+        auto& its_slot = slots_[dequeue_position_ & mask_];
+        if (its_slot.sequence_.load(std::memory_order_acquire) != dequeue_position_ + 1) {
+            break;
+        }
+
+        const std::uint32_t its_padded_length = pad(its_slot.length_);
+        append(_buffer, EPB_TYPE);
+        append(_buffer, EPB_SIZE + its_padded_length);
+        append(_buffer, std::uint32_t(0)); // interface
+        append(_buffer, std::uint32_t(its_slot.timestamp_ >> 32));
+        append(_buffer, std::uint32_t(its_slot.timestamp_));
+        append(_buffer, its_slot.length_);
+        append(_buffer, its_slot.original_length_);
+        const byte_t* its_data = &data_[(dequeue_position_ & mask_) * snaplen_];
+        _buffer.insert(_buffer.end(), its_data, its_data + its_slot.length_);
+        _buffer.resize(_buffer.size() + (its_padded_length - its_slot.length_), 0);
+        append(_buffer, EPB_SIZE + its_padded_length);
+
+        // Release the slot
+        its_slot.sequence_.store(dequeue_position_ + mask_ + 1, std::memory_order_release);
+        dequeue_position_++;
+        written_.fetch_add(1, std::memory_order_relaxed);
+    }
+    return !_buffer.empty();
+}
+
+void capture_sink::write_to_file(const std::vector<byte_t>& _buffer) {
+
+    if (file_.is_open() && file_written_ + _buffer.size() > file_size_) {
+        file_.close();
+        file_index_ = (file_index_ + 1) % file_count_;
+    }
+    if (!file_.is_open()) {
+        open_file();
+        if (!file_.is_open()) {
+            return;
+        }
+    }
+
+    file_.write(reinterpret_cast<const char*>(_buffer.data()), static_cast<std::streamsize>(_buffer.size()));
+    file_written_ += _buffer.size();
+}
+
+void capture_sink::open_file() {
+
+    const auto its_name = get_file_name(file_index_);
+    file_.open(its_name, std::ios::binary | std::ios::trunc);
+    if (!file_.is_open()) {
+        VSOMEIP_ERROR_P << "Cannot open capture file " << its_name;
+        return;
+    }
+
+    std::vector<byte_t> its_header;
+    // Section Header Block
+    append(its_header, SHB_TYPE);
+    append(its_header, SHB_SIZE);
+    append(its_header, BYTE_ORDER_MAGIC);
+    append(its_header, std::uint16_t(1)); // major version
+    append(its_header, std::uint16_t(0)); // minor version
+    append(its_header, std::int64_t(-1)); // section length: unspecified
+    append(its_header, SHB_SIZE);
+    // Interface Description Block
+    append(its_header, IDB_TYPE);
+    append(its_header, IDB_SIZE);
+    append(its_header, LINKTYPE);
+    append(its_header, std::uint16_t(0)); // reserved
+    append(its_header, snaplen_);
+    append(its_header, IDB_SIZE);
+
+    file_.write(reinterpret_cast<const char*>(its_header.data()), static_cast<std::streamsize>(its_header.size()));
+    file_written_ = its_header.size();
+}
+
+} // namespace trace
+} // namespace vsomeip_v3
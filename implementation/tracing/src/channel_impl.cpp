@@ -11,7 +11,58 @@ namespace trace {
 
 const filter_id_t FILTER_ID_ERROR(0);
 
-channel_impl::channel_impl(const std::string& _id, const std::string& _name) : id_(_id), name_(_name), current_filter_id_(1) { }
+namespace {
+const std::size_t ANY_SERVICE_MASK(0x1);
+const std::size_t ANY_INSTANCE_MASK(0x2);
+const std::size_t ANY_METHOD_MASK(0x4);
+} // namespace
+
+void filter_matcher::add(const match_t& _match, std::size_t _index) {
+
+    const auto [its_service, its_instance, its_method] = _match;
+    const std::size_t its_mask = (its_service == ANY_SERVICE ? ANY_SERVICE_MASK : 0)
+            | (its_instance == ANY_INSTANCE ? ANY_INSTANCE_MASK : 0) | (its_method == ANY_METHOD ? ANY_METHOD_MASK : 0);
+
+    // Keep the first filter that contains the match
+    if (matches_[its_mask].emplace(get_key(its_service, its_instance, its_method, its_mask), _index).second
+        && matches_[its_mask].size() == 1) {
+        masks_.push_back(its_mask);
+    }
+}
+
+void filter_matcher::add(const match_t& _from, const match_t& _to, std::size_t _index) {
+
+    ranges_.emplace_back(_from, _to, _index);
+}
+
+std::optional<std::size_t> filter_matcher::find(service_t _service, instance_t _instance, method_t _method) const {
+
+    std::optional<std::size_t> its_index;
+    for (const auto its_mask : masks_) {
+        const auto& its_matches = matches_[its_mask];
+        auto found_match = its_matches.find(get_key(_service, _instance, _method, its_mask));
+        if (found_match != its_matches.end() && (!its_index || found_match->second < *its_index)) {
+            its_index = found_match->second;
+        }
+    }
+    for (const auto& [its_from, its_to, its_range_index] : ranges_) {
+        if ((!its_index || its_range_index < *its_index) && std::get<0>(its_from) <= _service && _service <= std::get<0>(its_to)
+            && std::get<1>(its_from) <= _instance && _instance <= std::get<1>(its_to) && std::get<2>(its_from) <= _method
+            && _method <= std::get<2>(its_to)) {
+            its_index = its_range_index;
+        }
+    }
+    return its_index;
+}
+
+std::uint64_t filter_matcher::get_key(service_t _service, instance_t _instance, method_t _method, std::size_t _mask) {
+
+    return (_mask & ANY_SERVICE_MASK ? 0 : std::uint64_t(_service) << 32) | (_mask & ANY_INSTANCE_MASK ? 0 : std::uint64_t(_instance) << 16)
+            | (_mask & ANY_METHOD_MASK ? 0 : std::uint64_t(_method));
+}
+
+channel_impl::channel_impl(const std::string& _id, const std::string& _name) :
+    id_(_id), name_(_name), current_filter_id_(1), compiled_(std::make_shared<const compiled_filters>()) { }
 
 std::string channel_impl::get_id() const {
     return id_;
@@ -29,47 +80,7 @@ filter_id_t channel_impl::add_filter(const match_t& _match, bool _is_positive) {
 
 filter_id_t channel_impl::add_filter(const match_t& _match, filter_type_e _type) {
 
-    // Create a filter function
-    std::function<bool(service_t, instance_t, method_t)> its_filter_func;
-    if (std::get<0>(_match) != ANY_SERVICE) {
-        if (std::get<1>(_match) != ANY_INSTANCE) {
-            if (std::get<2>(_match) != ANY_METHOD) {
-                its_filter_func = [_match](service_t _s, instance_t _i, method_t _m) {
-                    return (std::get<0>(_match) == _s && std::get<1>(_match) == _i && std::get<2>(_match) == _m);
-                };
-            } else {
-                its_filter_func = [_match](service_t _s, instance_t _i, method_t) {
-                    return (std::get<0>(_match) == _s && std::get<1>(_match) == _i);
-                };
-            }
-        } else {
-            if (std::get<2>(_match) != ANY_METHOD) {
-                its_filter_func = [_match](service_t _s, instance_t, method_t _m) {
-                    return (std::get<0>(_match) == _s && std::get<1>(_match) == _m);
-                };
-            } else {
-                its_filter_func = [_match](service_t _s, instance_t, method_t) { return (std::get<0>(_match) == _s); };
-            }
-        }
-    } else {
-        if (std::get<1>(_match) != ANY_INSTANCE) {
-            if (std::get<2>(_match) != ANY_METHOD) {
-                its_filter_func = [_match](service_t, instance_t _i, method_t _m) {
-                    return (std::get<1>(_match) == _i && std::get<2>(_match) == _m);
-                };
-            } else {
-                its_filter_func = [_match](service_t, instance_t _i, method_t) { return (std::get<1>(_match) == _i); };
-            }
-        } else {
-            if (std::get<2>(_match) != ANY_METHOD) {
-                its_filter_func = [_match](service_t, instance_t, method_t _m) { return (std::get<2>(_match) == _m); };
-            } else {
-                its_filter_func = [](service_t, instance_t, method_t) { return true; };
-            }
-        }
-    }
-
-    return add_filter_intern(its_filter_func, _type);
+    return add_filter_intern(filter{{_match}, false, _type});
 }
 
 filter_id_t channel_impl::add_filter(const std::vector<match_t>& _matches, bool _is_positive) {
@@ -79,106 +90,8 @@ filter_id_t channel_impl::add_filter(const std::vector<match_t>& _matches, bool
 }
 
 filter_id_t channel_impl::add_filter(const std::vector<match_t>& _matches, filter_type_e _type) {
-    bool has_service(false);
-    bool has_instance(false);
-    bool has_method(false);
-
-    for (auto m : _matches) {
-        if (std::get<0>(m) != ANY_SERVICE)
-            has_service = true;
-        if (std::get<1>(m) != ANY_INSTANCE)
-            has_instance = true;
-        if (std::get<2>(m) != ANY_METHOD)
-            has_method = true;
-    }
 
-    // Create a filter function
-    std::function<bool(service_t, instance_t, method_t)> its_filter_func;
-    if (has_service) {
-        if (has_instance) {
-            if (has_method) {
-                its_filter_func = [_matches](service_t _s, instance_t _i, method_t _m) {
-                    for (const auto& m : _matches) {
-                        if ((std::get<0>(m) == _s || std::get<0>(m) == ANY_SERVICE)
-                            && (std::get<1>(m) == _i || std::get<1>(m) == ANY_INSTANCE)
-                            && (std::get<2>(m) == _m || std::get<2>(m) == ANY_METHOD)) {
-                            return true;
-                        }
-                    }
-                    return false;
-                };
-            } else {
-                its_filter_func = [_matches](service_t _s, instance_t _i, method_t) {
-                    for (const auto& m : _matches) {
-                        if ((std::get<0>(m) == _s || std::get<0>(m) == ANY_SERVICE)
-                            && (std::get<1>(m) == _i || std::get<1>(m) == ANY_INSTANCE)) {
-                            return true;
-                        }
-                    }
-                    return false;
-                };
-            }
-        } else {
-            if (has_method) {
-                its_filter_func = [_matches](service_t _s, instance_t, method_t _m) {
-                    for (const auto& m : _matches) {
-                        if ((std::get<0>(m) == _s || std::get<0>(m) == ANY_SERVICE)
-                            && (std::get<2>(m) == _m || std::get<2>(m) == ANY_METHOD)) {
-                            return true;
-                        }
-                    }
-                    return false;
-                };
-            } else {
-                its_filter_func = [_matches](service_t _s, instance_t, method_t) {
-                    for (auto& m : _matches) {
-                        if (std::get<0>(m) == _s || std::get<0>(m) == ANY_SERVICE) {
-                            return true;
-                        }
-                    }
-                    return false;
-                };
-            }
-        }
-    } else {
-        if (has_instance) {
-            if (has_method) {
-                its_filter_func = [_matches](service_t, instance_t _i, method_t _m) {
-                    for (auto& m : _matches) {
-                        if ((std::get<1>(m) == _i || std::get<1>(m) == ANY_INSTANCE)
-                            && (std::get<2>(m) == _m || std::get<2>(m) == ANY_METHOD)) {
-                            return true;
-                        }
-                    }
-                    return false;
-                };
-            } else {
-                its_filter_func = [_matches](service_t, instance_t _i, method_t) {
-                    for (auto& m : _matches) {
-                        if (std::get<1>(m) == _i || std::get<1>(m) == ANY_INSTANCE) {
-                            return true;
-                        }
-                    }
-                    return false;
-                };
-            }
-        } else {
-            if (has_method) {
-                its_filter_func = [_matches](service_t, instance_t, method_t _m) {
-                    for (auto& m : _matches) {
-                        if (std::get<2>(m) == _m || std::get<2>(m) == ANY_METHOD) {
-                            return true;
-                        }
-                    }
-                    return false;
-                };
-            } else {
-                its_filter_func = [](service_t, instance_t, method_t) { return true; };
-            }
-        }
-    }
-
-    return add_filter_intern(its_filter_func, _type);
+    return add_filter_intern(filter{_matches, false, _type});
 }
 
 filter_id_t channel_impl::add_filter(const match_t& _from, const match_t& _to, filter_type_e _type) {
@@ -190,12 +103,7 @@ filter_id_t channel_impl::add_filter(const match_t& _from, const match_t& _to, f
         return FILTER_ID_ERROR;
     }
 
-    std::function<bool(service_t, instance_t, method_t)> its_filter_func = [_from, _to](service_t _s, instance_t _i, method_t _m) {
-        return (std::get<0>(_from) <= _s && _s <= std::get<0>(_to) && std::get<1>(_from) <= _i && _i <= std::get<1>(_to)
-                && std::get<2>(_from) <= _m && _m <= std::get<2>(_to));
-    };
-
-    return add_filter_intern(its_filter_func, _type);
+    return add_filter_intern(filter{{_from, _to}, true, _type});
 }
 
 filter_id_t channel_impl::add_filter(const match_t& _from, const match_t& _to, bool _is_positive) {
@@ -206,51 +114,63 @@ filter_id_t channel_impl::add_filter(const match_t& _from, const match_t& _to, b
 
 void channel_impl::remove_filter(filter_id_t _id) {
     std::scoped_lock its_lock(mutex_);
-    positive_.erase(_id);
-    negative_.erase(_id);
+    if (filters_.erase(_id) > 0) {
+        compile_unlocked();
+    }
 }
 
-filter_id_t channel_impl::add_filter_intern(const filter_func_t& _func, filter_type_e _type) {
+filter_id_t channel_impl::add_filter_intern(filter&& _filter) {
     filter_id_t its_id = current_filter_id_.fetch_add(1);
 
     std::scoped_lock its_lock(mutex_);
-    switch (_type) {
-    case filter_type_e::NEGATIVE:
-        negative_[its_id] = _func;
-        break;
-    case filter_type_e::HEADER_ONLY:
-        positive_[its_id] = std::make_pair(_func, false);
-        break;
-    default:
-        positive_[its_id] = std::make_pair(_func, true);
-    }
+    filters_.emplace(its_id, std::move(_filter));
+    compile_unlocked();
 
     return its_id;
 }
 
-std::pair<bool, bool> channel_impl::matches(service_t _service, instance_t _instance, method_t _method) {
-    std::scoped_lock its_lock(mutex_);
+void channel_impl::compile_unlocked() {
+
+    auto its_compiled = std::make_shared<compiled_filters>();
+    for (const auto& [its_id, its_filter] : filters_) {
+        auto& its_matcher = (its_filter.type_ == filter_type_e::NEGATIVE ? its_compiled->negative_ : its_compiled->positive_);
+
+        // Positive filters are evaluated in the order they were added
+        const std::size_t its_index = its_compiled->is_full_.size();
+        if (its_filter.type_ != filter_type_e::NEGATIVE) {
+            const bool is_full = (its_filter.type_ != filter_type_e::HEADER_ONLY);
+            its_compiled->is_full_.push_back(is_full);
+            its_compiled->has_positive_ = its_compiled->has_positive_ || is_full;
+        }
+
+        if (its_filter.is_range_) {
+            its_matcher.add(its_filter.matches_[0], its_filter.matches_[1], its_index);
+        } else {
+            for (const auto& its_match : its_filter.matches_) {
+                its_matcher.add(its_match, its_index);
+            }
+        }
+    }
+
+    compiled_.store(its_compiled);
+}
+
+std::pair<bool, bool> channel_impl::matches(service_t _service, instance_t _instance, method_t _method) const {
+
+    const auto its_compiled = compiled_.load();
 
     // If a negative filter matches --> drop!
-    for (auto& its_filter : negative_) {
-        if (its_filter.second(_service, _instance, _method))
-            return std::make_pair(false, false);
+    if (its_compiled->negative_.find(_service, _instance, _method)) {
+        return std::make_pair(false, false);
     }
 
     // If a positive/header-only filter matches --> forward!
-    bool has_positive(false);
-    for (auto& its_filter : positive_) {
-        if (its_filter.second.first(_service, _instance, _method))
-            return std::make_pair(true, its_filter.second.second);
-
-        // If we have a positive filter that is no header-only
-        // filter, set the flag
-        if (its_filter.second.second)
-            has_positive = true;
+    if (auto its_index = its_compiled->positive_.find(_service, _instance, _method)) {
+        return std::make_pair(true, bool(its_compiled->is_full_[*its_index]));
     }
 
     // If no positive filter is defined --> forward!
-    if (!has_positive)
+    if (!its_compiled->has_positive_)
         return std::make_pair(true, true);
 
     // Default --> Drop!
@@ -6,6 +6,7 @@
 #include <vsomeip/constants.hpp>
 #include <vsomeip/runtime.hpp>
 
+#include <algorithm>
 #include <chrono>
 #include <ctime>
 #include <fstream>
@@ -14,6 +15,7 @@
 #include <sstream>
 
 #include "logger_ext.hpp"
+#include "../include/capture_sink.hpp"
 #include "../include/channel_impl.hpp"
 #include "../include/connector_impl.hpp"
 #include "../include/defines.hpp"
@@ -42,6 +44,20 @@ namespace trace {
 
 const char* VSOMEIP_TC_DEFAULT_CHANNEL_ID = "TC";
 
+#ifdef USE_DLT
+// The context is unregistered when the last reference is released. As trace()
+// holds a reference while it uses the context, a concurrently removed channel
+// does not unregister the context while it is used.
+static std::shared_ptr<DltContext> register_context(const std::string& _id, const std::string& _name) {
+    std::shared_ptr<DltContext> its_context(new DltContext(), [](DltContext* _context) {
+        DLT_UNREGISTER_CONTEXT(*_context);
+        delete _context;
+    });
+    DLT_REGISTER_CONTEXT_LL_TS(*(its_context.get()), _id.c_str(), _name.c_str(), DLT_LOG_INFO, DLT_TRACE_STATUS_ON);
+    return its_context;
+}
+#endif
+
 static std::mutex connector_impl_get;
 
 std::shared_ptr<connector_impl> connector_impl::get() {
@@ -50,17 +66,16 @@ std::shared_ptr<connector_impl> connector_impl::get() {
     return instance;
 }
 
-connector_impl::connector_impl() : is_enabled_(false), is_sd_enabled_(false) {
+connector_impl::connector_impl() :
+    is_enabled_(false), is_sd_enabled_(false), is_hexstream_enabled_(true),
+    active_channels_(std::make_shared<const std::vector<active_channel>>()) {
 
     channels_[VSOMEIP_TC_DEFAULT_CHANNEL_ID] =
             std::make_shared<channel_impl>(VSOMEIP_TC_DEFAULT_CHANNEL_ID, VSOMEIP_TC_DEFAULT_CHANNEL_NAME);
 #ifdef USE_DLT
-    std::shared_ptr<DltContext> its_default_context = std::make_shared<DltContext>();
-
-    contexts_[VSOMEIP_TC_DEFAULT_CHANNEL_ID] = its_default_context;
-    DLT_REGISTER_CONTEXT_LL_TS(*(its_default_context.get()), VSOMEIP_TC_DEFAULT_CHANNEL_ID, VSOMEIP_TC_DEFAULT_CHANNEL_NAME, DLT_LOG_INFO,
-                               DLT_TRACE_STATUS_ON);
+    contexts_[VSOMEIP_TC_DEFAULT_CHANNEL_ID] = register_context(VSOMEIP_TC_DEFAULT_CHANNEL_ID, VSOMEIP_TC_DEFAULT_CHANNEL_NAME);
 #endif
+    update_active_channels();
 }
 
 connector_impl::~connector_impl() {
@@ -72,6 +87,7 @@ void connector_impl::configure(const std::shared_ptr<cfg::trace>& _configuration
     if (_configuration) {
         is_enabled_ = _configuration->is_enabled_;
         is_sd_enabled_ = _configuration->is_sd_enabled_;
+        is_hexstream_enabled_ = _configuration->capture_.is_hexstream_enabled_;
     }
 
     if (is_enabled_) { // No need to create filters if tracing is disabled!
@@ -93,6 +109,13 @@ void connector_impl::configure(const std::shared_ptr<cfg::trace>& _configuration
                 }
             }
         }
+
+        // All applications of a process share the capture
+        if (_configuration->capture_.is_enabled_ && !capture_sink_.load()) {
+            auto its_sink = std::make_shared<capture_sink>(_configuration->capture_);
+            its_sink->start();
+            capture_sink_.store(its_sink);
+        }
     }
 
     VSOMEIP_INFO << "vsomeip tracing " << (is_enabled_ ? "enabled." : "not enabled.") << " vsomeip service discovery tracing "
@@ -101,6 +124,9 @@ void connector_impl::configure(const std::shared_ptr<cfg::trace>& _configuration
 
 void connector_impl::reset() {
     // reset to default
+    if (auto its_sink = capture_sink_.exchange(nullptr)) {
+        its_sink->stop();
+    }
     {
         std::scoped_lock its_lock_channels(channels_mutex_);
         channels_.clear();
@@ -111,6 +137,7 @@ void connector_impl::reset() {
         contexts_.clear();
     }
 #endif
+    update_active_channels();
 }
 
 void connector_impl::set_enabled(const bool _enabled) {
@@ -118,16 +145,15 @@ void connector_impl::set_enabled(const bool _enabled) {
 }
 
 bool connector_impl::is_enabled() const {
-    return is_enabled_;
+    // Checked before each trace header is prepared, relaxed is sufficient
+    return is_enabled_.load(std::memory_order_relaxed);
 }
 
 void connector_impl::set_sd_enabled(const bool _sd_enabled) {
-    std::scoped_lock lk{configure_mutex_};
     is_sd_enabled_ = _sd_enabled;
 }
 
 bool connector_impl::is_sd_enabled() const {
-    std::scoped_lock lk{configure_mutex_};
     return is_sd_enabled_;
 }
 
@@ -160,11 +186,10 @@ std::shared_ptr<channel> connector_impl::add_channel(const trace_channel_t& _id,
 #ifdef USE_DLT
     {
         std::scoped_lock its_contexts_lock(contexts_mutex_);
-        std::shared_ptr<DltContext> its_context = std::make_shared<DltContext>();
-        contexts_[_id] = its_context;
-        DLT_REGISTER_CONTEXT_LL_TS(*(its_context.get()), _id.c_str(), _name.c_str(), DLT_LOG_INFO, DLT_TRACE_STATUS_ON);
+        contexts_[_id] = register_context(_id, _name);
     }
 #endif
+    update_active_channels();
 
     return its_channel;
 }
@@ -183,16 +208,14 @@ bool connector_impl::remove_channel(const trace_channel_t& _id) {
     }
 
     if (has_removed) {
-        // unregister context
 #ifdef USE_DLT
+        // The context is unregistered as soon as no snapshot refers to it anymore
         {
             std::scoped_lock its_contexts_lock(contexts_mutex_);
-            auto its_context = contexts_.find(_id);
-            if (its_context != contexts_.end()) {
-                DLT_UNREGISTER_CONTEXT(*(its_context->second.get()));
-            }
+            contexts_.erase(_id);
         }
 #endif
+        update_active_channels();
     }
 
     return true;
@@ -210,9 +233,29 @@ std::shared_ptr<channel_impl> connector_impl::get_channel_impl(const std::string
     return (its_channel != channels_.end() ? its_channel->second : nullptr);
 }
 
+void connector_impl::update_active_channels() {
+
+    auto its_channels = std::make_shared<std::vector<active_channel>>();
+#ifdef USE_DLT
+    std::scoped_lock its_lock(channels_mutex_, contexts_mutex_);
+#else
+    std::scoped_lock its_lock(channels_mutex_);
+#endif
+    its_channels->reserve(channels_.size());
+    for (const auto& [its_id, its_channel] : channels_) {
+#ifdef USE_DLT
+        auto its_context = contexts_.find(its_id);
+        its_channels->push_back({its_id, its_channel, (its_context != contexts_.end() ? its_context->second : nullptr)});
+#else
+        its_channels->push_back({its_id, its_channel});
+#endif
+    }
+    active_channels_.store(its_channels);
+}
+
 void connector_impl::trace(const byte_t* _header, uint16_t _header_size, const byte_t* _data, uint32_t _data_size) {
 
-    if (!is_enabled_)
+    if (!is_enabled_.load(std::memory_order_relaxed))
         return;
 
     if (_data_size == 0)
@@ -221,11 +264,8 @@ void connector_impl::trace(const byte_t* _header, uint16_t _header_size, const b
     // Clip
     uint16_t its_data_size = uint16_t(_data_size > USHRT_MAX ? USHRT_MAX : _data_size);
 
-    {
-        std::scoped_lock lk{configure_mutex_};
-        if (is_sd_message(_data, its_data_size) && !is_sd_enabled_)
-            return; // tracing of service discovery messages is disabled!
-    }
+    if (is_sd_message(_data, its_data_size) && !is_sd_enabled_)
+        return; // tracing of service discovery messages is disabled!
 
     service_t its_service = bithelper::read_uint16_be(&_data[VSOMEIP_SERVICE_POS_MIN]);
 
@@ -234,27 +274,26 @@ void connector_impl::trace(const byte_t* _header, uint16_t _header_size, const b
     instance_t its_instance = bithelper::read_uint16_be(&_header[VSOMEIP_TC_INSTANCE_POS_MIN]);
     method_t its_method = bithelper::read_uint16_be(&_data[VSOMEIP_METHOD_POS_MIN]);
 
-// Forward to channel if the filter set of the channel allows
-#ifdef USE_DLT
-    std::scoped_lock its_lock(channels_mutex_, contexts_mutex_);
-#else
-    std::scoped_lock its_lock(channels_mutex_);
-#endif
-    for (auto its_channel : channels_) {
-        auto ftype = its_channel.second->matches(its_service, its_instance, its_method);
+    // Forward to channel if the filter set of the channel allows
+    const auto its_sink = capture_sink_.load();
+    bool is_captured(false), is_full_captured(false);
+    const auto its_channels = active_channels_.load();
+    for (const auto& its_channel : *its_channels) {
+        auto ftype = its_channel.channel_->matches(its_service, its_instance, its_method);
         if (ftype.first) {
+            is_captured = true;
+            is_full_captured = is_full_captured || ftype.second;
 #ifdef USE_DLT
-            auto its_context = contexts_.find(its_channel.second->get_id());
-            if (its_context != contexts_.end()) {
+            if (its_channel.context_) {
                 try {
                     if (ftype.second) {
                         // Positive Filter
-                        DLT_TRACE_NETWORK_SEGMENTED(*(its_context->second.get()), DLT_NW_TRACE_IPC, _header_size,
+                        DLT_TRACE_NETWORK_SEGMENTED(*(its_channel.context_.get()), DLT_NW_TRACE_IPC, _header_size,
                                                     static_cast<void*>(const_cast<byte_t*>(_header)), its_data_size,
                                                     static_cast<void*>(const_cast<byte_t*>(_data)));
                     } else {
                         // Header-Only Filter
-                        DLT_TRACE_NETWORK_TRUNCATED(*(its_context->second.get()), DLT_NW_TRACE_IPC, _header_size,
+                        DLT_TRACE_NETWORK_TRUNCATED(*(its_channel.context_.get()), DLT_NW_TRACE_IPC, _header_size,
                                                     static_cast<void*>(const_cast<byte_t*>(_header)), VSOMEIP_FULL_HEADER_SIZE,
                                                     static_cast<void*>(const_cast<byte_t*>(_data)));
                     }
@@ -266,9 +305,14 @@ void connector_impl::trace(const byte_t* _header, uint16_t _header_size, const b
                 VSOMEIP_ERROR << "tracing: found channel without DLT context!";
             }
 #else
+            // The formatting is expensive, skip it if the capture is sufficient
+            if (its_sink && !is_hexstream_enabled_.load(std::memory_order_relaxed)) {
+                continue;
+            }
+
             std::stringstream ss;
 #if !defined(ANDROID)
-            ss << its_channel.first << ":";
+            ss << its_channel.id_ << ":";
 #elif !defined(ANDROID_CI_BUILD)
             ss << "TC:";
 #endif
@@ -293,6 +337,12 @@ void connector_impl::trace(const byte_t* _header, uint16_t _header_size, const b
 #endif
         }
     }
+
+    // Each message is captured once, with the payload if at least one channel traces it
+    if (its_sink && is_captured) {
+        const uint32_t its_captured_size = (is_full_captured ? _data_size : std::min(_data_size, VSOMEIP_FULL_HEADER_SIZE));
+        its_sink->write(_header, _header_size, _data, its_captured_size, _data_size);
+    }
 }
 
 } // namespace trace
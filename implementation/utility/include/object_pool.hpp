@@ -0,0 +1,92 @@
+// Copyright (C) 2014-2026 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace vsomeip_v3 {
+
+/**
+ * \brief Growable pool of reusable objects.
+ *
+ * get() never waits for an object to be returned: if the pool is exhausted,
+ * a new object is created. Returned objects are kept for reuse up to the
+ * maximum number of free objects, further ones are released, so a load peak
+ * does not pin its memory. The mutex is only held to take an object from or
+ * return it to the free list.
+ */
+template<typename T>
+class object_pool {
+public:
+    using factory_t = std::function<std::shared_ptr<T>()>;
+
+    struct statistics {
+        std::size_t size_{0}; // objects owned by the pool, free or in use
+        std::size_t in_use_{0};
+        std::size_t high_water_{0}; // maximum number of objects in use at the same time
+    };
+
+    /**
+     * \param _initial_size Number of objects created in advance.
+     * \param _max_free Maximum number of returned objects that are kept, at least _initial_size.
+     */
+    object_pool(factory_t _factory, std::size_t _initial_size, std::size_t _max_free) :
+        factory_(std::move(_factory)), max_free_(std::max(_initial_size, _max_free)) {
+        free_.reserve(_initial_size);
+        for (std::size_t i = 0; i < _initial_size; ++i) {
+            free_.push_back(factory_());
+        }
+        statistics_.size_ = _initial_size;
+    }
+
+    std::shared_ptr<T> get() {
+        {
+            std::scoped_lock its_lock(mutex_);
+            statistics_.in_use_++;
+            statistics_.high_water_ = std::max(statistics_.high_water_, statistics_.in_use_);
+            if (!free_.empty()) {
+                auto its_object = std::move(free_.back());
+                free_.pop_back();
+                return its_object;
+            }
+            statistics_.size_++;
+        }
+
+        // Create outside the lock, the object is added to the pool when it is returned
+        return factory_();
+    }
+
+    void put(std::shared_ptr<T> _object) {
+        std::scoped_lock its_lock(mutex_);
+        statistics_.in_use_--;
+        if (free_.size() < max_free_) {
+            free_.push_back(std::move(_object));
+        } else {
+            // Dropped from the pool, _object is released after the mutex was unlocked
+            statistics_.size_--;
+        }
+    }
+
+    statistics get_statistics() const {
+        std::scoped_lock its_lock(mutex_);
+        return statistics_;
+    }
+
+private:
+    const factory_t factory_;
+    const std::size_t max_free_;
+
+    mutable std::mutex mutex_;
+    std::vector<std::shared_ptr<T>> free_;
+    statistics statistics_;
+};
+
+} // namespace vsomeip_v3
@@ -0,0 +1,68 @@
+// Copyright (C) 2014-2026 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <version>
+#include <memory>
+#include <utility>
+
+#if defined(__cpp_lib_atomic_shared_ptr)
+#include <atomic>
+#else
+#include <mutex>
+#endif
+
+namespace vsomeip_v3 {
+
+/**
+ * \brief Publishes an immutable object to concurrent readers.
+ *
+ * Readers take a reference to the current object and work on it without
+ * further locking, writers replace the object as a whole.
+ *
+ * Uses std::atomic<std::shared_ptr> if the standard library provides it.
+ * Otherwise (libstdc++ < 12, libc++) a mutex is only held to copy or swap
+ * the pointer; the replaced object is released after it was unlocked.
+ */
+template<typename T>
+class snapshot {
+public:
+    snapshot() = default;
+    explicit snapshot(std::shared_ptr<T> _value) : value_(std::move(_value)) { }
+
+    snapshot(const snapshot&) = delete;
+    snapshot& operator=(const snapshot&) = delete;
+
+#if defined(__cpp_lib_atomic_shared_ptr)
+    std::shared_ptr<T> load() const { return value_.load(std::memory_order_acquire); }
+
+    void store(std::shared_ptr<T> _value) { value_.store(std::move(_value), std::memory_order_release); }
+
+    std::shared_ptr<T> exchange(std::shared_ptr<T> _value) { return value_.exchange(std::move(_value), std::memory_order_acq_rel); }
+
+private:
+    std::atomic<std::shared_ptr<T>> value_;
+#else
+    std::shared_ptr<T> load() const {
+        std::scoped_lock its_lock(mutex_);
+        return value_;
+    }
+
+    void store(std::shared_ptr<T> _value) { exchange(std::move(_value)); }
+
+    std::shared_ptr<T> exchange(std::shared_ptr<T> _value) {
+        std::scoped_lock its_lock(mutex_);
+        value_.swap(_value);
+        return _value;
+    }
+
+private:
+    mutable std::mutex mutex_;
+    std::shared_ptr<T> value_;
+#endif
+};
+
+} // namespace vsomeip_v3
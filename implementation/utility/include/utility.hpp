@@ -8,6 +8,7 @@
 #include <algorithm>
 #include <atomic>
 #include <chrono>
+#include <functional>
 #include <map>
 #include <memory>
 #include <set>
@@ -26,6 +27,7 @@
 #include <vsomeip/vsomeip_sec.h>
 
 #include "criticalsection.hpp"
+#include "../../configuration/include/thread_scheduling.hpp"
 
 namespace vsomeip_v3 {
 
@@ -119,6 +121,17 @@ public:
     }
 
     static void set_thread_niceness(int _nice) noexcept;
+    // Pins the calling thread to the given CPUs, if the platform supports it.
+    static void set_thread_affinity(const std::vector<int>& _cpus) noexcept;
+    // Applies the CPU affinity and the scheduling policy to the calling thread.
+    static void set_thread_scheduling(const thread_scheduling_t& _scheduling) noexcept;
+
+    // Calls _function for all indices in [0, _count) from up to _max_threads threads (the
+    // calling one included), each of which handles at least _min_count indices. Returns
+    // when all calls are done. If _function throws, the remaining indices are skipped and
+    // the first exception is rethrown to the caller after all threads were joined.
+    static void parallel_for(std::size_t _count, std::size_t _max_threads, std::size_t _min_count,
+                             const std::function<void(std::size_t)>& _function);
 
     class Hex {
     public:
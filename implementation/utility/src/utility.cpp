@@ -3,7 +3,11 @@
 // License, v. 2.0. If a copy of the MPL was not distributed with this
 // file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
+#include <exception>
 #include <iomanip>
+#include <mutex>
+#include <system_error>
+#include <thread>
 
 #ifdef _WIN32
 #include <iostream>
@@ -16,12 +20,16 @@
 #include <unistd.h>
 #include <fcntl.h>
 #include <sys/mman.h>
-#include <thread>
 #include <sstream>
 #endif
 
 #include <sys/stat.h>
 
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
 #include <vsomeip/constants.hpp>
 #include <vsomeip/defines.hpp>
 
@@ -400,6 +408,101 @@ void utility::set_thread_niceness(int _nice) noexcept {
 #endif
 }
 
+void utility::set_thread_affinity(const std::vector<int>& _cpus) noexcept {
+    if (_cpus.empty()) {
+        return;
+    }
+#if defined(__linux__)
+    cpu_set_t its_set;
+    CPU_ZERO(&its_set);
+    for (const auto its_cpu : _cpus) {
+        if (its_cpu >= 0 && its_cpu < CPU_SETSIZE) {
+            CPU_SET(static_cast<std::size_t>(its_cpu), &its_set);
+        }
+    }
+    if (int its_error = pthread_setaffinity_np(pthread_self(), sizeof(its_set), &its_set); its_error != 0) {
+        VSOMEIP_WARNING << "Failed to set CPU affinity for thread " << std::this_thread::get_id() << ", error: " << its_error;
+    }
+#endif
+}
+
+void utility::set_thread_scheduling(const thread_scheduling_t& _scheduling) noexcept {
+    set_thread_affinity(_scheduling.cpus_);
+    if (_scheduling.policy_ == scheduling_policy_e::SP_DEFAULT) {
+        return;
+    }
+#if defined(__linux__)
+    int its_policy(SCHED_OTHER);
+    switch (_scheduling.policy_) {
+    case scheduling_policy_e::SP_FIFO:
+        its_policy = SCHED_FIFO;
+        break;
+    case scheduling_policy_e::SP_RR:
+        its_policy = SCHED_RR;
+        break;
+    default:
+        break;
+    }
+    sched_param its_param{};
+    its_param.sched_priority = (its_policy == SCHED_OTHER ? 0 : _scheduling.priority_);
+    if (int its_error = pthread_setschedparam(pthread_self(), its_policy, &its_param); its_error != 0) {
+        VSOMEIP_WARNING << "Failed to set scheduling policy " << its_policy << " (priority " << its_param.sched_priority
+                        << ") for thread " << std::this_thread::get_id() << ", error: " << its_error;
+    }
+#endif
+}
+
+void utility::parallel_for(std::size_t _count, std::size_t _max_threads, std::size_t _min_count,
+                           const std::function<void(std::size_t)>& _function) {
+    std::size_t its_threads = std::min(_max_threads, _count / std::max<std::size_t>(_min_count, 1));
+    its_threads = std::min<std::size_t>(its_threads, std::max(std::thread::hardware_concurrency(), 1u));
+    if (its_threads <= 1) {
+        for (std::size_t i = 0; i < _count; ++i) {
+            _function(i);
+        }
+        return;
+    }
+
+    // The first exception stops the distribution of the remaining indices and
+    // is rethrown once all workers were joined
+    std::atomic<std::size_t> its_next(0);
+    std::mutex its_exception_mutex;
+    std::exception_ptr its_exception;
+    auto its_worker = [&its_next, _count, &_function, &its_exception_mutex, &its_exception]() {
+        try {
+            for (auto i = its_next.fetch_add(1, std::memory_order_relaxed); i < _count;
+                 i = its_next.fetch_add(1, std::memory_order_relaxed)) {
+                _function(i);
+            }
+        } catch (...) {
+            its_next.store(_count, std::memory_order_relaxed);
+            std::scoped_lock its_lock(its_exception_mutex);
+            if (!its_exception) {
+                its_exception = std::current_exception();
+            }
+        }
+    };
+
+    std::vector<std::thread> its_workers;
+    its_workers.reserve(its_threads - 1);
+    for (std::size_t i = 1; i < its_threads; ++i) {
+        try {
+            its_workers.emplace_back(its_worker);
+        } catch (const std::system_error& e) {
+            // The remaining indices are processed by the threads that were started, at least by this one
+            VSOMEIP_WARNING << "Failed to start worker thread, continuing with " << its_workers.size() + 1 << " thread(s): " << e.what();
+            break;
+        }
+    }
+    its_worker();
+    for (auto& w : its_workers) {
+        w.join();
+    }
+    if (its_exception) {
+        std::rethrow_exception(its_exception);
+    }
+}
+
 std::uint16_t utility::get_max_client_number(const std::shared_ptr<configuration>& _config) {
     std::uint16_t its_max_clients(0);
     const int bits_for_clients =
@@ -9,6 +9,7 @@
 #include <memory>
 #include <set>
 #include <map>
+#include <utility>
 #include <vector>
 
 #include <vsomeip/deprecated.hpp>
@@ -1127,6 +1128,59 @@ public:
      */
     virtual connection_control_response_e change_connection_control(connection_control_request_e _control,
                                                                     const std::string& _guest_address) = 0;
+
+    /**
+     * \brief Get runtime statistics
+     *
+     * Returns a snapshot of the counters of all endpoints of the application
+     * (and of the routing manager, if the application hosts it) and of its
+     * dispatcher threads. The counters are read endpoint by endpoint while
+     * messages are processed, thus the snapshot is not necessarily consistent
+     * across endpoints.
+     *
+     * \return Statistics of endpoints and dispatchers
+     */
+    virtual statistics_t get_statistics() const = 0;
+
+    /**
+     * \brief Sets a handler to be called for slow application handlers
+     *
+     * If a handler budget ("handler_time_budget") is configured for the
+     * application, each handler execution that takes longer than the budget
+     * is counted in the dispatcher statistics and reported to the slow
+     * handler handler. If no slow handler handler is set, a warning is
+     * logged instead.
+     *
+     * The slow handler handler is called on the dispatcher thread that
+     * executed the slow handler, right after the slow handler returned.
+     *
+     * \param _handler Slow handler handler, pass nullptr to log a warning
+     * instead.
+     */
+    virtual void set_slow_handler_handler(const slow_handler_handler_t& _handler) = 0;
+
+    /**
+     *
+     * \brief Fire several event or field notifications of a service instance.
+     *
+     * Behaves like calling @ref notify for each of the given updates in order,
+     * but resolves all events at once. The resulting messages are collected
+     * per local receiver and handed to each receiver with a single send
+     * operation. Concurrent notifications of the same events are sent either
+     * before or after the whole batch.
+     *
+     * \param _service Service identifier of the service that contains the
+     * events.
+     * \param _instance Instance identifier of the service instance that
+     * holds the events.
+     * \param _notifications Event identifiers and serialized payloads of the
+     * updates.
+     * \param _force Forces the notification of field updates, even if the
+     * payload did not change.
+     *
+     */
+    virtual void notify(service_t _service, instance_t _instance,
+                        const std::vector<std::pair<event_t, std::shared_ptr<payload>>>& _notifications, bool _force = false) const = 0;
 };
 
 /** @} */
@@ -94,4 +94,14 @@ enum class connection_control_request_e : uint8_t { CCR_ACCEPT = 0, CCR_RESET_AN
 
 enum class connection_control_response_e : uint8_t { CCR_OK = 0, CCR_ERROR_INVALID_PARAMETER = 255 };
 
+enum class handler_type_e : uint8_t {
+    HT_MESSAGE = 0x00,
+    HT_AVAILABILITY = 0x01,
+    HT_STATE = 0x02,
+    HT_SUBSCRIPTION = 0x03,
+    HT_OFFERED_SERVICES_INFO = 0x04,
+    HT_WATCHDOG = 0x05,
+    HT_UNKNOWN = 0x06
+};
+
 } // namespace vsomeip_v3
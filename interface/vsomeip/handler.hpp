@@ -11,6 +11,7 @@
 
 #include <vsomeip/deprecated.hpp>
 #include <vsomeip/primitive_types.hpp>
+#include <vsomeip/structured_types.hpp>
 #include <vsomeip/vsomeip_sec.h>
 
 namespace vsomeip_v3 {
@@ -100,5 +101,6 @@ typedef std::function<void()> routing_ready_handler_t;
 typedef std::function<void(routing_state_e)> routing_state_handler_t;
 typedef std::function<void(security_update_state_e)> security_update_handler_t;
 typedef std::function<bool(const message_acceptance_t&)> message_acceptance_handler_t;
+typedef std::function<void(const slow_handler_t&)> slow_handler_handler_t;
 
 } // namespace vsomeip_v3
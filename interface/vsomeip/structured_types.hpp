@@ -5,8 +5,16 @@
 
 #pragma once
 
+#include <array>
 #include <chrono>
+#include <cstdint>
 #include <map>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <vsomeip/enumeration_types.hpp>
+#include <vsomeip/primitive_types.hpp>
 
 namespace vsomeip_v3 {
 
@@ -47,4 +55,86 @@ struct debounce_filter_t {
     bool send_current_value_after_; // ignored, does nothing
 };
 
+// Runtime counters of a single endpoint. Message and byte counters are
+// cumulative since the endpoint was created. Local endpoints (connections
+// to other applications of the same host) count commands, boardnet
+// endpoints count SOME/IP messages. Queue sizes are given in bytes.
+struct endpoint_statistics_t {
+    bool is_local_{false};
+    bool is_reliable_{false};
+    bool is_client_{false};
+    std::uint16_t local_port_{0};
+    // Remote address and port of boardnet client endpoints
+    std::string remote_address_;
+    std::uint16_t remote_port_{0};
+    // Connected application of local endpoints
+    client_t peer_{0};
+
+    std::uint64_t messages_sent_{0}; // accepted for sending
+    std::uint64_t bytes_sent_{0};
+    std::uint64_t messages_received_{0};
+    std::uint64_t bytes_received_{0};
+    std::uint64_t messages_dropped_{0}; // rejected for sending
+    std::size_t queue_size_{0};
+    std::size_t queue_size_high_water_mark_{0};
+    std::uint64_t tp_segments_received_{0};
+    std::uint64_t tp_messages_reassembled_{0};
+};
+
+// Distribution of durations. Bucket 0 counts durations below 1us, bucket i
+// counts durations from 2^(i-1)us up to (excluding) 2^i us. The last bucket
+// additionally counts all longer durations.
+struct latency_histogram_t {
+    static constexpr std::size_t BUCKETS = 24;
+
+    std::array<std::uint64_t, BUCKETS> buckets_{};
+    std::uint64_t count_{0};
+    std::chrono::nanoseconds total_{0};
+    std::chrono::nanoseconds max_{0};
+};
+
+// Timing of the handlers of a single handler type or method. The queue time
+// is measured from enqueuing the handler to the start of its execution.
+struct handler_statistics_t {
+    latency_histogram_t execution_time_;
+    latency_histogram_t queue_time_;
+    // Executions that exceeded the configured handler time budget
+    std::uint64_t budget_exceeded_{0};
+};
+
+// Runtime counters of the dispatcher threads of an application.
+struct dispatcher_statistics_t {
+    std::size_t dispatchers_{0};
+    // Dispatchers that currently execute a handler
+    std::size_t running_dispatchers_{0};
+    // Handlers that wait for execution
+    std::size_t queue_size_{0};
+    std::size_t queue_size_high_water_mark_{0};
+    std::uint64_t handlers_invoked_{0};
+    // Handlers that exceeded the maximum dispatch time
+    std::uint64_t handlers_blocked_{0};
+    std::chrono::nanoseconds handler_time_total_{0};
+    std::chrono::nanoseconds handler_time_max_{0};
+    std::map<handler_type_e, handler_statistics_t> handler_types_;
+    // Message handlers per service, instance and method
+    std::map<std::tuple<service_t, instance_t, method_t>, handler_statistics_t> methods_;
+};
+
+// A handler that exceeded the configured handler time budget. Service,
+// instance and method are those the handler was queued for; they are set
+// to ANY_SERVICE, ANY_INSTANCE and ANY_METHOD if unrelated to the handler.
+struct slow_handler_t {
+    handler_type_e type_{handler_type_e::HT_UNKNOWN};
+    service_t service_{0};
+    instance_t instance_{0};
+    method_t method_{0};
+    std::chrono::nanoseconds execution_time_{0};
+    std::chrono::nanoseconds queue_time_{0};
+};
+
+struct statistics_t {
+    std::vector<endpoint_statistics_t> endpoints_;
+    dispatcher_statistics_t dispatcher_;
+};
+
 } // namespace vsomeip_v3
@@ -0,0 +1,98 @@
+// Copyright (C) 2014-2026 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <benchmark/benchmark.h>
+
+#include <cstring>
+#include <random>
+#include <vector>
+
+#include <vsomeip/constants.hpp>
+
+#include "../../../implementation/endpoints/include/magic_cookie_search.hpp"
+
+namespace {
+using vsomeip_v3::byte_t;
+
+// Cookie searched by the TCP client endpoints
+const byte_t service_identifier = vsomeip_v3::MAGIC_COOKIE_SERVICE_MESSAGE;
+const byte_t service_type = static_cast<byte_t>(vsomeip_v3::MAGIC_COOKIE_SERVICE_MESSAGE_TYPE);
+
+// Cookie searched by the TCP server endpoints
+const byte_t client_identifier = vsomeip_v3::MAGIC_COOKIE_CLIENT_MESSAGE;
+const byte_t client_type = static_cast<byte_t>(vsomeip_v3::MAGIC_COOKIE_CLIENT_MESSAGE_TYPE);
+
+// Distance of the cookies within the stream, as sent once per TCP segment
+const size_t cookie_distance = 1400;
+
+using search_t = uint32_t (*)(const byte_t*, size_t, byte_t, byte_t);
+
+/**
+ * Creates a receive buffer as seen after a corrupted frame: random data that
+ * contains many bytes of the cookie, with valid cookies every cookie_distance
+ * bytes. The first cookie is placed behind the corrupted frame.
+ */
+std::vector<byte_t> make_corrupted_stream(size_t _size, byte_t _identifier, byte_t _type) {
+    const byte_t its_cookie[] = {0xFF, 0xFF, _identifier, 0x00, 0x00, 0x00, 0x00, 0x08, 0xDE, 0xAD, 0xBE, 0xEF, 0x01, 0x01, _type, 0x00};
+
+    std::mt19937 its_random(static_cast<std::mt19937::result_type>(_size));
+    std::uniform_int_distribution<int> its_byte(0, 255);
+    std::vector<byte_t> its_stream(_size);
+    for (auto& b : its_stream) {
+        const auto its_value = its_byte(its_random);
+        b = static_cast<byte_t>(its_value < 16 ? 0xFF : its_value < 24 ? 0xDE : its_value < 32 ? 0xEF : its_value);
+    }
+    for (size_t its_offset = cookie_distance / 2; its_offset + sizeof(its_cookie) < _size; its_offset += cookie_distance) {
+        std::memcpy(&its_stream[its_offset], its_cookie, sizeof(its_cookie));
+    }
+    return its_stream;
+}
+
+// Resyncs on the whole stream like the TCP endpoints do: searches the next
+// cookie and continues parsing behind it.
+void resync(benchmark::State& state, search_t _search, byte_t _identifier, byte_t _type) {
+    const auto its_stream = make_corrupted_stream(static_cast<size_t>(state.range(0)), _identifier, _type);
+
+    size_t its_resyncs{0};
+    for (auto _ : state) {
+        size_t its_offset{0};
+        while (its_offset < its_stream.size()) {
+            const uint32_t its_found = _search(&its_stream[its_offset], its_stream.size() - its_offset, _identifier, _type);
+            if (its_found == vsomeip_v3::magic_cookie::NOT_FOUND) {
+                break;
+            }
+            its_offset += its_found + 16;
+            its_resyncs++;
+        }
+        benchmark::DoNotOptimize(its_offset);
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+    // average time needed to find the next cookie
+    state.counters["resync_time"] =
+            benchmark::Counter(static_cast<double>(its_resyncs), benchmark::Counter::kIsRate | benchmark::Counter::kInvert);
+    state.SetLabel(_search == &vsomeip_v3::magic_cookie::find ? vsomeip_v3::magic_cookie::get_implementation() : "scalar");
+}
+}
+
+static void BM_find_magic_cookie_tcp_client_scalar(benchmark::State& state) {
+    resync(state, &vsomeip_v3::magic_cookie::find_scalar, service_identifier, service_type);
+}
+
+static void BM_find_magic_cookie_tcp_client(benchmark::State& state) {
+    resync(state, &vsomeip_v3::magic_cookie::find, service_identifier, service_type);
+}
+
+static void BM_find_magic_cookie_tcp_server_scalar(benchmark::State& state) {
+    resync(state, &vsomeip_v3::magic_cookie::find_scalar, client_identifier, client_type);
+}
+
+static void BM_find_magic_cookie_tcp_server(benchmark::State& state) {
+    resync(state, &vsomeip_v3::magic_cookie::find, client_identifier, client_type);
+}
+
+BENCHMARK(BM_find_magic_cookie_tcp_client_scalar)->RangeMultiplier(8)->Range(1 << 10, 1 << 20);
+BENCHMARK(BM_find_magic_cookie_tcp_client)->RangeMultiplier(8)->Range(1 << 10, 1 << 20);
+BENCHMARK(BM_find_magic_cookie_tcp_server_scalar)->RangeMultiplier(8)->Range(1 << 10, 1 << 20);
+BENCHMARK(BM_find_magic_cookie_tcp_server)->RangeMultiplier(8)->Range(1 << 10, 1 << 20);
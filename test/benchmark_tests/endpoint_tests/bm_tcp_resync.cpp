@@ -0,0 +1,206 @@
+// Copyright (C) 2014-2026 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <benchmark/benchmark.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include <boost/asio/executor_work_guard.hpp>
+#include <boost/asio/ip/tcp.hpp>
+#include <boost/asio/write.hpp>
+
+#include <vsomeip/constants.hpp>
+
+#include "../../../implementation/configuration/include/configuration_impl.hpp"
+#include "../../../implementation/endpoints/include/auxiliary_context.hpp"
+#include "../../../implementation/endpoints/include/boardnet_endpoint_host.hpp"
+#include "../../../implementation/endpoints/include/tcp_client_endpoint_impl.hpp"
+#include "../../../implementation/endpoints/include/tcp_server_endpoint_impl.hpp"
+#include "../../../implementation/routing/include/boardnet_routing_host.hpp"
+#include "../../../implementation/utility/include/bithelper.hpp"
+
+namespace {
+using namespace vsomeip_v3;
+using namespace std::chrono_literals;
+
+const boost::asio::ip::address localhost{boost::asio::ip::make_address("127.0.0.1")};
+
+/**
+ * Endpoint and routing host of the endpoints under test. It only counts the
+ * delivered messages.
+ */
+class resync_host : public boardnet_endpoint_host, public boardnet_routing_host {
+public:
+    void on_connect(std::shared_ptr<boardnet_endpoint> _endpoint) override { _endpoint->set_established(true); }
+    void on_disconnect(std::shared_ptr<boardnet_endpoint>) override { }
+    bool on_bind_error(std::shared_ptr<boardnet_endpoint>, const boost::asio::ip::address&, uint16_t, uint16_t&) override { return false; }
+    void on_error(const byte_t*, length_t, boardnet_endpoint* const, const boost::asio::ip::address&, std::uint16_t) override { }
+    client_t get_client() const override { return VSOMEIP_ROUTING_CLIENT; }
+    std::string get_client_host() const override { return ""; }
+    instance_t find_instance(service_t, boardnet_endpoint* const) const override { return 0x0001; }
+    void add_multicast_option(const multicast_option_t&) override { }
+
+    void on_message(const byte_t*, length_t, boardnet_endpoint*, const boost::asio::ip::address&, port_t, bool) override {
+        {
+            std::scoped_lock its_lock(mutex_);
+            ++received_;
+        }
+        cv_.notify_all();
+    }
+    void remove_subscriptions(port_t, const boost::asio::ip::address&, port_t) override { }
+
+    [[nodiscard]] bool wait_for(std::size_t _count) {
+        std::unique_lock its_lock(mutex_);
+        return cv_.wait_for(its_lock, 5s, [this, _count] { return received_ >= _count; });
+    }
+
+private:
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::size_t received_{0};
+};
+
+std::vector<byte_t> make_header(byte_t _type, std::uint32_t _size) {
+    std::vector<byte_t> its_header(VSOMEIP_FULL_HEADER_SIZE, 0);
+    bithelper::write_uint16_be(0x1234, &its_header[VSOMEIP_SERVICE_POS_MIN]);
+    bithelper::write_uint16_be(0x0001, &its_header[VSOMEIP_METHOD_POS_MIN]);
+    bithelper::write_uint32_be(_size - VSOMEIP_SOMEIP_HEADER_SIZE, &its_header[VSOMEIP_LENGTH_POS_MIN]);
+    bithelper::write_uint16_be(0x1111, &its_header[VSOMEIP_CLIENT_POS_MIN]);
+    its_header[VSOMEIP_PROTOCOL_VERSION_POS] = VSOMEIP_PROTOCOL_VERSION;
+    its_header[VSOMEIP_MESSAGE_TYPE_POS] = _type;
+    return its_header;
+}
+
+/**
+ * Creates a corrupted stream: the header of a broken frame that claims to
+ * span _size bytes of random data, followed by a magic cookie and a valid
+ * message. The endpoint must find the cookie to deliver the message.
+ */
+std::vector<byte_t> make_corrupted_stream(std::size_t _size, byte_t _identifier, byte_t _type) {
+    const byte_t its_cookie[] = {0xFF, 0xFF, _identifier, 0x00, 0x00, 0x00, 0x00, 0x08, 0xDE, 0xAD, 0xBE, 0xEF, 0x01, 0x01, _type, 0x00};
+
+    auto its_stream = make_header(static_cast<byte_t>(message_type_e::MT_NOTIFICATION), static_cast<std::uint32_t>(_size));
+    std::mt19937 its_random(static_cast<std::mt19937::result_type>(_size));
+    std::uniform_int_distribution<int> its_byte(0, 0xFE);
+    while (its_stream.size() < _size) {
+        its_stream.push_back(static_cast<byte_t>(its_byte(its_random)));
+    }
+    its_stream.insert(its_stream.end(), std::begin(its_cookie), std::end(its_cookie));
+
+    const byte_t its_message_type = static_cast<byte_t>(
+            _identifier == MAGIC_COOKIE_CLIENT_MESSAGE ? message_type_e::MT_REQUEST_NO_RETURN : message_type_e::MT_NOTIFICATION);
+    const auto its_message = make_header(its_message_type, VSOMEIP_FULL_HEADER_SIZE + 8);
+    its_stream.insert(its_stream.end(), its_message.begin(), its_message.end());
+    its_stream.resize(its_stream.size() + 8, 0x00);
+    return its_stream;
+}
+
+/**
+ * Runs the io and auxiliary contexts of the endpoints under test, with a
+ * configuration that suppresses the resync error logs.
+ */
+class resync_environment {
+public:
+    resync_environment() {
+        const auto its_path = std::filesystem::temp_directory_path() / "bm_tcp_resync.json";
+        std::ofstream(its_path) << R"({ "unicast": "127.0.0.1", "logging": { "level": "fatal", "console": "false" } })";
+        auto its_configuration = std::make_shared<cfg::configuration_impl>(its_path.string());
+        its_configuration->set_configuration_path(its_path.string());
+        its_configuration->load("bm_tcp_resync");
+        std::filesystem::remove(its_path);
+        configuration_ = its_configuration;
+
+        auxiliary_.start();
+        io_thread_ = std::thread([this] { io_.run(); });
+    }
+
+    ~resync_environment() {
+        work_guard_.reset();
+        io_.stop();
+        io_thread_.join();
+        auxiliary_.stop();
+    }
+
+    boost::asio::io_context io_;
+    boost::asio::executor_work_guard<boost::asio::io_context::executor_type> work_guard_{io_.get_executor()};
+    std::thread io_thread_;
+    auxiliary_context auxiliary_{0};
+    std::shared_ptr<configuration> configuration_;
+    std::shared_ptr<resync_host> host_{std::make_shared<resync_host>()};
+};
+
+// Writes the corrupted stream to the endpoint and measures the time until
+// the message behind the cookie was delivered.
+void resync(benchmark::State& state, boost::asio::ip::tcp::socket& _socket, resync_host& _host, byte_t _identifier, byte_t _type) {
+    const auto its_stream = make_corrupted_stream(static_cast<std::size_t>(state.range(0)), _identifier, _type);
+
+    std::size_t its_delivered{0};
+    for (auto _ : state) {
+        const auto its_start = std::chrono::steady_clock::now();
+        boost::asio::write(_socket, boost::asio::buffer(its_stream));
+        if (!_host.wait_for(++its_delivered)) {
+            state.SkipWithError("message behind the magic cookie was not delivered");
+            break;
+        }
+        state.SetIterationTime(std::chrono::duration<double>(std::chrono::steady_clock::now() - its_start).count());
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(its_stream.size()));
+}
+}
+
+static void BM_tcp_resync_server_endpoint(benchmark::State& state) {
+    resync_environment its_environment;
+
+    auto its_server = std::make_shared<tcp_server_endpoint_impl>(its_environment.host_, its_environment.host_, its_environment.io_,
+                                                                 its_environment.configuration_, its_environment.auxiliary_, true);
+    boost::system::error_code its_error;
+    its_server->init(boost::asio::ip::tcp::endpoint(localhost, 0), its_error);
+    if (its_error) {
+        state.SkipWithError(its_error.message().c_str());
+        return;
+    }
+    its_server->start();
+
+    boost::asio::io_context its_io;
+    boost::asio::ip::tcp::socket its_socket(its_io);
+    its_socket.connect(boost::asio::ip::tcp::endpoint(localhost, its_server->get_local_port()));
+
+    resync(state, its_socket, *its_environment.host_, MAGIC_COOKIE_CLIENT_MESSAGE,
+           static_cast<byte_t>(MAGIC_COOKIE_CLIENT_MESSAGE_TYPE));
+
+    its_socket.close();
+    its_server->stop(false);
+}
+
+static void BM_tcp_resync_client_endpoint(benchmark::State& state) {
+    resync_environment its_environment;
+
+    boost::asio::io_context its_io;
+    boost::asio::ip::tcp::acceptor its_acceptor(its_io, boost::asio::ip::tcp::endpoint(localhost, 0));
+    auto its_client = std::make_shared<tcp_client_endpoint_impl>(
+            its_environment.host_, its_environment.host_, boost::asio::ip::tcp::endpoint(localhost, 0),
+            boost::asio::ip::tcp::endpoint(localhost, its_acceptor.local_endpoint().port()), its_environment.io_,
+            its_environment.configuration_, true);
+    its_client->start();
+
+    boost::asio::ip::tcp::socket its_socket(its_io);
+    its_acceptor.accept(its_socket);
+
+    resync(state, its_socket, *its_environment.host_, MAGIC_COOKIE_SERVICE_MESSAGE,
+           static_cast<byte_t>(MAGIC_COOKIE_SERVICE_MESSAGE_TYPE));
+
+    its_client->stop(false);
+    its_socket.close();
+}
+
+BENCHMARK(BM_tcp_resync_server_endpoint)->RangeMultiplier(8)->Range(1 << 10, 1 << 20)->UseManualTime();
+BENCHMARK(BM_tcp_resync_client_endpoint)->RangeMultiplier(8)->Range(1 << 10, 1 << 20)->UseManualTime();
@@ -5,6 +5,8 @@
 
 #include <benchmark/benchmark.h>
 
+#include <sstream>
+
 #include <common/utility.hpp>
 
 namespace {
@@ -24,6 +26,34 @@ vsomeip_v3::gid_t invalid_gid = 1;
 vsomeip_v3::gid_t deny_uid = 9999;
 vsomeip_v3::gid_t deny_gid = 9999;
 vsomeip_v3::service_t deny_service = 0x40;
+
+// Loads the test policies and adds _count policies that allow other uids
+std::unique_ptr<vsomeip_v3::policy_manager_impl> create_manager(std::int64_t _count, bool _check_credentials = true) {
+    std::unique_ptr<vsomeip_v3::policy_manager_impl> its_manager(new vsomeip_v3::policy_manager_impl);
+    std::set<std::string> its_failed;
+    std::vector<vsomeip_v3::configuration_element> policy_elements;
+    std::vector<std::string> dir_skip;
+    utility::read_data(utility::get_all_files_in_dir(utility::get_policies_path(), dir_skip), policy_elements, its_failed);
+    if (!_check_credentials) {
+        utility::force_check_credentials(policy_elements, "false");
+    }
+    for (const auto& e : policy_elements) {
+        its_manager->load(e, false);
+    }
+
+    std::stringstream its_policies;
+    its_policies << R"({"security": {"policies": [)";
+    for (std::int64_t i = 0; i < _count; i++) {
+        its_policies << (i > 0 ? "," : "") << R"({"credentials": {"uid": ")" << 10000 + i << R"(", "gid": ")" << 10000 + i
+                     << R"("}, "allow": {"requests": [{"service": "0x1000", "instance": "any"}]}})";
+    }
+    its_policies << "]}}";
+    boost::property_tree::ptree its_tree;
+    boost::property_tree::json_parser::read_json(its_policies, its_tree);
+    its_manager->load(vsomeip_v3::configuration_element("credentials", its_tree), false);
+
+    return its_manager;
+}
 }
 
 static void BM_is_client_allowed_policies_not_loaded(benchmark::State& state) {
@@ -189,6 +219,54 @@ static void BM_is_client_allowed_policies_loaded_audit_mode_deny_valid_values(be
     }
 }
 
+// every lookup is denied by the policies and not found in the cache
+static void BM_is_client_allowed_policies_loaded_deny_uncached_values(benchmark::State& state) {
+    auto its_manager = create_manager(state.range(0));
+
+    vsomeip_sec_client_t its_sec_client_deny = utility::create_uds_client(deny_uid, deny_gid, host_address);
+
+    vsomeip_v3::method_t its_method(0);
+    for (auto _ : state) {
+        its_manager->is_client_allowed(&its_sec_client_deny, deny_service, instance, its_method++);
+    }
+}
+
+// every lookup is denied as no policy matches and not found in the cache
+static void BM_is_client_allowed_policies_loaded_unmatched_uncached_values(benchmark::State& state) {
+    auto its_manager = create_manager(state.range(0));
+
+    vsomeip_sec_client_t its_sec_client_invalid = utility::create_uds_client(invalid_uid, invalid_gid, host_address);
+
+    vsomeip_v3::method_t its_method(0);
+    for (auto _ : state) {
+        its_manager->is_client_allowed(&its_sec_client_invalid, service_1, instance, its_method++);
+    }
+}
+
+// a denied lookup that is repeated, as done by a misbehaving client
+static void BM_is_client_allowed_cache_policies_loaded_deny(benchmark::State& state) {
+    auto its_manager = create_manager(state.range(0));
+
+    vsomeip_sec_client_t its_sec_client_deny = utility::create_uds_client(deny_uid, deny_gid, host_address);
+
+    its_manager->is_client_allowed(&its_sec_client_deny, deny_service, instance, method);
+
+    for (auto _ : state) {
+        its_manager->is_client_allowed(&its_sec_client_deny, deny_service, instance, method);
+    }
+}
+
+// repeated lookup of unmatched credentials in audit mode, which are logged but allowed
+static void BM_is_client_allowed_cache_policies_loaded_audit_mode_unmatched(benchmark::State& state) {
+    auto its_manager = create_manager(state.range(0), false);
+
+    vsomeip_sec_client_t its_sec_client_invalid = utility::create_uds_client(invalid_uid, invalid_gid, host_address);
+
+    for (auto _ : state) {
+        its_manager->is_client_allowed(&its_sec_client_invalid, service_1, instance, method);
+    }
+}
+
 BENCHMARK(BM_is_client_allowed_policies_not_loaded);
 BENCHMARK(BM_is_client_allowed_policies_loaded_valid_values);
 BENCHMARK(BM_is_client_allowed_cache_policies_loaded);
@@ -198,3 +276,7 @@ BENCHMARK(BM_is_client_allowed_policies_loaded_audit_mode_valid_values);
 BENCHMARK(BM_is_client_allowed_cache_policies_loaded_audit_mode);
 BENCHMARK(BM_is_client_allowed_policies_loaded_audit_mode_invalid_values);
 BENCHMARK(BM_is_client_allowed_policies_loaded_audit_mode_deny_valid_values);
+BENCHMARK(BM_is_client_allowed_policies_loaded_deny_uncached_values)->Arg(0)->Arg(100)->Arg(1000);
+BENCHMARK(BM_is_client_allowed_policies_loaded_unmatched_uncached_values)->Arg(0)->Arg(100)->Arg(1000);
+BENCHMARK(BM_is_client_allowed_cache_policies_loaded_deny)->Arg(0)->Arg(1000);
+BENCHMARK(BM_is_client_allowed_cache_policies_loaded_audit_mode_unmatched)->Arg(0)->Arg(1000);
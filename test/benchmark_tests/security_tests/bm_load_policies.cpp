@@ -7,8 +7,45 @@
 #include <common/utility.hpp>
 #include <benchmark/benchmark.h>
 
+#include <fstream>
+
 namespace {
 std::string configuration_file{"/vsomeip/0_0/vsomeip_security.json"};
+
+std::string create_policy(std::size_t _index) {
+    std::stringstream its_policy;
+    its_policy << R"({ "security" : { "check_credentials" : "true", "policies" : [ { "credentials" : { "uid" : ")" << 1000 + _index
+               << R"(", "gid" : ")" << 1000 + _index << R"(" }, "allow" : { "requests" : [ { "service" : ")" << 0x1000 + _index
+               << R"(", "instance" : "any" } ], "offers" : [ { "service" : ")" << 0x2000 + _index
+               << R"(", "instance" : "0x1" } ] } } ] } })";
+    return its_policy.str();
+}
+
+// Creates a folder with the given number of policy files. If _is_flat is set, all files are
+// stored in the folder itself and a routing configuration is added, otherwise each of the
+// files is stored in its own <uid>_<gid> sub folder.
+std::string create_policy_folder(std::size_t _count, bool _is_flat) {
+    boost::filesystem::path its_folder =
+            boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("bm_load_policies_%%%%%%%%");
+    boost::filesystem::create_directories(its_folder);
+    for (std::size_t i = 0; i < _count; ++i) {
+        boost::filesystem::path its_file;
+        if (_is_flat) {
+            its_file = its_folder / ("policy_" + std::to_string(i) + ".json");
+        } else {
+            const std::string its_credentials = std::to_string(1000 + i) + "_" + std::to_string(1000 + i);
+            boost::filesystem::create_directories(its_folder / its_credentials);
+            its_file = its_folder / its_credentials / "vsomeip_security.json";
+        }
+        std::ofstream(its_file.string()) << create_policy(i);
+    }
+    if (_is_flat) {
+        std::ofstream((its_folder / "vsomeip.json").string())
+                << R"({ "unicast" : "127.0.0.1", "logging" : { "level" : "error", "console" : "false" },)"
+                << R"( "applications" : [ { "name" : "routingmanagerd", "id" : "0x0100" } ], "routing" : "routingmanagerd" })";
+    }
+    return its_folder.string();
+}
 }
 
 // Since this set of tests check a private method, there is the need to indirectly change the
@@ -88,7 +125,39 @@ static void BM_load_policies_check_credentials_false(benchmark::State& state) {
     }
 }
 
+// Loads the policies of the given number of policy files at once.
+static void BM_load_policies_policy_files(benchmark::State& state) {
+    const std::string its_folder = create_policy_folder(static_cast<std::size_t>(state.range(0)), false);
+
+    std::set<std::string> its_failed;
+    std::vector<vsomeip_v3::configuration_element> policy_elements;
+    utility::read_data({its_folder}, policy_elements, its_failed);
+    const std::vector<std::reference_wrapper<const vsomeip_v3::configuration_element>> its_elements(policy_elements.begin(),
+                                                                                                    policy_elements.end());
+
+    for (auto _ : state) {
+        std::unique_ptr<vsomeip_v3::policy_manager_impl> security(new vsomeip_v3::policy_manager_impl);
+        security->load(its_elements, true);
+    }
+
+    boost::filesystem::remove_all(its_folder);
+}
+
+// Reads and loads a configuration folder containing the given number of policy files.
+static void BM_load_policies_configuration_folder(benchmark::State& state) {
+    const std::string its_folder = create_policy_folder(static_cast<std::size_t>(state.range(0)), true);
+
+    for (auto _ : state) {
+        auto its_configuration = std::make_shared<vsomeip_v3::cfg::configuration_impl>(its_folder);
+        benchmark::DoNotOptimize(its_configuration->load("routingmanagerd"));
+    }
+
+    boost::filesystem::remove_all(its_folder);
+}
+
 BENCHMARK(BM_load_policies_loaded_policies);
 BENCHMARK(BM_load_policies_no_policies);
 BENCHMARK(BM_load_policies_check_credentials_true);
 BENCHMARK(BM_load_policies_check_credentials_false);
+BENCHMARK(BM_load_policies_policy_files)->Arg(10)->Arg(100)->Arg(1000)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_load_policies_configuration_folder)->Arg(10)->Arg(100)->Arg(1000)->Unit(benchmark::kMillisecond);
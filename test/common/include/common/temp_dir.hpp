@@ -0,0 +1,53 @@
+// Copyright (C) 2014-2026 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <filesystem>
+#include <string>
+#include <system_error>
+
+#include <gtest/gtest.h>
+
+namespace common {
+/**
+ * @brief Empty directory below the temporary directory that is removed,
+ * including its content, when the object is destroyed.
+ *
+ * The directory is named after the running test, thus tests do not share
+ * their directories.
+ */
+class temp_dir {
+public:
+    temp_dir() : path_(std::filesystem::temp_directory_path() / get_name()) {
+        std::error_code its_error;
+        std::filesystem::remove_all(path_, its_error);
+        std::filesystem::create_directories(path_);
+    }
+
+    ~temp_dir() {
+        std::error_code its_error;
+        std::filesystem::remove_all(path_, its_error);
+    }
+
+    temp_dir(const temp_dir&) = delete;
+    temp_dir& operator=(const temp_dir&) = delete;
+
+    const std::filesystem::path& path() const { return path_; }
+
+    std::string file(const std::string& _name) const { return (path_ / _name).string(); }
+
+private:
+    static std::string get_name() {
+        std::string its_name("vsomeip_test");
+        if (const auto its_info = ::testing::UnitTest::GetInstance()->current_test_info()) {
+            its_name = its_name + "_" + its_info->test_suite_name() + "_" + its_info->name();
+        }
+        return its_name;
+    }
+
+    std::filesystem::path path_;
+};
+} // namespace common
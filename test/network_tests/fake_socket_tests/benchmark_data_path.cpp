@@ -0,0 +1,306 @@
+// Copyright (C) 2014-2026 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#if __GNUC__ > 10
+// The global operator delete is replaced below and releases via free
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+#include "helpers/app.hpp"
+#include "helpers/base_fake_socket_fixture.hpp"
+#include "helpers/service_state.hpp"
+
+#include <vsomeip/vsomeip.hpp>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <mutex>
+#include <new>
+#include <sstream>
+
+// Counts the allocations of the whole process to report the allocations per message.
+// Array and sized variants end up in these, aligned ones are not counted.
+static std::atomic<std::uint64_t> allocations_{0};
+
+void* operator new(std::size_t _size) {
+    allocations_.fetch_add(1, std::memory_order_relaxed);
+    if (void* its_memory = std::malloc(_size == 0 ? 1 : _size)) {
+        return its_memory;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* _memory) noexcept {
+    std::free(_memory);
+}
+
+void operator delete(void* _memory, std::size_t) noexcept {
+    std::free(_memory);
+}
+
+namespace vsomeip_v3::testing {
+static std::string const routingmanager_name_{"routingmanagerd"};
+static std::string const server_name_{"server"};
+
+/**
+ * The scenarios can be configured by environment variables:
+ * - FAKE_SOCKET_BENCHMARK_CLIENTS: comma separated list of subscriber/client counts
+ * - FAKE_SOCKET_BENCHMARK_PAYLOADS: comma separated list of payload sizes (at least 8 bytes)
+ * - FAKE_SOCKET_BENCHMARK_MESSAGES: number of notifications/requests per scenario
+ */
+static std::vector<std::size_t> get_values(char const* _name, std::vector<std::size_t> const& _default) {
+    char const* its_env = std::getenv(_name);
+    if (its_env == nullptr) {
+        return _default;
+    }
+    std::vector<std::size_t> its_values;
+    std::stringstream its_stream(its_env);
+    std::string its_value;
+    while (std::getline(its_stream, its_value, ',')) {
+        its_values.push_back(std::stoul(its_value));
+    }
+    return its_values;
+}
+
+static std::size_t get_message_count() {
+    return get_values("FAKE_SOCKET_BENCHMARK_MESSAGES", {1000}).at(0);
+}
+
+/**
+ * Collects the latencies (taken from the timestamp at the begin of each payload) and
+ * the allocations of one scenario and reports them.
+ */
+class data_path_recorder {
+public:
+    explicit data_path_recorder(std::size_t _expected) { latencies_.reserve(_expected); }
+
+    static void stamp(std::vector<vsomeip::byte_t>& _payload) {
+        auto const its_now = std::chrono::steady_clock::now().time_since_epoch().count();
+        std::memcpy(_payload.data(), &its_now, sizeof(its_now));
+    }
+
+    void add(std::shared_ptr<vsomeip::payload> const& _payload) {
+        auto const its_now = std::chrono::steady_clock::now().time_since_epoch().count();
+        std::chrono::steady_clock::rep its_sent{0};
+        if (_payload->get_length() >= sizeof(its_sent)) {
+            std::memcpy(&its_sent, _payload->get_data(), sizeof(its_sent));
+        }
+        {
+            std::scoped_lock its_lock(mutex_);
+            latencies_.push_back(its_now - its_sent);
+            received_.fetch_add(1, std::memory_order_release);
+        }
+        condition_.notify_all();
+    }
+
+    /**
+     * Waits until at least _count messages were received.
+     */
+    [[nodiscard]] bool wait_for(std::size_t _count, std::chrono::milliseconds _timeout = std::chrono::seconds(5)) {
+        std::unique_lock its_lock(mutex_);
+        return condition_.wait_for(its_lock, _timeout, [this, _count] { return received_.load(std::memory_order_acquire) >= _count; });
+    }
+
+    std::size_t get_received() const { return received_.load(std::memory_order_acquire); }
+
+    void start() {
+        allocations_at_start_ = allocations_.load(std::memory_order_relaxed);
+        start_ = std::chrono::steady_clock::now();
+    }
+
+    void stop() {
+        stop_ = std::chrono::steady_clock::now();
+        allocations_at_stop_ = allocations_.load(std::memory_order_relaxed);
+    }
+
+    void report(std::string const& _scenario) {
+        std::scoped_lock its_lock(mutex_);
+        std::sort(latencies_.begin(), latencies_.end());
+
+        auto const its_count = latencies_.size();
+        auto const its_seconds = std::chrono::duration<double>(stop_ - start_).count();
+        auto const its_rate = its_seconds > 0 ? static_cast<double>(its_count) / its_seconds : 0.0;
+        auto const its_allocations =
+                its_count > 0 ? static_cast<double>(allocations_at_stop_ - allocations_at_start_) / static_cast<double>(its_count) : 0.0;
+
+        std::stringstream its_report;
+        its_report << std::fixed << std::setprecision(1) << "[ BENCHMARK ] " << _scenario << ": " << its_count << " msgs, " << its_rate
+                   << " msgs/s, p50 " << get_percentile(0.5) << "us, p99 " << get_percentile(0.99) << "us, p999 "
+                   << get_percentile(0.999) << "us, " << its_allocations << " allocs/msg";
+        std::cout << its_report.str() << std::endl;
+
+        ::testing::Test::RecordProperty("msgs_per_second", std::to_string(static_cast<std::uint64_t>(its_rate)));
+        ::testing::Test::RecordProperty("p50_us", std::to_string(get_percentile(0.5)));
+        ::testing::Test::RecordProperty("p99_us", std::to_string(get_percentile(0.99)));
+        ::testing::Test::RecordProperty("p999_us", std::to_string(get_percentile(0.999)));
+        ::testing::Test::RecordProperty("allocs_per_msg", std::to_string(its_allocations));
+    }
+
+private:
+    // nearest rank, latencies_ must be sorted
+    double get_percentile(double _percentile) const {
+        if (latencies_.empty()) {
+            return 0.0;
+        }
+        auto its_rank = static_cast<std::size_t>(std::ceil(_percentile * static_cast<double>(latencies_.size())));
+        its_rank = std::clamp<std::size_t>(its_rank, 1, latencies_.size());
+        return std::chrono::duration<double, std::micro>(std::chrono::nanoseconds(latencies_[its_rank - 1])).count();
+    }
+
+    std::mutex mutex_;
+    std::condition_variable condition_;
+    std::vector<std::int64_t> latencies_;
+    std::atomic<std::size_t> received_{0};
+
+    std::chrono::steady_clock::time_point start_;
+    std::chrono::steady_clock::time_point stop_;
+    std::uint64_t allocations_at_start_{0};
+    std::uint64_t allocations_at_stop_{0};
+};
+
+/**
+ * Runs a routing manager, one server and the given number of clients in one process
+ * and measures the throughput, latency and allocations of the local data path.
+ *
+ * At most window_ messages per client are in flight, which keeps the queues (and
+ * therefore the latencies) bounded while still measuring the throughput.
+ */
+struct benchmark_data_path : public base_fake_socket_fixture, public ::testing::WithParamInterface<std::tuple<std::size_t, std::size_t>> {
+    benchmark_data_path() : client_count_(std::get<0>(GetParam())), payload_size_(std::max<std::size_t>(std::get<1>(GetParam()), 8)) {
+        use_configuration("benchmark_data_path.json");
+        create_app(routingmanager_name_);
+        create_app(server_name_);
+        for (std::size_t i = 0; i < client_count_; ++i) {
+            create_app(get_client_name(i));
+        }
+    }
+
+    static std::string get_client_name(std::size_t _index) { return "client-" + std::to_string(_index); }
+
+    void start_apps() {
+        routingmanagerd_ = start_client(routingmanager_name_);
+        ASSERT_NE(routingmanagerd_, nullptr);
+        ASSERT_TRUE(await_connectable(routingmanager_name_));
+
+        server_ = start_client(server_name_);
+        ASSERT_NE(server_, nullptr);
+        ASSERT_TRUE(server_->app_state_record_.wait_for_last(vsomeip::state_type_e::ST_REGISTERED));
+        server_->offer(interface_);
+
+        for (std::size_t i = 0; i < client_count_; ++i) {
+            auto* its_client = start_client(get_client_name(i));
+            ASSERT_NE(its_client, nullptr);
+            ASSERT_TRUE(its_client->app_state_record_.wait_for_last(vsomeip::state_type_e::ST_REGISTERED));
+            its_client->request_service(interface_.instance_);
+            ASSERT_TRUE(its_client->availability_record_.wait_for_last(service_availability::available(interface_.instance_)));
+            clients_.push_back(its_client);
+        }
+    }
+
+    // Blocks until less than window_ messages per client are in flight
+    [[nodiscard]] bool await_window(data_path_recorder& _recorder, std::size_t _sent) {
+        auto const its_in_flight = window_ * client_count_;
+        return _sent < its_in_flight || _recorder.wait_for(_sent - its_in_flight);
+    }
+
+    std::string get_scenario(std::string const& _name) const {
+        return _name + " (clients=" + std::to_string(client_count_) + ", payload=" + std::to_string(payload_size_) + ")";
+    }
+
+    static constexpr std::size_t window_{16};
+
+    std::size_t const client_count_;
+    std::size_t const payload_size_;
+    std::size_t const message_count_{get_message_count()};
+
+    interface interface_{0x3344};
+    vsomeip::method_t method_{0x1111};
+
+    app* routingmanagerd_{};
+    app* server_{};
+    std::vector<app*> clients_;
+};
+
+TEST_P(benchmark_data_path, notify) {
+    start_apps();
+
+    auto const& its_event = interface_.events_[0];
+    data_path_recorder its_recorder(message_count_ * client_count_);
+    for (auto* its_client : clients_) {
+        its_client->subscribe_event(its_event);
+        ASSERT_TRUE(its_client->subscription_record_.wait_for_last(event_subscription::successfully_subscribed_to(its_event)));
+        its_client->get_application()->register_message_handler(
+                its_event.si_.service_, its_event.si_.instance_, its_event.event_id_,
+                [&its_recorder](std::shared_ptr<vsomeip::message> const& _message) { its_recorder.add(_message->get_payload()); });
+    }
+
+    auto its_server = server_->get_application();
+    std::vector<vsomeip::byte_t> its_data(payload_size_);
+    its_recorder.start();
+    for (std::size_t i = 0; i < message_count_; ++i) {
+        ASSERT_TRUE(await_window(its_recorder, i * client_count_));
+        data_path_recorder::stamp(its_data);
+        auto its_payload = vsomeip::runtime::get()->create_payload(its_data);
+        its_server->notify(its_event.si_.service_, its_event.si_.instance_, its_event.event_id_, its_payload, true);
+    }
+    ASSERT_TRUE(its_recorder.wait_for(message_count_ * client_count_)) << its_recorder.get_received() << " received";
+    its_recorder.stop();
+    its_recorder.report(get_scenario("notify"));
+}
+
+TEST_P(benchmark_data_path, request_response) {
+    start_apps();
+
+    auto its_server = server_->get_application();
+    its_server->register_message_handler(interface_.instance_.service_, interface_.instance_.instance_, method_,
+                                         [its_server](std::shared_ptr<vsomeip::message> const& _request) {
+                                             auto its_response = vsomeip::runtime::get()->create_response(_request);
+                                             its_response->set_payload(_request->get_payload());
+                                             its_server->send(its_response);
+                                         });
+
+    data_path_recorder its_recorder(message_count_ * client_count_);
+    std::vector<std::shared_ptr<vsomeip::application>> its_clients;
+    for (auto* its_client : clients_) {
+        its_clients.push_back(its_client->get_application());
+        its_clients.back()->register_message_handler(
+                interface_.instance_.service_, interface_.instance_.instance_, method_,
+                [&its_recorder](std::shared_ptr<vsomeip::message> const& _message) { its_recorder.add(_message->get_payload()); });
+    }
+
+    std::vector<vsomeip::byte_t> its_data(payload_size_);
+    its_recorder.start();
+    for (std::size_t i = 0; i < message_count_; ++i) {
+        ASSERT_TRUE(await_window(its_recorder, i * client_count_));
+        for (auto const& its_client : its_clients) {
+            auto its_request = vsomeip::runtime::get()->create_request(true);
+            its_request->set_service(interface_.instance_.service_);
+            its_request->set_instance(interface_.instance_.instance_);
+            its_request->set_method(method_);
+            data_path_recorder::stamp(its_data);
+            its_request->set_payload(vsomeip::runtime::get()->create_payload(its_data));
+            its_client->send(its_request);
+        }
+    }
+    ASSERT_TRUE(its_recorder.wait_for(message_count_ * client_count_)) << its_recorder.get_received() << " received";
+    its_recorder.stop();
+    its_recorder.report(get_scenario("request_response"));
+}
+
+INSTANTIATE_TEST_SUITE_P(scenarios, benchmark_data_path,
+                         ::testing::Combine(::testing::ValuesIn(get_values("FAKE_SOCKET_BENCHMARK_CLIENTS", {1, 8})),
+                                            ::testing::ValuesIn(get_values("FAKE_SOCKET_BENCHMARK_PAYLOADS", {16, 1024, 16384}))),
+                         [](::testing::TestParamInfo<std::tuple<std::size_t, std::size_t>> const& _info) {
+                             return "clients_" + std::to_string(std::get<0>(_info.param)) + "_payload_"
+                                     + std::to_string(std::get<1>(_info.param));
+                         });
+}
@@ -178,6 +178,21 @@ void app::send_event(event_ids const& _ei, std::vector<unsigned char> const& _pa
     app_->notify(_ei.si_.service_, _ei.si_.instance_, _ei.event_id_, payload, false);
 }
 
+void app::send_events(std::vector<std::pair<event_ids, std::vector<unsigned char>>> const& _events) {
+    if (_events.empty()) {
+        return;
+    }
+    std::vector<std::pair<vsomeip::event_t, std::shared_ptr<vsomeip::payload>>> its_notifications;
+    for (auto const& [ei, data] : _events) {
+        TEST_LOG << "[app] \"" << app_->get_name() << "\" is sending: " << ei;
+        auto payload = vsomeip::runtime::get()->create_payload();
+        payload->set_data(data);
+        its_notifications.emplace_back(ei.event_id_, payload);
+    }
+    auto const& si = _events.front().first.si_;
+    app_->notify(si.service_, si.instance_, its_notifications, false);
+}
+
 void app::send_request(request const& _req) {
     TEST_LOG << "[app] \"" << app_->get_name() << "\" is requesting: " << _req;
     auto message = vsomeip::runtime::get()->create_request(_req.reliability_);
@@ -231,6 +231,12 @@ public:
      */
     void send_event(event_ids const& _ei, std::vector<unsigned char> const& _payload);
 
+    /**
+     * Forwards the event payloads, which must belong to the same service instance,
+     * to the batch variant of vsomeip::application::notify()
+     */
+    void send_events(std::vector<std::pair<event_ids, std::vector<unsigned char>>> const& _events);
+
     /**
      * Wait for message (payloads!) to reach given state
      *
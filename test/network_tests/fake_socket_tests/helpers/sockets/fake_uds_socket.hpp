@@ -47,7 +47,9 @@ private:
     void async_receive(boost::asio::mutable_buffer _buffer, rw_handler _handler) {
         state_->async_receive(std::move(_buffer), std::move(_handler));
     }
-    void async_write(boost::asio::const_buffer const& _buffer, rw_handler _handler) { state_->write({_buffer}, std::move(_handler)); }
+    void async_write(std::vector<boost::asio::const_buffer> const& _buffers, rw_handler _handler) {
+        state_->write(_buffers, std::move(_handler));
+    }
 
     friend struct fake_tcp_acceptor_handle;
     friend struct fake_uds_acceptor;
@@ -0,0 +1,137 @@
+// Copyright (C) 2014-2026 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "helpers/app.hpp"
+#include "helpers/base_fake_socket_fixture.hpp"
+#include "helpers/service_state.hpp"
+
+#include <vsomeip/vsomeip.hpp>
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <future>
+#include <thread>
+
+namespace vsomeip_v3::testing {
+static std::string const routingmanager_name_{"routingmanagerd"};
+static std::string const server_name_{"server"};
+static std::string const client_name_{"client"};
+
+struct dispatcher_statistics_fixture : public base_fake_socket_fixture {
+    dispatcher_statistics_fixture() {
+        use_configuration("dispatcher_statistics.json");
+        create_app(routingmanager_name_);
+        create_app(server_name_);
+        create_app(client_name_);
+    }
+
+    void start_apps() {
+        routingmanagerd_ = start_client(routingmanager_name_);
+        ASSERT_NE(routingmanagerd_, nullptr);
+        ASSERT_TRUE(await_connectable(routingmanager_name_));
+
+        server_ = start_client(server_name_);
+        ASSERT_NE(server_, nullptr);
+        ASSERT_TRUE(server_->app_state_record_.wait_for_last(vsomeip::state_type_e::ST_REGISTERED));
+        server_->offer(service_instance_);
+
+        client_ = start_client(client_name_);
+        ASSERT_NE(client_, nullptr);
+        ASSERT_TRUE(client_->app_state_record_.wait_for_last(vsomeip::state_type_e::ST_REGISTERED));
+        client_->request_service(service_instance_);
+        ASSERT_TRUE(client_->availability_record_.wait_for_last(service_availability::available(service_instance_)));
+    }
+
+    /**
+     * The statistics are updated after a handler returned, thus after its
+     * effects became visible to the test.
+     */
+    [[nodiscard]] bool await_handlers_invoked(std::uint64_t _count) {
+        for (int i = 0; i < 100; ++i) {
+            if (server_->get_application()->get_statistics().dispatcher_.handlers_invoked_ >= _count) {
+                return true;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+        return false;
+    }
+
+    service_instance service_instance_{0x3344, 0x1};
+    vsomeip_v3::method_t method_{0x1111};
+    request request_{service_instance_, method_, vsomeip::message_type_e::MT_REQUEST, {}};
+    message expected_request_{client_session{0x3490 /*client id*/, 1}, service_instance_, method_, vsomeip::message_type_e::MT_REQUEST, {}};
+    message expected_reply_{client_session{0x3490 /*client id*/, 1}, service_instance_, method_, vsomeip::message_type_e::MT_RESPONSE,
+                            {0x2, 0x3}};
+
+    app* routingmanagerd_{};
+    app* client_{};
+    app* server_{};
+};
+
+TEST_F(dispatcher_statistics_fixture, invoked_handlers_are_counted) {
+    start_apps();
+    server_->answer_request(request_, [] { return std::vector<unsigned char>{0x2, 0x3}; });
+
+    // at least the state handler was already executed
+    ASSERT_TRUE(await_handlers_invoked(1));
+    auto const its_before = server_->get_application()->get_statistics().dispatcher_;
+    EXPECT_GE(its_before.dispatchers_, 1u);
+
+    client_->send_request(request_);
+    ASSERT_TRUE(server_->message_record_.wait_for_last(expected_request_));
+    ASSERT_TRUE(client_->message_record_.wait_for_last(expected_reply_));
+    ASSERT_TRUE(await_handlers_invoked(its_before.handlers_invoked_ + 1));
+
+    auto const its_after = server_->get_application()->get_statistics().dispatcher_;
+    EXPECT_GT(its_after.handlers_invoked_, its_before.handlers_invoked_);
+    EXPECT_GE(its_after.queue_size_high_water_mark_, 1u);
+    EXPECT_GT(its_after.handler_time_total_, std::chrono::nanoseconds::zero());
+    EXPECT_GE(its_after.handler_time_total_, its_after.handler_time_max_);
+    EXPECT_EQ(0u, its_after.handlers_blocked_);
+}
+
+TEST_F(dispatcher_statistics_fixture, handlers_exceeding_the_budget_are_reported) {
+    start_apps();
+    // the budget of the server is 10ms
+    server_->answer_request(request_, [] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(30));
+        return std::vector<unsigned char>{0x2, 0x3};
+    });
+
+    std::promise<slow_handler_t> its_promise;
+    std::atomic<bool> is_reported{false};
+    server_->get_application()->set_slow_handler_handler([&its_promise, &is_reported](const slow_handler_t& _slow_handler) {
+        if (_slow_handler.type_ == handler_type_e::HT_MESSAGE && !is_reported.exchange(true)) {
+            its_promise.set_value(_slow_handler);
+        }
+    });
+    auto its_future = its_promise.get_future();
+
+    client_->send_request(request_);
+    ASSERT_TRUE(client_->message_record_.wait_for_last(expected_reply_));
+    ASSERT_EQ(std::future_status::ready, its_future.wait_for(std::chrono::seconds(3)));
+
+    auto const its_slow_handler = its_future.get();
+    EXPECT_EQ(service_instance_.service_, its_slow_handler.service_);
+    EXPECT_EQ(service_instance_.instance_, its_slow_handler.instance_);
+    EXPECT_EQ(method_, its_slow_handler.method_);
+    EXPECT_GE(its_slow_handler.execution_time_, std::chrono::milliseconds(30));
+    // the queue time is measured from the enqueuing of the handler
+    EXPECT_GE(its_slow_handler.queue_time_, std::chrono::nanoseconds::zero());
+    EXPECT_LT(its_slow_handler.queue_time_, std::chrono::seconds(3));
+
+    // the statistics are updated before the slow handler is reported
+    auto its_statistics = server_->get_application()->get_statistics().dispatcher_;
+    EXPECT_EQ(1u, its_statistics.handler_types_[handler_type_e::HT_MESSAGE].budget_exceeded_);
+    auto const& its_method = its_statistics.methods_[std::make_tuple(service_instance_.service_, service_instance_.instance_, method_)];
+    EXPECT_EQ(1u, its_method.budget_exceeded_);
+    ASSERT_EQ(1u, its_method.execution_time_.count_);
+    auto const its_us = std::chrono::duration_cast<std::chrono::microseconds>(its_slow_handler.execution_time_).count();
+    EXPECT_EQ(1u, its_method.execution_time_.buckets_[std::bit_width(static_cast<std::uint64_t>(its_us))]);
+    EXPECT_EQ(its_slow_handler.execution_time_, its_method.execution_time_.max_);
+}
+}
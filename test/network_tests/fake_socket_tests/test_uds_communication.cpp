@@ -18,7 +18,10 @@
 #include <vsomeip/vsomeip.hpp>
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <cstdlib>
+#include <latch>
+#include <thread>
 
 namespace vsomeip_v3::testing {
 static std::string const routingmanager_name_{"routingmanagerd"};
@@ -95,4 +98,67 @@ TEST_F(test_uds_communication, field_subscription) {
     ASSERT_TRUE(cafe_client_->message_record_.wait_for(cafe_checker_));
 }
 
+TEST_F(test_uds_communication, batched_notifications) {
+    start_apps();
+
+    ASSERT_TRUE(subscribe_to_event());
+    ASSERT_TRUE(subscribe_to_field());
+
+    std::vector<unsigned char> const event_payload{0x1, 0x2};
+    cafe_server_->send_events({{interfaces::cafe.events_[0], event_payload}, {interfaces::cafe.fields_[0], field_payload_}});
+
+    ASSERT_TRUE(cafe_client_->message_record_.wait_for(message_checker{std::nullopt, interfaces::cafe.instance_,
+                                                                       interfaces::cafe.events_[0].event_id_,
+                                                                       vsomeip::message_type_e::MT_NOTIFICATION, event_payload}));
+    ASSERT_TRUE(cafe_client_->message_record_.wait_for(cafe_checker_));
+}
+
+TEST_F(test_uds_communication, batched_notification_does_not_overtake_a_concurrent_notification) {
+    start_apps();
+
+    ASSERT_TRUE(subscribe_to_event());
+    ASSERT_TRUE(subscribe_to_field());
+
+    auto const& its_field = interfaces::cafe.fields_[0];
+    auto last_field_payload = [&its_field](std::vector<message> const& _messages) {
+        auto found = std::find_if(_messages.rbegin(), _messages.rend(), [&its_field](auto const& _m) {
+            return _m.method_ == its_field.event_id_ && _m.message_type_ == vsomeip::message_type_e::MT_NOTIFICATION;
+        });
+        return (found != _messages.rend() ? found->payload_ : std::vector<unsigned char>());
+    };
+
+    for (unsigned char i = 1; i <= 100; ++i) {
+        std::vector<unsigned char> const batched_payload{i, 0xa};
+        std::vector<unsigned char> const single_payload{i, 0xb};
+
+        // Update the field from two threads at the same time
+        std::latch its_start(2);
+        std::thread its_batch_thread([&] {
+            its_start.arrive_and_wait();
+            cafe_server_->send_events({{its_field, batched_payload}});
+        });
+        its_start.arrive_and_wait();
+        cafe_server_->send_event(its_field, single_payload);
+        its_batch_thread.join();
+
+        // Field updates are only sent if the payload changes. Thus, the field now
+        // holds single_payload, and it was notified last - unless a notification
+        // was sent out of order.
+        cafe_server_->send_event(its_field, single_payload);
+
+        // All notifications of the server are received once this one is
+        std::vector<unsigned char> const sync_payload{i};
+        cafe_server_->send_event(interfaces::cafe.events_[0], sync_payload);
+        ASSERT_TRUE(cafe_client_->message_record_.wait_for(message_checker{std::nullopt, interfaces::cafe.instance_,
+                                                                           interfaces::cafe.events_[0].event_id_,
+                                                                           vsomeip::message_type_e::MT_NOTIFICATION, sync_payload}));
+        std::vector<unsigned char> its_last;
+        ASSERT_TRUE(cafe_client_->message_record_.wait_for([&](auto const& _messages) {
+            its_last = last_field_payload(_messages);
+            return true;
+        }));
+        EXPECT_EQ(single_payload, its_last) << "round " << int(i);
+    }
+}
+
 }
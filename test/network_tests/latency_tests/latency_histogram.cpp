@@ -0,0 +1,134 @@
+// Copyright (C) 2014-2026 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "latency_histogram.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <iomanip>
+#include <limits>
+
+namespace {
+
+constexpr std::size_t sub_bucket_bits(5);
+constexpr std::size_t sub_bucket_count(std::size_t(1) << sub_bucket_bits);
+// One set of sub buckets for the values below sub_bucket_count and one for
+// every power of two above
+constexpr std::size_t bucket_count((64 - sub_bucket_bits + 1) * sub_bucket_count);
+
+double to_microseconds(std::chrono::nanoseconds _value) {
+    return std::chrono::duration<double, std::micro>(_value).count();
+}
+
+} // namespace
+
+latency_histogram::latency_histogram() : counts_(bucket_count, 0) {
+    reset();
+}
+
+void latency_histogram::record(std::chrono::nanoseconds _latency) {
+    const auto its_value = static_cast<std::uint64_t>(std::max(_latency.count(), std::chrono::nanoseconds::rep(0)));
+
+    counts_[get_index(its_value)]++;
+    count_++;
+    min_ = std::min(min_, its_value);
+    max_ = std::max(max_, its_value);
+    sum_ += static_cast<double>(its_value);
+}
+
+void latency_histogram::reset() {
+    std::fill(counts_.begin(), counts_.end(), 0);
+    count_ = 0;
+    min_ = std::numeric_limits<std::uint64_t>::max();
+    max_ = 0;
+    sum_ = 0.0;
+}
+
+std::uint64_t latency_histogram::get_count() const {
+    return count_;
+}
+
+std::chrono::nanoseconds latency_histogram::get_min() const {
+    return std::chrono::nanoseconds(count_ ? min_ : 0);
+}
+
+std::chrono::nanoseconds latency_histogram::get_max() const {
+    return std::chrono::nanoseconds(max_);
+}
+
+std::chrono::nanoseconds latency_histogram::get_mean() const {
+    return std::chrono::nanoseconds(count_ ? static_cast<std::uint64_t>(sum_ / static_cast<double>(count_)) : 0);
+}
+
+std::chrono::nanoseconds latency_histogram::get_percentile(double _percentile) const {
+    if (count_ == 0) {
+        return std::chrono::nanoseconds(0);
+    }
+
+    const double its_percentile = std::clamp(_percentile, 0.0, 100.0);
+    const auto its_target = std::max(std::uint64_t(1), static_cast<std::uint64_t>(std::ceil(its_percentile / 100.0 * double(count_))));
+
+    std::uint64_t its_total(0);
+    for (std::size_t i = 0; i < counts_.size(); i++) {
+        its_total += counts_[i];
+        if (its_total >= its_target) {
+            return std::chrono::nanoseconds(std::clamp(get_highest_equivalent_value(i), min_, max_));
+        }
+    }
+    return std::chrono::nanoseconds(max_);
+}
+
+void latency_histogram::print(std::ostream& _stream) const {
+    const auto its_flags = _stream.flags();
+
+    _stream << std::setw(12) << "Value [us]" << std::setw(14) << "Percentile" << std::setw(12) << "TotalCount" << std::setw(18)
+            << "1/(1-Percentile)" << std::endl;
+
+    std::uint64_t its_total(0);
+    for (std::size_t i = 0; i < counts_.size(); i++) {
+        if (counts_[i] == 0) {
+            continue;
+        }
+        its_total += counts_[i];
+
+        const std::chrono::nanoseconds its_value(std::clamp(get_highest_equivalent_value(i), min_, max_));
+        const double its_percentile = static_cast<double>(its_total) / static_cast<double>(count_);
+        _stream << std::fixed << std::setprecision(3) << std::setw(12) << to_microseconds(its_value) << std::setprecision(6)
+                << std::setw(14) << its_percentile << std::setw(12) << its_total;
+        if (its_total < count_) {
+            _stream << std::setprecision(2) << std::setw(18) << 1.0 / (1.0 - its_percentile);
+        }
+        _stream << std::endl;
+    }
+
+    _stream << std::fixed << std::setprecision(3) << "#[Mean = " << to_microseconds(get_mean()) << ", Min = " << to_microseconds(get_min())
+            << ", Max = " << to_microseconds(get_max()) << "]" << std::endl
+            << "#[p50 = " << to_microseconds(get_percentile(50.0)) << ", p90 = " << to_microseconds(get_percentile(90.0))
+            << ", p99 = " << to_microseconds(get_percentile(99.0)) << ", p99.9 = " << to_microseconds(get_percentile(99.9)) << "]"
+            << std::endl
+            << "#[Total count = " << count_ << "]" << std::endl;
+
+    _stream.flags(its_flags);
+}
+
+std::size_t latency_histogram::get_index(std::uint64_t _value) {
+    if (_value < sub_bucket_count) {
+        return static_cast<std::size_t>(_value);
+    }
+
+    const auto its_shift = static_cast<std::size_t>(std::bit_width(_value)) - 1 - sub_bucket_bits;
+    return (its_shift + 1) * sub_bucket_count + static_cast<std::size_t>(_value >> its_shift) - sub_bucket_count;
+}
+
+std::uint64_t latency_histogram::get_highest_equivalent_value(std::size_t _index) {
+    if (_index < sub_bucket_count) {
+        return _index;
+    }
+
+    const std::size_t its_shift = _index / sub_bucket_count - 1;
+    const std::uint64_t its_sub_bucket = _index % sub_bucket_count + sub_bucket_count;
+    return ((its_sub_bucket + 1) << its_shift) - 1;
+}
@@ -0,0 +1,44 @@
+// Copyright (C) 2014-2026 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <ostream>
+#include <vector>
+
+// Log-linear latency histogram in the spirit of HdrHistogram: every power of
+// two is split into a fixed number of linear sub buckets, which bounds the
+// relative error of each recorded value to 1 / number of sub buckets (~3%)
+// independent of its magnitude.
+class latency_histogram {
+public:
+    latency_histogram();
+
+    void record(std::chrono::nanoseconds _latency);
+    void reset();
+
+    std::uint64_t get_count() const;
+    std::chrono::nanoseconds get_min() const;
+    std::chrono::nanoseconds get_max() const;
+    std::chrono::nanoseconds get_mean() const;
+    std::chrono::nanoseconds get_percentile(double _percentile) const;
+
+    // Prints the percentile distribution (one line per non-empty bucket,
+    // values in microseconds) followed by a summary.
+    void print(std::ostream& _stream) const;
+
+private:
+    static std::size_t get_index(std::uint64_t _value);
+    static std::uint64_t get_highest_equivalent_value(std::size_t _index);
+
+private:
+    std::vector<std::uint64_t> counts_;
+    std::uint64_t count_;
+    std::uint64_t min_;
+    std::uint64_t max_;
+    double sum_;
+};
@@ -0,0 +1,345 @@
+// Copyright (C) 2014-2026 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+
+#include <vsomeip/vsomeip.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <thread>
+
+#include "common/test_main.hpp"
+
+#include "latency_test_globals.hpp"
+#include <vsomeip/internal/logger.hpp>
+#include "latency_histogram.hpp"
+
+enum protocol_e { PR_UNKNOWN, PR_TCP, PR_UDP };
+enum mode_e { MO_REQUEST, MO_NOTIFY };
+
+class latency_test_client {
+public:
+    latency_test_client(protocol_e _protocol, mode_e _mode, std::uint32_t _number_of_calls, std::uint32_t _payload_size,
+                        std::chrono::microseconds _interval) :
+        protocol_(_protocol), mode_(_mode), app_(vsomeip::runtime::get()->create_application("latency_test_client")),
+        request_(vsomeip::runtime::get()->create_request(protocol_ == protocol_e::PR_TCP)),
+        event_(protocol_ == protocol_e::PR_TCP ? latency_test::event_id_reliable : latency_test::event_id_unreliable),
+        eventgroup_(protocol_ == protocol_e::PR_TCP ? latency_test::eventgroup_id_reliable : latency_test::eventgroup_id_unreliable),
+        is_running_(true), is_available_(false), is_subscribed_(false), number_of_calls_(_number_of_calls),
+        number_of_calls_total_(_number_of_calls + latency_test::number_of_warm_up_calls), number_of_received_messages_(0),
+        payload_size_(_payload_size), interval_(_interval), initialized_(false), sender_(std::bind(&latency_test_client::run, this)) {
+        if (!app_->init()) {
+            ADD_FAILURE() << "Couldn't initialize application";
+            return;
+        }
+        initialized_ = true;
+        app_->register_state_handler(std::bind(&latency_test_client::on_state, this, std::placeholders::_1));
+
+        app_->register_message_handler(latency_test::service_id, latency_test::instance_id, latency_test::method_id,
+                                       std::bind(&latency_test_client::on_message, this, std::placeholders::_1));
+        app_->register_message_handler(latency_test::service_id, latency_test::instance_id, event_,
+                                       std::bind(&latency_test_client::on_message, this, std::placeholders::_1));
+
+        app_->register_availability_handler(latency_test::service_id, latency_test::instance_id,
+                                            std::bind(&latency_test_client::on_availability, this, std::placeholders::_1,
+                                                      std::placeholders::_2, std::placeholders::_3));
+        if (mode_ == mode_e::MO_NOTIFY) {
+            app_->register_subscription_status_handler(
+                    latency_test::service_id, latency_test::instance_id, eventgroup_, event_,
+                    std::bind(&latency_test_client::on_subscription_status, this, std::placeholders::_1, std::placeholders::_2,
+                              std::placeholders::_3, std::placeholders::_4, std::placeholders::_5));
+        }
+        VSOMEIP_INFO << "Starting...";
+        app_->start();
+    }
+
+    ~latency_test_client() {
+        {
+            std::scoped_lock its_lock(mutex_);
+            is_running_ = false;
+            condition_.notify_one();
+        }
+        sender_.join();
+    }
+
+private:
+    void stop() {
+        VSOMEIP_INFO << "Stopping...";
+        shutdown_service();
+
+        // give the shutdown request time to be sent
+        std::this_thread::sleep_for(std::chrono::milliseconds(250));
+
+        app_->clear_all_handler();
+    }
+
+    void on_state(vsomeip::state_type_e _state) {
+        if (_state == vsomeip::state_type_e::ST_REGISTERED) {
+            app_->request_service(latency_test::service_id, latency_test::instance_id);
+            if (mode_ == mode_e::MO_NOTIFY) {
+                app_->request_event(latency_test::service_id, latency_test::instance_id, event_, {eventgroup_},
+                                    vsomeip::event_type_e::ET_EVENT,
+                                    (protocol_ == protocol_e::PR_TCP ? vsomeip::reliability_type_e::RT_RELIABLE
+                                                                     : vsomeip::reliability_type_e::RT_UNRELIABLE));
+                app_->subscribe(latency_test::service_id, latency_test::instance_id, eventgroup_);
+            }
+        }
+    }
+
+    void on_availability(vsomeip::service_t _service, vsomeip::instance_t _instance, bool _is_available) {
+        VSOMEIP_INFO << "Service [" << std::hex << std::setfill('0') << std::setw(4) << _service << "." << _instance << "] is "
+                     << (_is_available ? "available." : "NOT available.");
+
+        if (latency_test::service_id == _service && latency_test::instance_id == _instance) {
+            std::scoped_lock its_lock(mutex_);
+            is_available_ = _is_available;
+            condition_.notify_one();
+        }
+    }
+
+    void on_subscription_status(vsomeip::service_t _service, vsomeip::instance_t _instance, vsomeip::eventgroup_t _eventgroup,
+                                vsomeip::event_t _event, uint16_t _error) {
+        (void)_service;
+        (void)_instance;
+        (void)_eventgroup;
+        (void)_event;
+        if (_error == 0) {
+            std::scoped_lock its_lock(mutex_);
+            is_subscribed_ = true;
+            condition_.notify_one();
+        }
+    }
+
+    void on_message(const std::shared_ptr<vsomeip::message>& _message) {
+        const auto its_received = std::chrono::steady_clock::now();
+
+        const auto its_payload = _message->get_payload();
+        ASSERT_GE(its_payload->get_length(), latency_test::timestamp_length);
+        std::int64_t its_timestamp;
+        std::memcpy(&its_timestamp, its_payload->get_data(), latency_test::timestamp_length);
+        const std::chrono::steady_clock::time_point its_sent{std::chrono::steady_clock::duration(its_timestamp)};
+
+        std::scoped_lock its_lock(mutex_);
+        if (number_of_received_messages_ >= latency_test::number_of_warm_up_calls) {
+            if (number_of_received_messages_ == latency_test::number_of_warm_up_calls) {
+                measurement_start_ = its_sent;
+            }
+            measurement_stop_ = its_received;
+            histogram_.record(its_received - its_sent);
+        }
+        number_of_received_messages_++;
+        condition_.notify_one();
+    }
+
+    void run() {
+        {
+            std::unique_lock its_lock(mutex_);
+            condition_.wait(its_lock,
+                            [this] { return !is_running_ || (is_available_ && (mode_ == mode_e::MO_REQUEST || is_subscribed_)); });
+            if (!is_running_) {
+                return;
+            }
+        }
+
+        if (mode_ == mode_e::MO_REQUEST) {
+            send_requests();
+        } else {
+            request_notifications();
+        }
+        print_results();
+
+        stop();
+        if (initialized_) {
+            app_->stop();
+        }
+    }
+
+    void send_requests() {
+        request_->set_service(latency_test::service_id);
+        request_->set_instance(latency_test::instance_id);
+        request_->set_method(latency_test::method_id);
+        std::shared_ptr<vsomeip::payload> its_payload = vsomeip::runtime::get()->create_payload();
+        std::vector<vsomeip::byte_t> its_data(payload_size_, latency_test::latency_test_data);
+
+        for (std::uint32_t i = 0; i < number_of_calls_total_; i++) {
+            const std::int64_t its_timestamp = std::chrono::steady_clock::now().time_since_epoch().count();
+            std::memcpy(its_data.data(), &its_timestamp, latency_test::timestamp_length);
+            its_payload->set_data(its_data);
+            request_->set_payload(its_payload);
+            app_->send(request_);
+
+            // wait until the response was received
+            std::unique_lock its_lock(mutex_);
+            if (!condition_.wait_for(its_lock, std::chrono::seconds(5), [this, i] { return number_of_received_messages_ > i; })) {
+                ADD_FAILURE() << "Didn't receive a response for request " << i;
+                return;
+            }
+        }
+    }
+
+    void request_notifications() {
+        std::shared_ptr<vsomeip::message> its_request = vsomeip::runtime::get()->create_request(protocol_ == protocol_e::PR_TCP);
+        its_request->set_service(latency_test::service_id);
+        its_request->set_instance(latency_test::instance_id);
+        its_request->set_method(latency_test::method_id_notify);
+
+        // number of notifications, payload size and interval [us]
+        const std::uint32_t its_parameters[] = {number_of_calls_total_, payload_size_, static_cast<std::uint32_t>(interval_.count())};
+        std::shared_ptr<vsomeip::payload> its_payload = vsomeip::runtime::get()->create_payload();
+        its_payload->set_data(reinterpret_cast<const vsomeip::byte_t*>(its_parameters), sizeof(its_parameters));
+        its_request->set_payload(its_payload);
+        app_->send(its_request);
+
+        std::unique_lock its_lock(mutex_);
+        const auto its_timeout = interval_ * number_of_calls_total_ + std::chrono::seconds(5);
+        if (!condition_.wait_for(its_lock, its_timeout, [this] { return number_of_received_messages_ == number_of_calls_total_; })) {
+            VSOMEIP_WARNING << "Received " << number_of_received_messages_ << " of " << number_of_calls_total_ << " notifications.";
+            EXPECT_GT(number_of_received_messages_, latency_test::number_of_warm_up_calls);
+        }
+    }
+
+    void print_results() {
+        std::scoped_lock its_lock(mutex_);
+
+        const std::chrono::duration<double> its_duration = measurement_stop_ - measurement_start_;
+        const auto its_count = static_cast<double>(histogram_.get_count());
+        const double its_throughput = (its_duration.count() > 0.0 ? its_count / its_duration.count() : 0.0);
+
+        std::cout << "Latency distribution (" << (protocol_ == protocol_e::PR_TCP ? "TCP" : "UDP") << ", "
+                  << (mode_ == mode_e::MO_REQUEST ? "request/response round trip" : "notification") << ", " << payload_size_
+                  << " Bytes payload):" << std::endl;
+        histogram_.print(std::cout);
+        std::cout << std::fixed << std::setprecision(2) << "#[Throughput = " << its_throughput << " msgs/s, "
+                  << its_throughput * static_cast<double>(payload_size_) / (1024.0 * 1024.0) << " MiB/s, lost "
+                  << number_of_calls_total_ - number_of_received_messages_ << " of " << number_of_calls_ << "]" << std::endl;
+    }
+
+    void shutdown_service() {
+        std::shared_ptr<vsomeip::message> its_request = vsomeip::runtime::get()->create_request(protocol_ == protocol_e::PR_TCP);
+        its_request->set_service(latency_test::service_id);
+        its_request->set_instance(latency_test::instance_id);
+        its_request->set_method(latency_test::method_id_shutdown);
+        app_->send(its_request);
+    }
+
+private:
+    protocol_e protocol_;
+    mode_e mode_;
+    std::shared_ptr<vsomeip::application> app_;
+    std::shared_ptr<vsomeip::message> request_;
+    const vsomeip::event_t event_;
+    const vsomeip::eventgroup_t eventgroup_;
+
+    std::mutex mutex_;
+    std::condition_variable condition_;
+    bool is_running_;
+    bool is_available_;
+    bool is_subscribed_;
+    const std::uint32_t number_of_calls_;
+    const std::uint32_t number_of_calls_total_;
+    std::uint32_t number_of_received_messages_;
+    std::uint32_t payload_size_;
+    std::chrono::microseconds interval_;
+
+    latency_histogram histogram_;
+    std::chrono::steady_clock::time_point measurement_start_;
+    std::chrono::steady_clock::time_point measurement_stop_;
+    std::atomic<bool> initialized_;
+    std::thread sender_;
+};
+
+// this variables are changed via cmdline parameters
+static protocol_e protocol(protocol_e::PR_UNKNOWN);
+static mode_e mode(mode_e::MO_REQUEST);
+static std::uint32_t number_of_calls(0);
+static std::uint32_t payload_size(latency_test::default_payload_length);
+static std::uint32_t interval(1000);
+
+TEST(someip_latency_test, measure_latency) {
+    latency_test_client test_client_(protocol, mode, number_of_calls, payload_size, std::chrono::microseconds(interval));
+}
+
+#if defined(__linux__) || defined(__QNX__)
+int main(int argc, char** argv) {
+    int i = 1;
+    while (i < argc) {
+        const std::string its_arg(argv[i]);
+        const std::string its_value(i + 1 < argc ? argv[i + 1] : "");
+        if (its_arg == "--protocol" || its_arg == "-p") {
+            if (its_value == "udp" || its_value == "UDP") {
+                protocol = protocol_e::PR_UDP;
+                i++;
+            } else if (its_value == "tcp" || its_value == "TCP") {
+                protocol = protocol_e::PR_TCP;
+                i++;
+            }
+        } else if (its_arg == "--mode" || its_arg == "-m") {
+            if (its_value == "request" || its_value == "REQUEST") {
+                mode = mode_e::MO_REQUEST;
+                i++;
+            } else if (its_value == "notify" || its_value == "NOTIFY") {
+                mode = mode_e::MO_NOTIFY;
+                i++;
+            }
+        } else if (its_arg == "--calls" || its_arg == "-c") {
+            try {
+                number_of_calls = static_cast<std::uint32_t>(std::stoul(its_value, nullptr, 10));
+            } catch (const std::exception& e) {
+                std::cerr << "Please specify a valid value for number of calls" << std::endl;
+                return (EXIT_FAILURE);
+            }
+            i++;
+        } else if (its_arg == "--payload-size" || its_arg == "-pl") {
+            try {
+                payload_size = static_cast<std::uint32_t>(std::stoul(its_value, nullptr, 10));
+            } catch (const std::exception& e) {
+                std::cerr << "Please specify a valid value for payload size" << std::endl;
+                return (EXIT_FAILURE);
+            }
+            i++;
+        } else if (its_arg == "--interval" || its_arg == "-i") {
+            try {
+                interval = static_cast<std::uint32_t>(std::stoul(its_value, nullptr, 10));
+            } catch (const std::exception& e) {
+                std::cerr << "Please specify a valid value for the notification interval" << std::endl;
+                return (EXIT_FAILURE);
+            }
+            i++;
+        } else if (its_arg == "--help" || its_arg == "-h") {
+            std::cout << "Available options:" << std::endl;
+            std::cout << "--protocol|-p: valid values TCP or UDP" << std::endl;
+            std::cout << "--mode|-m: request (round trip of method calls) or notify (one way delay of notifications)" << std::endl;
+            std::cout << "--calls|-c: number of method calls / notifications to measure" << std::endl;
+            std::cout << "--payload-size|-pl: payload size in Bytes default: " << latency_test::default_payload_length
+                      << " minimum: " << latency_test::minimum_payload_length << std::endl;
+            std::cout << "--interval|-i: interval between two notifications in us default: 1000" << std::endl;
+        }
+        i++;
+    }
+
+    if (protocol == protocol_e::PR_UNKNOWN) {
+        std::cerr << "Please specify valid protocol mode, see --help" << std::endl;
+        return (EXIT_FAILURE);
+    }
+    if (!number_of_calls) {
+        std::cerr << "Please specify valid number of calls, see --help" << std::endl;
+        return (EXIT_FAILURE);
+    }
+    if (payload_size < latency_test::minimum_payload_length) {
+        std::cerr << "Please specify a payload size of at least " << latency_test::minimum_payload_length << " Bytes, see --help"
+                  << std::endl;
+        return (EXIT_FAILURE);
+    }
+
+    return test_main(argc, argv);
+}
+#endif
@@ -0,0 +1,26 @@
+// Copyright (C) 2014-2026 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+namespace latency_test {
+
+static constexpr vsomeip::service_t service_id(0x1111);
+static constexpr vsomeip::instance_t instance_id(0x1);
+static constexpr vsomeip::method_t method_id(0x1111);
+static constexpr vsomeip::method_t method_id_notify(0x8888);
+static constexpr vsomeip::method_t method_id_shutdown(0x7777);
+static constexpr vsomeip::event_t event_id_unreliable(0x8001);
+static constexpr vsomeip::event_t event_id_reliable(0x8002);
+static constexpr vsomeip::eventgroup_t eventgroup_id_unreliable(0x1);
+static constexpr vsomeip::eventgroup_t eventgroup_id_reliable(0x2);
+static constexpr vsomeip::byte_t latency_test_data(0xDD);
+// The send timestamp is stored in front of the payload, followed by enough
+// room for an E2E profile 04 header (crc_offset 128)
+static constexpr vsomeip::length_t timestamp_length(8);
+static constexpr vsomeip::length_t minimum_payload_length(24);
+static constexpr vsomeip::length_t default_payload_length(40);
+static constexpr std::uint32_t number_of_warm_up_calls(10);
+}
@@ -0,0 +1,185 @@
+// Copyright (C) 2014-2026 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+
+#include <vsomeip/vsomeip.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+#include "common/test_main.hpp"
+
+#include "latency_test_globals.hpp"
+#include <vsomeip/internal/logger.hpp>
+
+class latency_test_service {
+public:
+    latency_test_service() :
+        app_(vsomeip::runtime::get()->create_application("latency_test_service")), is_registered_(false), blocked_(false),
+        is_notifying_(false), number_of_received_messages_(0), offer_thread_(std::bind(&latency_test_service::run, this)) { }
+
+    ~latency_test_service() {
+        {
+            std::scoped_lock its_lock(mutex_);
+            blocked_ = true;
+            condition_.notify_one();
+        }
+        offer_thread_.join();
+        stop_notifying();
+    }
+
+    bool init() {
+        std::scoped_lock its_lock(mutex_);
+
+        if (!app_->init()) {
+            ADD_FAILURE() << "Couldn't initialize application";
+            return false;
+        }
+        app_->register_message_handler(latency_test::service_id, latency_test::instance_id, latency_test::method_id,
+                                       std::bind(&latency_test_service::on_message, this, std::placeholders::_1));
+        app_->register_message_handler(latency_test::service_id, latency_test::instance_id, latency_test::method_id_notify,
+                                       std::bind(&latency_test_service::on_message_notify, this, std::placeholders::_1));
+        app_->register_message_handler(latency_test::service_id, latency_test::instance_id, latency_test::method_id_shutdown,
+                                       std::bind(&latency_test_service::on_message_shutdown, this, std::placeholders::_1));
+        app_->register_state_handler(std::bind(&latency_test_service::on_state, this, std::placeholders::_1));
+
+        app_->offer_event(latency_test::service_id, latency_test::instance_id, latency_test::event_id_unreliable,
+                          {latency_test::eventgroup_id_unreliable}, vsomeip::event_type_e::ET_EVENT, std::chrono::milliseconds::zero(),
+                          false, true, nullptr, vsomeip::reliability_type_e::RT_UNRELIABLE);
+        app_->offer_event(latency_test::service_id, latency_test::instance_id, latency_test::event_id_reliable,
+                          {latency_test::eventgroup_id_reliable}, vsomeip::event_type_e::ET_EVENT, std::chrono::milliseconds::zero(),
+                          false, true, nullptr, vsomeip::reliability_type_e::RT_RELIABLE);
+        return true;
+    }
+
+    void start() {
+        VSOMEIP_INFO << "Starting...";
+        app_->start();
+    }
+
+    void stop() {
+        VSOMEIP_INFO << "Stopping...";
+        stop_notifying();
+        app_->stop_offer_service(latency_test::service_id, latency_test::instance_id);
+        app_->clear_all_handler();
+        app_->stop();
+    }
+
+    void on_state(vsomeip::state_type_e _state) {
+        VSOMEIP_INFO << "Application " << app_->get_name() << " is "
+                     << (_state == vsomeip::state_type_e::ST_REGISTERED ? "registered." : "deregistered.");
+
+        if (_state == vsomeip::state_type_e::ST_REGISTERED) {
+            if (!is_registered_) {
+                is_registered_ = true;
+                std::scoped_lock its_lock(mutex_);
+                blocked_ = true;
+                // "start" the run method thread
+                condition_.notify_one();
+            }
+        } else {
+            is_registered_ = false;
+        }
+    }
+
+    void on_message(const std::shared_ptr<vsomeip::message>& _request) {
+        number_of_received_messages_++;
+
+        // echo the payload, it contains the timestamp of the client
+        std::shared_ptr<vsomeip::message> its_response = vsomeip::runtime::get()->create_response(_request);
+        its_response->set_payload(_request->get_payload());
+        app_->send(its_response);
+    }
+
+    void on_message_notify(const std::shared_ptr<vsomeip::message>& _request) {
+        // number of notifications, payload size and interval [us]
+        std::uint32_t its_parameters[3];
+        const auto its_payload = _request->get_payload();
+        if (its_payload->get_length() != sizeof(its_parameters)) {
+            ADD_FAILURE() << "Invalid notify request of length " << its_payload->get_length();
+            return;
+        }
+        std::memcpy(its_parameters, its_payload->get_data(), sizeof(its_parameters));
+
+        const vsomeip::event_t its_event =
+                (_request->is_reliable() ? latency_test::event_id_reliable : latency_test::event_id_unreliable);
+
+        stop_notifying();
+        is_notifying_ = true;
+        notify_thread_ = std::thread(std::bind(&latency_test_service::notify, this, its_event, its_parameters[0], its_parameters[1],
+                                               std::chrono::microseconds(its_parameters[2])));
+    }
+
+    void on_message_shutdown(const std::shared_ptr<vsomeip::message>& _request) {
+        (void)_request;
+        VSOMEIP_INFO << "Shutdown method was called, going down now. Received " << number_of_received_messages_ << " requests.";
+        stop();
+    }
+
+    void run() {
+        std::unique_lock its_lock(mutex_);
+        condition_.wait(its_lock, [this] { return blocked_; });
+
+        app_->offer_service(latency_test::service_id, latency_test::instance_id);
+    }
+
+private:
+    void notify(vsomeip::event_t _event, std::uint32_t _number_of_notifications, std::uint32_t _payload_size,
+                std::chrono::microseconds _interval) {
+        std::shared_ptr<vsomeip::payload> its_payload = vsomeip::runtime::get()->create_payload();
+        std::vector<vsomeip::byte_t> its_data(std::max(_payload_size, latency_test::minimum_payload_length),
+                                              latency_test::latency_test_data);
+
+        auto its_next = std::chrono::steady_clock::now();
+        for (std::uint32_t i = 0; i < _number_of_notifications && is_notifying_; i++) {
+            const std::int64_t its_timestamp = std::chrono::steady_clock::now().time_since_epoch().count();
+            std::memcpy(its_data.data(), &its_timestamp, latency_test::timestamp_length);
+            its_payload->set_data(its_data);
+            app_->notify(latency_test::service_id, latency_test::instance_id, _event, its_payload, true);
+
+            its_next += _interval;
+            std::this_thread::sleep_until(its_next);
+        }
+        VSOMEIP_INFO << "Sent " << _number_of_notifications << " notifications.";
+    }
+
+    void stop_notifying() {
+        is_notifying_ = false;
+        if (notify_thread_.joinable() && notify_thread_.get_id() != std::this_thread::get_id()) {
+            notify_thread_.join();
+        }
+    }
+
+private:
+    std::shared_ptr<vsomeip::application> app_;
+    bool is_registered_;
+
+    std::mutex mutex_;
+    std::condition_variable condition_;
+    bool blocked_;
+    std::atomic<bool> is_notifying_;
+    std::uint32_t number_of_received_messages_;
+    std::thread notify_thread_;
+    std::thread offer_thread_;
+};
+
+TEST(someip_latency_test, echo_requests_and_send_notifications) {
+    latency_test_service test_service;
+    if (test_service.init()) {
+        test_service.start();
+    }
+}
+
+#if defined(__linux__) || defined(__QNX__)
+int main(int argc, char** argv) {
+    return test_main(argc, argv);
+}
+#endif
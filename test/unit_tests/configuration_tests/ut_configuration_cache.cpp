@@ -0,0 +1,289 @@
+// Copyright (C) 2014-2026 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+#include <common/temp_dir.hpp>
+
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <optional>
+#include <sstream>
+#include <vector>
+
+#include <boost/property_tree/json_parser.hpp>
+
+#include "../../../implementation/configuration/include/configuration_cache.hpp"
+
+using namespace vsomeip_v3;
+
+namespace {
+
+const std::string CONFIGURATION = R"({
+    "unicast" : "192.168.0.1",
+    "applications" : [
+        { "name" : "client", "id" : "0x1343" },
+        { "name" : "service", "id" : "0x1277" }
+    ],
+    "services" : [
+        { "service" : "0x1234", "instance" : "0x5678", "unreliable" : "30509" }
+    ],
+    "routing" : "service"
+})";
+
+std::string to_json(const boost::property_tree::ptree& _tree) {
+    std::stringstream its_stream;
+    boost::property_tree::json_parser::write_json(its_stream, _tree);
+    return its_stream.str();
+}
+
+using services_t = std::optional<std::vector<cfg::service_definition>>;
+
+class configuration_cache_test : public ::testing::Test {
+protected:
+    void SetUp() override {
+        path_ = temp_dir_.path();
+        file_ = (path_ / "vsomeip.json").string();
+        cache_ = (path_ / "vsomeip.cache").string();
+        write_file(file_, CONFIGURATION);
+    }
+
+    static void write_file(const std::string& _name, const std::string& _content) {
+        std::ofstream its_file(_name, std::ios::trunc);
+        its_file << _content;
+    }
+
+    std::vector<configuration_element> read(const std::string& _name) {
+        boost::property_tree::ptree its_tree;
+        boost::property_tree::json_parser::read_json(_name, its_tree);
+        std::vector<configuration_element> its_elements;
+        its_elements.emplace_back(_name, its_tree);
+        return its_elements;
+    }
+
+    common::temp_dir temp_dir_;
+    std::filesystem::path path_;
+    std::string file_;
+    std::string cache_;
+};
+
+} // namespace
+
+TEST_F(configuration_cache_test, cached_tree_equals_parsed_tree) {
+    const auto its_elements = read(file_);
+    ASSERT_TRUE(cfg::configuration_cache::write(cache_, its_elements));
+
+    cfg::configuration_cache its_cache;
+    ASSERT_TRUE(its_cache.open(cache_));
+    EXPECT_EQ(1u, its_cache.get_size());
+
+    boost::property_tree::ptree its_tree;
+    services_t its_services;
+    ASSERT_TRUE(its_cache.get(file_, its_tree, its_services));
+    EXPECT_EQ("service", its_tree.get<std::string>("routing"));
+    EXPECT_EQ(1u, its_cache.get_hits());
+
+    // The services are compiled, they are not part of the tree
+    auto its_expected = its_elements[0].tree_;
+    its_expected.erase("services");
+    EXPECT_EQ(to_json(its_expected), to_json(its_tree));
+    ASSERT_TRUE(its_services);
+    ASSERT_EQ(1u, its_services->size());
+    const auto& its_service = its_services->front();
+    EXPECT_EQ(0x1234, its_service.service_);
+    EXPECT_EQ(0x5678, its_service.instance_);
+    EXPECT_EQ(ILLEGAL_PORT, its_service.reliable_);
+    EXPECT_EQ(30509, its_service.unreliable_);
+    EXPECT_FALSE(its_service.unicast_address_);
+
+    // The same file, referenced by a different path
+    ASSERT_TRUE(its_cache.get((path_ / "." / "vsomeip.json").string(), its_tree, its_services));
+}
+
+TEST_F(configuration_cache_test, compiled_services_equal_parsed_services) {
+    write_file(file_, R"({
+        "services" : [
+            {
+                "service" : "0x1234", "instance" : "0x5678", "unicast" : "192.168.0.2",
+                "reliable" : { "port" : "30509", "enable-magic-cookies" : "true" },
+                "events" : [ { "event" : "0x8001", "is_field" : "true", "is_reliable" : "true", "cycle" : "100" } ],
+                "eventgroups" : [
+                    { "eventgroup" : "0x4001", "events" : [ "0x8001", "0x8002" ], "threshold" : "3",
+                      "multicast" : { "address" : "224.0.0.1", "port" : "30490" } }
+                ],
+                "debounce-times" : { "requests" : { "0x0001" : { "debounce-time" : "10" } } },
+                "someip-tp" : { "client-to-service" : [ { "method" : "0x0002", "max-segment-length" : "800" } ] }
+            }
+        ]
+    })");
+    const auto its_elements = read(file_);
+    ASSERT_TRUE(cfg::configuration_cache::write(cache_, its_elements));
+
+    cfg::configuration_cache its_cache;
+    ASSERT_TRUE(its_cache.open(cache_));
+    boost::property_tree::ptree its_tree;
+    services_t its_services;
+    ASSERT_TRUE(its_cache.get(file_, its_tree, its_services));
+    ASSERT_TRUE(its_services);
+    ASSERT_EQ(1u, its_services->size());
+
+    const auto its_parsed = cfg::service_definition::parse(its_elements[0].tree_.get_child("services").begin()->second);
+    const auto& its_compiled = its_services->front();
+    EXPECT_EQ(its_parsed.unicast_address_, its_compiled.unicast_address_);
+    EXPECT_EQ(its_parsed.reliable_, its_compiled.reliable_);
+    EXPECT_TRUE(its_compiled.use_magic_cookies_);
+    EXPECT_EQ(its_parsed.protocol_, its_compiled.protocol_);
+
+    ASSERT_EQ(1u, its_compiled.events_.size());
+    EXPECT_EQ(0x8001, its_compiled.events_[0].id_);
+    EXPECT_TRUE(its_compiled.events_[0].is_field_);
+    EXPECT_EQ(reliability_type_e::RT_RELIABLE, its_compiled.events_[0].reliability_);
+    EXPECT_EQ(100u, its_compiled.events_[0].cycle_);
+
+    ASSERT_EQ(1u, its_compiled.eventgroups_.size());
+    EXPECT_EQ(its_parsed.eventgroups_[0].events_, its_compiled.eventgroups_[0].events_);
+    EXPECT_EQ("224.0.0.1", its_compiled.eventgroups_[0].multicast_address_);
+    EXPECT_EQ(30490, its_compiled.eventgroups_[0].multicast_port_);
+    EXPECT_EQ(3, its_compiled.eventgroups_[0].threshold_);
+
+    // Unset values remain unset, they are replaced by the defaults when the configuration is loaded
+    ASSERT_EQ(1u, its_compiled.debounce_times_.size());
+    EXPECT_EQ(std::chrono::milliseconds(10), its_compiled.debounce_times_[0].debounce_time_);
+    EXPECT_FALSE(its_compiled.debounce_times_[0].maximum_retention_time_);
+    ASSERT_EQ(1u, its_compiled.someip_tp_.size());
+    EXPECT_EQ(0x0002, its_compiled.someip_tp_[0].method_);
+    EXPECT_EQ(800, its_compiled.someip_tp_[0].max_segment_length_);
+}
+
+TEST_F(configuration_cache_test, changed_files_are_not_used) {
+    ASSERT_TRUE(cfg::configuration_cache::write(cache_, read(file_)));
+    write_file(file_, R"({ "routing" : "client" })");
+
+    cfg::configuration_cache its_cache;
+    ASSERT_TRUE(its_cache.open(cache_));
+
+    boost::property_tree::ptree its_tree;
+    services_t its_services;
+    EXPECT_FALSE(its_cache.get(file_, its_tree, its_services));
+    EXPECT_FALSE(its_cache.get((path_ / "other.json").string(), its_tree, its_services));
+    EXPECT_EQ(0u, its_cache.get_hits());
+    EXPECT_FALSE(its_services);
+}
+
+TEST_F(configuration_cache_test, touched_files_are_identified_by_their_content) {
+    ASSERT_TRUE(cfg::configuration_cache::write(cache_, read(file_)));
+    const auto its_modified = std::filesystem::last_write_time(file_);
+
+    cfg::configuration_cache its_cache;
+    ASSERT_TRUE(its_cache.open(cache_));
+    boost::property_tree::ptree its_tree;
+    services_t its_services;
+
+    // Touching the file does not invalidate the entry, the content is hashed then...
+    std::filesystem::last_write_time(file_, its_modified + std::chrono::hours(1));
+    EXPECT_TRUE(its_cache.get(file_, its_tree, its_services));
+
+    // ...which detects a changed content
+    auto its_content = CONFIGURATION;
+    its_content.replace(its_content.find("30509"), 5, "30510");
+    write_file(file_, its_content);
+    EXPECT_FALSE(its_cache.get(file_, its_tree, its_services));
+}
+
+TEST_F(configuration_cache_test, unmodified_files_are_not_hashed) {
+    ASSERT_TRUE(cfg::configuration_cache::write(cache_, read(file_), "/"));
+    const auto its_modified = std::filesystem::last_write_time(file_);
+
+    cfg::configuration_cache its_cache;
+    ASSERT_TRUE(its_cache.open(cache_));
+    boost::property_tree::ptree its_tree;
+    services_t its_services;
+
+    // Size and modification time match: the entry is used without reading the file
+    auto its_content = CONFIGURATION;
+    its_content.replace(its_content.find("30509"), 5, "30510");
+    write_file(file_, its_content);
+    std::filesystem::last_write_time(file_, its_modified);
+    ASSERT_TRUE(its_cache.get(file_, its_tree, its_services));
+    EXPECT_EQ(30509, its_services->front().unreliable_);
+
+    // Copying the file may truncate its modification time to full seconds
+    const auto its_truncated = std::chrono::floor<std::chrono::seconds>(its_modified);
+    std::filesystem::last_write_time(file_, its_truncated);
+    EXPECT_TRUE(its_cache.get(file_, its_tree, its_services));
+
+    std::filesystem::last_write_time(file_, its_truncated - std::chrono::seconds(1));
+    EXPECT_FALSE(its_cache.get(file_, its_tree, its_services));
+}
+
+TEST_F(configuration_cache_test, replaced_files_are_identified_by_their_content) {
+    ASSERT_TRUE(cfg::configuration_cache::write(cache_, read(file_)));
+
+    cfg::configuration_cache its_cache;
+    ASSERT_TRUE(its_cache.open(cache_));
+    boost::property_tree::ptree its_tree;
+
+    // A new file (inode) with the same content, as after copying it to the target
+    std::filesystem::remove(file_);
+    write_file(file_, CONFIGURATION);
+    services_t its_services;
+    EXPECT_TRUE(its_cache.get(file_, its_tree, its_services));
+    EXPECT_EQ("service", its_tree.get<std::string>("routing"));
+}
+
+TEST_F(configuration_cache_test, paths_are_stored_relative_to_the_root) {
+    // The files must be below the root
+    EXPECT_FALSE(cfg::configuration_cache::write(cache_, read(file_), (path_ / "sysroot").string()));
+
+    // Stored as "/vsomeip.json", which is not the path of the file on this host
+    ASSERT_TRUE(cfg::configuration_cache::write(cache_, read(file_), path_.string()));
+    cfg::configuration_cache its_cache;
+    ASSERT_TRUE(its_cache.open(cache_));
+    EXPECT_EQ(1u, its_cache.get_size());
+    boost::property_tree::ptree its_tree;
+    services_t its_services;
+    EXPECT_FALSE(its_cache.get(file_, its_tree, its_services));
+
+    ASSERT_TRUE(cfg::configuration_cache::write(cache_, read(file_), "/"));
+    ASSERT_TRUE(its_cache.open(cache_));
+    EXPECT_TRUE(its_cache.get(file_, its_tree, its_services));
+}
+
+TEST_F(configuration_cache_test, cache_is_written_in_little_endian_byte_order) {
+    ASSERT_TRUE(cfg::configuration_cache::write(cache_, read(file_)));
+
+    std::ifstream its_file(cache_, std::ios::binary);
+    char its_header[12];
+    ASSERT_TRUE(its_file.read(its_header, sizeof(its_header)));
+    EXPECT_EQ(0, std::memcmp(its_header, "VSCC", 4)); // magic
+    EXPECT_EQ(0, std::memcmp(&its_header[4], "\x04\x00\x00\x00", 4)); // version
+    EXPECT_EQ(0, std::memcmp(&its_header[8], "\x01\x00\x00\x00", 4)); // number of entries
+}
+
+TEST_F(configuration_cache_test, invalid_caches_are_rejected) {
+    cfg::configuration_cache its_cache;
+    EXPECT_FALSE(its_cache.open((path_ / "missing.cache").string()));
+
+    write_file(cache_, CONFIGURATION);
+    EXPECT_FALSE(its_cache.open(cache_));
+
+    // Truncated cache
+    ASSERT_TRUE(cfg::configuration_cache::write(cache_, read(file_)));
+    std::filesystem::resize_file(cache_, std::filesystem::file_size(cache_) / 2);
+    if (its_cache.open(cache_)) {
+        boost::property_tree::ptree its_tree;
+        services_t its_services;
+        EXPECT_FALSE(its_cache.get(file_, its_tree, its_services));
+    }
+}
+
+TEST_F(configuration_cache_test, failed_writes_leave_no_temporary_file) {
+    // The cache path is a non-empty directory, thus the temporary file cannot replace it
+    std::filesystem::create_directories(std::filesystem::path(cache_) / "occupied");
+    EXPECT_FALSE(cfg::configuration_cache::write(cache_, read(file_)));
+    EXPECT_FALSE(std::filesystem::exists(cache_ + ".tmp"));
+    EXPECT_TRUE(std::filesystem::is_directory(cache_));
+}
@@ -0,0 +1,167 @@
+// Copyright (C) 2014-2026 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+#include <common/temp_dir.hpp>
+
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+
+#include <boost/property_tree/json_parser.hpp>
+
+#include <vsomeip/constants.hpp>
+
+#include "../../../implementation/configuration/include/configuration_cache.hpp"
+#include "../../../implementation/configuration/include/configuration_impl.hpp"
+#include "../../../implementation/configuration/include/internal.hpp"
+
+using namespace vsomeip_v3;
+
+namespace {
+
+const std::string CONFIGURATION = R"({
+    "unicast" : "127.0.0.1",
+    "applications" : [ { "name" : "service", "id" : "0x1277", "handler_time_budget" : "20" } ],
+    "services" : [
+        { "service" : "0x1234", "instance" : "0x5678", "reliable" : { "port" : "30509" }, "unreliable" : "30510" },
+        { "service" : "0x1235", "instance" : "0x5678", "unreliable" : "30511",
+          "events" : [ { "event" : "0x8001", "is_reliable" : "true" } ] },
+        { "service" : "0x1236", "instance" : "0x5678", "unicast" : "192.168.0.2", "reliable" : { "port" : "30512" },
+          "debounce-times" : { "requests" : { "0x0001" : { "debounce-time" : "10", "maximum-retention-time" : "100" } } } }
+    ],
+    "partitions" : [ [ { "service" : "0x1234", "instance" : "0x5678" } ] ],
+    "secure-services" : [ { "service" : "0x1235", "instance" : "0x5678" } ],
+    "routing" : "service"
+})";
+
+class configuration_impl_test : public ::testing::Test {
+protected:
+    void SetUp() override {
+        const auto its_path = (temp_dir_.path() / "vsomeip.json").string();
+        std::ofstream its_file(its_path, std::ios::trunc);
+        its_file << CONFIGURATION;
+        its_file.close();
+
+        configuration_ = std::make_shared<cfg::configuration_impl>(its_path);
+        ASSERT_TRUE(configuration_->load("service"));
+    }
+
+    common::temp_dir temp_dir_;
+    std::shared_ptr<cfg::configuration_impl> configuration_;
+};
+
+} // namespace
+
+TEST_F(configuration_impl_test, service_lookups) {
+    EXPECT_EQ(30509, configuration_->get_reliable_port(0x1234, 0x5678));
+    EXPECT_EQ(30510, configuration_->get_unreliable_port(0x1234, 0x5678));
+    EXPECT_EQ(ILLEGAL_PORT, configuration_->get_reliable_port(0x1235, 0x5678));
+    EXPECT_EQ(ILLEGAL_PORT, configuration_->get_reliable_port(0x1237, 0x5678));
+
+    EXPECT_EQ(reliability_type_e::RT_BOTH, configuration_->get_service_reliability(0x1234, 0x5678));
+    EXPECT_EQ(reliability_type_e::RT_UNRELIABLE, configuration_->get_service_reliability(0x1235, 0x5678));
+    EXPECT_EQ(reliability_type_e::RT_RELIABLE, configuration_->get_event_reliability(0x1235, 0x5678, 0x8001));
+    EXPECT_EQ(reliability_type_e::RT_UNKNOWN, configuration_->get_event_reliability(0x1235, 0x5678, 0x8002));
+
+    EXPECT_NE(VSOMEIP_DEFAULT_PARTITION_ID, configuration_->get_partition_id(0x1234, 0x5678));
+    EXPECT_EQ(VSOMEIP_DEFAULT_PARTITION_ID, configuration_->get_partition_id(0x1235, 0x5678));
+
+    EXPECT_TRUE(configuration_->is_secure_service(0x1235, 0x5678));
+    EXPECT_FALSE(configuration_->is_secure_service(0x1234, 0x5678));
+}
+
+TEST_F(configuration_impl_test, remote_offer_info_updates_lookups) {
+    EXPECT_TRUE(configuration_->remote_offer_info_add(0x2000, 0x0001, 40000, true, false));
+    EXPECT_EQ(40000, configuration_->get_reliable_port(0x2000, 0x0001));
+    EXPECT_EQ(ILLEGAL_PORT, configuration_->get_unreliable_port(0x2000, 0x0001));
+    EXPECT_TRUE(configuration_->is_offered_remote(0x2000, 0x0001));
+
+    EXPECT_TRUE(configuration_->remote_offer_info_add(0x2000, 0x0001, 40001, false, false));
+    EXPECT_EQ(40000, configuration_->get_reliable_port(0x2000, 0x0001));
+    EXPECT_EQ(40001, configuration_->get_unreliable_port(0x2000, 0x0001));
+
+    bool is_still_offered(false);
+    EXPECT_TRUE(configuration_->remote_offer_info_remove(0x2000, 0x0001, 40000, true, false, &is_still_offered));
+    EXPECT_TRUE(is_still_offered);
+    EXPECT_EQ(ILLEGAL_PORT, configuration_->get_reliable_port(0x2000, 0x0001));
+    EXPECT_TRUE(configuration_->remote_offer_info_remove(0x2000, 0x0001, 40001, false, false, &is_still_offered));
+    EXPECT_FALSE(is_still_offered);
+    EXPECT_FALSE(configuration_->is_offered_remote(0x2000, 0x0001));
+
+    EXPECT_FALSE(configuration_->remote_offer_info_remove(0x2001, 0x0001, 40000, true, false, &is_still_offered));
+}
+
+TEST_F(configuration_impl_test, remote_offer_info_keeps_the_configured_service) {
+    using set_t = std::set<std::pair<service_t, instance_t>>;
+    EXPECT_EQ(set_t({{0x1236, 0x5678}}), configuration_->get_remote_services());
+
+    // Updates replace the configured service object, all lookups must see the replacement
+    const auto its_generation = configuration_->get_service_generation();
+    EXPECT_TRUE(configuration_->remote_offer_info_add(0x1235, 0x5678, 30600, true, false));
+    EXPECT_NE(its_generation, configuration_->get_service_generation());
+    EXPECT_EQ(30600, configuration_->get_reliable_port(0x1235, 0x5678));
+    EXPECT_EQ(30511, configuration_->get_unreliable_port(0x1235, 0x5678));
+    EXPECT_TRUE(configuration_->is_secure_service(0x1235, 0x5678));
+
+    EXPECT_TRUE(configuration_->remote_offer_info_add(0x1236, 0x5678, 30601, false, false));
+    EXPECT_EQ(30512, configuration_->get_reliable_port(0x1236, 0x5678));
+    EXPECT_EQ(30601, configuration_->get_unreliable_port(0x1236, 0x5678));
+    EXPECT_EQ(set_t({{0x1236, 0x5678}}), configuration_->get_remote_services());
+
+    // Looked up by address and port
+    std::chrono::nanoseconds its_debounce_time, its_retention_time;
+    configuration_->get_configured_timing_requests(0x1236, "192.168.0.2", 30512, 0x0001, &its_debounce_time, &its_retention_time);
+    EXPECT_EQ(std::chrono::milliseconds(10), its_debounce_time);
+    EXPECT_EQ(std::chrono::milliseconds(100), its_retention_time);
+
+    bool is_still_offered(false);
+    EXPECT_TRUE(configuration_->remote_offer_info_remove(0x1236, 0x5678, 30512, true, false, &is_still_offered));
+    EXPECT_TRUE(is_still_offered);
+    EXPECT_EQ(ILLEGAL_PORT, configuration_->get_reliable_port(0x1236, 0x5678));
+    EXPECT_EQ(30601, configuration_->get_unreliable_port(0x1236, 0x5678));
+    EXPECT_EQ(set_t({{0x1236, 0x5678}}), configuration_->get_remote_services());
+}
+
+TEST_F(configuration_impl_test, services_are_loaded_from_the_cache) {
+    const auto its_path = (temp_dir_.path() / "vsomeip.json").string();
+    const auto its_cache_path = (temp_dir_.path() / "vsomeip.cache").string();
+    boost::property_tree::ptree its_tree;
+    boost::property_tree::json_parser::read_json(its_path, its_tree);
+    std::vector<configuration_element> its_elements;
+    its_elements.emplace_back(its_path, its_tree);
+    ASSERT_TRUE(cfg::configuration_cache::write(its_cache_path, its_elements));
+
+    // Same size and modification time: the cached services are used, not the changed port
+    const auto its_modified = std::filesystem::last_write_time(its_path);
+    auto its_content = CONFIGURATION;
+    its_content.replace(its_content.find("30510"), 5, "30520");
+    std::ofstream(its_path, std::ios::trunc) << its_content;
+    std::filesystem::last_write_time(its_path, its_modified);
+
+    ::setenv(VSOMEIP_ENV_CONFIGURATION_CACHE, its_cache_path.c_str(), 1);
+    auto its_configuration = std::make_shared<cfg::configuration_impl>(its_path);
+    const bool is_loaded = its_configuration->load("service");
+    ::unsetenv(VSOMEIP_ENV_CONFIGURATION_CACHE);
+    ASSERT_TRUE(is_loaded);
+
+    EXPECT_EQ(30509, its_configuration->get_reliable_port(0x1234, 0x5678));
+    EXPECT_EQ(30510, its_configuration->get_unreliable_port(0x1234, 0x5678));
+    EXPECT_EQ(reliability_type_e::RT_RELIABLE, its_configuration->get_event_reliability(0x1235, 0x5678, 0x8001));
+    EXPECT_TRUE(its_configuration->is_secure_service(0x1235, 0x5678));
+    EXPECT_NE(VSOMEIP_DEFAULT_PARTITION_ID, its_configuration->get_partition_id(0x1234, 0x5678));
+
+    std::chrono::nanoseconds its_debounce_time, its_retention_time;
+    its_configuration->get_configured_timing_requests(0x1236, "192.168.0.2", 30512, 0x0001, &its_debounce_time, &its_retention_time);
+    EXPECT_EQ(std::chrono::milliseconds(10), its_debounce_time);
+    EXPECT_EQ(std::chrono::milliseconds(100), its_retention_time);
+    EXPECT_EQ(configuration_->get_remote_services(), its_configuration->get_remote_services());
+}
+
+TEST_F(configuration_impl_test, handler_time_budget) {
+    EXPECT_EQ(20u, configuration_->get_handler_time_budget("service"));
+    EXPECT_EQ(std::size_t(VSOMEIP_DEFAULT_HANDLER_TIME_BUDGET), configuration_->get_handler_time_budget("client"));
+}
@@ -0,0 +1,14 @@
+// Copyright (C) 2014-2026 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "mock_boardnet_hosts.hpp"
+
+namespace vsomeip_v3::testing {
+mock_boardnet_endpoint_host::mock_boardnet_endpoint_host() = default;
+mock_boardnet_endpoint_host::~mock_boardnet_endpoint_host() = default;
+
+mock_boardnet_routing_host::mock_boardnet_routing_host() = default;
+mock_boardnet_routing_host::~mock_boardnet_routing_host() = default;
+}
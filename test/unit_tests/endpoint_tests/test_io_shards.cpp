@@ -0,0 +1,155 @@
+// Copyright (C) 2014-2026 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <thread>
+
+#include <boost/asio.hpp>
+
+#include <vsomeip/constants.hpp>
+
+#include "../../../implementation/configuration/include/internal.hpp"
+#include "../../../implementation/endpoints/include/io_shards.hpp"
+
+using namespace vsomeip_v3;
+
+TEST(test_io_shards, disabled_shards_return_the_default_context) {
+    boost::asio::io_context its_default;
+    io_shards shards({}, 0);
+
+    EXPECT_FALSE(shards.is_enabled());
+    EXPECT_EQ(&its_default, &shards.get_context(0x1234, 0x1, its_default));
+    EXPECT_EQ(&its_default, &shards.get_local_context(its_default));
+    EXPECT_NO_THROW(shards.start());
+    EXPECT_NO_THROW(shards.stop());
+}
+
+TEST(test_io_shards, service_instances_are_assigned_round_robin) {
+    boost::asio::io_context its_default;
+    io_shards_config_t its_config;
+    its_config.count_ = 2;
+    io_shards shards(its_config, 0);
+
+    auto* its_first = &shards.get_context(0x1234, 0x1, its_default);
+    auto* its_second = &shards.get_context(0x1234, 0x2, its_default);
+    auto* its_third = &shards.get_context(0x1235, 0x1, its_default);
+
+    EXPECT_NE(&its_default, its_first);
+    EXPECT_NE(its_first, its_second);
+    EXPECT_EQ(its_first, its_third);
+    // the assignment is kept
+    EXPECT_EQ(its_second, &shards.get_context(0x1234, 0x2, its_default));
+    EXPECT_EQ(1u, shards.get_shard(0x1234, 0x2));
+    EXPECT_FALSE(shards.get_shard(0x4711, 0x1));
+}
+
+TEST(test_io_shards, configured_shards_are_used) {
+    boost::asio::io_context its_default;
+    io_shards_config_t its_config;
+    its_config.count_ = 4;
+    its_config.local_ = 3;
+    its_config.services_[{0x1234, 0x1}] = 2;
+    its_config.services_[{0x1235, ANY_INSTANCE}] = 1;
+    io_shards shards(its_config, 0);
+
+    shards.get_context(0x1234, 0x1, its_default);
+    shards.get_context(0x1235, 0x7, its_default);
+    shards.get_context(0x4711, 0x1, its_default);
+    shards.get_local_context(its_default);
+
+    EXPECT_EQ(2u, shards.get_shard(0x1234, 0x1));
+    EXPECT_EQ(1u, shards.get_shard(0x1235, 0x7));
+    // the configured shards do not advance the round-robin assignment
+    EXPECT_EQ(0u, shards.get_shard(0x4711, 0x1));
+}
+
+TEST(test_io_shards, service_instances_join_the_shard_of_a_shared_server_endpoint) {
+    boost::asio::io_context its_default;
+    io_shards_config_t its_config;
+    its_config.count_ = 4;
+    its_config.services_[{0x1234, 0x1}] = 2;
+    its_config.services_[{0x1236, 0x1}] = 3;
+    io_shards shards(its_config, 0);
+
+    // the first service instance on the port determines the shard of the endpoint
+    auto* its_server = &shards.get_server_context(30509, true, 0x1234, 0x1, its_default);
+    EXPECT_EQ(&shards.get_context(0x1234, 0x1, its_default), its_server);
+    EXPECT_EQ(2u, shards.get_shard(0x1234, 0x1));
+
+    // service instances without configuration are assigned to it
+    EXPECT_TRUE(shards.join_server(30509, true, 0x1235, 0x1));
+    EXPECT_EQ(2u, shards.get_shard(0x1235, 0x1));
+
+    // service instances configured for another shard are reported
+    EXPECT_FALSE(shards.join_server(30509, true, 0x1236, 0x1));
+    EXPECT_EQ(3u, shards.get_shard(0x1236, 0x1));
+
+    // other ports and the unreliable endpoint of the same port are independent
+    EXPECT_TRUE(shards.join_server(30509, false, 0x1236, 0x1));
+    EXPECT_TRUE(shards.join_server(30510, true, 0x1236, 0x1));
+}
+
+TEST(test_io_shards, use_contexts_after_restart) {
+    boost::asio::io_context its_default;
+    io_shards_config_t its_config;
+    its_config.count_ = 2;
+    io_shards shards(its_config, 0);
+
+    EXPECT_NO_THROW(shards.start());
+    EXPECT_NO_THROW(shards.stop());
+    EXPECT_NO_THROW(shards.start());
+
+    std::promise<void> first_promise, second_promise;
+    boost::asio::post(shards.get_context(0x1234, 0x1, its_default), [&first_promise]() { first_promise.set_value(); });
+    boost::asio::post(shards.get_context(0x1234, 0x2, its_default), [&second_promise]() { second_promise.set_value(); });
+
+    EXPECT_EQ(first_promise.get_future().wait_for(std::chrono::seconds(1)), std::future_status::ready);
+    EXPECT_EQ(second_promise.get_future().wait_for(std::chrono::seconds(1)), std::future_status::ready);
+
+    EXPECT_NO_THROW(shards.stop());
+}
+
+TEST(test_io_shards, stop_completes_the_queued_handlers) {
+    boost::asio::io_context its_default;
+    io_shards_config_t its_config;
+    its_config.count_ = 2;
+    io_shards shards(its_config, 0);
+    shards.start();
+
+    // e.g. the shutdown of the socket of an endpoint that was stopped right before
+    std::atomic<int> its_completed{0};
+    // handlers are queued while the shards are busy with the first ones
+    for (int n = 0; n < 2; n++) {
+        for (instance_t i = 1; i <= 2; i++) {
+            boost::asio::post(shards.get_context(0x1234, i, its_default), [&its_completed]() {
+                std::this_thread::sleep_for(std::chrono::milliseconds(50));
+                ++its_completed;
+            });
+        }
+    }
+    shards.stop();
+
+    EXPECT_EQ(4, its_completed);
+}
+
+TEST(test_io_shards, stop_does_not_wait_for_shards_that_keep_working) {
+    boost::asio::io_context its_default;
+    io_shards_config_t its_config;
+    its_config.count_ = 1;
+    io_shards shards(its_config, 0);
+    shards.start();
+
+    // a timer that never expires keeps the shard busy
+    boost::asio::steady_timer its_timer(shards.get_context(0x1234, 0x1, its_default), std::chrono::hours(1));
+    its_timer.async_wait([](const boost::system::error_code&) { });
+
+    const auto its_start = std::chrono::steady_clock::now();
+    shards.stop();
+    EXPECT_LT(std::chrono::steady_clock::now() - its_start, std::chrono::milliseconds(VSOMEIP_IO_SHARDS_STOP_TIMEOUT) * 2);
+}
@@ -19,6 +19,7 @@
 #include "../../../implementation/protocol/include/protocol.hpp"
 #include "../../../implementation/protocol/include/config_command.hpp"
 #include "../../../implementation/protocol/include/offer_service_command.hpp"
+#include "../../../implementation/protocol/include/send_command.hpp"
 #include <boost/asio/local/stream_protocol.hpp>
 #include <boost/system/error_code.hpp>
 
@@ -76,9 +77,9 @@ struct test_uds_local_endpoint : base_endpoint_fixture {
                 },
                 false, "host-env");
     }
-    auto create_client_ep() {
+    auto create_client_ep(local_coalescing_t _coalescing = {}) {
         return local_endpoint::create_client_ep(
-                local_endpoint_context{io_, configuration_, client_routing_host_},
+                local_endpoint_context{io_, configuration_, client_routing_host_, _coalescing},
                 local_endpoint_params{server_, client_, "",
                                       std::make_unique<local_socket_uds_impl>(io_, boost::asio::local::stream_protocol::endpoint{},
                                                                               server_endpoint_, socket_role_e::CLIENT)});
@@ -157,4 +158,222 @@ TEST_F(test_uds_local_endpoint, config_command_leads_to_information_forwarding_t
 
     EXPECT_EQ(received_messages, send_messages);
 }
+
+TEST_F(test_uds_local_endpoint, shared_frames_are_sent_without_copying_them) {
+
+    auto server = create_server();
+    auto client = create_client_ep();
+    server->start();
+    client->start();
+    io_.poll();
+
+    EXPECT_CALL(*server_routing_host_, lazy_load(::testing::_));
+    auto config_msg = create_client_config_command();
+    client->send(&config_msg[0], static_cast<uint32_t>(config_msg.size()));
+    io_.poll();
+
+    std::vector<std::vector<byte_t>> received_messages;
+    ON_CALL(*server_routing_host_, on_message).WillByDefault([&](auto ptr, auto size, auto...) {
+        received_messages.emplace_back(ptr, ptr + size);
+    });
+    EXPECT_CALL(*server_routing_host_, on_message).Times(2);
+
+    auto its_frame = std::make_shared<const std::vector<byte_t>>(VSOMEIP_LOCAL_GATHER_THRESHOLD, byte_t(0x42));
+    protocol::send_command its_command(protocol::id_e::SEND_ID);
+    its_command.set_client(client_);
+    its_command.set_message(*its_frame);
+    std::vector<byte_t> its_expected;
+    its_command.serialize(its_expected);
+
+    byte_t its_header[protocol::SEND_COMMAND_HEADER_SIZE];
+    its_command.serialize_header(its_header, its_frame->size());
+
+    auto const its_before = client->get_send_statistics();
+    client->send(its_header, sizeof(its_header), its_frame);
+    client->send(its_header, sizeof(its_header), its_frame);
+    io_.poll();
+
+    EXPECT_EQ(received_messages, std::vector<std::vector<byte_t>>(2, its_expected));
+
+    auto const its_after = client->get_send_statistics();
+    EXPECT_EQ(2 * sizeof(its_header), its_after.bytes_copied_ - its_before.bytes_copied_);
+    EXPECT_EQ(2 * its_expected.size(), its_after.bytes_sent_ - its_before.bytes_sent_);
+}
+
+TEST_F(test_uds_local_endpoint, batched_commands_are_sent_with_a_single_write) {
+
+    auto server = create_server();
+    auto client = create_client_ep();
+    server->start();
+    client->start();
+    io_.poll();
+
+    EXPECT_CALL(*server_routing_host_, lazy_load(::testing::_));
+    auto config_msg = create_client_config_command();
+    client->send(&config_msg[0], static_cast<uint32_t>(config_msg.size()));
+    io_.poll();
+
+    std::vector<std::vector<byte_t>> received_messages;
+    ON_CALL(*server_routing_host_, on_message).WillByDefault([&](auto ptr, auto size, auto...) {
+        received_messages.emplace_back(ptr, ptr + size);
+    });
+    EXPECT_CALL(*server_routing_host_, on_message).Times(3);
+
+    std::vector<local_endpoint::command> its_commands;
+    std::vector<std::vector<byte_t>> its_expected;
+    for (byte_t i = 1; i <= 3; ++i) {
+        auto its_frame = std::make_shared<const std::vector<byte_t>>(16 * i, i);
+        protocol::send_command its_command(protocol::id_e::SEND_ID);
+        its_command.set_client(client_);
+        its_command.set_message(*its_frame);
+        its_command.serialize(its_expected.emplace_back());
+
+        auto& its_batched = its_commands.emplace_back();
+        its_command.serialize_header(its_batched.header_.data(), its_frame->size());
+        its_batched.frame_ = its_frame;
+    }
+
+    auto const its_before = client->get_send_statistics();
+    EXPECT_EQ(its_commands.size(), client->send(its_commands));
+    io_.poll();
+
+    EXPECT_EQ(received_messages, its_expected);
+    EXPECT_EQ(1u, client->get_send_statistics().writes_ - its_before.writes_);
+}
+
+TEST_F(test_uds_local_endpoint, coalescing_holds_back_small_commands_up_to_the_maximum_delay) {
+    auto const its_coalescing = configuration_->get_local_coalescing("coalescing-app");
+    ASSERT_EQ(std::chrono::milliseconds(50), its_coalescing.max_delay_);
+    ASSERT_EQ(1024u, its_coalescing.max_batch_size_);
+
+    auto server = create_server();
+    auto client = create_client_ep(its_coalescing);
+    server->start();
+    client->start();
+    io_.poll();
+
+    std::vector<std::vector<byte_t>> received_messages;
+    ON_CALL(*server_routing_host_, on_message).WillByDefault([&](auto ptr, auto size, auto...) {
+        received_messages.emplace_back(ptr, ptr + size);
+    });
+    EXPECT_CALL(*server_routing_host_, lazy_load(::testing::_));
+    EXPECT_CALL(*server_routing_host_, on_message).Times(3);
+
+    auto config_msg = create_client_config_command();
+    client->send(&config_msg[0], static_cast<uint32_t>(config_msg.size()));
+    std::vector<std::vector<byte_t>> send_messages;
+    add_offer_service_command(send_messages);
+    add_offer_service_command(send_messages);
+    add_offer_service_command(send_messages);
+    for (auto const& msg : send_messages) {
+        client->send(&msg[0], static_cast<uint32_t>(msg.size()));
+    }
+    io_.poll();
+    EXPECT_EQ(0u, client->get_send_statistics().writes_);
+    EXPECT_TRUE(received_messages.empty());
+
+    auto const its_deadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+    while (received_messages.size() < send_messages.size() && std::chrono::steady_clock::now() < its_deadline) {
+        io_.run_one_for(std::chrono::milliseconds(10));
+    }
+    EXPECT_EQ(received_messages, send_messages);
+
+    auto const its_statistics = client->get_send_statistics();
+    EXPECT_EQ(1u, its_statistics.writes_);
+    EXPECT_EQ(1u, its_statistics.coalesced_);
+}
+
+TEST_F(test_uds_local_endpoint, coalescing_sends_a_full_batch_without_delay) {
+    auto server = create_server();
+    auto client = create_client_ep(local_coalescing_t{std::chrono::seconds(10), 1});
+    server->start();
+    client->start();
+    io_.poll();
+
+    EXPECT_CALL(*server_routing_host_, lazy_load(::testing::_));
+    auto config_msg = create_client_config_command();
+    client->send(&config_msg[0], static_cast<uint32_t>(config_msg.size()));
+    io_.poll();
+
+    auto const its_statistics = client->get_send_statistics();
+    EXPECT_EQ(1u, its_statistics.writes_);
+    EXPECT_EQ(0u, its_statistics.coalesced_);
+}
+
+TEST_F(test_uds_local_endpoint, statistics_count_commands_of_both_endpoints) {
+    auto server = create_server();
+    auto client = create_client_ep();
+    server->start();
+    client->start();
+    io_.poll();
+
+    EXPECT_CALL(*server_routing_host_, lazy_load(::testing::_));
+    EXPECT_CALL(*server_routing_host_, on_message).Times(3);
+
+    auto config_msg = create_client_config_command();
+    client->send(&config_msg[0], static_cast<uint32_t>(config_msg.size()));
+    std::vector<std::vector<byte_t>> send_messages;
+    add_offer_service_command(send_messages);
+    add_offer_service_command(send_messages);
+    add_offer_service_command(send_messages);
+    for (auto const& msg : send_messages) {
+        client->send(&msg[0], static_cast<uint32_t>(msg.size()));
+    }
+    io_.poll();
+
+    endpoint_statistics_t its_client_statistics;
+    client->get_statistics(its_client_statistics);
+    EXPECT_TRUE(its_client_statistics.is_local_);
+    EXPECT_EQ(server_, its_client_statistics.peer_);
+    EXPECT_EQ(4u, its_client_statistics.messages_sent_);
+    EXPECT_EQ(config_msg.size() + 3 * send_messages[0].size(), its_client_statistics.bytes_sent_);
+    EXPECT_EQ(0u, its_client_statistics.messages_dropped_);
+    EXPECT_EQ(0u, its_client_statistics.queue_size_);
+    EXPECT_LE(config_msg.size(), its_client_statistics.queue_size_high_water_mark_);
+
+    ASSERT_EQ(1u, server_eps_.size());
+    endpoint_statistics_t its_server_statistics;
+    server_eps_[0]->get_statistics(its_server_statistics);
+    EXPECT_EQ(3u, its_server_statistics.messages_received_);
+    EXPECT_EQ(3 * send_messages[0].size(), its_server_statistics.bytes_received_);
+
+    client->start_flushing();
+    EXPECT_FALSE(client->send(&send_messages[0][0], static_cast<uint32_t>(send_messages[0].size())));
+    client->get_statistics(its_client_statistics);
+    EXPECT_EQ(4u, its_client_statistics.messages_sent_);
+    EXPECT_EQ(1u, its_client_statistics.messages_dropped_);
+}
+
+TEST_F(test_uds_local_endpoint, statistics_count_the_full_size_of_gathered_frames) {
+    auto server = create_server();
+    auto client = create_client_ep();
+    server->start();
+    client->start();
+    io_.poll();
+
+    EXPECT_CALL(*server_routing_host_, lazy_load(::testing::_));
+    auto config_msg = create_client_config_command();
+    client->send(&config_msg[0], static_cast<uint32_t>(config_msg.size()));
+    io_.poll();
+
+    EXPECT_CALL(*server_routing_host_, on_message).Times(1);
+
+    // Frames at the gather threshold are referenced by the send queue, not copied
+    auto its_frame = std::make_shared<const std::vector<byte_t>>(VSOMEIP_LOCAL_GATHER_THRESHOLD + 1, byte_t(0x42));
+    protocol::send_command its_command(protocol::id_e::SEND_ID);
+    its_command.set_client(client_);
+    its_command.set_message(*its_frame);
+    byte_t its_header[protocol::SEND_COMMAND_HEADER_SIZE];
+    its_command.serialize_header(its_header, its_frame->size());
+
+    endpoint_statistics_t its_before;
+    client->get_statistics(its_before);
+    EXPECT_TRUE(client->send(its_header, sizeof(its_header), its_frame));
+    io_.poll();
+
+    endpoint_statistics_t its_after;
+    client->get_statistics(its_after);
+    EXPECT_EQ(1u, its_after.messages_sent_ - its_before.messages_sent_);
+    EXPECT_EQ(sizeof(its_header) + its_frame->size(), its_after.bytes_sent_ - its_before.bytes_sent_);
+}
 }
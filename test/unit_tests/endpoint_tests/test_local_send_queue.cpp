@@ -0,0 +1,101 @@
+// Copyright (C) 2014-2026 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+
+#include <numeric>
+#include <vector>
+
+#include "../../../implementation/endpoints/include/local_send_queue.hpp"
+
+namespace vsomeip_v3::testing {
+
+struct test_local_send_queue : ::testing::Test {
+
+    static local_send_queue::frame_t make_frame(size_t _size, byte_t _first = 0) {
+        auto its_frame = std::make_shared<std::vector<byte_t>>(_size);
+        std::iota(its_frame->begin(), its_frame->end(), _first);
+        return its_frame;
+    }
+
+    // Concatenates the buffers as a gather write would do
+    static std::vector<byte_t> gather(const local_send_queue& _queue) {
+        std::vector<byte_t> its_data;
+        for (const auto& b : _queue.buffers()) {
+            auto const* its_begin = static_cast<const byte_t*>(b.data());
+            its_data.insert(its_data.end(), its_begin, its_begin + b.size());
+        }
+        return its_data;
+    }
+
+    size_t const threshold_{64};
+    local_send_queue queue_{threshold_};
+    std::vector<byte_t> const header_{0xA, 0xB, 0xC};
+};
+
+TEST_F(test_local_send_queue, given_copied_commands_when_getting_buffers_then_a_single_buffer_is_returned) {
+    EXPECT_EQ(header_.size(), queue_.push(header_.data(), header_.size()));
+    EXPECT_EQ(header_.size(), queue_.push(header_.data(), header_.size()));
+
+    ASSERT_EQ(1u, queue_.buffers().size());
+    EXPECT_EQ(2 * header_.size(), queue_.size());
+    EXPECT_EQ(std::vector<byte_t>({0xA, 0xB, 0xC, 0xA, 0xB, 0xC}), gather(queue_));
+}
+
+TEST_F(test_local_send_queue, given_a_large_frame_when_pushing_then_only_the_header_is_copied) {
+    auto its_frame = make_frame(threshold_);
+
+    EXPECT_EQ(header_.size(), queue_.push(header_.data(), header_.size(), its_frame));
+    EXPECT_EQ(header_.size() + its_frame->size(), queue_.size());
+    // frame is referenced, not copied
+    EXPECT_EQ(2, its_frame.use_count());
+
+    auto its_buffers = queue_.buffers();
+    ASSERT_EQ(2u, its_buffers.size());
+    EXPECT_EQ(its_frame->data(), its_buffers[1].data());
+}
+
+TEST_F(test_local_send_queue, given_a_small_frame_when_pushing_then_frame_is_copied) {
+    auto its_frame = make_frame(threshold_ - 1);
+
+    EXPECT_EQ(header_.size() + its_frame->size(), queue_.push(header_.data(), header_.size(), its_frame));
+    EXPECT_EQ(1, its_frame.use_count());
+    EXPECT_EQ(1u, queue_.buffers().size());
+}
+
+TEST_F(test_local_send_queue, given_mixed_commands_when_gathering_then_order_is_kept) {
+    auto its_frame = make_frame(threshold_, 0x10);
+    queue_.push(header_.data(), header_.size(), its_frame);
+    *queue_.extend(1) = 0xFF;
+    queue_.push(header_.data(), header_.size(), its_frame);
+
+    // header | frame | 0xFF, header | frame
+    EXPECT_EQ(4u, queue_.buffers().size());
+
+    std::vector<byte_t> its_expected(header_);
+    its_expected.insert(its_expected.end(), its_frame->begin(), its_frame->end());
+    its_expected.push_back(0xFF);
+    its_expected.insert(its_expected.end(), header_.begin(), header_.end());
+    its_expected.insert(its_expected.end(), its_frame->begin(), its_frame->end());
+    EXPECT_EQ(its_expected, gather(queue_));
+}
+
+TEST_F(test_local_send_queue, given_a_moved_queue_when_getting_buffers_then_data_is_not_moved) {
+    queue_.push(header_.data(), header_.size());
+    auto its_buffers = queue_.buffers();
+
+    local_send_queue its_moved(std::move(queue_));
+    EXPECT_EQ(its_buffers[0].data(), its_moved.buffers()[0].data());
+}
+
+TEST_F(test_local_send_queue, given_a_disabled_threshold_when_pushing_then_frames_are_always_copied) {
+    local_send_queue its_queue{0};
+    auto its_frame = make_frame(1024);
+
+    EXPECT_EQ(header_.size() + its_frame->size(), its_queue.push(header_.data(), header_.size(), its_frame));
+    EXPECT_EQ(1u, its_queue.buffers().size());
+}
+
+} // namespace vsomeip_v3::testing
@@ -0,0 +1,93 @@
+// Copyright (C) 2014-2026 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <random>
+#include <vector>
+
+#include <vsomeip/constants.hpp>
+
+#include "../../../implementation/endpoints/include/magic_cookie_search.hpp"
+
+namespace vsomeip_v3::testing {
+
+struct test_magic_cookie_search : ::testing::Test {
+    static constexpr byte_t service_type_ = static_cast<byte_t>(MAGIC_COOKIE_SERVICE_MESSAGE_TYPE);
+    static constexpr byte_t client_type_ = static_cast<byte_t>(MAGIC_COOKIE_CLIENT_MESSAGE_TYPE);
+
+    static constexpr byte_t service_cookie_[] = {0xFF, 0xFF, MAGIC_COOKIE_SERVICE_MESSAGE, 0x00, 0x00, 0x00, 0x00, 0x08,
+                                                 0xDE, 0xAD, 0xBE, 0xEF, 0x01, 0x01, service_type_, 0x00};
+
+    uint32_t find_service(const std::vector<byte_t>& _data) {
+        return magic_cookie::find(_data.data(), _data.size(), MAGIC_COOKIE_SERVICE_MESSAGE, service_type_);
+    }
+
+    uint32_t find_service_scalar(const std::vector<byte_t>& _data) {
+        return magic_cookie::find_scalar(_data.data(), _data.size(), MAGIC_COOKIE_SERVICE_MESSAGE, service_type_);
+    }
+
+    void put(std::vector<byte_t>& _data, size_t _offset, const byte_t* _cookie = service_cookie_) {
+        std::memcpy(&_data[_offset], _cookie, sizeof(service_cookie_));
+    }
+
+    std::mt19937 random_{42};
+};
+
+TEST_F(test_magic_cookie_search, given_a_cookie_at_any_offset_when_searching_then_offset_is_found) {
+    for (size_t its_size = 17; its_size < 160; ++its_size) {
+        for (size_t its_offset = 0; its_offset + 16 < its_size; ++its_offset) {
+            std::vector<byte_t> its_data(its_size, 0x5A);
+            put(its_data, its_offset);
+            ASSERT_EQ(its_offset, find_service(its_data)) << "size " << its_size;
+            ASSERT_EQ(its_offset, find_service_scalar(its_data)) << "size " << its_size;
+        }
+    }
+}
+
+TEST_F(test_magic_cookie_search, given_a_cookie_at_the_end_of_the_buffer_when_searching_then_it_is_not_reported) {
+    for (size_t its_size = 16; its_size < 100; ++its_size) {
+        std::vector<byte_t> its_data(its_size, 0x00);
+        put(its_data, its_size - 16);
+        EXPECT_EQ(magic_cookie::NOT_FOUND, find_service(its_data));
+    }
+    std::vector<byte_t> its_short(8, 0xFF);
+    EXPECT_EQ(magic_cookie::NOT_FOUND, find_service(its_short));
+    EXPECT_EQ(magic_cookie::NOT_FOUND, magic_cookie::find(nullptr, 0, MAGIC_COOKIE_SERVICE_MESSAGE, service_type_));
+}
+
+TEST_F(test_magic_cookie_search, given_near_misses_before_a_cookie_when_searching_then_first_full_match_is_found) {
+    std::vector<byte_t> its_data(256, 0x00);
+    // anchors match, but the identifier and the last byte differ
+    put(its_data, 3);
+    its_data[3 + 2] = MAGIC_COOKIE_CLIENT_MESSAGE;
+    put(its_data, 40);
+    its_data[40 + 15] = 0x01;
+    put(its_data, 97);
+
+    EXPECT_EQ(97u, find_service(its_data));
+    EXPECT_EQ(3u, magic_cookie::find(its_data.data(), its_data.size(), MAGIC_COOKIE_CLIENT_MESSAGE, service_type_));
+    EXPECT_EQ(magic_cookie::NOT_FOUND, magic_cookie::find(its_data.data(), its_data.size(), MAGIC_COOKIE_CLIENT_MESSAGE, client_type_));
+}
+
+TEST_F(test_magic_cookie_search, given_random_corrupted_streams_when_searching_then_result_equals_reference) {
+    std::uniform_int_distribution<int> its_byte(0, 255);
+    std::uniform_int_distribution<size_t> its_size(0, 2048);
+    for (int its_round = 0; its_round < 500; ++its_round) {
+        std::vector<byte_t> its_data(its_size(random_));
+        for (auto& b : its_data) {
+            // bias towards the anchor bytes to provoke many candidates
+            const auto its_value = its_byte(random_);
+            b = static_cast<byte_t>(its_value < 64 ? 0xFF : its_value < 96 ? 0xDE : its_value < 128 ? 0xEF : its_value);
+        }
+        if (its_data.size() > 16 && its_round % 2 == 0) {
+            put(its_data, std::uniform_int_distribution<size_t>(0, its_data.size() - 17)(random_));
+        }
+        ASSERT_EQ(find_service_scalar(its_data), find_service(its_data)) << magic_cookie::get_implementation();
+    }
+}
+
+} // namespace vsomeip_v3::testing
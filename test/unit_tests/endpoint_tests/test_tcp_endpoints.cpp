@@ -0,0 +1,200 @@
+// Copyright (C) 2014-2026 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "base_endpoint_fixture.hpp"
+#include "mock_boardnet_hosts.hpp"
+
+#include "../../../implementation/configuration/include/configuration_impl.hpp"
+#include "../../../implementation/endpoints/include/asio_socket_factory.hpp"
+#include "../../../implementation/endpoints/include/auxiliary_context.hpp"
+#include "../../../implementation/endpoints/include/endpoint_definition.hpp"
+#include "../../../implementation/endpoints/include/tcp_client_endpoint_impl.hpp"
+#include "../../../implementation/endpoints/include/tcp_server_endpoint_impl.hpp"
+#include "../../../implementation/utility/include/bithelper.hpp"
+
+#include <boost/asio/executor_work_guard.hpp>
+#include <boost/asio/ip/tcp.hpp>
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace vsomeip_v3::testing {
+using namespace std::chrono_literals;
+
+namespace {
+
+constexpr service_t service_{0x1234};
+constexpr instance_t instance_{0x0001};
+constexpr method_t method_{0x0001};
+
+const boost::asio::ip::address localhost_{boost::asio::ip::make_address("127.0.0.1")};
+
+std::vector<byte_t> make_message(message_type_e _type, std::size_t _payload_size) {
+    std::vector<byte_t> its_message(VSOMEIP_FULL_HEADER_SIZE + _payload_size, 0);
+    bithelper::write_uint16_be(service_, &its_message[VSOMEIP_SERVICE_POS_MIN]);
+    bithelper::write_uint16_be(method_, &its_message[VSOMEIP_METHOD_POS_MIN]);
+    bithelper::write_uint32_be(static_cast<std::uint32_t>(_payload_size + VSOMEIP_SOMEIP_HEADER_SIZE),
+                               &its_message[VSOMEIP_LENGTH_POS_MIN]);
+    its_message[VSOMEIP_PROTOCOL_VERSION_POS] = VSOMEIP_PROTOCOL_VERSION;
+    its_message[VSOMEIP_MESSAGE_TYPE_POS] = static_cast<byte_t>(_type);
+    return its_message;
+}
+
+std::uint16_t get_free_port(boost::asio::io_context& _io) {
+    boost::asio::ip::tcp::acceptor its_acceptor(_io, boost::asio::ip::tcp::endpoint(localhost_, 0));
+    return its_acceptor.local_endpoint().port();
+}
+
+/**
+ * Counts the calls of a mocked host and remembers the last remote port.
+ **/
+class call_counter {
+public:
+    void add(port_t _remote_port = 0) {
+        {
+            std::scoped_lock its_lock(mutex_);
+            ++count_;
+            remote_port_ = _remote_port;
+        }
+        cv_.notify_all();
+    }
+
+    [[nodiscard]] bool wait_for(std::size_t _count, std::chrono::milliseconds _timeout = 5s) {
+        std::unique_lock its_lock(mutex_);
+        return cv_.wait_for(its_lock, _timeout, [this, _count] { return count_ >= _count; });
+    }
+
+    port_t get_remote_port() {
+        std::scoped_lock its_lock(mutex_);
+        return remote_port_;
+    }
+
+private:
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::size_t count_{0};
+    port_t remote_port_{0};
+};
+
+} // namespace
+
+struct test_tcp_endpoints : base_endpoint_fixture {
+    test_tcp_endpoints() {
+        delegate_->impl_ = std::make_shared<asio_socket_factory>();
+
+        static constexpr char const* path = "tcp_endpoints_config.json";
+        configuration_ = std::make_shared<vsomeip_v3::cfg::configuration_impl>(path);
+        configuration_->set_configuration_path(path);
+        configuration_->load("stub");
+
+        ON_CALL(*server_endpoint_host_, find_instance).WillByDefault(::testing::Return(instance_));
+        ON_CALL(*client_endpoint_host_, find_instance).WillByDefault(::testing::Return(instance_));
+        ON_CALL(*client_endpoint_host_, on_connect).WillByDefault([this](std::shared_ptr<boardnet_endpoint> _endpoint) {
+            _endpoint->set_established(true);
+            connected_.add();
+        });
+        ON_CALL(*server_routing_host_, on_message)
+                .WillByDefault([this](const byte_t*, length_t, boardnet_endpoint*, const boost::asio::ip::address&, port_t _remote_port,
+                                      bool) { server_received_.add(_remote_port); });
+        ON_CALL(*client_routing_host_, on_message).WillByDefault([this](auto&&...) { client_received_.add(); });
+    }
+
+    void SetUp() override {
+        auxiliary_.start();
+        for (int i = 0; i < 2; ++i) {
+            io_threads_.emplace_back([this] { io_.run(); });
+        }
+
+        const auto its_port = get_free_port(io_);
+        server_ = std::make_shared<tcp_server_endpoint_impl>(server_endpoint_host_, server_routing_host_, io_, configuration_, auxiliary_,
+                                                             false);
+        boost::system::error_code its_error;
+        server_->init(boost::asio::ip::tcp::endpoint(localhost_, its_port), its_error);
+        ASSERT_FALSE(its_error) << its_error.message();
+        server_->start();
+
+        client_ = std::make_shared<tcp_client_endpoint_impl>(client_endpoint_host_, client_routing_host_,
+                                                             boost::asio::ip::tcp::endpoint(localhost_, 0),
+                                                             boost::asio::ip::tcp::endpoint(localhost_, its_port), io_,
+                                                             configuration_, false);
+        client_->start();
+    }
+
+    void TearDown() override {
+        if (client_) {
+            client_->stop(false);
+        }
+        if (server_) {
+            server_->stop(false);
+        }
+        work_guard_.reset();
+        io_.stop();
+        for (auto& t : io_threads_) {
+            t.join();
+        }
+        auxiliary_.stop();
+    }
+
+    boost::asio::io_context io_;
+    boost::asio::executor_work_guard<boost::asio::io_context::executor_type> work_guard_{io_.get_executor()};
+    std::vector<std::thread> io_threads_;
+    auxiliary_context auxiliary_{0};
+
+    std::shared_ptr<::testing::NiceMock<mock_boardnet_endpoint_host>> server_endpoint_host_{
+            std::make_shared<::testing::NiceMock<mock_boardnet_endpoint_host>>()};
+    std::shared_ptr<::testing::NiceMock<mock_boardnet_routing_host>> server_routing_host_{
+            std::make_shared<::testing::NiceMock<mock_boardnet_routing_host>>()};
+    std::shared_ptr<::testing::NiceMock<mock_boardnet_endpoint_host>> client_endpoint_host_{
+            std::make_shared<::testing::NiceMock<mock_boardnet_endpoint_host>>()};
+    std::shared_ptr<::testing::NiceMock<mock_boardnet_routing_host>> client_routing_host_{
+            std::make_shared<::testing::NiceMock<mock_boardnet_routing_host>>()};
+    std::shared_ptr<configuration> configuration_;
+    std::shared_ptr<tcp_server_endpoint_impl> server_;
+    std::shared_ptr<tcp_client_endpoint_impl> client_;
+
+    call_counter connected_;
+    call_counter server_received_;
+    call_counter client_received_;
+};
+
+TEST_F(test_tcp_endpoints, sent_and_received_messages_are_counted) {
+    ASSERT_TRUE(connected_.wait_for(1));
+
+    const auto its_request = make_message(message_type_e::MT_REQUEST, 8);
+    const auto its_response = make_message(message_type_e::MT_RESPONSE, 100);
+
+    EXPECT_TRUE(client_->send(its_request.data(), static_cast<std::uint32_t>(its_request.size())));
+    EXPECT_TRUE(client_->send(its_request.data(), static_cast<std::uint32_t>(its_request.size())));
+    ASSERT_TRUE(server_received_.wait_for(2));
+
+    const auto its_client = endpoint_definition::get(localhost_, server_received_.get_remote_port(), true, service_, instance_);
+    EXPECT_TRUE(server_->send_to(its_client, its_response.data(), static_cast<std::uint32_t>(its_response.size())));
+    ASSERT_TRUE(client_received_.wait_for(1));
+
+    endpoint_statistics_t its_client_statistics;
+    client_->get_statistics(its_client_statistics);
+    EXPECT_TRUE(its_client_statistics.is_reliable_);
+    EXPECT_TRUE(its_client_statistics.is_client_);
+    EXPECT_EQ(2u, its_client_statistics.messages_sent_);
+    EXPECT_EQ(2 * its_request.size(), its_client_statistics.bytes_sent_);
+    EXPECT_EQ(1u, its_client_statistics.messages_received_);
+    EXPECT_EQ(its_response.size(), its_client_statistics.bytes_received_);
+    EXPECT_EQ(0u, its_client_statistics.messages_dropped_);
+
+    endpoint_statistics_t its_server_statistics;
+    server_->get_statistics(its_server_statistics);
+    EXPECT_TRUE(its_server_statistics.is_reliable_);
+    EXPECT_FALSE(its_server_statistics.is_client_);
+    EXPECT_EQ(1u, its_server_statistics.messages_sent_);
+    EXPECT_EQ(its_response.size(), its_server_statistics.bytes_sent_);
+    EXPECT_EQ(2u, its_server_statistics.messages_received_);
+    EXPECT_EQ(2 * its_request.size(), its_server_statistics.bytes_received_);
+    EXPECT_EQ(0u, its_server_statistics.messages_dropped_);
+}
+
+} // namespace vsomeip_v3::testing
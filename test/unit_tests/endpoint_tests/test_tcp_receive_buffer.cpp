@@ -0,0 +1,121 @@
+// Copyright (C) 2014-2026 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <numeric>
+#include <vector>
+
+#include "../../../implementation/endpoints/include/tcp_receive_buffer.hpp"
+
+namespace vsomeip_v3::testing {
+
+struct test_tcp_receive_buffer : ::testing::Test {
+
+    // Simulates a receive of (at most) _size bytes from _data
+    size_t receive(uint8_t const* _data, size_t _size) {
+        auto its_buffer = buf_.buffer();
+        auto const its_length = std::min(_size, its_buffer.size());
+        std::memcpy(its_buffer.data(), _data, its_length);
+        EXPECT_TRUE(buf_.bump_end(its_length));
+        return its_length;
+    }
+
+    static std::vector<uint8_t> make_data(size_t _size) {
+        std::vector<uint8_t> its_data(_size);
+        std::iota(its_data.begin(), its_data.end(), uint8_t(0));
+        return its_data;
+    }
+
+    size_t const chunk_size_{64};
+    uint32_t const shrink_threshold_{2};
+    tcp_receive_buffer buf_{chunk_size_, shrink_threshold_};
+};
+
+TEST_F(test_tcp_receive_buffer, given_an_empty_buffer_when_getting_buffer_then_whole_chunk_is_returned) {
+    EXPECT_EQ(0u, buf_.size());
+    EXPECT_EQ(chunk_size_, buf_.capacity());
+    EXPECT_EQ(chunk_size_, buf_.buffer().size());
+}
+
+TEST_F(test_tcp_receive_buffer, given_multiple_messages_when_consuming_then_data_is_handed_out_in_place) {
+    auto its_data = make_data(30);
+    ASSERT_EQ(30u, receive(its_data.data(), its_data.size()));
+
+    auto const* its_first = buf_.data();
+    buf_.consume(10);
+    EXPECT_EQ(its_first + 10, buf_.data());
+    EXPECT_EQ(20u, buf_.size());
+    EXPECT_EQ(10, buf_.data()[0]);
+
+    // the free space behind the data is still available without moving
+    EXPECT_EQ(chunk_size_ - 30, buf_.buffer().size());
+
+    buf_.consume(20);
+    EXPECT_EQ(0u, buf_.size());
+    // an empty buffer restarts at the front
+    EXPECT_EQ(chunk_size_, buf_.buffer().size());
+}
+
+TEST_F(test_tcp_receive_buffer, given_a_message_cut_at_the_end_of_the_chunk_when_preparing_then_data_is_moved_to_front) {
+    auto its_data = make_data(chunk_size_);
+    ASSERT_EQ(chunk_size_, receive(its_data.data(), its_data.size()));
+    buf_.consume(50);
+
+    // 14 bytes received of a 30 bytes message
+    buf_.prepare(16);
+    EXPECT_EQ(chunk_size_, buf_.capacity());
+    EXPECT_EQ(14u, buf_.size());
+    EXPECT_EQ(50, buf_.data()[0]);
+    EXPECT_EQ(chunk_size_ - 14, buf_.buffer().size());
+}
+
+TEST_F(test_tcp_receive_buffer, given_a_large_message_when_preparing_then_a_right_sized_allocation_is_used) {
+    auto its_data = make_data(200);
+    ASSERT_EQ(chunk_size_, receive(its_data.data(), its_data.size()));
+
+    buf_.prepare(200 - chunk_size_);
+    EXPECT_EQ(200u, buf_.capacity());
+    EXPECT_EQ(200u - chunk_size_, buf_.buffer().size());
+    ASSERT_EQ(200u - chunk_size_, receive(its_data.data() + chunk_size_, 200 - chunk_size_));
+
+    ASSERT_EQ(200u, buf_.size());
+    EXPECT_EQ(0, std::memcmp(its_data.data(), buf_.data(), its_data.size()));
+    buf_.consume(200);
+}
+
+TEST_F(test_tcp_receive_buffer, given_a_large_allocation_when_consuming_small_messages_then_the_chunk_is_restored) {
+    auto its_data = make_data(200);
+    receive(its_data.data(), its_data.size());
+    buf_.prepare(200 - chunk_size_);
+    receive(its_data.data() + chunk_size_, 200 - chunk_size_);
+    buf_.consume(200);
+    EXPECT_EQ(200u, buf_.capacity());
+
+    for (uint32_t i = 0; i <= shrink_threshold_; ++i) {
+        EXPECT_EQ(200u, buf_.capacity());
+        receive(its_data.data(), 8);
+        buf_.consume(8);
+    }
+    EXPECT_EQ(chunk_size_, buf_.capacity());
+}
+
+TEST_F(test_tcp_receive_buffer, given_a_filled_buffer_when_resetting_then_buffer_is_empty) {
+    auto its_data = make_data(200);
+    receive(its_data.data(), its_data.size());
+    buf_.prepare(200 - chunk_size_);
+
+    buf_.reset();
+    EXPECT_EQ(0u, buf_.size());
+    EXPECT_EQ(chunk_size_, buf_.capacity());
+}
+
+TEST_F(test_tcp_receive_buffer, given_bump_beyond_capacity_when_calling_bump_end_then_false_returned) {
+    EXPECT_FALSE(buf_.bump_end(chunk_size_ + 1));
+    EXPECT_TRUE(buf_.bump_end(chunk_size_));
+}
+
+} // namespace vsomeip_v3::testing
@@ -0,0 +1,89 @@
+// Copyright (C) 2014-2026 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+
+#include "../../../implementation/endpoints/include/tp_pacer.hpp"
+
+namespace vsomeip_v3::testing {
+using namespace std::chrono_literals;
+
+struct test_tp_pacer : ::testing::Test {
+    using pacer_t = tp::tp_pacer<int>;
+
+    pacer_t pacer_;
+    pacer_t::clock_type::time_point const start_{pacer_t::clock_type::now()};
+};
+
+TEST_F(test_tp_pacer, given_no_previous_segment_when_asking_for_release_time_then_segment_may_be_sent_immediately) {
+    EXPECT_EQ(pacer_t::clock_type::time_point(), pacer_.get_release_time(1, 100));
+}
+
+TEST_F(test_tp_pacer, given_a_sent_segment_when_asking_for_release_time_then_separation_time_is_respected_per_target) {
+    pacer_.on_sent(1, 100, start_);
+
+    EXPECT_EQ(start_ + 100us, pacer_.get_release_time(1, 100));
+    // other targets are not affected
+    EXPECT_EQ(pacer_t::clock_type::time_point(), pacer_.get_release_time(2, 100));
+    // entries without separation time are never delayed
+    EXPECT_EQ(pacer_t::clock_type::time_point(), pacer_.get_release_time(1, 0));
+}
+
+TEST_F(test_tp_pacer, given_an_unpaced_segment_when_asking_for_release_time_then_paced_sequence_is_restarted) {
+    pacer_.on_sent(1, 100, start_);
+    pacer_.on_sent(1, 0, start_ + 10us);
+
+    EXPECT_EQ(pacer_t::clock_type::time_point(), pacer_.get_release_time(1, 100));
+}
+
+TEST_F(test_tp_pacer, given_deferred_targets_when_popping_then_targets_are_served_in_deadline_order) {
+    pacer_.defer(1, start_ + 300us);
+    pacer_.defer(2, start_ + 100us);
+    pacer_.defer(3, start_ + 200us);
+
+    ASSERT_TRUE(pacer_.get_next_deadline());
+    EXPECT_EQ(start_ + 100us, *pacer_.get_next_deadline());
+
+    int its_key{0};
+    EXPECT_FALSE(pacer_.pop_due(start_, its_key));
+
+    ASSERT_TRUE(pacer_.pop_due(start_ + 250us, its_key));
+    EXPECT_EQ(2, its_key);
+    ASSERT_TRUE(pacer_.pop_due(start_ + 250us, its_key));
+    EXPECT_EQ(3, its_key);
+    EXPECT_FALSE(pacer_.pop_due(start_ + 250us, its_key));
+
+    ASSERT_TRUE(pacer_.pop_due(start_ + 300us, its_key));
+    EXPECT_EQ(1, its_key);
+    EXPECT_FALSE(pacer_.has_deferred());
+    EXPECT_EQ(3u, pacer_.get_statistics().deferred_segments_);
+}
+
+TEST_F(test_tp_pacer, given_a_removed_target_when_popping_then_target_is_not_served) {
+    pacer_.on_sent(1, 100, start_);
+    pacer_.defer(1, start_ + 100us);
+    pacer_.remove(1);
+
+    int its_key{0};
+    EXPECT_FALSE(pacer_.pop_due(start_ + 1s, its_key));
+    EXPECT_EQ(pacer_t::clock_type::time_point(), pacer_.get_release_time(1, 100));
+}
+
+TEST_F(test_tp_pacer, given_paced_segments_when_reading_statistics_then_achieved_gaps_are_reported) {
+    pacer_.on_sent(1, 100, start_);
+    pacer_.on_sent(1, 100, start_ + 100us);
+    pacer_.on_sent(1, 100, start_ + 250us);
+    pacer_.on_sent(2, 100, start_ + 260us);
+
+    auto const& its_statistics = pacer_.get_statistics();
+    EXPECT_EQ(4u, its_statistics.paced_segments_);
+    EXPECT_EQ(2u, its_statistics.gaps_);
+    EXPECT_EQ(100us, its_statistics.min_gap_);
+    EXPECT_EQ(150us, its_statistics.max_gap_);
+    EXPECT_EQ(125us, its_statistics.get_average_gap());
+    EXPECT_EQ(50us, its_statistics.max_overshoot_);
+}
+
+} // namespace vsomeip_v3::testing
@@ -0,0 +1,165 @@
+// Copyright (C) 2014-2026 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <deque>
+#include <thread>
+#include <vector>
+
+#include "../../../implementation/endpoints/include/buffer.hpp"
+
+namespace vsomeip_v3::testing {
+
+TEST(test_train, passengers_are_only_added_once) {
+    train its_train;
+    its_train.add_passenger(0x1234, 0x8001);
+    its_train.add_passenger(0x1234, 0x8001);
+    its_train.add_passenger(0x1234, 0x8002);
+
+    EXPECT_EQ(2u, its_train.passengers_.size());
+    EXPECT_TRUE(its_train.has_passenger(0x1234, 0x8001));
+    EXPECT_TRUE(its_train.has_passenger(0x1234, 0x8002));
+    EXPECT_FALSE(its_train.has_passenger(0x8001, 0x1234));
+}
+
+TEST(test_train_pool, buffers_are_reused_once_they_were_sent) {
+    train_pool its_pool;
+    std::deque<message_buffer_ptr_t> its_queue;
+
+    auto its_train = its_pool.get();
+    its_train->buffer_->assign(100, 0x42);
+    auto* its_first_buffer = its_train->buffer_.get();
+
+    // the buffer is queued, the train departs
+    its_queue.push_back(its_train->buffer_);
+    its_pool.reset(*its_train);
+    EXPECT_NE(its_first_buffer, its_train->buffer_.get());
+    EXPECT_TRUE(its_train->buffer_->empty());
+    EXPECT_TRUE(its_train->passengers_.empty());
+
+    // the queued buffer was sent
+    its_queue.pop_front();
+    its_queue.push_back(its_train->buffer_);
+    its_pool.reset(*its_train);
+    EXPECT_EQ(its_first_buffer, its_train->buffer_.get());
+    EXPECT_TRUE(its_train->buffer_->empty());
+    EXPECT_GE(its_train->buffer_->capacity(), 100u);
+}
+
+TEST(test_train_pool, released_trains_are_reused) {
+    train_pool its_pool;
+
+    auto its_train = its_pool.get();
+    its_train->add_passenger(0x1234, 0x8001);
+    auto* its_first_train = its_train.get();
+
+    its_pool.release(std::move(its_train));
+
+    auto its_next_train = its_pool.get();
+    EXPECT_EQ(its_first_train, its_next_train.get());
+    EXPECT_TRUE(its_next_train->passengers_.empty());
+    ASSERT_TRUE(its_next_train->buffer_);
+    EXPECT_TRUE(its_next_train->buffer_->empty());
+}
+
+TEST(test_dispatched_trains, trains_are_ordered_by_departure) {
+    dispatched_trains its_trains;
+    const auto its_now = std::chrono::steady_clock::now();
+
+    auto its_late = std::make_shared<train>();
+    its_late->departure_ = its_now + std::chrono::milliseconds(10);
+    auto its_early = std::make_shared<train>();
+    its_early->departure_ = its_now + std::chrono::milliseconds(1);
+    auto its_early_too = std::make_shared<train>();
+    its_early_too->departure_ = its_early->departure_;
+
+    its_trains.push(its_late);
+    its_trains.push(its_early);
+    its_trains.push(its_early_too);
+    ASSERT_EQ(3u, its_trains.size());
+
+    // trains with the same departure keep their order
+    EXPECT_EQ(its_early, its_trains.pop());
+    EXPECT_EQ(its_early_too, its_trains.pop());
+    EXPECT_EQ(its_late, its_trains.front());
+    EXPECT_EQ(its_late, its_trains.pop());
+    EXPECT_TRUE(its_trains.empty());
+}
+
+TEST(test_npdu_timings, timings_are_loaded_once) {
+    npdu_timings its_timings;
+    int its_loads(0);
+    auto its_loader = [&its_loads](std::chrono::nanoseconds* _debounce, std::chrono::nanoseconds* _retention) {
+        its_loads++;
+        *_debounce = std::chrono::milliseconds(2);
+        *_retention = std::chrono::milliseconds(5);
+    };
+
+    std::chrono::nanoseconds its_debouncing(0), its_retention(0);
+    its_timings.get(0x1234, 0x8001, 0, its_debouncing, its_retention, its_loader);
+    its_timings.get(0x1234, 0x8001, 0, its_debouncing, its_retention, its_loader);
+    EXPECT_EQ(1, its_loads);
+    EXPECT_EQ(std::chrono::milliseconds(2), its_debouncing);
+    EXPECT_EQ(std::chrono::milliseconds(5), its_retention);
+
+    its_timings.get(0x1234, 0x8002, 0, its_debouncing, its_retention, its_loader);
+    EXPECT_EQ(2, its_loads);
+}
+
+TEST(test_npdu_timings, timings_are_reloaded_for_a_new_generation) {
+    npdu_timings its_timings;
+    std::chrono::milliseconds its_configured(2);
+    int its_loads(0);
+    auto its_loader = [&its_loads, &its_configured](std::chrono::nanoseconds* _debounce, std::chrono::nanoseconds* _retention) {
+        its_loads++;
+        *_debounce = its_configured;
+        *_retention = its_configured;
+    };
+
+    std::chrono::nanoseconds its_debouncing(0), its_retention(0);
+    its_timings.get(0x1234, 0x8001, 0, its_debouncing, its_retention, its_loader);
+    its_timings.get(0x1234, 0x8002, 0, its_debouncing, its_retention, its_loader);
+    EXPECT_EQ(2, its_loads);
+
+    // The services were changed, e.g. by a remote offer
+    its_configured = std::chrono::milliseconds(3);
+    its_timings.get(0x1234, 0x8001, 1, its_debouncing, its_retention, its_loader);
+    EXPECT_EQ(3, its_loads);
+    EXPECT_EQ(std::chrono::milliseconds(3), its_debouncing);
+    its_timings.get(0x1234, 0x8002, 1, its_debouncing, its_retention, its_loader);
+    its_timings.get(0x1234, 0x8002, 1, its_debouncing, its_retention, its_loader);
+    EXPECT_EQ(4, its_loads);
+    EXPECT_EQ(std::chrono::milliseconds(3), its_retention);
+}
+
+TEST(test_npdu_timings, concurrent_senders_load_the_timings_once) {
+    npdu_timings its_timings;
+    std::atomic<int> its_loads(0);
+    auto its_loader = [&its_loads](std::chrono::nanoseconds* _debounce, std::chrono::nanoseconds* _retention) {
+        its_loads++;
+        *_debounce = std::chrono::milliseconds(2);
+        *_retention = std::chrono::milliseconds(5);
+    };
+
+    std::vector<std::thread> its_senders;
+    for (int i = 0; i < 4; ++i) {
+        its_senders.emplace_back([&its_timings, &its_loader] {
+            for (method_t its_method = 0x8001; its_method <= 0x8010; ++its_method) {
+                std::chrono::nanoseconds its_debouncing(0), its_retention(0);
+                its_timings.get(0x1234, its_method, 0, its_debouncing, its_retention, its_loader);
+                EXPECT_EQ(std::chrono::milliseconds(2), its_debouncing);
+                EXPECT_EQ(std::chrono::milliseconds(5), its_retention);
+            }
+        });
+    }
+    for (auto& its_sender : its_senders) {
+        its_sender.join();
+    }
+    EXPECT_EQ(16, its_loads);
+}
+
+} // namespace vsomeip_v3::testing
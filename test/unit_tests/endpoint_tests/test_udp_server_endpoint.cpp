@@ -0,0 +1,377 @@
+// Copyright (C) 2014-2026 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "base_endpoint_fixture.hpp"
+#include "mock_boardnet_hosts.hpp"
+
+#include "../../../implementation/configuration/include/configuration_impl.hpp"
+#include "../../../implementation/endpoints/include/asio_socket_factory.hpp"
+#include "../../../implementation/endpoints/include/endpoint_definition.hpp"
+#include "../../../implementation/endpoints/include/tp.hpp"
+#include "../../../implementation/endpoints/include/udp_server_endpoint_impl.hpp"
+#include "../../../implementation/utility/include/bithelper.hpp"
+
+#include <boost/asio/executor_work_guard.hpp>
+#include <boost/asio/ip/udp.hpp>
+
+#include <array>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <numeric>
+#include <thread>
+#include <vector>
+
+namespace vsomeip_v3::testing {
+using namespace std::chrono_literals;
+
+namespace {
+
+constexpr service_t service_{0x1234};
+constexpr instance_t instance_{0x0001};
+// sent as is
+constexpr method_t event_{0x8001};
+// configured for SOME/IP-TP with a separation time of 1ms
+constexpr method_t tp_event_{0x8002};
+constexpr std::uint16_t max_segment_length_{1392};
+
+const boost::asio::ip::address localhost_{boost::asio::ip::make_address("127.0.0.1")};
+
+std::vector<byte_t> make_notification(method_t _method, std::uint32_t _sequence, std::size_t _payload_size) {
+    std::vector<byte_t> its_message(VSOMEIP_FULL_HEADER_SIZE + _payload_size, 0);
+    bithelper::write_uint16_be(service_, &its_message[VSOMEIP_SERVICE_POS_MIN]);
+    bithelper::write_uint16_be(_method, &its_message[VSOMEIP_METHOD_POS_MIN]);
+    bithelper::write_uint32_be(static_cast<std::uint32_t>(_payload_size + VSOMEIP_SOMEIP_HEADER_SIZE),
+                               &its_message[VSOMEIP_LENGTH_POS_MIN]);
+    bithelper::write_uint16_be(static_cast<session_t>(_sequence), &its_message[VSOMEIP_SESSION_POS_MIN]);
+    its_message[VSOMEIP_PROTOCOL_VERSION_POS] = VSOMEIP_PROTOCOL_VERSION;
+    its_message[VSOMEIP_MESSAGE_TYPE_POS] = static_cast<byte_t>(message_type_e::MT_NOTIFICATION);
+    bithelper::write_uint32_be(_sequence, &its_message[VSOMEIP_PAYLOAD_POS]);
+    return its_message;
+}
+
+/**
+ * Loopback socket acting as a remote client of the endpoint.
+ **/
+class udp_receiver {
+public:
+    explicit udp_receiver(boost::asio::io_context& _io) : socket_(_io, boost::asio::ip::udp::endpoint(localhost_, 0)) {
+        socket_.set_option(boost::asio::socket_base::receive_buffer_size(1024 * 1024));
+        receive();
+    }
+
+    std::shared_ptr<endpoint_definition> get_target() const {
+        return endpoint_definition::get(localhost_, socket_.local_endpoint().port(), false, service_, instance_);
+    }
+
+    [[nodiscard]] bool wait_for(std::size_t _count, std::chrono::milliseconds _timeout = 5s) {
+        std::unique_lock its_lock(mutex_);
+        return cv_.wait_for(its_lock, _timeout, [this, _count] { return received_.size() >= _count; });
+    }
+
+    std::vector<std::vector<byte_t>> get_received() {
+        std::scoped_lock its_lock(mutex_);
+        return received_;
+    }
+
+    void send(std::uint16_t _port, const std::vector<byte_t>& _message) {
+        socket_.send_to(boost::asio::buffer(_message), boost::asio::ip::udp::endpoint(localhost_, _port));
+    }
+
+    void close() {
+        boost::system::error_code its_error;
+        socket_.close(its_error);
+    }
+
+private:
+    void receive() {
+        socket_.async_receive(boost::asio::buffer(buffer_), [this](const boost::system::error_code& _error, std::size_t _bytes) {
+            if (_error) {
+                return;
+            }
+            {
+                std::scoped_lock its_lock(mutex_);
+                received_.emplace_back(buffer_.begin(), buffer_.begin() + static_cast<std::ptrdiff_t>(_bytes));
+            }
+            cv_.notify_all();
+            receive();
+        });
+    }
+
+    boost::asio::ip::udp::socket socket_;
+    std::array<byte_t, VSOMEIP_MAX_UDP_MESSAGE_SIZE> buffer_;
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::vector<std::vector<byte_t>> received_;
+};
+
+// The endpoint reports the configured port, thus it is bound to a known free one
+std::uint16_t get_free_port(boost::asio::io_context& _io) {
+    boost::asio::ip::udp::socket its_socket(_io, boost::asio::ip::udp::endpoint(localhost_, 0));
+    return its_socket.local_endpoint().port();
+}
+
+std::vector<std::uint32_t> get_sequences(const std::vector<std::vector<byte_t>>& _messages, method_t _method) {
+    std::vector<std::uint32_t> its_sequences;
+    for (const auto& m : _messages) {
+        if (bithelper::read_uint16_be(&m[VSOMEIP_METHOD_POS_MIN]) == _method) {
+            its_sequences.push_back(bithelper::read_uint32_be(&m[VSOMEIP_PAYLOAD_POS]));
+        }
+    }
+    return its_sequences;
+}
+
+} // namespace
+
+/**
+ * Gives the tests access to the targets of the endpoint.
+ **/
+class udp_server_endpoint_under_test : public udp_server_endpoint_impl {
+public:
+    using udp_server_endpoint_impl::udp_server_endpoint_impl;
+
+    bool has_target(const std::shared_ptr<endpoint_definition>& _target) {
+        return find_locked_target({_target->get_address(), _target->get_port()}).has_value();
+    }
+};
+
+struct test_udp_server_endpoint : base_endpoint_fixture {
+    test_udp_server_endpoint() {
+        delegate_->impl_ = std::make_shared<asio_socket_factory>();
+
+        static constexpr char const* path = "udp_server_endpoint_config.json";
+        configuration_ = std::make_shared<vsomeip_v3::cfg::configuration_impl>(path);
+        configuration_->set_configuration_path(path);
+        configuration_->load("stub");
+
+        ON_CALL(*endpoint_host_, find_instance).WillByDefault(::testing::Return(instance_));
+    }
+
+    void SetUp() override {
+        endpoint_ = std::make_shared<udp_server_endpoint_under_test>(endpoint_host_, routing_host_, io_, configuration_);
+
+        boost::system::error_code its_error;
+        endpoint_->init(boost::asio::ip::udp::endpoint(localhost_, get_free_port(io_)), its_error);
+        ASSERT_FALSE(its_error) << its_error.message();
+        endpoint_->start();
+
+        // sending and receiving are completed concurrently
+        for (int i = 0; i < 2; ++i) {
+            io_threads_.emplace_back([this] { io_.run(); });
+        }
+    }
+
+    void TearDown() override {
+        for (auto& r : receivers_) {
+            r->close();
+        }
+        if (endpoint_) {
+            endpoint_->stop(false);
+        }
+        work_guard_.reset();
+        io_.stop();
+        for (auto& t : io_threads_) {
+            t.join();
+        }
+    }
+
+    udp_receiver& add_receiver() { return *receivers_.emplace_back(std::make_unique<udp_receiver>(io_)); }
+
+    bool send(const std::shared_ptr<endpoint_definition>& _target, const std::vector<byte_t>& _message) {
+        return endpoint_->send_to(_target, _message.data(), static_cast<uint32_t>(_message.size()));
+    }
+
+    boost::asio::io_context io_;
+    boost::asio::executor_work_guard<boost::asio::io_context::executor_type> work_guard_{io_.get_executor()};
+    std::vector<std::thread> io_threads_;
+
+    std::shared_ptr<::testing::NiceMock<mock_boardnet_endpoint_host>> endpoint_host_{
+            std::make_shared<::testing::NiceMock<mock_boardnet_endpoint_host>>()};
+    std::shared_ptr<::testing::NiceMock<mock_boardnet_routing_host>> routing_host_{
+            std::make_shared<::testing::NiceMock<mock_boardnet_routing_host>>()};
+    std::shared_ptr<configuration> configuration_;
+    std::shared_ptr<udp_server_endpoint_under_test> endpoint_;
+    std::vector<std::unique_ptr<udp_receiver>> receivers_;
+};
+
+TEST_F(test_udp_server_endpoint, parallel_sends_to_different_targets_reach_every_target_in_order) {
+    constexpr std::size_t its_target_count{4};
+    constexpr std::uint32_t its_message_count{100};
+
+    std::vector<udp_receiver*> its_receivers;
+    for (std::size_t i = 0; i < its_target_count; ++i) {
+        its_receivers.push_back(&add_receiver());
+    }
+
+    std::vector<std::thread> its_senders;
+    for (auto* r : its_receivers) {
+        its_senders.emplace_back([this, its_target = r->get_target()] {
+            for (std::uint32_t i = 0; i < its_message_count; ++i) {
+                EXPECT_TRUE(send(its_target, make_notification(event_, i, 8)));
+            }
+        });
+    }
+    for (auto& t : its_senders) {
+        t.join();
+    }
+
+    std::vector<std::uint32_t> its_expected(its_message_count);
+    std::iota(its_expected.begin(), its_expected.end(), 0);
+    for (auto* r : its_receivers) {
+        ASSERT_TRUE(r->wait_for(its_message_count));
+        EXPECT_EQ(its_expected, get_sequences(r->get_received(), event_));
+    }
+
+    endpoint_statistics_t its_statistics;
+    endpoint_->get_statistics(its_statistics);
+    EXPECT_EQ(its_target_count * its_message_count, its_statistics.messages_sent_);
+    EXPECT_EQ(0u, its_statistics.messages_dropped_);
+}
+
+TEST_F(test_udp_server_endpoint, removing_a_target_while_sending_to_it_does_not_stall_other_targets) {
+    constexpr std::uint32_t its_message_count{100};
+
+    auto& its_receiver = add_receiver();
+    auto its_target = its_receiver.get_target();
+    // Sending to port 0 fails, the failed send removes the target while
+    // the other threads keep sending to it and to the receiving target.
+    auto its_failing_target = endpoint_definition::get(localhost_, 0, false, service_, instance_);
+
+    std::vector<std::thread> its_senders;
+    for (int i = 0; i < 2; ++i) {
+        its_senders.emplace_back([this, its_failing_target] {
+            for (std::uint32_t i = 0; i < its_message_count; ++i) {
+                (void)send(its_failing_target, make_notification(event_, i, 8));
+            }
+        });
+    }
+    its_senders.emplace_back([this, its_target] {
+        for (std::uint32_t i = 0; i < its_message_count; ++i) {
+            EXPECT_TRUE(send(its_target, make_notification(event_, i, 8)));
+        }
+    });
+    for (auto& t : its_senders) {
+        t.join();
+    }
+
+    ASSERT_TRUE(its_receiver.wait_for(its_message_count));
+    std::vector<std::uint32_t> its_expected(its_message_count);
+    std::iota(its_expected.begin(), its_expected.end(), 0);
+    EXPECT_EQ(its_expected, get_sequences(its_receiver.get_received(), event_));
+
+    // the last failed send removes the failing target for good
+    const auto its_deadline = std::chrono::steady_clock::now() + 5s;
+    while (endpoint_->has_target(its_failing_target) && std::chrono::steady_clock::now() < its_deadline) {
+        std::this_thread::sleep_for(1ms);
+    }
+    EXPECT_FALSE(endpoint_->has_target(its_failing_target));
+    EXPECT_TRUE(endpoint_->has_target(its_target));
+
+    // the endpoint keeps serving new targets
+    auto& its_other_receiver = add_receiver();
+    EXPECT_TRUE(send(its_other_receiver.get_target(), make_notification(event_, 0, 8)));
+    EXPECT_TRUE(its_other_receiver.wait_for(1));
+}
+
+TEST_F(test_udp_server_endpoint, pacing_timer_firing_while_sending_keeps_all_segments) {
+    constexpr std::uint32_t its_message_count{25};
+
+    auto& its_paced_receiver = add_receiver();
+    auto& its_other_receiver = add_receiver();
+    auto its_paced_target = its_paced_receiver.get_target();
+    auto its_other_target = its_other_receiver.get_target();
+
+    const auto its_large_message = make_notification(tp_event_, 0, 3000);
+    const auto its_segment_count =
+            tp::tp::tp_split_message(its_large_message.data(), static_cast<std::uint32_t>(its_large_message.size()), max_segment_length_)
+                    .size();
+    ASSERT_GT(its_segment_count, 1u);
+
+    // While the pacing timer releases the segments of the large messages,
+    // small messages are sent to the same and to another target.
+    std::vector<std::thread> its_senders;
+    its_senders.emplace_back([this, its_paced_target] {
+        for (std::uint32_t i = 0; i < its_message_count; ++i) {
+            EXPECT_TRUE(send(its_paced_target, make_notification(tp_event_, i, 3000)));
+        }
+    });
+    its_senders.emplace_back([this, its_paced_target] {
+        for (std::uint32_t i = 0; i < its_message_count; ++i) {
+            EXPECT_TRUE(send(its_paced_target, make_notification(event_, i, 8)));
+            std::this_thread::sleep_for(100us);
+        }
+    });
+    its_senders.emplace_back([this, its_other_target] {
+        for (std::uint32_t i = 0; i < its_message_count; ++i) {
+            EXPECT_TRUE(send(its_other_target, make_notification(event_, i, 8)));
+            std::this_thread::sleep_for(100us);
+        }
+    });
+    for (auto& t : its_senders) {
+        t.join();
+    }
+
+    ASSERT_TRUE(its_paced_receiver.wait_for(its_message_count * its_segment_count + its_message_count));
+    ASSERT_TRUE(its_other_receiver.wait_for(its_message_count));
+
+    std::vector<std::uint32_t> its_expected(its_message_count);
+    std::iota(its_expected.begin(), its_expected.end(), 0);
+    const auto its_received = its_paced_receiver.get_received();
+    EXPECT_EQ(its_expected, get_sequences(its_received, event_));
+    EXPECT_EQ(its_message_count * its_segment_count, its_received.size() - its_message_count);
+    EXPECT_EQ(its_expected, get_sequences(its_other_receiver.get_received(), event_));
+
+    EXPECT_GT(endpoint_->get_tp_pacing_statistics().deferred_segments_, 0u);
+}
+
+TEST_F(test_udp_server_endpoint, sent_and_received_messages_are_counted) {
+    std::mutex its_mutex;
+    std::condition_variable its_cv;
+    std::size_t its_delivered{0};
+    ON_CALL(*routing_host_, on_message).WillByDefault([&](auto&&...) {
+        {
+            std::scoped_lock its_lock(its_mutex);
+            ++its_delivered;
+        }
+        its_cv.notify_all();
+    });
+
+    auto& its_client = add_receiver();
+    const auto its_small_message = make_notification(event_, 0, 8);
+    const auto its_large_message = make_notification(tp_event_, 0, 3000);
+    const auto its_segments =
+            tp::tp::tp_split_message(its_large_message.data(), static_cast<std::uint32_t>(its_large_message.size()), max_segment_length_);
+    ASSERT_GT(its_segments.size(), 1u);
+
+    its_client.send(endpoint_->get_local_port(), its_small_message);
+    its_client.send(endpoint_->get_local_port(), its_small_message);
+    for (const auto& s : its_segments) {
+        its_client.send(endpoint_->get_local_port(), *s);
+    }
+    {
+        std::unique_lock its_lock(its_mutex);
+        ASSERT_TRUE(its_cv.wait_for(its_lock, 5s, [&its_delivered] { return its_delivered >= 3; }));
+    }
+
+    EXPECT_TRUE(send(its_client.get_target(), its_small_message));
+    ASSERT_TRUE(its_client.wait_for(1));
+
+    endpoint_statistics_t its_statistics;
+    endpoint_->get_statistics(its_statistics);
+    EXPECT_FALSE(its_statistics.is_reliable_);
+    EXPECT_FALSE(its_statistics.is_client_);
+    EXPECT_EQ(endpoint_->get_local_port(), its_statistics.local_port_);
+    EXPECT_EQ(1u, its_statistics.messages_sent_);
+    EXPECT_EQ(its_small_message.size(), its_statistics.bytes_sent_);
+    EXPECT_EQ(0u, its_statistics.messages_dropped_);
+    // The segments count as one message of the reassembled size
+    EXPECT_EQ(3u, its_statistics.messages_received_);
+    EXPECT_EQ(2 * its_small_message.size() + its_large_message.size(), its_statistics.bytes_received_);
+    EXPECT_EQ(its_segments.size(), its_statistics.tp_segments_received_);
+    EXPECT_EQ(1u, its_statistics.tp_messages_reassembled_);
+}
+
+} // namespace vsomeip_v3::testing
@@ -0,0 +1,94 @@
+// Copyright (C) 2014-2026 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+
+#include "../../../implementation/routing/include/cycle_scheduler.hpp"
+
+#include <boost/asio.hpp>
+#include <chrono>
+#include <map>
+
+using namespace vsomeip_v3;
+using namespace std::chrono_literals;
+
+TEST(cycle_scheduler_test, equal_cycles_share_the_timer_expiries) {
+    boost::asio::io_context its_io;
+    auto its_scheduler = std::make_shared<cycle_scheduler>(its_io, 10ms, false);
+
+    std::map<cycle_scheduler::id_t, int> its_calls;
+    auto its_handler = [&its_calls](cycle_scheduler::id_t _id) { its_calls[_id]++; };
+    const auto its_first = its_scheduler->add(20ms, its_handler);
+    const auto its_second = its_scheduler->add(20ms, its_handler);
+
+    its_io.run_for(110ms);
+
+    EXPECT_GE(its_calls[its_first], 3);
+    EXPECT_EQ(its_calls[its_first], its_calls[its_second]);
+
+    const auto its_statistics = its_scheduler->get_statistics();
+    ASSERT_EQ(1u, its_statistics.size());
+    const auto& its_cycle_statistics = its_statistics.at(20ms);
+    EXPECT_EQ(2u, its_cycle_statistics.events_);
+    EXPECT_EQ(static_cast<std::uint64_t>(its_calls[its_first] + its_calls[its_second]), its_cycle_statistics.notifications_);
+    EXPECT_EQ(its_cycle_statistics.notifications_, 2 * its_cycle_statistics.expiries_);
+    EXPECT_LE(its_cycle_statistics.min_jitter_, its_cycle_statistics.max_jitter_);
+}
+
+TEST(cycle_scheduler_test, spread_phases_use_distinct_expiries) {
+    boost::asio::io_context its_io;
+    auto its_scheduler = std::make_shared<cycle_scheduler>(its_io, 10ms, true);
+
+    int its_calls(0);
+    for (int i = 0; i < 4; ++i) {
+        its_scheduler->add(40ms, [&its_calls](cycle_scheduler::id_t) { its_calls++; });
+    }
+
+    its_io.run_for(130ms);
+
+    const auto its_statistics = its_scheduler->get_statistics().at(40ms);
+    EXPECT_GE(its_calls, 4);
+    EXPECT_EQ(static_cast<std::uint64_t>(its_calls), its_statistics.notifications_);
+    EXPECT_EQ(its_statistics.notifications_, its_statistics.expiries_);
+}
+
+TEST(cycle_scheduler_test, removed_handlers_are_not_called) {
+    boost::asio::io_context its_io;
+    auto its_scheduler = std::make_shared<cycle_scheduler>(its_io, 1ms, false);
+
+    int its_calls(0);
+    const auto its_id = its_scheduler->add(10ms, [&its_calls](cycle_scheduler::id_t) { its_calls++; });
+    its_scheduler->remove(its_id);
+
+    its_io.run_for(50ms);
+
+    EXPECT_EQ(0, its_calls);
+    EXPECT_EQ(0u, its_scheduler->get_statistics().at(10ms).events_);
+}
+
+TEST(cycle_scheduler_test, due_times_are_rounded_to_the_nearest_grid_point) {
+    const std::chrono::steady_clock::time_point its_origin{1s};
+
+    EXPECT_EQ(its_origin + 30ms, cycle_scheduler::align(its_origin, 10ms, 100ms, its_origin + 30ms));
+    EXPECT_EQ(its_origin + 30ms, cycle_scheduler::align(its_origin, 10ms, 100ms, its_origin + 30ms + 1ns));
+    EXPECT_EQ(its_origin + 30ms, cycle_scheduler::align(its_origin, 10ms, 100ms, its_origin + 34ms));
+    EXPECT_EQ(its_origin + 40ms, cycle_scheduler::align(its_origin, 10ms, 100ms, its_origin + 35ms));
+    EXPECT_EQ(its_origin + 40ms, cycle_scheduler::align(its_origin, 10ms, 100ms, its_origin + 36ms));
+    // in a later period
+    EXPECT_EQ(its_origin + 510ms, cycle_scheduler::align(its_origin, 10ms, 100ms, its_origin + 511ms));
+    // the last grid point of a period is followed by the start of the next one
+    EXPECT_EQ(its_origin + 600ms, cycle_scheduler::align(its_origin, 10ms, 100ms, its_origin + 596ms));
+    // grid points that do not divide the cycle, the grid restarts every cycle
+    EXPECT_EQ(its_origin + 90ms, cycle_scheduler::align(its_origin, 30ms, 100ms, its_origin + 97ms));
+    EXPECT_EQ(its_origin + 190ms, cycle_scheduler::align(its_origin, 30ms, 100ms, its_origin + 184ms));
+    EXPECT_EQ(its_origin + 160ms, cycle_scheduler::align(its_origin, 30ms, 100ms, its_origin + 174ms));
+
+    for (auto its_due = its_origin; its_due < its_origin + 300ms; its_due += 700us) {
+        const auto its_aligned = cycle_scheduler::align(its_origin, 10ms, 100ms, its_due);
+        EXPECT_GE(its_aligned, its_due - 5ms);
+        EXPECT_LE(its_aligned, its_due + 5ms);
+        EXPECT_EQ(std::chrono::nanoseconds::zero(), (its_aligned - its_origin) % 10ms);
+    }
+}
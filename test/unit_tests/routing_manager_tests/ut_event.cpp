@@ -0,0 +1,93 @@
+// Copyright (C) 2014-2026 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+
+#include <vsomeip/message.hpp>
+#include <vsomeip/primitive_types.hpp>
+
+#include "../../../implementation/message/include/payload_impl.hpp"
+#include "../../../implementation/routing/include/event.hpp"
+#include "../../../implementation/routing/include/event_dispatcher.hpp"
+#include "../../../implementation/routing/include/types.hpp"
+
+#include <boost/asio.hpp>
+#include <vector>
+
+using namespace vsomeip_v3;
+
+namespace {
+
+class counting_dispatcher : public event_dispatcher {
+public:
+    session_t get_event_session() override { return ++session_; }
+
+    bool send_event(client_t, std::shared_ptr<message> _message, bool) override {
+        auto its_payload = _message->get_payload();
+        sent_.emplace_back(its_payload->get_data(), its_payload->get_data() + its_payload->get_length());
+        return true;
+    }
+
+    bool send_event_to(const client_t, const std::shared_ptr<endpoint_definition>&, std::shared_ptr<message>) override { return true; }
+
+    session_t session_{0};
+    std::vector<std::vector<byte_t>> sent_;
+};
+
+std::shared_ptr<payload> make_payload(std::vector<byte_t> _data) {
+    auto its_payload = std::make_shared<payload_impl>();
+    its_payload->set_data(std::move(_data));
+    return its_payload;
+}
+
+} // namespace
+
+class event_test : public ::testing::Test {
+protected:
+    void SetUp() override {
+        scheduler_ = std::make_shared<cycle_scheduler>(io_, std::chrono::milliseconds(1), false);
+        field_ = std::make_shared<event>(scheduler_, dispatcher_, false, false);
+        field_->set_type(event_type_e::ET_FIELD);
+        field_->set_provided(true);
+        field_->add_eventgroup(0x1);
+        ASSERT_TRUE(field_->add_subscriber(0x1, nullptr, 0x1234, false));
+    }
+
+    boost::asio::io_context io_;
+    std::shared_ptr<cycle_scheduler> scheduler_;
+    counting_dispatcher dispatcher_;
+    std::shared_ptr<event> field_;
+};
+
+TEST_F(event_test, unchanged_field_values_are_not_notified) {
+    field_->set_payload(make_payload({1, 2, 3}), false);
+    field_->set_payload(make_payload({1, 2, 3}), false);
+    EXPECT_EQ(1u, dispatcher_.sent_.size());
+
+    // Same length, different content
+    field_->set_payload(make_payload({1, 2, 4}), false);
+    // Different length, same prefix
+    field_->set_payload(make_payload({1, 2, 4, 0}), false);
+    ASSERT_EQ(3u, dispatcher_.sent_.size());
+    EXPECT_EQ(std::vector<byte_t>({1, 2, 4, 0}), dispatcher_.sent_.back());
+
+    // Forced notifications are sent regardless of the value
+    field_->set_payload(make_payload({1, 2, 4, 0}), true);
+    EXPECT_EQ(4u, dispatcher_.sent_.size());
+}
+
+TEST_F(event_test, published_payload_is_the_last_notified_value) {
+    field_->set_payload(make_payload({5}), false);
+    field_->set_payload(make_payload({6, 7}), false);
+
+    auto its_payload = field_->get_payload();
+    ASSERT_TRUE(its_payload);
+    EXPECT_EQ(std::vector<byte_t>({6, 7}),
+              std::vector<byte_t>(its_payload->get_data(), its_payload->get_data() + its_payload->get_length()));
+
+    field_->unset_payload();
+    EXPECT_EQ(0u, field_->get_payload()->get_length());
+    EXPECT_FALSE(field_->is_set());
+}
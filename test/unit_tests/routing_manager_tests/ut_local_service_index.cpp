@@ -0,0 +1,94 @@
+// Copyright (C) 2014-2026 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+
+#include <vsomeip/constants.hpp>
+
+#include "../../../implementation/routing/include/local_service_index.hpp"
+
+#include <set>
+
+using namespace vsomeip_v3;
+
+namespace {
+
+using clients_t = std::set<client_t>;
+using instances_t = std::set<instance_t>;
+
+const service_t SERVICE = 0x1234;
+const service_t OTHER_SERVICE = 0x1235;
+
+} // namespace
+
+TEST(local_service_index_test, requesters_of_a_concrete_instance_include_any_instance_requesters) {
+    local_service_index its_index;
+    its_index.add_request(0x1001, SERVICE, 0x0001, 0x01, 0x00000000);
+    its_index.add_request(0x1002, SERVICE, ANY_INSTANCE, ANY_MAJOR, ANY_MINOR);
+    its_index.add_request(0x1003, SERVICE, 0x0002, 0x01, 0x00000000);
+    its_index.add_request(0x1004, OTHER_SERVICE, ANY_INSTANCE, ANY_MAJOR, ANY_MINOR);
+
+    EXPECT_EQ(clients_t({0x1001, 0x1002}), its_index.get_requesters(SERVICE, 0x0001));
+    EXPECT_EQ(clients_t({0x1002, 0x1003}), its_index.get_requesters(SERVICE, 0x0002));
+    EXPECT_EQ(clients_t({0x1002}), its_index.get_requesters(SERVICE, 0x0003));
+    EXPECT_EQ(clients_t({0x1004}), its_index.get_requesters(OTHER_SERVICE, 0x0001));
+    EXPECT_TRUE(its_index.get_requesters(0x1236, 0x0001).empty());
+
+    EXPECT_TRUE(its_index.has_requested(0x1001, SERVICE, 0x0001));
+    EXPECT_TRUE(its_index.has_requested(0x1002, SERVICE, ANY_INSTANCE));
+    EXPECT_FALSE(its_index.has_requested(0x1002, SERVICE, 0x0001));
+}
+
+TEST(local_service_index_test, offered_instances_answer_any_instance_requests) {
+    local_service_index its_index;
+    its_index.add_offer(0x2001, SERVICE, 0x0001);
+    its_index.add_offer(0x2001, SERVICE, 0x0002);
+    its_index.add_offer(0x2001, OTHER_SERVICE, 0x0001);
+    its_index.add_offer(0x2002, SERVICE, 0x0003);
+
+    EXPECT_EQ(instances_t({0x0001, 0x0002}), its_index.get_offered_instances(0x2001, SERVICE));
+    EXPECT_EQ(instances_t({0x0001}), its_index.get_offered_instances(0x2001, OTHER_SERVICE));
+    EXPECT_EQ(instances_t({0x0003}), its_index.get_offered_instances(0x2002, SERVICE));
+    EXPECT_TRUE(its_index.get_offered_instances(0x2002, OTHER_SERVICE).empty());
+    EXPECT_TRUE(its_index.get_offered_instances(0x2003, SERVICE).empty());
+}
+
+TEST(local_service_index_test, stopped_offers_are_removed) {
+    local_service_index its_index;
+    its_index.add_offer(0x2001, SERVICE, 0x0001);
+    its_index.add_offer(0x2001, SERVICE, 0x0002);
+
+    its_index.remove_offer(0x2001, SERVICE, 0x0001);
+    EXPECT_EQ(instances_t({0x0002}), its_index.get_offered_instances(0x2001, SERVICE));
+
+    its_index.remove_offer(0x2001, SERVICE, 0x0002);
+    EXPECT_TRUE(its_index.get_offered_instances(0x2001, SERVICE).empty());
+
+    // A new offer after all instances were stopped
+    its_index.add_offer(0x2001, SERVICE, 0x0003);
+    EXPECT_EQ(instances_t({0x0003}), its_index.get_offered_instances(0x2001, SERVICE));
+}
+
+TEST(local_service_index_test, deregistered_clients_are_removed) {
+    local_service_index its_index;
+    its_index.add_request(0x1001, SERVICE, 0x0001, 0x01, 0x00000000);
+    its_index.add_request(0x1001, OTHER_SERVICE, ANY_INSTANCE, ANY_MAJOR, ANY_MINOR);
+    its_index.add_request(0x1002, SERVICE, 0x0001, 0x01, 0x00000000);
+    its_index.add_offer(0x1001, SERVICE, 0x0002);
+    its_index.add_offer(0x1002, SERVICE, 0x0003);
+
+    its_index.remove_requests(0x1001);
+    its_index.remove_offers(0x1001);
+
+    EXPECT_FALSE(its_index.has_requested(0x1001, SERVICE, 0x0001));
+    EXPECT_FALSE(its_index.has_requested(0x1001, OTHER_SERVICE, ANY_INSTANCE));
+    EXPECT_EQ(clients_t({0x1002}), its_index.get_requesters(SERVICE, 0x0001));
+    EXPECT_TRUE(its_index.get_requesters(OTHER_SERVICE, 0x0001).empty());
+    EXPECT_TRUE(its_index.get_offered_instances(0x1001, SERVICE).empty());
+
+    // The other client is not affected
+    EXPECT_TRUE(its_index.has_requested(0x1002, SERVICE, 0x0001));
+    EXPECT_EQ(instances_t({0x0003}), its_index.get_offered_instances(0x1002, SERVICE));
+}
@@ -0,0 +1,136 @@
+// Copyright (C) 2014-2026 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+
+#include "../../../implementation/routing/include/routing_info_coalescer.hpp"
+
+#include <boost/asio.hpp>
+#include <chrono>
+#include <utility>
+#include <vector>
+
+using namespace vsomeip_v3;
+using namespace std::chrono_literals;
+
+namespace {
+
+struct sent_routing_info {
+    client_t target_;
+    std::vector<protocol::routing_info_entry> entries_;
+};
+
+protocol::routing_info_entry make_entry(protocol::routing_info_entry_type_e _type, client_t _hoster, service_t _service) {
+    protocol::routing_info_entry its_entry;
+    its_entry.set_type(_type);
+    its_entry.set_client(_hoster);
+    its_entry.add_service({_service, 0x0001, 0x01, 0x00000000});
+    return its_entry;
+}
+
+class routing_info_coalescer_test : public ::testing::Test {
+protected:
+    std::shared_ptr<routing_info_coalescer> create(std::chrono::milliseconds _window, std::size_t _max_services) {
+        return std::make_shared<routing_info_coalescer>(io_, _window, _max_services,
+                                                        [this](client_t _target, std::vector<protocol::routing_info_entry>&& _entries) {
+                                                            sent_.push_back({_target, std::move(_entries)});
+                                                        });
+    }
+
+    boost::asio::io_context io_;
+    std::vector<sent_routing_info> sent_;
+};
+
+} // namespace
+
+TEST_F(routing_info_coalescer_test, updates_within_the_window_are_sent_in_one_flush) {
+    auto its_coalescer = create(2ms, 64);
+
+    its_coalescer->queue(0x1001, make_entry(protocol::routing_info_entry_type_e::RIE_ADD_SERVICE_INSTANCE, 0x2001, 0x1234));
+    its_coalescer->queue(0x1001, make_entry(protocol::routing_info_entry_type_e::RIE_ADD_SERVICE_INSTANCE, 0x2001, 0x1235));
+    its_coalescer->queue(0x1001, make_entry(protocol::routing_info_entry_type_e::RIE_ADD_SERVICE_INSTANCE, 0x2001, 0x1236));
+    its_coalescer->queue(0x1002, make_entry(protocol::routing_info_entry_type_e::RIE_ADD_SERVICE_INSTANCE, 0x2001, 0x1234));
+    EXPECT_TRUE(sent_.empty());
+
+    io_.run_for(50ms);
+
+    ASSERT_EQ(2u, sent_.size());
+    EXPECT_EQ(0x1001, sent_[0].target_);
+    ASSERT_EQ(1u, sent_[0].entries_.size());
+    ASSERT_EQ(3u, sent_[0].entries_[0].get_services().size());
+    EXPECT_EQ(0x1234, sent_[0].entries_[0].get_services()[0].service_);
+    EXPECT_EQ(0x1235, sent_[0].entries_[0].get_services()[1].service_);
+    EXPECT_EQ(0x1236, sent_[0].entries_[0].get_services()[2].service_);
+    EXPECT_EQ(0x1002, sent_[1].target_);
+    ASSERT_EQ(1u, sent_[1].entries_.size());
+    EXPECT_EQ(1u, sent_[1].entries_[0].get_services().size());
+}
+
+TEST_F(routing_info_coalescer_test, reaching_the_cap_sends_at_once) {
+    auto its_coalescer = create(10s, 3);
+
+    its_coalescer->queue(0x1001, make_entry(protocol::routing_info_entry_type_e::RIE_ADD_SERVICE_INSTANCE, 0x2001, 0x1234));
+    its_coalescer->queue(0x1001, make_entry(protocol::routing_info_entry_type_e::RIE_ADD_SERVICE_INSTANCE, 0x2002, 0x1235));
+    EXPECT_TRUE(sent_.empty());
+    its_coalescer->queue(0x1001, make_entry(protocol::routing_info_entry_type_e::RIE_ADD_SERVICE_INSTANCE, 0x2003, 0x1236));
+
+    // sent without running the io_context, thus without waiting for the window
+    ASSERT_EQ(1u, sent_.size());
+    EXPECT_EQ(0x1001, sent_[0].target_);
+    ASSERT_EQ(3u, sent_[0].entries_.size());
+    EXPECT_EQ(0x2001, sent_[0].entries_[0].get_client());
+    EXPECT_EQ(0x2002, sent_[0].entries_[1].get_client());
+    EXPECT_EQ(0x2003, sent_[0].entries_[2].get_client());
+
+    // nothing is left for the next flush
+    its_coalescer->flush();
+    EXPECT_EQ(1u, sent_.size());
+}
+
+TEST_F(routing_info_coalescer_test, updates_are_neither_lost_nor_reordered) {
+    auto its_coalescer = create(10s, 64);
+
+    its_coalescer->queue(0x1001, make_entry(protocol::routing_info_entry_type_e::RIE_ADD_SERVICE_INSTANCE, 0x2001, 0x1234));
+    its_coalescer->queue(0x1001, make_entry(protocol::routing_info_entry_type_e::RIE_ADD_SERVICE_INSTANCE, 0x2002, 0x1235));
+    its_coalescer->queue(0x1001, make_entry(protocol::routing_info_entry_type_e::RIE_DELETE_SERVICE_INSTANCE, 0x2001, 0x1234));
+
+    // a direct answer is sent after the pending updates of its client
+    std::vector<protocol::routing_info_entry> its_answer;
+    its_answer.push_back(make_entry(protocol::routing_info_entry_type_e::RIE_ADD_SERVICE_INSTANCE, 0x2003, 0x1236));
+    its_coalescer->send(0x1001, std::move(its_answer));
+
+    ASSERT_EQ(1u, sent_.size());
+    const auto& its_entries = sent_[0].entries_;
+    ASSERT_EQ(4u, its_entries.size());
+    EXPECT_EQ(protocol::routing_info_entry_type_e::RIE_ADD_SERVICE_INSTANCE, its_entries[0].get_type());
+    EXPECT_EQ(0x2001, its_entries[0].get_client());
+    EXPECT_EQ(0x2002, its_entries[1].get_client());
+    EXPECT_EQ(protocol::routing_info_entry_type_e::RIE_DELETE_SERVICE_INSTANCE, its_entries[2].get_type());
+    EXPECT_EQ(0x2001, its_entries[2].get_client());
+    EXPECT_EQ(0x2003, its_entries[3].get_client());
+
+    // updates queued after the direct answer are sent by stop()
+    its_coalescer->queue(0x1001, make_entry(protocol::routing_info_entry_type_e::RIE_DELETE_SERVICE_INSTANCE, 0x2003, 0x1236));
+    its_coalescer->stop();
+    ASSERT_EQ(2u, sent_.size());
+    ASSERT_EQ(1u, sent_[1].entries_.size());
+    EXPECT_EQ(0x2003, sent_[1].entries_[0].get_client());
+
+    io_.run_for(10ms);
+    EXPECT_EQ(2u, sent_.size());
+}
+
+TEST_F(routing_info_coalescer_test, removed_clients_do_not_receive_pending_updates) {
+    auto its_coalescer = create(2ms, 64);
+
+    its_coalescer->queue(0x1001, make_entry(protocol::routing_info_entry_type_e::RIE_ADD_SERVICE_INSTANCE, 0x2001, 0x1234));
+    its_coalescer->queue(0x1002, make_entry(protocol::routing_info_entry_type_e::RIE_ADD_SERVICE_INSTANCE, 0x2001, 0x1234));
+    its_coalescer->remove(0x1001);
+
+    io_.run_for(50ms);
+
+    ASSERT_EQ(1u, sent_.size());
+    EXPECT_EQ(0x1002, sent_[0].target_);
+}
@@ -0,0 +1,147 @@
+// Copyright (C) 2014-2026 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <optional>
+#include <tuple>
+
+#include <vsomeip/constants.hpp>
+
+#include "../../../implementation/runtime/include/handler_time_statistics.hpp"
+
+using namespace vsomeip_v3;
+using namespace std::chrono_literals;
+
+namespace {
+
+const service_t SERVICE = 0x1234;
+const instance_t INSTANCE = 0x0001;
+const method_t METHOD = 0x8001;
+
+// Records a handler that waited `_queue_time` and ran for `_execution_time`
+std::optional<slow_handler_t> add(handler_time_statistics& _statistics, handler_type_e _type, service_t _service, instance_t _instance,
+                                  method_t _method, std::chrono::nanoseconds _queue_time, std::chrono::nanoseconds _execution_time) {
+    const auto its_enqueued = std::chrono::steady_clock::now();
+    const auto its_started = its_enqueued + _queue_time;
+    return _statistics.add(_type, _service, _instance, _method, its_enqueued, its_started, its_started + _execution_time);
+}
+
+} // namespace
+
+TEST(handler_time_statistics_test, durations_are_sorted_into_log2_microsecond_buckets) {
+    latency_histogram_t its_histogram;
+
+    handler_time_statistics::add_to_histogram(its_histogram, 0ns);
+    handler_time_statistics::add_to_histogram(its_histogram, 999ns);
+    handler_time_statistics::add_to_histogram(its_histogram, -5us);
+    handler_time_statistics::add_to_histogram(its_histogram, 1us);
+    handler_time_statistics::add_to_histogram(its_histogram, 2us);
+    handler_time_statistics::add_to_histogram(its_histogram, 3us);
+    handler_time_statistics::add_to_histogram(its_histogram, 4us);
+    handler_time_statistics::add_to_histogram(its_histogram, 1ms);
+    handler_time_statistics::add_to_histogram(its_histogram, 1h);
+
+    EXPECT_EQ(3u, its_histogram.buckets_[0]);
+    EXPECT_EQ(1u, its_histogram.buckets_[1]);
+    EXPECT_EQ(2u, its_histogram.buckets_[2]);
+    EXPECT_EQ(1u, its_histogram.buckets_[3]);
+    // 1000us is in [512us, 1024us)
+    EXPECT_EQ(1u, its_histogram.buckets_[10]);
+    // The last bucket takes all longer durations
+    EXPECT_EQ(1u, its_histogram.buckets_[latency_histogram_t::BUCKETS - 1]);
+
+    EXPECT_EQ(9u, its_histogram.count_);
+    EXPECT_EQ(std::chrono::nanoseconds(1h), its_histogram.max_);
+    EXPECT_EQ(std::chrono::nanoseconds(1h + 1ms + 4us + 3us + 2us + 1us - 5us + 999ns), its_histogram.total_);
+}
+
+TEST(handler_time_statistics_test, method_keys_are_unique_and_reversible) {
+    EXPECT_NE(handler_time_statistics::to_method_key(SERVICE, INSTANCE, METHOD),
+              handler_time_statistics::to_method_key(INSTANCE, SERVICE, METHOD));
+    EXPECT_NE(handler_time_statistics::to_method_key(SERVICE, INSTANCE, METHOD),
+              handler_time_statistics::to_method_key(SERVICE, METHOD, INSTANCE));
+    EXPECT_NE(handler_time_statistics::to_method_key(SERVICE, INSTANCE, METHOD),
+              handler_time_statistics::to_method_key(METHOD, INSTANCE, SERVICE));
+
+    EXPECT_EQ(std::make_tuple(SERVICE, INSTANCE, METHOD),
+              handler_time_statistics::from_method_key(handler_time_statistics::to_method_key(SERVICE, INSTANCE, METHOD)));
+    EXPECT_EQ(std::make_tuple(ANY_SERVICE, ANY_INSTANCE, ANY_METHOD),
+              handler_time_statistics::from_method_key(handler_time_statistics::to_method_key(ANY_SERVICE, ANY_INSTANCE, ANY_METHOD)));
+}
+
+TEST(handler_time_statistics_test, message_handlers_are_collected_per_method) {
+    handler_time_statistics its_statistics;
+
+    add(its_statistics, handler_type_e::HT_MESSAGE, SERVICE, INSTANCE, METHOD, 0ns, 10us);
+    add(its_statistics, handler_type_e::HT_MESSAGE, SERVICE, INSTANCE, METHOD, 0ns, 20us);
+    add(its_statistics, handler_type_e::HT_MESSAGE, INSTANCE, SERVICE, METHOD, 0ns, 30us);
+    add(its_statistics, handler_type_e::HT_AVAILABILITY, SERVICE, INSTANCE, ANY_METHOD, 0ns, 40us);
+
+    dispatcher_statistics_t its_dispatcher;
+    its_statistics.get(its_dispatcher);
+
+    EXPECT_EQ(4u, its_dispatcher.handlers_invoked_);
+    EXPECT_EQ(std::chrono::nanoseconds(100us), its_dispatcher.handler_time_total_);
+    EXPECT_EQ(std::chrono::nanoseconds(40us), its_dispatcher.handler_time_max_);
+
+    ASSERT_EQ(2u, its_dispatcher.handler_types_.size());
+    EXPECT_EQ(3u, its_dispatcher.handler_types_[handler_type_e::HT_MESSAGE].execution_time_.count_);
+    EXPECT_EQ(1u, its_dispatcher.handler_types_[handler_type_e::HT_AVAILABILITY].execution_time_.count_);
+
+    // Only message handlers are collected per method
+    ASSERT_EQ(2u, its_dispatcher.methods_.size());
+    const auto& its_method = its_dispatcher.methods_[std::make_tuple(SERVICE, INSTANCE, METHOD)];
+    EXPECT_EQ(2u, its_method.execution_time_.count_);
+    EXPECT_EQ(std::chrono::nanoseconds(20us), its_method.execution_time_.max_);
+    EXPECT_EQ(1u, its_dispatcher.methods_[std::make_tuple(INSTANCE, SERVICE, METHOD)].execution_time_.count_);
+}
+
+TEST(handler_time_statistics_test, queue_time_is_measured_from_enqueuing_to_start) {
+    handler_time_statistics its_statistics;
+
+    add(its_statistics, handler_type_e::HT_MESSAGE, SERVICE, INSTANCE, METHOD, 5ms, 100us);
+
+    dispatcher_statistics_t its_dispatcher;
+    its_statistics.get(its_dispatcher);
+    const auto& its_method = its_dispatcher.methods_[std::make_tuple(SERVICE, INSTANCE, METHOD)];
+
+    EXPECT_EQ(std::chrono::nanoseconds(5ms), its_method.queue_time_.total_);
+    EXPECT_EQ(std::chrono::nanoseconds(100us), its_method.execution_time_.total_);
+    // 5000us is in [4096us, 8192us), 100us in [64us, 128us)
+    EXPECT_EQ(1u, its_method.queue_time_.buckets_[13]);
+    EXPECT_EQ(1u, its_method.execution_time_.buckets_[7]);
+    // The queue time is not part of the handler time
+    EXPECT_EQ(std::chrono::nanoseconds(100us), its_dispatcher.handler_time_total_);
+}
+
+TEST(handler_time_statistics_test, handlers_exceeding_the_budget_are_slow) {
+    handler_time_statistics its_statistics(10ms);
+
+    EXPECT_FALSE(add(its_statistics, handler_type_e::HT_MESSAGE, SERVICE, INSTANCE, METHOD, 0ns, 5ms));
+    EXPECT_FALSE(add(its_statistics, handler_type_e::HT_MESSAGE, SERVICE, INSTANCE, METHOD, 0ns, 10ms));
+
+    const auto its_slow_handler = add(its_statistics, handler_type_e::HT_MESSAGE, SERVICE, INSTANCE, METHOD, 2ms, 20ms);
+    ASSERT_TRUE(its_slow_handler);
+    EXPECT_EQ(handler_type_e::HT_MESSAGE, its_slow_handler->type_);
+    EXPECT_EQ(SERVICE, its_slow_handler->service_);
+    EXPECT_EQ(INSTANCE, its_slow_handler->instance_);
+    EXPECT_EQ(METHOD, its_slow_handler->method_);
+    EXPECT_EQ(std::chrono::nanoseconds(20ms), its_slow_handler->execution_time_);
+    EXPECT_EQ(std::chrono::nanoseconds(2ms), its_slow_handler->queue_time_);
+
+    EXPECT_TRUE(add(its_statistics, handler_type_e::HT_STATE, ANY_SERVICE, ANY_INSTANCE, ANY_METHOD, 0ns, 11ms));
+
+    dispatcher_statistics_t its_dispatcher;
+    its_statistics.get(its_dispatcher);
+    EXPECT_EQ(1u, its_dispatcher.handler_types_[handler_type_e::HT_MESSAGE].budget_exceeded_);
+    EXPECT_EQ(1u, its_dispatcher.handler_types_[handler_type_e::HT_STATE].budget_exceeded_);
+    EXPECT_EQ(1u, its_dispatcher.methods_[std::make_tuple(SERVICE, INSTANCE, METHOD)].budget_exceeded_);
+
+    // Without a budget, no handler is slow
+    its_statistics.set_budget(std::chrono::milliseconds::zero());
+    EXPECT_FALSE(add(its_statistics, handler_type_e::HT_MESSAGE, SERVICE, INSTANCE, METHOD, 0ns, 1h));
+}
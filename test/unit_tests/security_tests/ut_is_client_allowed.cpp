@@ -3,7 +3,10 @@
 // License, v. 2.0. If a copy of the MPL was not distributed with this
 // file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
+#include <atomic>
 #include <memory>
+#include <sstream>
+#include <thread>
 #include "gtest/gtest.h"
 #include <common/utility.hpp>
 
@@ -156,3 +159,111 @@ TEST(is_client_allowed_test, check_policies_loaded_in_audit_mode) {
     // credencials exists in deny policy, but not for that service
     EXPECT_TRUE(its_manager->is_client_allowed(&its_sec_client_deny, service_2, instance, method));
 }
+
+// denied requests are cached, the cache must be invalidated if the policies change
+TEST(is_client_allowed_test, check_denied_client_allowed_after_policy_update) {
+    std::unique_ptr<vsomeip_v3::policy_manager_impl> its_manager(new vsomeip_v3::policy_manager_impl);
+
+    // force load of some policies
+    std::set<std::string> its_failed;
+    std::vector<vsomeip_v3::configuration_element> policy_elements;
+    std::vector<std::string> dir_skip;
+    utility::read_data(utility::get_all_files_in_dir(utility::get_policies_path(), dir_skip), policy_elements, its_failed);
+
+    // check if the load worked
+    ASSERT_TRUE(policy_elements.size() > 0);
+    ASSERT_TRUE(its_failed.size() == 0);
+
+    for (const auto& e : policy_elements) {
+        its_manager->load(e, false);
+    }
+    ASSERT_FALSE(its_manager->is_audit());
+
+    vsomeip_sec_client_t its_sec_client_invalid = utility::create_uds_client(invalid_uid, invalid_gid, host_address);
+
+    // denied twice, the second time from the cache
+    EXPECT_FALSE(its_manager->is_client_allowed(&its_sec_client_invalid, service_1, instance, method));
+    EXPECT_FALSE(its_manager->is_client_allowed(&its_sec_client_invalid, service_1, instance, method));
+
+    // allow the credentials to access the method
+    std::stringstream its_policy;
+    its_policy << R"({"security": {"policies": [{"credentials": {"uid": "1", "gid": "1"}, "allow": {"requests": [)"
+               << R"({"service": "0xf913", "instances": [{"ids": ["0x03"], "methods": ["0x04"]}]}]}}]}})";
+    boost::property_tree::ptree its_tree;
+    boost::property_tree::json_parser::read_json(its_policy, its_tree);
+    its_manager->load(vsomeip_v3::configuration_element("allow_invalid", its_tree), false);
+
+    EXPECT_TRUE(its_manager->is_client_allowed(&its_sec_client_invalid, service_1, instance, method));
+    // other methods are still denied
+    EXPECT_FALSE(its_manager->is_client_allowed(&its_sec_client_invalid, service_1, instance, method_2));
+
+    // removing the policy denies the request again
+    EXPECT_TRUE(its_manager->remove_security_policy(invalid_uid, invalid_gid));
+    EXPECT_FALSE(its_manager->is_client_allowed(&its_sec_client_invalid, service_1, instance, method));
+}
+
+// concurrent checks while the policies change must not publish an outdated decision
+TEST(is_client_allowed_test, check_concurrent_denials_during_policy_update) {
+    std::unique_ptr<vsomeip_v3::policy_manager_impl> its_manager(new vsomeip_v3::policy_manager_impl);
+
+    std::set<std::string> its_failed;
+    std::vector<vsomeip_v3::configuration_element> policy_elements;
+    std::vector<std::string> dir_skip;
+    utility::read_data(utility::get_all_files_in_dir(utility::get_policies_path(), dir_skip), policy_elements, its_failed);
+    ASSERT_TRUE(policy_elements.size() > 0);
+    for (const auto& e : policy_elements) {
+        its_manager->load(e, false);
+    }
+
+    vsomeip_sec_client_t its_sec_client_invalid = utility::create_uds_client(invalid_uid, invalid_gid, host_address);
+
+    std::atomic<bool> is_running{true};
+    std::vector<std::thread> its_checkers;
+    for (int i = 0; i < 4; ++i) {
+        its_checkers.emplace_back([&] {
+            while (is_running) {
+                (void)its_manager->is_client_allowed(&its_sec_client_invalid, service_1, instance, method);
+            }
+        });
+    }
+
+    std::stringstream its_policy;
+    its_policy << R"({"security": {"policies": [{"credentials": {"uid": "1", "gid": "1"}, "allow": {"requests": [)"
+               << R"({"service": "0xf913", "instances": [{"ids": ["0x03"], "methods": ["0x04"]}]}]}}]}})";
+    boost::property_tree::ptree its_tree;
+    boost::property_tree::json_parser::read_json(its_policy, its_tree);
+    for (int i = 0; i < 100; ++i) {
+        its_manager->load(vsomeip_v3::configuration_element("allow_invalid", its_tree), false);
+        EXPECT_TRUE(its_manager->is_client_allowed(&its_sec_client_invalid, service_1, instance, method));
+        EXPECT_TRUE(its_manager->remove_security_policy(invalid_uid, invalid_gid));
+        EXPECT_FALSE(its_manager->is_client_allowed(&its_sec_client_invalid, service_1, instance, method));
+    }
+
+    is_running = false;
+    for (auto& t : its_checkers) {
+        t.join();
+    }
+}
+
+// the denied cache is reset when it is full, the decisions must not change
+TEST(is_client_allowed_test, check_denials_beyond_the_denied_cache_size) {
+    std::unique_ptr<vsomeip_v3::policy_manager_impl> its_manager(new vsomeip_v3::policy_manager_impl);
+
+    std::set<std::string> its_failed;
+    std::vector<vsomeip_v3::configuration_element> policy_elements;
+    std::vector<std::string> dir_skip;
+    utility::read_data(utility::get_all_files_in_dir(utility::get_policies_path(), dir_skip), policy_elements, its_failed);
+    ASSERT_TRUE(policy_elements.size() > 0);
+    for (const auto& e : policy_elements) {
+        its_manager->load(e, false);
+    }
+
+    vsomeip_sec_client_t its_sec_client_invalid = utility::create_uds_client(invalid_uid, invalid_gid, host_address);
+    vsomeip_sec_client_t its_sec_client_deny = utility::create_uds_client(deny_uid, deny_gid, host_address);
+    for (int i = 0; i < 2; ++i) {
+        for (vsomeip_v3::method_t its_method = 0x0001; its_method <= 0x1400; ++its_method) {
+            EXPECT_FALSE(its_manager->is_client_allowed(&its_sec_client_invalid, service_1, instance, its_method));
+        }
+    }
+    EXPECT_FALSE(its_manager->is_client_allowed(&its_sec_client_deny, deny_service, instance, method));
+}
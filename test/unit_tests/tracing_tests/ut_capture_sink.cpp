@@ -0,0 +1,172 @@
+// Copyright (C) 2014-2026 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+#include <common/temp_dir.hpp>
+
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <thread>
+#include <vector>
+
+#include "../../../implementation/configuration/include/trace.hpp"
+#include "../../../implementation/tracing/include/capture_sink.hpp"
+#include "../../../implementation/tracing/include/connector_impl.hpp"
+#include "../../../implementation/tracing/include/header.hpp"
+
+using namespace vsomeip_v3;
+using namespace vsomeip_v3::trace;
+
+namespace {
+
+struct block {
+    std::uint32_t type_;
+    std::vector<byte_t> body_;
+};
+
+std::uint32_t read_uint32(const byte_t* _data) {
+    std::uint32_t its_value;
+    std::memcpy(&its_value, _data, sizeof(its_value));
+    return its_value;
+}
+
+std::vector<block> read_blocks(const std::string& _file_name) {
+    std::ifstream its_file(_file_name, std::ios::binary);
+    std::vector<byte_t> its_data((std::istreambuf_iterator<char>(its_file)), std::istreambuf_iterator<char>());
+
+    std::vector<block> its_blocks;
+    std::size_t its_position(0);
+    while (its_position + 12 <= its_data.size()) {
+        const auto its_type = read_uint32(&its_data[its_position]);
+        const auto its_length = read_uint32(&its_data[its_position + 4]);
+        if (its_length < 12 || its_position + its_length > its_data.size()
+            || read_uint32(&its_data[its_position + its_length - 4]) != its_length) {
+            ADD_FAILURE() << "Malformed block at " << its_position;
+            break;
+        }
+        its_blocks.push_back({its_type, std::vector<byte_t>(&its_data[its_position + 8], &its_data[its_position + its_length - 4])});
+        its_position += its_length;
+    }
+    EXPECT_EQ(its_position, its_data.size());
+    return its_blocks;
+}
+
+class capture_sink_test : public ::testing::Test {
+protected:
+    void SetUp() override {
+        configuration_.is_enabled_ = true;
+        configuration_.path_ = temp_dir_.path().string();
+        configuration_.snaplen_ = 64;
+    }
+
+    common::temp_dir temp_dir_;
+    cfg::trace_capture configuration_;
+
+    const byte_t header_[VSOMEIP_TRACE_HEADER_SIZE]{127, 0, 0, 1, 0x75, 0x30, 0x01, 0x01, 0x00, 0x01};
+};
+
+} // namespace
+
+TEST_F(capture_sink_test, records_are_written_as_enhanced_packet_blocks) {
+    std::vector<byte_t> its_message(100);
+    for (std::size_t i = 0; i < its_message.size(); ++i) {
+        its_message[i] = static_cast<byte_t>(i);
+    }
+
+    capture_sink its_sink(configuration_);
+    its_sink.start();
+    its_sink.write(header_, VSOMEIP_TRACE_HEADER_SIZE, its_message.data(), 20, 20);
+    its_sink.write(header_, VSOMEIP_TRACE_HEADER_SIZE, its_message.data(), 100, 100); // truncated to the snaplen
+    its_sink.stop();
+    EXPECT_EQ(2u, its_sink.get_written());
+    EXPECT_EQ(0u, its_sink.get_dropped());
+
+    auto its_blocks = read_blocks(its_sink.get_file_name(0));
+    ASSERT_EQ(4u, its_blocks.size());
+    EXPECT_EQ(0x0A0D0D0Au, its_blocks[0].type_);
+    EXPECT_EQ(0x1A2B3C4Du, read_uint32(its_blocks[0].body_.data()));
+    EXPECT_EQ(0x00000001u, its_blocks[1].type_);
+    EXPECT_EQ(capture_sink::LINKTYPE, its_blocks[1].body_[0] | (its_blocks[1].body_[1] << 8));
+
+    // Enhanced Packet Blocks: interface, timestamp (2), captured length, original length, data
+    ASSERT_EQ(0x00000006u, its_blocks[2].type_);
+    EXPECT_EQ(30u, read_uint32(&its_blocks[2].body_[12]));
+    EXPECT_EQ(30u, read_uint32(&its_blocks[2].body_[16]));
+    EXPECT_EQ(0, std::memcmp(header_, &its_blocks[2].body_[20], VSOMEIP_TRACE_HEADER_SIZE));
+    EXPECT_EQ(0, std::memcmp(its_message.data(), &its_blocks[2].body_[20 + VSOMEIP_TRACE_HEADER_SIZE], 20));
+
+    ASSERT_EQ(0x00000006u, its_blocks[3].type_);
+    EXPECT_EQ(64u, read_uint32(&its_blocks[3].body_[12]));
+    EXPECT_EQ(110u, read_uint32(&its_blocks[3].body_[16]));
+}
+
+TEST_F(capture_sink_test, full_buffer_drops_records) {
+    configuration_.buffer_size_ = 0; // minimal ring buffer
+
+    capture_sink its_sink(configuration_);
+    std::vector<byte_t> its_message(16);
+    for (int i = 0; i < 5; ++i) {
+        // Not yet started --> nothing is drained
+        its_sink.write(header_, VSOMEIP_TRACE_HEADER_SIZE, its_message.data(), 16, 16);
+    }
+    EXPECT_EQ(3u, its_sink.get_dropped());
+
+    its_sink.start();
+    its_sink.stop();
+    EXPECT_EQ(2u, its_sink.get_written());
+}
+
+TEST_F(capture_sink_test, files_are_rotated) {
+    configuration_.buffer_size_ = 64 * 4;
+    configuration_.file_size_ = 200;
+    configuration_.file_count_ = 2;
+
+    capture_sink its_sink(configuration_);
+    its_sink.start();
+    std::vector<byte_t> its_message(40);
+    for (int i = 0; i < 8; ++i) {
+        its_sink.write(header_, VSOMEIP_TRACE_HEADER_SIZE, its_message.data(), 40, 40);
+        while (its_sink.get_written() < std::uint64_t(i + 1)) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+    }
+    its_sink.stop();
+
+    EXPECT_TRUE(std::filesystem::exists(its_sink.get_file_name(0)));
+    EXPECT_TRUE(std::filesystem::exists(its_sink.get_file_name(1)));
+    EXPECT_FALSE(std::filesystem::exists(its_sink.get_file_name(2)));
+    for (std::uint32_t i = 0; i < 2; ++i) {
+        auto its_blocks = read_blocks(its_sink.get_file_name(i));
+        ASSERT_GE(its_blocks.size(), 3u);
+        EXPECT_EQ(0x0A0D0D0Au, its_blocks[0].type_);
+        EXPECT_LE(std::filesystem::file_size(its_sink.get_file_name(i)), 200u);
+    }
+}
+
+TEST_F(capture_sink_test, messages_are_captured_without_hexstream) {
+    auto its_configuration = std::make_shared<cfg::trace>();
+    its_configuration->is_enabled_ = true;
+    its_configuration->capture_ = configuration_;
+    its_configuration->capture_.is_hexstream_enabled_ = false;
+
+    connector_impl its_connector;
+    its_connector.configure(its_configuration);
+
+    std::vector<byte_t> its_message(VSOMEIP_FULL_HEADER_SIZE);
+    its_message[VSOMEIP_SERVICE_POS_MIN] = 0x12;
+    its_connector.trace(header_, VSOMEIP_TRACE_HEADER_SIZE, its_message.data(), static_cast<std::uint32_t>(its_message.size()));
+    its_connector.reset(); // flushes the capture
+
+    std::string its_file_name;
+    for (const auto& its_entry : std::filesystem::directory_iterator(temp_dir_.path())) {
+        its_file_name = its_entry.path().string();
+    }
+    auto its_blocks = read_blocks(its_file_name);
+    ASSERT_EQ(3u, its_blocks.size());
+    EXPECT_EQ(0x00000006u, its_blocks[2].type_);
+}
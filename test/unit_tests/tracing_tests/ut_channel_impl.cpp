@@ -0,0 +1,91 @@
+// Copyright (C) 2014-2026 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+
+#include <vsomeip/constants.hpp>
+
+#include "../../../implementation/tracing/include/channel_impl.hpp"
+
+using namespace vsomeip_v3;
+using namespace vsomeip_v3::trace;
+
+namespace {
+const std::pair<bool, bool> FORWARD(true, true);
+const std::pair<bool, bool> HEADER_ONLY(true, false);
+const std::pair<bool, bool> DROP(false, false);
+} // namespace
+
+TEST(channel_impl_test, without_filters_everything_is_forwarded) {
+    channel_impl its_channel("TC", "Test Channel");
+    EXPECT_EQ(FORWARD, its_channel.matches(0x1234, 0x1, 0x8001));
+}
+
+TEST(channel_impl_test, negative_filter_takes_precedence) {
+    channel_impl its_channel("TC", "Test Channel");
+    its_channel.add_filter(match_t(0x1234, ANY_INSTANCE, ANY_METHOD), filter_type_e::POSITIVE);
+    its_channel.add_filter(match_t(0x1234, 0x1, 0x8001), filter_type_e::NEGATIVE);
+
+    EXPECT_EQ(DROP, its_channel.matches(0x1234, 0x1, 0x8001));
+    EXPECT_EQ(FORWARD, its_channel.matches(0x1234, 0x2, 0x8001));
+    EXPECT_EQ(FORWARD, its_channel.matches(0x1234, 0x1, 0x8002));
+    EXPECT_EQ(DROP, its_channel.matches(0x4321, 0x1, 0x8001));
+}
+
+TEST(channel_impl_test, first_matching_positive_filter_wins) {
+    channel_impl its_channel("TC", "Test Channel");
+    its_channel.add_filter(match_t(0x1234, ANY_INSTANCE, 0x8001), filter_type_e::HEADER_ONLY);
+    its_channel.add_filter(match_t(0x1234, ANY_INSTANCE, ANY_METHOD), filter_type_e::POSITIVE);
+
+    EXPECT_EQ(HEADER_ONLY, its_channel.matches(0x1234, 0x1, 0x8001));
+    EXPECT_EQ(FORWARD, its_channel.matches(0x1234, 0x1, 0x8002));
+}
+
+TEST(channel_impl_test, header_only_filters_do_not_restrict) {
+    channel_impl its_channel("TC", "Test Channel");
+    its_channel.add_filter(match_t(0x1234, ANY_INSTANCE, ANY_METHOD), filter_type_e::HEADER_ONLY);
+
+    EXPECT_EQ(HEADER_ONLY, its_channel.matches(0x1234, 0x1, 0x8001));
+    EXPECT_EQ(FORWARD, its_channel.matches(0x4321, 0x1, 0x8001));
+}
+
+TEST(channel_impl_test, service_and_method_filter_ignores_instance) {
+    channel_impl its_channel("TC", "Test Channel");
+    its_channel.add_filter(match_t(0x1234, ANY_INSTANCE, 0x8001), filter_type_e::POSITIVE);
+
+    EXPECT_EQ(FORWARD, its_channel.matches(0x1234, 0x1, 0x8001));
+    EXPECT_EQ(FORWARD, its_channel.matches(0x1234, 0x2, 0x8001));
+    EXPECT_EQ(DROP, its_channel.matches(0x1234, 0x1, 0x8002));
+}
+
+TEST(channel_impl_test, multi_match_filter) {
+    channel_impl its_channel("TC", "Test Channel");
+    its_channel.add_filter(std::vector<match_t>{{0x1234, 0x1, ANY_METHOD}, {0x4321, ANY_INSTANCE, 0x1}}, filter_type_e::POSITIVE);
+
+    EXPECT_EQ(FORWARD, its_channel.matches(0x1234, 0x1, 0x8001));
+    EXPECT_EQ(DROP, its_channel.matches(0x1234, 0x2, 0x8001));
+    EXPECT_EQ(FORWARD, its_channel.matches(0x4321, 0x2, 0x1));
+    EXPECT_EQ(DROP, its_channel.matches(0x4321, 0x2, 0x2));
+}
+
+TEST(channel_impl_test, range_filter) {
+    channel_impl its_channel("TC", "Test Channel");
+    EXPECT_NE(0u, its_channel.add_filter(match_t(0x1000, 0x1, 0x1), match_t(0x2000, 0x2, 0x8000), filter_type_e::POSITIVE));
+    EXPECT_EQ(0u, its_channel.add_filter(match_t(0x1000, ANY_INSTANCE, 0x1), match_t(0x2000, 0x2, 0x8000), filter_type_e::NEGATIVE));
+
+    EXPECT_EQ(FORWARD, its_channel.matches(0x1000, 0x1, 0x1));
+    EXPECT_EQ(FORWARD, its_channel.matches(0x2000, 0x2, 0x8000));
+    EXPECT_EQ(DROP, its_channel.matches(0x2001, 0x2, 0x8000));
+    EXPECT_EQ(DROP, its_channel.matches(0x1500, 0x3, 0x1));
+}
+
+TEST(channel_impl_test, removed_filters_no_longer_match) {
+    channel_impl its_channel("TC", "Test Channel");
+    auto its_id = its_channel.add_filter(match_t(0x1234, 0x1, 0x8001), filter_type_e::NEGATIVE);
+    EXPECT_EQ(DROP, its_channel.matches(0x1234, 0x1, 0x8001));
+
+    its_channel.remove_filter(its_id);
+    EXPECT_EQ(FORWARD, its_channel.matches(0x1234, 0x1, 0x8001));
+}
@@ -31,7 +31,7 @@ vsomeip_v3::endpoint_impl<Protocol>::endpoint_impl(const std::shared_ptr<boardne
     is_supporting_someip_tp_(false) { }
 
 template<typename Protocol>
-uint32_t vsomeip_v3::endpoint_impl<Protocol>::find_magic_cookie(byte_t* /*_buffer*/, size_t /*_size*/) {
+uint32_t vsomeip_v3::endpoint_impl<Protocol>::find_magic_cookie(const byte_t* /*_buffer*/, size_t /*_size*/) {
     return 0xFFFFFFFF;
 }
 
@@ -122,14 +122,28 @@ bool vsomeip_v3::server_endpoint_impl<Protocol>::tp_segmentation_enabled(service
 
 template<typename Protocol>
 void vsomeip_v3::server_endpoint_impl<Protocol>::send_segments(const tp::tp_split_messages_t& /*_segments*/,
-                                                               std::uint32_t /*_separation_time*/, const endpoint_type& /*_target*/) { }
+                                                               std::uint32_t /*_separation_time*/,
+                                                               const target_data_iterator_type /*_it*/) { }
 
 template<typename Protocol>
-typename vsomeip_v3::server_endpoint_impl<Protocol>::target_data_iterator_type
-vsomeip_v3::server_endpoint_impl<Protocol>::find_or_create_target_unlocked(endpoint_type /*_target*/) {
-    return targets_.end();
+typename vsomeip_v3::server_endpoint_impl<Protocol>::locked_target
+vsomeip_v3::server_endpoint_impl<Protocol>::lock_target(const endpoint_type& /*_target*/) {
+    return locked_target{std::shared_lock(targets_mutex_), targets_.end(), {}};
 }
 
+template<typename Protocol>
+std::optional<typename vsomeip_v3::server_endpoint_impl<Protocol>::locked_target>
+vsomeip_v3::server_endpoint_impl<Protocol>::find_locked_target(const endpoint_type& /*_target*/) {
+    return std::nullopt;
+}
+
+template<typename Protocol>
+void vsomeip_v3::server_endpoint_impl<Protocol>::remove_target(const endpoint_type& /*_target*/,
+                                                               const std::shared_ptr<endpoint_data_type>& /*_data*/) { }
+
+template<typename Protocol>
+void vsomeip_v3::server_endpoint_impl<Protocol>::reset_sending_state() { }
+
 template<typename Protocol>
 void vsomeip_v3::server_endpoint_impl<Protocol>::schedule_train(endpoint_data_type& /*_data*/) { }
 
@@ -141,7 +155,7 @@ bool vsomeip_v3::server_endpoint_impl<Protocol>::check_message_size(std::uint32_
 template<typename Protocol>
 typename vsomeip_v3::endpoint_impl<Protocol>::cms_ret_e
 vsomeip_v3::server_endpoint_impl<Protocol>::segment_message(const std::uint8_t* const /*_data*/, std::uint32_t /*_size*/,
-                                                            const endpoint_type& /*_target*/) {
+                                                            const target_data_iterator_type /*_it*/) {
     return endpoint_impl<Protocol>::cms_ret_e::MSG_WAS_SPLIT;
 }
 
@@ -0,0 +1,101 @@
+// Copyright (C) 2014-2026 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+
+#include "../../../implementation/utility/include/object_pool.hpp"
+
+#include <vector>
+
+using namespace vsomeip_v3;
+
+TEST(object_pool_test, exhausted_pool_grows_instead_of_blocking) {
+    int its_created(0);
+    object_pool<int> its_pool(
+            [&its_created] {
+                its_created++;
+                return std::make_shared<int>(its_created);
+            },
+            2, 4);
+    EXPECT_EQ(2, its_created);
+
+    std::vector<std::shared_ptr<int>> its_objects;
+    for (int i = 0; i < 3; ++i) {
+        its_objects.push_back(its_pool.get());
+    }
+    EXPECT_EQ(3, its_created);
+
+    auto its_statistics = its_pool.get_statistics();
+    EXPECT_EQ(3u, its_statistics.size_);
+    EXPECT_EQ(3u, its_statistics.in_use_);
+    EXPECT_EQ(3u, its_statistics.high_water_);
+
+    for (auto& o : its_objects) {
+        its_pool.put(std::move(o));
+    }
+
+    // Returned objects are reused
+    auto its_object = its_pool.get();
+    EXPECT_EQ(3, its_created);
+
+    its_statistics = its_pool.get_statistics();
+    EXPECT_EQ(3u, its_statistics.size_);
+    EXPECT_EQ(1u, its_statistics.in_use_);
+    EXPECT_EQ(3u, its_statistics.high_water_);
+
+    its_pool.put(std::move(its_object));
+}
+
+TEST(object_pool_test, returned_objects_beyond_the_maximum_are_released) {
+    int its_created(0);
+    object_pool<int> its_pool(
+            [&its_created] {
+                its_created++;
+                return std::make_shared<int>(its_created);
+            },
+            1, 2);
+
+    // Load peak
+    std::vector<std::shared_ptr<int>> its_objects;
+    for (int i = 0; i < 5; ++i) {
+        its_objects.push_back(its_pool.get());
+    }
+    EXPECT_EQ(5u, its_pool.get_statistics().size_);
+
+    std::weak_ptr<int> its_dropped(its_objects.back());
+    for (auto& o : its_objects) {
+        its_pool.put(std::move(o));
+    }
+
+    // Only two objects are kept
+    EXPECT_TRUE(its_dropped.expired());
+    auto its_statistics = its_pool.get_statistics();
+    EXPECT_EQ(2u, its_statistics.size_);
+    EXPECT_EQ(0u, its_statistics.in_use_);
+    EXPECT_EQ(5u, its_statistics.high_water_);
+
+    auto its_first = its_pool.get();
+    auto its_second = its_pool.get();
+    EXPECT_EQ(5, its_created);
+    auto its_third = its_pool.get();
+    EXPECT_EQ(6, its_created);
+
+    its_pool.put(std::move(its_first));
+    its_pool.put(std::move(its_second));
+    its_pool.put(std::move(its_third));
+}
+
+TEST(object_pool_test, initially_created_objects_are_always_kept) {
+    object_pool<int> its_pool([] { return std::make_shared<int>(0); }, 3, 1);
+
+    std::vector<std::shared_ptr<int>> its_objects;
+    for (int i = 0; i < 3; ++i) {
+        its_objects.push_back(its_pool.get());
+    }
+    for (auto& o : its_objects) {
+        its_pool.put(std::move(o));
+    }
+    EXPECT_EQ(3u, its_pool.get_statistics().size_);
+}
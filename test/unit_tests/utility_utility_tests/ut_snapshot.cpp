@@ -0,0 +1,70 @@
+// Copyright (C) 2014-2026 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+
+#include "../../../implementation/utility/include/snapshot.hpp"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace vsomeip_v3;
+
+TEST(snapshot_test, load_store_exchange) {
+    snapshot<const int> its_snapshot;
+    EXPECT_FALSE(its_snapshot.load());
+
+    its_snapshot.store(std::make_shared<const int>(1));
+    auto its_first = its_snapshot.load();
+    ASSERT_TRUE(its_first);
+    EXPECT_EQ(1, *its_first);
+
+    auto its_old = its_snapshot.exchange(std::make_shared<const int>(2));
+    EXPECT_EQ(its_first, its_old);
+    EXPECT_EQ(2, *its_snapshot.load());
+
+    // Readers keep their reference after the snapshot was replaced
+    EXPECT_EQ(1, *its_first);
+
+    EXPECT_EQ(2, *its_snapshot.exchange(nullptr));
+    EXPECT_FALSE(its_snapshot.load());
+}
+
+TEST(snapshot_test, concurrent_readers_see_complete_objects) {
+    struct value {
+        explicit value(int _v) : a_(_v), b_(_v) { }
+        int a_;
+        int b_;
+    };
+    snapshot<const value> its_snapshot(std::make_shared<const value>(0));
+
+    std::atomic<bool> is_done(false);
+    std::atomic<int> its_torn(0);
+    std::vector<std::thread> its_readers;
+    for (int i = 0; i < 4; ++i) {
+        its_readers.emplace_back([&] {
+            int its_last(0);
+            while (!is_done) {
+                auto its_value = its_snapshot.load();
+                if (its_value->a_ != its_value->b_ || its_value->a_ < its_last) {
+                    its_torn++;
+                }
+                its_last = its_value->a_;
+            }
+        });
+    }
+
+    for (int i = 1; i <= 10000; ++i) {
+        its_snapshot.store(std::make_shared<const value>(i));
+    }
+    is_done = true;
+    for (auto& t : its_readers) {
+        t.join();
+    }
+
+    EXPECT_EQ(0, its_torn);
+    EXPECT_EQ(10000, its_snapshot.load()->a_);
+}
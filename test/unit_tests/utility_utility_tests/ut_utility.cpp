@@ -6,6 +6,18 @@
 #include <gtest/gtest.h>
 #include <vsomeip/defines.hpp>
 
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <set>
+#include <stdexcept>
+#include <thread>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
 #include "../../../implementation/configuration/include/configuration_impl.hpp"
 #include "../../../implementation/utility/include/bithelper.hpp"
 #include "../../../implementation/utility/include/utility.hpp"
@@ -453,3 +465,72 @@ TEST(utility_test, reset_client_ids) {
     // Clean up
     its_utility->remove_lockfile(network_);
 }
+
+TEST(utility_test, parallel_for) {
+    for (const std::size_t its_count : {0, 1, 7, 100, 1000}) {
+        std::vector<std::atomic<std::uint32_t>> its_calls(its_count);
+        vsomeip_v3::utility::parallel_for(its_count, 4, 8, [&its_calls](std::size_t _index) { its_calls[_index]++; });
+        for (const auto& c : its_calls) {
+            EXPECT_EQ(1u, c.load());
+        }
+    }
+
+    // Not more threads than allowed
+    std::mutex its_mutex;
+    std::set<std::thread::id> its_threads;
+    vsomeip_v3::utility::parallel_for(1000, 2, 1, [&its_mutex, &its_threads](std::size_t) {
+        std::scoped_lock its_lock(its_mutex);
+        its_threads.insert(std::this_thread::get_id());
+    });
+    EXPECT_LE(its_threads.size(), 2u);
+}
+
+TEST(utility_test, parallel_for_rethrows_after_joining_the_workers) {
+    // Thrown by the worker of the calling thread as well as by the others
+    for (const std::size_t its_failing : {0, 500, 999}) {
+        std::atomic<std::uint32_t> its_running(0);
+        EXPECT_THROW(vsomeip_v3::utility::parallel_for(1000, 4, 1,
+                                                       [its_failing, &its_running](std::size_t _index) {
+                                                           its_running++;
+                                                           std::this_thread::sleep_for(std::chrono::microseconds(10));
+                                                           its_running--;
+                                                           if (_index == its_failing) {
+                                                               throw std::runtime_error("failed");
+                                                           }
+                                                       }),
+                     std::runtime_error);
+        EXPECT_EQ(0u, its_running.load());
+    }
+}
+
+#if defined(__linux__)
+TEST(utility_test, set_thread_scheduling) {
+    cpu_set_t its_allowed;
+    CPU_ZERO(&its_allowed);
+    ASSERT_EQ(0, pthread_getaffinity_np(pthread_self(), sizeof(its_allowed), &its_allowed));
+    int its_cpu(0);
+    while (its_cpu < CPU_SETSIZE && !CPU_ISSET(its_cpu, &its_allowed)) {
+        its_cpu++;
+    }
+    ASSERT_LT(its_cpu, CPU_SETSIZE);
+
+    std::thread its_thread([its_cpu]() {
+        vsomeip_v3::thread_scheduling_t its_scheduling;
+        its_scheduling.cpus_ = {its_cpu};
+        its_scheduling.policy_ = vsomeip_v3::scheduling_policy_e::SP_OTHER;
+        vsomeip_v3::utility::set_thread_scheduling(its_scheduling);
+
+        cpu_set_t its_set;
+        CPU_ZERO(&its_set);
+        ASSERT_EQ(0, pthread_getaffinity_np(pthread_self(), sizeof(its_set), &its_set));
+        EXPECT_EQ(1, CPU_COUNT(&its_set));
+        EXPECT_TRUE(CPU_ISSET(its_cpu, &its_set));
+
+        int its_policy(-1);
+        sched_param its_param{};
+        ASSERT_EQ(0, pthread_getschedparam(pthread_self(), &its_policy, &its_param));
+        EXPECT_EQ(SCHED_OTHER, its_policy);
+    });
+    its_thread.join();
+}
+#endif
@@ -0,0 +1,116 @@
+// Copyright (C) 2014-2026 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/algorithm/string.hpp>
+#include <boost/property_tree/json_parser.hpp>
+
+#include "../implementation/configuration/include/configuration_cache.hpp"
+
+#include <cstdlib>
+#include <filesystem>
+#include <iostream>
+#include <set>
+#include <string>
+#include <vector>
+
+static void print_help(char* binary_name) {
+    std::cout << "Usage example:" << std::endl;
+    std::cout << binary_name << " --output /etc/vsomeip.cache /etc/vsomeip.json /etc/vsomeip\n"
+              << "This will precompile the configuration file /etc/vsomeip.json and all json files\n"
+              << "within the folder /etc/vsomeip (including its sub folders) into /etc/vsomeip.cache." << std::endl
+              << std::endl;
+    std::cout << binary_name << " --root /sysroot --output /sysroot/etc/vsomeip.cache /sysroot/etc/vsomeip.json\n"
+              << "This will precompile the configuration file of a target whose root file system is\n"
+              << "located at /sysroot. The file is stored as /etc/vsomeip.json in the cache. Keep its\n"
+              << "modification time when copying it into the image (e.g. cp -p), else it is hashed on\n"
+              << "every start." << std::endl
+              << std::endl;
+    std::cout << "Available options:\n"
+                 "--help   | -h : print this help\n"
+                 "--output | -o : path of the configuration cache (required)\n"
+                 "--root   | -r : root directory of the target, the configuration files must be below it\n\n"
+                 "Please note: the configuration cache is only used for files that were not\n"
+                 "changed after it was generated. The cache is not used by default, the\n"
+                 "applications must set VSOMEIP_CONFIGURATION_CACHE to the same path."
+              << std::endl;
+}
+
+static void add_files(const std::filesystem::path& _input, std::set<std::string>& _files) {
+    std::error_code its_error;
+    if (std::filesystem::is_directory(_input, its_error)) {
+        for (const auto& e : std::filesystem::recursive_directory_iterator(_input, its_error)) {
+            if (e.is_regular_file() && boost::iequals(e.path().extension().string(), ".json")) {
+                _files.insert(e.path().string());
+            }
+        }
+    } else if (std::filesystem::is_regular_file(_input, its_error)) {
+        _files.insert(_input.string());
+    } else {
+        std::cerr << "Configuration '" << _input.string() << "' does not exist, exiting." << std::endl;
+        exit(EXIT_FAILURE);
+    }
+}
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        std::cerr << "Too few arguments, please see the help with : " << argv[0] << " --help" << std::endl;
+        exit(EXIT_FAILURE);
+    }
+
+    std::string its_output;
+    std::string its_root;
+    std::set<std::string> its_files;
+    for (int i = 1; i < argc; i++) {
+        std::string arg(argv[i]);
+        if (arg == "--help" || arg == "-h") {
+            print_help(argv[0]);
+            exit(EXIT_SUCCESS);
+        } else if (arg == "--output" || arg == "-o") {
+            if (i + 1 == argc) {
+                std::cerr << "Missing path of the configuration cache, exiting." << std::endl;
+                exit(EXIT_FAILURE);
+            }
+            its_output = argv[++i];
+        } else if (arg == "--root" || arg == "-r") {
+            if (i + 1 == argc) {
+                std::cerr << "Missing root directory, exiting." << std::endl;
+                exit(EXIT_FAILURE);
+            }
+            its_root = argv[++i];
+            std::error_code its_error;
+            if (!std::filesystem::is_directory(its_root, its_error)) {
+                std::cerr << "Root directory '" << its_root << "' does not exist, exiting." << std::endl;
+                exit(EXIT_FAILURE);
+            }
+        } else {
+            add_files(arg, its_files);
+        }
+    }
+
+    if (its_output.empty()) {
+        std::cerr << "Please provide the path of the configuration cache with --output, exiting." << std::endl;
+        exit(EXIT_FAILURE);
+    }
+
+    std::vector<vsomeip_v3::configuration_element> its_elements;
+    for (const auto& f : its_files) {
+        boost::property_tree::ptree its_tree;
+        try {
+            boost::property_tree::json_parser::read_json(f, its_tree);
+        } catch (boost::property_tree::json_parser_error& e) {
+            std::cerr << "Reading of configuration file '" << f << "' failed: " << e.what() << ", exiting." << std::endl;
+            exit(EXIT_FAILURE);
+        }
+        its_elements.emplace_back(f, its_tree);
+    }
+
+    if (!vsomeip_v3::cfg::configuration_cache::write(its_output, its_elements, its_root)) {
+        std::cerr << "Writing of configuration cache '" << its_output << "' failed, exiting." << std::endl;
+        exit(EXIT_FAILURE);
+    }
+
+    std::cout << "Precompiled " << its_elements.size() << " configuration files into '" << its_output << "'." << std::endl;
+    return EXIT_SUCCESS;
+}
@@ -929,3 +929,51 @@ function vsomeip_protocol.dissector(buffer, packet_info, root_tree)
 end
 
 DissectorTable.get('tcp.port'):add('1-65535', vsomeip_protocol)
+
+-- VSOMEIP TRACE CAPTURE (pcapng files written by the trace connector, link type USER0)
+vsomeip_trace_name = 'vsomeip3_trace'
+vsomeip_trace = Proto(vsomeip_trace_name, 'VSOMEIP3 Trace')
+vsomeip_trace_address = ProtoField.ipv4(vsomeip_trace_name .. '.address', "Address")
+vsomeip_trace_port = ProtoField.uint16(vsomeip_trace_name .. '.port', "Port", base.DEC)
+vsomeip_trace_protocol = ProtoField.uint8(vsomeip_trace_name .. '.protocol', "Protocol", base.HEX)
+vsomeip_trace_sending = ProtoField.uint8(vsomeip_trace_name .. '.sending', "Sending", base.DEC)
+vsomeip_trace_instance = ProtoField.uint16(vsomeip_trace_name .. '.instance', "Instance", base.HEX)
+
+vsomeip_trace.fields = {
+    vsomeip_trace_address, vsomeip_trace_port, vsomeip_trace_protocol, vsomeip_trace_sending, vsomeip_trace_instance
+}
+
+vsomeip_trace_header_size = 10
+
+function get_trace_protocol_name(protocol)
+    local protocol_name = "unknown"
+    if protocol == 0 then protocol_name = "local"
+    elseif protocol == 1 then protocol_name = "udp"
+    elseif protocol == 2 then protocol_name = "tcp"
+    end
+
+    return protocol_name
+end
+
+function vsomeip_trace.dissector(buffer, packet_info, root_tree)
+    if buffer:len() < vsomeip_trace_header_size then
+        return 0
+    end
+
+    packet_info.cols.protocol = vsomeip_trace_name:upper()
+    local tree = root_tree:add(vsomeip_trace, buffer(0, vsomeip_trace_header_size))
+    tree:add(vsomeip_trace_address, buffer(0, 4))
+    tree:add(vsomeip_trace_port, buffer(4, 2))
+    tree:add(vsomeip_trace_protocol, buffer(6, 1)):append_text(" (" .. get_trace_protocol_name(buffer(6, 1):uint()) .. ")")
+    tree:add(vsomeip_trace_sending, buffer(7, 1))
+    tree:add(vsomeip_trace_instance, buffer(8, 2))
+
+    -- The traced message is a SOME/IP message
+    local someip_dissector = Dissector.get("someip")
+    if someip_dissector and buffer:len() > vsomeip_trace_header_size then
+        someip_dissector:call(buffer(vsomeip_trace_header_size):tvb(), packet_info, root_tree)
+    end
+    return buffer:len()
+end
+
+DissectorTable.get('wtap_encap'):add(wtap_encaps and wtap_encaps.USER0 or wtap.USER0, vsomeip_trace)